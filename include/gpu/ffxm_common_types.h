@@ -22,22 +22,32 @@
 #ifndef FFXM_COMMON_TYPES_H
 #define FFXM_COMMON_TYPES_H
 
-#if defined(FFXM_CPU)
+// Output parameters take their type, the GPU code compiled as C++ passes them by reference.
+#if defined(FFXM_CPU) && defined(FFXM_GPU)
+#define FFXM_PARAMETER_IN
+#define FFXM_PARAMETER_OUT(type)                    type&
+#define FFXM_PARAMETER_INOUT(type)                  type&
+#define FFXM_PARAMETER_OUT_ARRAY(type, name, size)  type (&name)[size]
+#define FFXM_PARAMETER_UNIFORM
+#elif defined(FFXM_CPU)
 #define FFXM_PARAMETER_IN
-#define FFXM_PARAMETER_OUT
-#define FFXM_PARAMETER_INOUT
+#define FFXM_PARAMETER_OUT(type)                    type
+#define FFXM_PARAMETER_INOUT(type)                  type
+#define FFXM_PARAMETER_OUT_ARRAY(type, name, size)  type name[size]
 #define FFXM_PARAMETER_UNIFORM
 #elif defined(FFXM_HLSL)
 #define FFXM_PARAMETER_IN        in
-#define FFXM_PARAMETER_OUT       out
-#define FFXM_PARAMETER_INOUT     inout
+#define FFXM_PARAMETER_OUT(type)                    out type
+#define FFXM_PARAMETER_INOUT(type)                  inout type
+#define FFXM_PARAMETER_OUT_ARRAY(type, name, size)  out type name[size]
 #define FFXM_PARAMETER_UNIFORM uniform
 #elif defined(FFXM_GLSL)
 #define FFXM_PARAMETER_IN        in
-#define FFXM_PARAMETER_OUT       out
-#define FFXM_PARAMETER_INOUT     inout
+#define FFXM_PARAMETER_OUT(type)                    out type
+#define FFXM_PARAMETER_INOUT(type)                  inout type
+#define FFXM_PARAMETER_OUT_ARRAY(type, name, size)  out type name[size]
 #define FFXM_PARAMETER_UNIFORM const //[cacao_placeholder] until a better fit is found!
-#endif // #if defined(FFXM_CPU)
+#endif // #if defined(FFXM_CPU) && defined(FFXM_GPU)
 
 #if defined(FFXM_CPU)
 /// A typedef for a boolean value.
@@ -90,6 +100,7 @@ typedef int64_t FfxInt64;
 /// @ingroup CPUTypes
 typedef float FfxFloat32;
 
+#if !defined(FFXM_GPU)
 /// A typedef for a 2-dimensional floating point value.
 ///
 /// @ingroup CPUTypes
@@ -119,6 +130,7 @@ typedef uint32_t FfxUInt32x3[3];
 ///
 /// @ingroup CPUTypes
 typedef uint32_t FfxUInt32x4[4];
+#endif // #if !defined(FFXM_GPU)
 #endif // #if defined(FFXM_CPU)
 
 #if defined(FFXM_HLSL)
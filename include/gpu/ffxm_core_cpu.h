@@ -19,6 +19,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#if !defined(FFXM_GPU)
 /// A define for a true value in a boolean expression.
 ///
 /// @ingroup CPUTypes
@@ -28,6 +29,7 @@
 ///
 /// @ingroup CPUTypes
 #define FFXM_FALSE (0)
+#endif // #if !defined(FFXM_GPU)
 
 #if !defined(FFXM_STATIC)
 /// A define to abstract declaration of static variables and functions.
@@ -65,6 +67,8 @@ FFXM_STATIC FfxUInt32 ffxAsUInt32(FfxFloat32 x)
     return bits.u;
 }
 
+// The GPU code compiled as C++ takes the functions below from the GPU core headers.
+#if !defined(FFXM_GPU)
 FFXM_STATIC FfxFloat32 ffxDot2(FfxFloat32x2 a, FfxFloat32x2 b)
 {
     return a[0] * b[0] + a[1] * b[1];
@@ -234,6 +238,7 @@ FFXM_STATIC void opARcpF3(FfxFloat32x3 d, FfxFloat32x3 a)
     d[2] = ffxReciprocal(a[2]);
     return;
 }
+#endif // #if !defined(FFXM_GPU)
 
 /// Convert FfxFloat32 to half (in lower 16-bits of output).
 ///
@@ -319,6 +324,7 @@ FFXM_STATIC FfxUInt32 f32tof16(FfxFloat32 f)
     return (FfxUInt32)(base[i]) + ((u & 0x7fffff) >> shift[i]);
 }
 
+#if !defined(FFXM_GPU)
 /// Pack 2x32-bit floating point values in a single 32bit value.
 ///
 /// This function first converts each component of <c><i>value</i></c> into their nearest 16-bit floating
@@ -335,3 +341,1241 @@ FFXM_STATIC FfxUInt32 packHalf2x16(FfxFloat32x2 x)
 {
     return f32tof16(x[0]) + (f32tof16(x[1]) << 16);
 }
+#endif // #if !defined(FFXM_GPU)
+
+#if defined(FFXM_GPU)
+
+/// @defgroup CPUShader CPU Shader
+/// Shader types and intrinsics to compile the GPU code of the effects as C++, with both <c><i>FFXM_CPU</i></c> and
+/// <c><i>FFXM_GPU</i></c> defined. The 16bit types are the 32bit ones, as with <c><i>FFXM_HALF</i></c> 0.
+///
+/// The translation unit includes <c><i>&lt;atomic&gt;</i></c>, <c><i>&lt;bit&gt;</i></c>, <c><i>&lt;cmath&gt;</i></c> and
+/// <c><i>&lt;type_traits&gt;</i></c> before the shaders, and defines the <c><i>ffxmCpu</i></c> host functions declared
+/// below in the namespace it includes the shaders in.
+///
+/// @ingroup CPUCore
+
+#if defined(_MSC_VER)
+#pragma warning(disable : 4201) // nameless struct/union, the components of a vector alias its array
+#endif
+
+#if !defined(FFXM_CPU_WAVE_LANE_COUNT)
+/// A define for the lane count of the emulated waves.
+///
+/// @ingroup CPUShader
+#define FFXM_CPU_WAVE_LANE_COUNT (32)
+#endif // #if !defined(FFXM_CPU_WAVE_LANE_COUNT)
+
+/// A define for the largest work group the host runs, in threads.
+///
+/// @ingroup CPUShader
+#define FFXM_CPU_MAX_WORK_GROUP_SIZE (256)
+
+template <typename T, int N>
+struct FfxmVector;
+
+template <typename T, int N, int... I>
+struct FfxmSwizzle;
+
+template <typename X>
+struct FfxmVectorTraits
+{
+    static constexpr bool isVector = false;
+    static constexpr int  size     = 1;
+    typedef X             Component;
+};
+
+template <typename T, int N>
+struct FfxmVectorTraits<FfxmVector<T, N>>
+{
+    static constexpr bool isVector = true;
+    static constexpr int  size     = N;
+    typedef T             Component;
+};
+
+template <typename T, int N, int... I>
+struct FfxmVectorTraits<FfxmSwizzle<T, N, I...>>
+{
+    static constexpr bool isVector = true;
+    static constexpr int  size     = int(sizeof...(I));
+    typedef T             Component;
+};
+
+template <typename X>
+concept FfxmVectorOperand = FfxmVectorTraits<std::remove_cvref_t<X>>::isVector;
+
+template <typename X>
+concept FfxmScalarOperand = std::is_arithmetic_v<std::remove_cvref_t<X>>;
+
+template <typename X>
+concept FfxmOperand = FfxmVectorOperand<X> || FfxmScalarOperand<X>;
+
+template <typename X>
+using FfxmComponent = typename FfxmVectorTraits<std::remove_cvref_t<X>>::Component;
+
+// Component type of an operation between two component types. As with the literals of the shading languages, a
+// floating point operand keeps the precision of the other floating point one.
+template <typename A, typename B>
+struct FfxmPromotion
+{
+    typedef std::conditional_t<std::is_floating_point_v<A> && std::is_floating_point_v<B>,
+                               std::conditional_t<(sizeof(A) < sizeof(B)), A, B>,
+                               std::conditional_t<std::is_floating_point_v<A>,
+                                                  A,
+                                                  std::conditional_t<std::is_floating_point_v<B>, B, std::common_type_t<A, B>>>>
+        Type;
+};
+
+template <typename A, typename... B>
+struct FfxmPromotions
+{
+    typedef A Type;
+};
+
+template <typename A, typename B, typename... C>
+struct FfxmPromotions<A, B, C...>
+{
+    typedef typename FfxmPromotions<typename FfxmPromotion<A, B>::Type, C...>::Type Type;
+};
+
+template <typename... X>
+using FfxmPromoted = typename FfxmPromotions<FfxmComponent<X>...>::Type;
+
+template <typename... X>
+constexpr int ffxmOperandSize()
+{
+    int size = 1;
+    ((size = FfxmVectorTraits<std::remove_cvref_t<X>>::size > size ? FfxmVectorTraits<std::remove_cvref_t<X>>::size : size), ...);
+    return size;
+}
+
+template <typename... X>
+constexpr bool ffxmOperandSizesMatch()
+{
+    return ((!FfxmVectorOperand<X> || FfxmVectorTraits<std::remove_cvref_t<X>>::size == ffxmOperandSize<X...>()) && ...);
+}
+
+template <typename X>
+constexpr auto ffxmComponent(const X& x, int index)
+{
+    if constexpr (FfxmVectorOperand<X>)
+        return x[index];
+    else
+        return x;
+}
+
+// Applies a function to each component of the operands, scalars being broadcast. The components are promoted to a
+// common type first.
+template <typename F, typename... X>
+constexpr auto ffxmMap(F function, const X&... x)
+{
+    static_assert(ffxmOperandSizesMatch<X...>(), "Operands of different vector sizes");
+
+    typedef FfxmPromoted<X...> Type;
+    if constexpr (!(FfxmVectorOperand<X> || ...))
+    {
+        return function(Type(x)...);
+    }
+    else
+    {
+        constexpr int N = ffxmOperandSize<X...>();
+        FfxmVector<decltype(function(Type(ffxmComponent(x, 0))...)), N> result;
+        for (int index = 0; index < N; ++index)
+            result.v[index] = function(Type(ffxmComponent(x, index))...);
+        return result;
+    }
+}
+
+// Vectors convert implicitly to the vectors of the same size, unless from floating point to integer components.
+template <typename From, typename To>
+constexpr bool ffxmImplicitConversion = !(std::is_floating_point_v<From> && std::is_integral_v<To>);
+
+/// A swizzle of the components of a vector, aliasing the vector storage.
+///
+/// @ingroup CPUShader
+template <typename T, int N, int... I>
+struct FfxmSwizzle
+{
+    static constexpr int indices[sizeof...(I)] = {I...};
+
+    T c[N];
+
+    T operator[](int index) const
+    {
+        return c[indices[index]];
+    }
+
+    FfxmSwizzle& operator=(const FfxmSwizzle& value)
+    {
+        return *this = FfxmVector<T, int(sizeof...(I))>(value);
+    }
+
+    template <FfxmOperand X>
+    FfxmSwizzle& operator=(const X& value)
+    {
+        const FfxmVector<T, int(sizeof...(I))> components(value);
+        for (int index = 0; index < int(sizeof...(I)); ++index)
+            c[indices[index]] = components.v[index];
+        return *this;
+    }
+
+#define FFXM_CPU_SWIZZLE_COMPOUND_OPERATOR(op)           \
+    template <FfxmOperand X>                             \
+    FfxmSwizzle& operator op##=(const X& value)          \
+    {                                                    \
+        return *this = FfxmVector<T, int(sizeof...(I))>(*this op value); \
+    }
+    FFXM_CPU_SWIZZLE_COMPOUND_OPERATOR(+)
+    FFXM_CPU_SWIZZLE_COMPOUND_OPERATOR(-)
+    FFXM_CPU_SWIZZLE_COMPOUND_OPERATOR(*)
+    FFXM_CPU_SWIZZLE_COMPOUND_OPERATOR(/)
+#undef FFXM_CPU_SWIZZLE_COMPOUND_OPERATOR
+};
+
+#define FFXM_CPU_SWIZZLE2(N, a, b, i, j) FfxmSwizzle<T, N, i, j> a##b;
+#define FFXM_CPU_SWIZZLE3(N, a, b, c, i, j, k) FfxmSwizzle<T, N, i, j, k> a##b##c;
+
+template <typename T, int N>
+struct FfxmVectorStorage;
+
+template <typename T>
+struct FfxmVectorStorage<T, 2>
+{
+    union
+    {
+        T v[2] = {};
+        struct
+        {
+            T x, y;
+        };
+        struct
+        {
+            T r, g;
+        };
+        FFXM_CPU_SWIZZLE2(2, x, y, 0, 1)
+        FFXM_CPU_SWIZZLE2(2, y, x, 1, 0)
+        FFXM_CPU_SWIZZLE2(2, x, x, 0, 0)
+        FFXM_CPU_SWIZZLE2(2, y, y, 1, 1)
+        FFXM_CPU_SWIZZLE2(2, r, g, 0, 1)
+        FFXM_CPU_SWIZZLE2(2, g, r, 1, 0)
+        FFXM_CPU_SWIZZLE3(2, x, x, x, 0, 0, 0)
+        FFXM_CPU_SWIZZLE3(2, y, y, y, 1, 1, 1)
+    };
+};
+
+template <typename T>
+struct FfxmVectorStorage<T, 3>
+{
+    union
+    {
+        T v[3] = {};
+        struct
+        {
+            T x, y, z;
+        };
+        struct
+        {
+            T r, g, b;
+        };
+        FFXM_CPU_SWIZZLE2(3, x, y, 0, 1)
+        FFXM_CPU_SWIZZLE2(3, y, x, 1, 0)
+        FFXM_CPU_SWIZZLE2(3, x, z, 0, 2)
+        FFXM_CPU_SWIZZLE2(3, y, z, 1, 2)
+        FFXM_CPU_SWIZZLE2(3, x, x, 0, 0)
+        FFXM_CPU_SWIZZLE2(3, y, y, 1, 1)
+        FFXM_CPU_SWIZZLE2(3, z, z, 2, 2)
+        FFXM_CPU_SWIZZLE2(3, r, g, 0, 1)
+        FFXM_CPU_SWIZZLE2(3, g, b, 1, 2)
+        FFXM_CPU_SWIZZLE3(3, x, y, z, 0, 1, 2)
+        FFXM_CPU_SWIZZLE3(3, x, x, x, 0, 0, 0)
+        FFXM_CPU_SWIZZLE3(3, y, y, y, 1, 1, 1)
+        FFXM_CPU_SWIZZLE3(3, z, z, z, 2, 2, 2)
+        FFXM_CPU_SWIZZLE3(3, r, g, b, 0, 1, 2)
+        FFXM_CPU_SWIZZLE3(3, b, g, r, 2, 1, 0)
+    };
+};
+
+template <typename T>
+struct FfxmVectorStorage<T, 4>
+{
+    union
+    {
+        T v[4] = {};
+        struct
+        {
+            T x, y, z, w;
+        };
+        struct
+        {
+            T r, g, b, a;
+        };
+        FFXM_CPU_SWIZZLE2(4, x, y, 0, 1)
+        FFXM_CPU_SWIZZLE2(4, y, x, 1, 0)
+        FFXM_CPU_SWIZZLE2(4, x, z, 0, 2)
+        FFXM_CPU_SWIZZLE2(4, y, z, 1, 2)
+        FFXM_CPU_SWIZZLE2(4, z, w, 2, 3)
+        FFXM_CPU_SWIZZLE2(4, x, x, 0, 0)
+        FFXM_CPU_SWIZZLE2(4, y, y, 1, 1)
+        FFXM_CPU_SWIZZLE2(4, z, z, 2, 2)
+        FFXM_CPU_SWIZZLE2(4, w, w, 3, 3)
+        FFXM_CPU_SWIZZLE2(4, r, g, 0, 1)
+        FFXM_CPU_SWIZZLE2(4, g, b, 1, 2)
+        FFXM_CPU_SWIZZLE2(4, b, a, 2, 3)
+        FFXM_CPU_SWIZZLE3(4, x, y, z, 0, 1, 2)
+        FFXM_CPU_SWIZZLE3(4, y, z, w, 1, 2, 3)
+        FFXM_CPU_SWIZZLE3(4, x, x, x, 0, 0, 0)
+        FFXM_CPU_SWIZZLE3(4, y, y, y, 1, 1, 1)
+        FFXM_CPU_SWIZZLE3(4, z, z, z, 2, 2, 2)
+        FFXM_CPU_SWIZZLE3(4, w, w, w, 3, 3, 3)
+        FFXM_CPU_SWIZZLE3(4, r, g, b, 0, 1, 2)
+        FFXM_CPU_SWIZZLE3(4, b, g, r, 2, 1, 0)
+    };
+};
+
+#undef FFXM_CPU_SWIZZLE2
+#undef FFXM_CPU_SWIZZLE3
+
+/// A vector of 2 to 4 components, with the swizzles of the shading languages.
+///
+/// @ingroup CPUShader
+template <typename T, int N>
+struct FfxmVector : FfxmVectorStorage<T, N>
+{
+    using FfxmVectorStorage<T, N>::v;
+
+    // Zero initialised, and constant initialised in the shared memory of the work groups.
+    constexpr FfxmVector() = default;
+
+    FfxmVector(const FfxmVector&) = default;
+
+    FfxmVector& operator=(const FfxmVector& value)
+    {
+        for (int index = 0; index < N; ++index)
+            v[index] = value.v[index];
+        return *this;
+    }
+
+    template <FfxmScalarOperand S>
+    FfxmVector(S value)
+    {
+        for (int index = 0; index < N; ++index)
+            v[index] = T(value);
+    }
+
+    template <FfxmVectorOperand X>
+        requires(FfxmVectorTraits<X>::size == N)
+    explicit(!ffxmImplicitConversion<FfxmComponent<X>, T>) FfxmVector(const X& value)
+    {
+        for (int index = 0; index < N; ++index)
+            v[index] = T(value[index]);
+    }
+
+    template <FfxmOperand... X>
+        requires(sizeof...(X) >= 2 && (FfxmVectorTraits<X>::size + ...) == N)
+    FfxmVector(const X&... values)
+    {
+        int index = 0;
+        (append(index, values), ...);
+    }
+
+    T operator[](int index) const
+    {
+        return v[index];
+    }
+
+    T& operator[](int index)
+    {
+        return v[index];
+    }
+
+#define FFXM_CPU_VECTOR_COMPOUND_OPERATOR(op)            \
+    template <FfxmOperand X>                             \
+    FfxmVector& operator op##=(const X& value)           \
+    {                                                    \
+        return *this = FfxmVector(*this op value);       \
+    }
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(+)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(-)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(*)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(/)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(%)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(&)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(|)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(^)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(<<)
+    FFXM_CPU_VECTOR_COMPOUND_OPERATOR(>>)
+#undef FFXM_CPU_VECTOR_COMPOUND_OPERATOR
+
+private:
+    template <typename X>
+    void append(int& index, const X& value)
+    {
+        for (int component = 0; component < FfxmVectorTraits<X>::size; ++component)
+            v[index++] = T(ffxmComponent(value, component));
+    }
+};
+
+#define FFXM_CPU_BINARY_OPERATOR(op)                                                     \
+    template <FfxmOperand A, FfxmOperand B>                                              \
+        requires(FfxmVectorOperand<A> || FfxmVectorOperand<B>)                           \
+    FfxmVector<decltype(FfxmPromoted<A, B>() op FfxmPromoted<A, B>()), ffxmOperandSize<A, B>()> \
+    operator op(const A& a, const B& b)                                                  \
+    {                                                                                    \
+        return ffxmMap([](auto x, auto y) { return x op y; }, a, b);                     \
+    }
+FFXM_CPU_BINARY_OPERATOR(+)
+FFXM_CPU_BINARY_OPERATOR(-)
+FFXM_CPU_BINARY_OPERATOR(*)
+FFXM_CPU_BINARY_OPERATOR(/)
+FFXM_CPU_BINARY_OPERATOR(%)
+FFXM_CPU_BINARY_OPERATOR(&)
+FFXM_CPU_BINARY_OPERATOR(|)
+FFXM_CPU_BINARY_OPERATOR(^)
+FFXM_CPU_BINARY_OPERATOR(<<)
+FFXM_CPU_BINARY_OPERATOR(>>)
+FFXM_CPU_BINARY_OPERATOR(==)
+FFXM_CPU_BINARY_OPERATOR(!=)
+FFXM_CPU_BINARY_OPERATOR(<)
+FFXM_CPU_BINARY_OPERATOR(>)
+FFXM_CPU_BINARY_OPERATOR(<=)
+FFXM_CPU_BINARY_OPERATOR(>=)
+FFXM_CPU_BINARY_OPERATOR(&&)
+FFXM_CPU_BINARY_OPERATOR(||)
+#undef FFXM_CPU_BINARY_OPERATOR
+
+#define FFXM_CPU_UNARY_OPERATOR(op)                                                      \
+    template <FfxmVectorOperand A>                                                       \
+    auto operator op(const A& a)                                                         \
+    {                                                                                    \
+        return ffxmMap([](auto x) { return op x; }, a);                                  \
+    }
+FFXM_CPU_UNARY_OPERATOR(-)
+FFXM_CPU_UNARY_OPERATOR(+)
+FFXM_CPU_UNARY_OPERATOR(~)
+FFXM_CPU_UNARY_OPERATOR(!)
+#undef FFXM_CPU_UNARY_OPERATOR
+
+/// A typedef for a 2-dimensional floating point value.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxFloat32, 2> FfxFloat32x2;
+
+/// A typedef for a 3-dimensional floating point value.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxFloat32, 3> FfxFloat32x3;
+
+/// A typedef for a 4-dimensional floating point value.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxFloat32, 4> FfxFloat32x4;
+
+/// A typedef for a 2-dimensional 32bit unsigned integer.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxUInt32, 2> FfxUInt32x2;
+
+/// A typedef for a 3-dimensional 32bit unsigned integer.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxUInt32, 3> FfxUInt32x3;
+
+/// A typedef for a 4-dimensional 32bit unsigned integer.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxUInt32, 4> FfxUInt32x4;
+
+/// A typedef for a 2-dimensional 32bit signed integer.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxInt32, 2> FfxInt32x2;
+
+/// A typedef for a 3-dimensional 32bit signed integer.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxInt32, 3> FfxInt32x3;
+
+/// A typedef for a 4-dimensional 32bit signed integer.
+///
+/// @ingroup CPUShader
+typedef FfxmVector<FfxInt32, 4> FfxInt32x4;
+
+#define FFXM_MIN16_F  FfxFloat32
+#define FFXM_MIN16_F2 FfxFloat32x2
+#define FFXM_MIN16_F3 FfxFloat32x3
+#define FFXM_MIN16_F4 FfxFloat32x4
+
+#define FFXM_MIN16_I  FfxInt32
+#define FFXM_MIN16_I2 FfxInt32x2
+#define FFXM_MIN16_I3 FfxInt32x3
+#define FFXM_MIN16_I4 FfxInt32x4
+
+#define FFXM_MIN16_U  FfxUInt32
+#define FFXM_MIN16_U2 FfxUInt32x2
+#define FFXM_MIN16_U3 FfxUInt32x3
+#define FFXM_MIN16_U4 FfxUInt32x4
+
+#define FFXM_16BIT_F  FfxFloat32
+#define FFXM_16BIT_F2 FfxFloat32x2
+#define FFXM_16BIT_F3 FfxFloat32x3
+#define FFXM_16BIT_F4 FfxFloat32x4
+
+#define FFXM_16BIT_I  FfxInt32
+#define FFXM_16BIT_I2 FfxInt32x2
+#define FFXM_16BIT_I3 FfxInt32x3
+#define FFXM_16BIT_I4 FfxInt32x4
+
+#define FFXM_16BIT_U  FfxUInt32
+#define FFXM_16BIT_U2 FfxUInt32x2
+#define FFXM_16BIT_U3 FfxUInt32x3
+#define FFXM_16BIT_U4 FfxUInt32x4
+
+/// A define for the shared memory of a work group. The host runs the threads of a work group on a single thread.
+///
+/// @ingroup CPUShader
+#define FFXM_GROUPSHARED thread_local
+
+/// A define for a barrier within the work group.
+///
+/// @ingroup CPUShader
+#define FFXM_GROUP_MEMORY_BARRIER() ffxmCpuGroupMemoryBarrier()
+
+/// A define for an atomic add on a variable of the work group.
+///
+/// @ingroup CPUShader
+#define FFXM_ATOMIC_ADD(x, y) InterlockedAdd(x, y)
+
+/// A define to hint a loop to be unrolled.
+///
+/// @ingroup CPUShader
+#define FFXM_UNROLL
+
+#define FFXM_GREATER_THAN(x, y) x > y
+#define FFXM_GREATER_THAN_EQUAL(x, y) x >= y
+#define FFXM_LESS_THAN(x, y) x < y
+#define FFXM_LESS_THAN_EQUAL(x, y) x <= y
+#define FFXM_EQUAL(x, y) x == y
+#define FFXM_NOT_EQUAL(x, y) x != y
+#define FFXM_MODULO(a, b) (fmod(a, b))
+
+#define FFXM_BROADCAST_FLOAT32(x) FfxFloat32(x)
+#define FFXM_BROADCAST_FLOAT32X2(x) FfxFloat32x2(FfxFloat32(x))
+#define FFXM_BROADCAST_FLOAT32X3(x) FfxFloat32x3(FfxFloat32(x))
+#define FFXM_BROADCAST_FLOAT32X4(x) FfxFloat32x4(FfxFloat32(x))
+#define FFXM_BROADCAST_UINT32(x) FfxUInt32(x)
+#define FFXM_BROADCAST_UINT32X2(x) FfxUInt32x2(FfxUInt32(x))
+#define FFXM_BROADCAST_UINT32X3(x) FfxUInt32x3(FfxUInt32(x))
+#define FFXM_BROADCAST_UINT32X4(x) FfxUInt32x4(FfxUInt32(x))
+#define FFXM_BROADCAST_INT32(x) FfxInt32(x)
+#define FFXM_BROADCAST_INT32X2(x) FfxInt32x2(FfxInt32(x))
+#define FFXM_BROADCAST_INT32X3(x) FfxInt32x3(FfxInt32(x))
+#define FFXM_BROADCAST_INT32X4(x) FfxInt32x4(FfxInt32(x))
+#define FFXM_BROADCAST_MIN_FLOAT16(a) FFXM_MIN16_F(a)
+#define FFXM_BROADCAST_MIN_FLOAT16X2(a) FFXM_MIN16_F2(FFXM_MIN16_F(a))
+#define FFXM_BROADCAST_MIN_FLOAT16X3(a) FFXM_MIN16_F3(FFXM_MIN16_F(a))
+#define FFXM_BROADCAST_MIN_FLOAT16X4(a) FFXM_MIN16_F4(FFXM_MIN16_F(a))
+#define FFXM_BROADCAST_MIN_UINT16(a) FFXM_MIN16_U(a)
+#define FFXM_BROADCAST_MIN_UINT16X2(a) FFXM_MIN16_U2(FFXM_MIN16_U(a))
+#define FFXM_BROADCAST_MIN_UINT16X3(a) FFXM_MIN16_U3(FFXM_MIN16_U(a))
+#define FFXM_BROADCAST_MIN_UINT16X4(a) FFXM_MIN16_U4(FFXM_MIN16_U(a))
+#define FFXM_BROADCAST_MIN_INT16(a) FFXM_MIN16_I(a)
+#define FFXM_BROADCAST_MIN_INT16X2(a) FFXM_MIN16_I2(FFXM_MIN16_I(a))
+#define FFXM_BROADCAST_MIN_INT16X3(a) FFXM_MIN16_I3(FFXM_MIN16_I(a))
+#define FFXM_BROADCAST_MIN_INT16X4(a) FFXM_MIN16_I4(FFXM_MIN16_I(a))
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Intrinsics of the shading languages, component-wise on vectors
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define FFXM_CPU_INTRINSIC1(name, expression)                                            \
+    template <FfxmOperand X>                                                             \
+    auto name(const X& x)                                                                \
+    {                                                                                    \
+        return ffxmMap([](auto a) { return expression; }, x);                            \
+    }
+#define FFXM_CPU_INTRINSIC2(name, expression)                                            \
+    template <FfxmOperand X, FfxmOperand Y>                                              \
+    auto name(const X& x, const Y& y)                                                    \
+    {                                                                                    \
+        return ffxmMap([](auto a, auto b) { return expression; }, x, y);                 \
+    }
+#define FFXM_CPU_INTRINSIC3(name, expression)                                            \
+    template <FfxmOperand X, FfxmOperand Y, FfxmOperand Z>                               \
+    auto name(const X& x, const Y& y, const Z& z)                                        \
+    {                                                                                    \
+        return ffxmMap([](auto a, auto b, auto c) { return expression; }, x, y, z);      \
+    }
+
+template <typename T>
+T ffxmCpuAbs(T a)
+{
+    if constexpr (std::is_unsigned_v<T>)
+        return a;
+    else
+        return std::abs(a);
+}
+
+template <typename T>
+T ffxmCpuSign(T a)
+{
+    return T((a > T(0)) - (a < T(0)));
+}
+
+FFXM_CPU_INTRINSIC1(abs, ffxmCpuAbs(a))
+FFXM_CPU_INTRINSIC1(sign, ffxmCpuSign(a))
+FFXM_CPU_INTRINSIC1(floor, std::floor(a))
+FFXM_CPU_INTRINSIC1(ceil, std::ceil(a))
+FFXM_CPU_INTRINSIC1(round, std::nearbyint(a))
+FFXM_CPU_INTRINSIC1(trunc, std::trunc(a))
+FFXM_CPU_INTRINSIC1(frac, a - std::floor(a))
+FFXM_CPU_INTRINSIC1(sqrt, std::sqrt(a))
+FFXM_CPU_INTRINSIC1(rsqrt, decltype(a)(1) / std::sqrt(a))
+FFXM_CPU_INTRINSIC1(rcp, decltype(a)(1) / a)
+FFXM_CPU_INTRINSIC1(exp, std::exp(a))
+FFXM_CPU_INTRINSIC1(exp2, std::exp2(a))
+FFXM_CPU_INTRINSIC1(log, std::log(a))
+FFXM_CPU_INTRINSIC1(log2, std::log2(a))
+FFXM_CPU_INTRINSIC1(sin, std::sin(a))
+FFXM_CPU_INTRINSIC1(cos, std::cos(a))
+FFXM_CPU_INTRINSIC1(saturate, a < decltype(a)(0) ? decltype(a)(0) : (a > decltype(a)(1) ? decltype(a)(1) : a))
+FFXM_CPU_INTRINSIC1(isnan, std::isnan(a))
+FFXM_CPU_INTRINSIC1(isinf, std::isinf(a))
+FFXM_CPU_INTRINSIC2(min, b < a ? b : a)
+FFXM_CPU_INTRINSIC2(max, a < b ? b : a)
+FFXM_CPU_INTRINSIC2(pow, std::pow(a, b))
+FFXM_CPU_INTRINSIC2(fmod, std::fmod(a, b))
+FFXM_CPU_INTRINSIC2(step, b >= a ? decltype(a)(1) : decltype(a)(0))
+FFXM_CPU_INTRINSIC3(clamp, c < (b < a ? a : b) ? c : (b < a ? a : b))
+FFXM_CPU_INTRINSIC3(lerp, a + (b - a) * c)
+FFXM_CPU_INTRINSIC3(mad, a * b + c)
+
+#undef FFXM_CPU_INTRINSIC1
+#undef FFXM_CPU_INTRINSIC2
+#undef FFXM_CPU_INTRINSIC3
+
+template <FfxmOperand X, FfxmOperand Y>
+auto dot(const X& x, const Y& y)
+{
+    const auto products = x * y;
+    typedef std::remove_cvref_t<decltype(products)> Products;
+    if constexpr (FfxmVectorOperand<Products>)
+    {
+        auto result = products[0];
+        for (int index = 1; index < FfxmVectorTraits<Products>::size; ++index)
+            result += products[index];
+        return result;
+    }
+    else
+    {
+        return products;
+    }
+}
+
+template <FfxmOperand X>
+auto length(const X& x)
+{
+    return sqrt(dot(x, x));
+}
+
+template <FfxmOperand X, FfxmOperand Y>
+auto distance(const X& x, const Y& y)
+{
+    return length(x - y);
+}
+
+template <FfxmOperand X>
+auto normalize(const X& x)
+{
+    return x * rsqrt(dot(x, x));
+}
+
+template <FfxmOperand X, FfxmOperand Y>
+auto cross(const X& x, const Y& y)
+{
+    return FfxmVector<FfxmPromoted<X, Y>, 3>(x[1] * y[2] - x[2] * y[1], x[2] * y[0] - x[0] * y[2], x[0] * y[1] - x[1] * y[0]);
+}
+
+template <FfxmOperand X>
+FfxBoolean all(const X& x)
+{
+    for (int index = 0; index < FfxmVectorTraits<std::remove_cvref_t<X>>::size; ++index)
+    {
+        if (!ffxmComponent(x, index))
+            return false;
+    }
+    return true;
+}
+
+template <FfxmOperand X>
+FfxBoolean any(const X& x)
+{
+    for (int index = 0; index < FfxmVectorTraits<std::remove_cvref_t<X>>::size; ++index)
+    {
+        if (ffxmComponent(x, index))
+            return true;
+    }
+    return false;
+}
+
+template <FfxmOperand X>
+auto asfloat(const X& x)
+{
+    return ffxmMap([](auto a) { return std::bit_cast<FfxFloat32>(a); }, x);
+}
+
+template <FfxmOperand X>
+auto asuint(const X& x)
+{
+    return ffxmMap([](auto a) { return std::bit_cast<FfxUInt32>(a); }, x);
+}
+
+template <FfxmOperand X>
+auto asint(const X& x)
+{
+    return ffxmMap([](auto a) { return std::bit_cast<FfxInt32>(a); }, x);
+}
+
+FFXM_STATIC FfxFloat32 ffxmCpuHalfToFloat(FfxUInt32 value)
+{
+    const FfxUInt32 sign     = (value & 0x8000u) << 16;
+    const FfxUInt32 exponent = (value >> 10) & 0x1fu;
+    const FfxUInt32 mantissa = value & 0x3ffu;
+    if (exponent == 0)
+    {
+        const FfxFloat32 denormal = std::ldexp(FfxFloat32(mantissa), -24);
+        return sign ? -denormal : denormal;
+    }
+    if (exponent == 0x1f)
+        return std::bit_cast<FfxFloat32>(sign | 0x7f800000u | (mantissa << 13));
+    return std::bit_cast<FfxFloat32>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+template <FfxmVectorOperand X>
+auto f32tof16(const X& x)
+{
+    return ffxmMap([](FfxFloat32 a) { return f32tof16(a); }, x);
+}
+
+template <FfxmOperand X>
+auto f16tof32(const X& x)
+{
+    return ffxmMap([](FfxUInt32 a) { return ffxmCpuHalfToFloat(a); }, x);
+}
+
+template <FfxmOperand X, FfxmOperand Y>
+void InterlockedAdd(X& destination, const Y& value)
+{
+    std::atomic_ref<X>(destination).fetch_add(X(value));
+}
+
+template <FfxmOperand X, FfxmOperand Y, FfxmOperand Z>
+void InterlockedAdd(X& destination, const Y& value, Z& originalValue)
+{
+    originalValue = Z(std::atomic_ref<X>(destination).fetch_add(X(value)));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers of ffxm_core_hlsl.h
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+FFXM_STATIC FfxUInt32 packHalf2x16(FfxFloat32x2 value)
+{
+    return f32tof16(value.x) | (f32tof16(value.y) << 16);
+}
+
+FFXM_STATIC FfxFloat32x2 ffxBroadcast2(FfxFloat32 value)
+{
+    return FfxFloat32x2(value, value);
+}
+
+FFXM_STATIC FfxFloat32x3 ffxBroadcast3(FfxFloat32 value)
+{
+    return FfxFloat32x3(value, value, value);
+}
+
+FFXM_STATIC FfxFloat32x4 ffxBroadcast4(FfxFloat32 value)
+{
+    return FfxFloat32x4(value, value, value, value);
+}
+
+// The literals of the GPU code, such as 1.0, are doubles in C++.
+FFXM_STATIC FfxFloat32x2 ffxBroadcast2(double value)
+{
+    return ffxBroadcast2(FfxFloat32(value));
+}
+
+FFXM_STATIC FfxFloat32x3 ffxBroadcast3(double value)
+{
+    return ffxBroadcast3(FfxFloat32(value));
+}
+
+FFXM_STATIC FfxFloat32x4 ffxBroadcast4(double value)
+{
+    return ffxBroadcast4(FfxFloat32(value));
+}
+
+FFXM_STATIC FfxInt32x2 ffxBroadcast2(FfxInt32 value)
+{
+    return FfxInt32x2(value, value);
+}
+
+FFXM_STATIC FfxUInt32x3 ffxBroadcast3(FfxInt32 value)
+{
+    return FfxUInt32x3(value, value, value);
+}
+
+FFXM_STATIC FfxInt32x4 ffxBroadcast4(FfxInt32 value)
+{
+    return FfxInt32x4(value, value, value, value);
+}
+
+FFXM_STATIC FfxUInt32x2 ffxBroadcast2(FfxUInt32 value)
+{
+    return FfxUInt32x2(value, value);
+}
+
+FFXM_STATIC FfxUInt32x3 ffxBroadcast3(FfxUInt32 value)
+{
+    return FfxUInt32x3(value, value, value);
+}
+
+FFXM_STATIC FfxUInt32x4 ffxBroadcast4(FfxUInt32 value)
+{
+    return FfxUInt32x4(value, value, value, value);
+}
+
+FFXM_STATIC FfxUInt32 bitfieldExtract(FfxUInt32 src, FfxUInt32 off, FfxUInt32 bits)
+{
+    FfxUInt32 mask = (1u << bits) - 1;
+    return (src >> off) & mask;
+}
+
+FFXM_STATIC FfxUInt32 bitfieldInsert(FfxUInt32 src, FfxUInt32 ins, FfxUInt32 mask)
+{
+    return (ins & mask) | (src & (~mask));
+}
+
+FFXM_STATIC FfxUInt32 bitfieldInsertMask(FfxUInt32 src, FfxUInt32 ins, FfxUInt32 bits)
+{
+    FfxUInt32 mask = (1u << bits) - 1;
+    return (ins & mask) | (src & (~mask));
+}
+
+template <FfxmVectorOperand X>
+auto ffxAsUInt32(const X& x)
+{
+    return asuint(x);
+}
+
+template <FfxmOperand X>
+auto ffxAsFloat(const X& x)
+{
+    return asfloat(x);
+}
+
+template <FfxmOperand X, FfxmOperand Y, FfxmOperand T>
+auto ffxLerp(const X& x, const Y& y, const T& t)
+{
+    return lerp(x, y, t);
+}
+
+template <FfxmOperand X>
+auto ffxSaturate(const X& x)
+{
+    return saturate(x);
+}
+
+template <FfxmOperand X>
+auto ffxFract(const X& x)
+{
+    return x - floor(x);
+}
+
+template <FfxmOperand X, FfxmOperand Y, FfxmOperand Z>
+auto ffxMax3(const X& x, const Y& y, const Z& z)
+{
+    return max(x, max(y, z));
+}
+
+template <FfxmOperand X, FfxmOperand Y, FfxmOperand Z>
+auto ffxMed3(const X& x, const Y& y, const Z& z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+template <FfxmOperand X, FfxmOperand Y, FfxmOperand Z>
+auto ffxMin3(const X& x, const Y& y, const Z& z)
+{
+    return min(x, min(y, z));
+}
+
+FFXM_STATIC FfxUInt32 AShrSU1(FfxUInt32 a, FfxUInt32 b)
+{
+    return FfxUInt32(FfxInt32(a) >> FfxInt32(b));
+}
+
+FFXM_STATIC FfxUInt32 ffxPackF32(FfxFloat32x2 v)
+{
+    FfxUInt32x2 p = FfxUInt32x2(f32tof16(FfxFloat32x2(v).x), f32tof16(FfxFloat32x2(v).y));
+    return p.x | (p.y << 16);
+}
+
+FFXM_STATIC FfxFloat32x2 ffxUnpackF32(FfxUInt32 a)
+{
+    return f16tof32(FfxUInt32x2(a & 0xFFFF, a >> 16));
+}
+
+template <FfxmOperand X>
+auto ffxInvertSafe(const X& v)
+{
+    return ffxmMap([](FfxFloat32 a) { return a != 0.0f ? 1.0f / a : 0.0f; }, v);
+}
+
+#define FFXM_UINT32_TO_FLOAT16X2(x) ffxUnpackF32(FfxUInt32(x))
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Work groups and waves
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Wait for all the threads of the work group running on the calling host thread. Defined by the host.
+///
+/// @ingroup CPUShader
+void ffxmCpuGroupMemoryBarrier();
+
+/// The index of the calling thread in its work group. Defined by the host.
+///
+/// @ingroup CPUShader
+FfxUInt32 ffxmCpuLocalThreadIndex();
+
+FFXM_GROUPSHARED FfxFloat32x4 ffxmCpuWaveValues[FFXM_CPU_MAX_WORK_GROUP_SIZE];
+
+FFXM_STATIC FfxUInt32 WaveGetLaneCount()
+{
+    return FFXM_CPU_WAVE_LANE_COUNT;
+}
+
+FFXM_STATIC FfxBoolean WaveIsFirstLane()
+{
+    return (ffxmCpuLocalThreadIndex() % FFXM_CPU_WAVE_LANE_COUNT) == 0;
+}
+
+// The waves of the work group sum their values in lane order. All the threads of the work group take part.
+FFXM_STATIC FfxFloat32x4 ffxmCpuWaveActiveSum(FfxFloat32x4 value)
+{
+    const FfxUInt32 thread = ffxmCpuLocalThreadIndex();
+    const FfxUInt32 firstLane = thread - thread % FFXM_CPU_WAVE_LANE_COUNT;
+
+    ffxmCpuWaveValues[thread] = value;
+    ffxmCpuGroupMemoryBarrier();
+
+    FfxFloat32x4 sum = ffxmCpuWaveValues[firstLane];
+    for (FfxUInt32 lane = 1; lane < FFXM_CPU_WAVE_LANE_COUNT; ++lane)
+        sum += ffxmCpuWaveValues[firstLane + lane];
+    ffxmCpuGroupMemoryBarrier();
+
+    return sum;
+}
+
+FFXM_STATIC FfxFloat32 WaveActiveSum(FfxFloat32 value)
+{
+    return ffxmCpuWaveActiveSum(FfxFloat32x4(value, 0.0f, 0.0f, 0.0f)).x;
+}
+
+FFXM_STATIC FfxFloat32x4 WaveActiveSum(FfxFloat32x4 value)
+{
+    return ffxmCpuWaveActiveSum(value);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Textures and samplers
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// A view of a host texture, from its base mip.
+///
+/// @ingroup CPUShader
+typedef struct FfxmCpuTextureView
+{
+    void*     texture;
+    FfxUInt32 baseMip;
+} FfxmCpuTextureView;
+
+/// The size of a mip of a view, zero without texture. Defined by the host.
+///
+/// @ingroup CPUShader
+FfxInt32x2 ffxmCpuTextureSize(const FfxmCpuTextureView& view, FfxUInt32 mip);
+
+/// Read a texel of a view as floating point values, out of bounds texels read zero. Defined by the host.
+///
+/// @ingroup CPUShader
+FfxFloat32x4 ffxmCpuTextureLoad(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip);
+
+/// Read a texel of a view of an integer texture. Defined by the host.
+///
+/// @ingroup CPUShader
+FfxUInt32x4 ffxmCpuTextureLoadUint(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip);
+
+/// Write a texel of a view, out of bounds writes are dropped. Defined by the host.
+///
+/// @ingroup CPUShader
+void ffxmCpuTextureStore(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip, FfxFloat32x4 value);
+
+/// Write a texel of a view of an integer texture. Defined by the host.
+///
+/// @ingroup CPUShader
+void ffxmCpuTextureStoreUint(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip, FfxUInt32x4 value);
+
+/// The texel of a view of a 32bit integer texture, for the atomic operations, or null out of bounds. Defined by the host.
+///
+/// @ingroup CPUShader
+FfxUInt32* ffxmCpuTextureAtomic(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip);
+
+/// The view of the texture bound to a resource of the running pass, by name. Defined by the host.
+///
+/// @ingroup CPUShader
+FfxmCpuTextureView ffxmCpuBindTexture(const wchar_t* name);
+
+/// Copy the constant buffer bound to the running pass, by name, zero filling what it does not provide. Defined by the host.
+///
+/// @ingroup CPUShader
+void ffxmCpuBindConstants(const wchar_t* name, void* data, FfxUInt32 size);
+
+/// A sampler, all of them clamp to the edge.
+///
+/// @ingroup CPUShader
+typedef struct FfxmSamplerState
+{
+    FfxBoolean linear;
+} FfxmSamplerState;
+
+FFXM_STATIC const FfxmSamplerState s_PointClamp  = {false};
+FFXM_STATIC const FfxmSamplerState s_LinearClamp = {true};
+
+// Integer texels convert from and to FfxUInt32x4, a round trip through floats would lose the low bits of 32bit values.
+template <typename T, typename V>
+T ffxmCpuTexel(const V& value)
+{
+    if constexpr (FfxmVectorOperand<T>)
+    {
+        T texel;
+        for (int index = 0; index < FfxmVectorTraits<T>::size; ++index)
+            texel[index] = FfxmComponent<T>(value[index]);
+        return texel;
+    }
+    else
+    {
+        return T(value.x);
+    }
+}
+
+template <typename V, typename T>
+V ffxmCpuTexelValue(const T& texel)
+{
+    // the components missing from the texel are written as they are read
+    V value = V(0, 0, 0, 1);
+    for (int index = 0; index < FfxmVectorTraits<T>::size; ++index)
+        value[index] = FfxmComponent<V>(ffxmComponent(texel, index));
+    return value;
+}
+
+template <typename T>
+T ffxmCpuTextureRead(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip)
+{
+    if constexpr (std::is_integral_v<FfxmComponent<T>>)
+        return ffxmCpuTexel<T>(ffxmCpuTextureLoadUint(view, position, mip));
+    else
+        return ffxmCpuTexel<T>(ffxmCpuTextureLoad(view, position, mip));
+}
+
+template <typename T>
+void ffxmCpuTextureWrite(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip, const T& texel)
+{
+    if constexpr (std::is_integral_v<FfxmComponent<T>>)
+        ffxmCpuTextureStoreUint(view, position, mip, ffxmCpuTexelValue<FfxUInt32x4>(texel));
+    else
+        ffxmCpuTextureStore(view, position, mip, ffxmCpuTexelValue<FfxFloat32x4>(texel));
+}
+
+/// A read only texture, <c><i>Texture2D</i></c> of HLSL.
+///
+/// @ingroup CPUShader
+template <typename T>
+struct FfxmTexture2D
+{
+    struct Mip
+    {
+        const FfxmCpuTextureView* view;
+        FfxUInt32                 mip;
+
+        template <FfxmVectorOperand P>
+        T operator[](const P& position) const
+        {
+            return ffxmCpuTextureRead<T>(*view, FfxInt32x2(position), mip);
+        }
+    };
+
+    // The view is held by the mips to read them as <c><i>texture.mips[mip][position]</i></c>.
+    struct Mips
+    {
+        FfxmCpuTextureView view;
+
+        Mip operator[](FfxUInt32 mip) const
+        {
+            return {&view, mip};
+        }
+    } mips;
+
+    FfxmTexture2D& operator=(const FfxmCpuTextureView& value)
+    {
+        mips.view = value;
+        return *this;
+    }
+
+    template <FfxmVectorOperand P>
+    T operator[](const P& position) const
+    {
+        return ffxmCpuTextureRead<T>(mips.view, FfxInt32x2(position), 0);
+    }
+
+    T Load(FfxInt32x3 position) const
+    {
+        return ffxmCpuTextureRead<T>(mips.view, position.xy, FfxUInt32(position.z));
+    }
+
+    T SampleLevel(FfxmSamplerState sampler, FfxFloat32x2 uv, FfxFloat32 level) const
+    {
+        const FfxUInt32  mip  = FfxUInt32(level);
+        const FfxInt32x2 size = ffxmCpuTextureSize(mips.view, mip);
+        const FfxInt32x2 last = max(size - 1, FfxInt32x2(0, 0));
+        if (!sampler.linear)
+            return ffxmCpuTexel<T>(ffxmCpuTextureLoad(mips.view, clamp(FfxInt32x2(floor(uv * FfxFloat32x2(size))), FfxInt32x2(0, 0), last), mip));
+
+        const FfxFloat32x2 position = uv * FfxFloat32x2(size) - 0.5f;
+        const FfxFloat32x2 base     = floor(position);
+        const FfxFloat32x2 weight   = position - base;
+        const FfxInt32x2   p0       = clamp(FfxInt32x2(base), FfxInt32x2(0, 0), last);
+        const FfxInt32x2   p1       = clamp(FfxInt32x2(base) + 1, FfxInt32x2(0, 0), last);
+
+        const FfxFloat32x4 top    = lerp(ffxmCpuTextureLoad(mips.view, p0, mip), ffxmCpuTextureLoad(mips.view, FfxInt32x2(p1.x, p0.y), mip), weight.x);
+        const FfxFloat32x4 bottom = lerp(ffxmCpuTextureLoad(mips.view, FfxInt32x2(p0.x, p1.y), mip), ffxmCpuTextureLoad(mips.view, p1, mip), weight.x);
+        return ffxmCpuTexel<T>(lerp(top, bottom, weight.y));
+    }
+
+    typedef FfxmVector<FfxmComponent<T>, 4> GatherType;
+
+    FfxmComponent<T> GatherTexel(FfxInt32x2 position, FfxUInt32 component) const
+    {
+        return ffxmComponent(ffxmCpuTextureRead<T>(mips.view, position, 0), component);
+    }
+
+    GatherType Gather(FfxUInt32 component, FfxFloat32x2 uv) const
+    {
+        const FfxInt32x2 size = ffxmCpuTextureSize(mips.view, 0);
+        const FfxInt32x2 last = max(size - 1, FfxInt32x2(0, 0));
+        const FfxInt32x2 base = FfxInt32x2(floor(uv * FfxFloat32x2(size) - 0.5f));
+        const FfxInt32x2 p0   = clamp(base, FfxInt32x2(0, 0), last);
+        const FfxInt32x2 p1   = clamp(base + 1, FfxInt32x2(0, 0), last);
+
+        // (0, 1), (1, 1), (1, 0), (0, 0) of the bilinear footprint
+        return GatherType(GatherTexel(FfxInt32x2(p0.x, p1.y), component),
+                          GatherTexel(p1, component),
+                          GatherTexel(FfxInt32x2(p1.x, p0.y), component),
+                          GatherTexel(p0, component));
+    }
+
+    GatherType GatherRed(FfxmSamplerState, FfxFloat32x2 uv) const
+    {
+        return Gather(0, uv);
+    }
+
+    GatherType GatherGreen(FfxmSamplerState, FfxFloat32x2 uv) const
+    {
+        return Gather(1, uv);
+    }
+
+    GatherType GatherBlue(FfxmSamplerState, FfxFloat32x2 uv) const
+    {
+        return Gather(2, uv);
+    }
+
+    GatherType GatherAlpha(FfxmSamplerState, FfxFloat32x2 uv) const
+    {
+        return Gather(3, uv);
+    }
+};
+
+/// A texel of a read write texture, to read, write or update atomically.
+///
+/// @ingroup CPUShader
+template <typename T>
+struct FfxmRWTexel
+{
+    const FfxmCpuTextureView* view;
+    FfxInt32x2                position;
+
+    operator T() const
+    {
+        return ffxmCpuTextureRead<T>(*view, position, 0);
+    }
+
+    const FfxmRWTexel& operator=(const T& value) const
+    {
+        ffxmCpuTextureWrite<T>(*view, position, 0, value);
+        return *this;
+    }
+};
+
+/// A read write texture, <c><i>RWTexture2D</i></c> of HLSL.
+///
+/// @ingroup CPUShader
+template <typename T>
+struct FfxmRWTexture2D
+{
+    FfxmCpuTextureView view;
+
+    FfxmRWTexture2D& operator=(const FfxmCpuTextureView& value)
+    {
+        view = value;
+        return *this;
+    }
+
+    template <FfxmVectorOperand P>
+    FfxmRWTexel<T> operator[](const P& position) const
+    {
+        return {&view, FfxInt32x2(position)};
+    }
+};
+
+template <typename T, FfxmOperand Y>
+void InterlockedAdd(const FfxmRWTexel<T>& destination, const Y& value, FfxUInt32& originalValue)
+{
+    FfxUInt32* texel = ffxmCpuTextureAtomic(*destination.view, destination.position, 0);
+    originalValue    = texel ? std::atomic_ref<FfxUInt32>(*texel).fetch_add(FfxUInt32(value)) : 0;
+}
+
+template <typename T, FfxmOperand Y>
+void InterlockedMin(const FfxmRWTexel<T>& destination, const Y& value)
+{
+    if (FfxUInt32* texel = ffxmCpuTextureAtomic(*destination.view, destination.position, 0))
+    {
+        std::atomic_ref<FfxUInt32> atomic(*texel);
+        FfxUInt32                  current = atomic.load();
+        while (FfxUInt32(value) < current && !atomic.compare_exchange_weak(current, FfxUInt32(value)))
+        {
+        }
+    }
+}
+
+template <typename T, FfxmOperand Y>
+void InterlockedMax(const FfxmRWTexel<T>& destination, const Y& value)
+{
+    if (FfxUInt32* texel = ffxmCpuTextureAtomic(*destination.view, destination.position, 0))
+    {
+        std::atomic_ref<FfxUInt32> atomic(*texel);
+        FfxUInt32                  current = atomic.load();
+        while (FfxUInt32(value) > current && !atomic.compare_exchange_weak(current, FfxUInt32(value)))
+        {
+        }
+    }
+}
+
+#endif // #if defined(FFXM_GPU)
@@ -33,6 +33,22 @@
 #ifndef FFXM_FSR2_OPTION_SHADER_OPT_BALANCED
 #define FFXM_FSR2_OPTION_SHADER_OPT_BALANCED 0
 #endif
+/// FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP. If defined with the performance or ultra performance preset, the depth clip is evaluated at half render resolution.
+#ifndef FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP
+#define FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP 0
+#endif
+/// FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK. If defined, the lock pass also dilates the inputs and reconstructs the previous depth.
+#ifndef FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+#define FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK 0
+#endif
+/// FFXM_FSR2_OPTION_SUBGROUP_LUMINANCE_PYRAMID. If defined, the luminance pyramid is reduced with subgroup operations and only writes the levels read by the upscaler.
+#ifndef FFXM_FSR2_OPTION_SUBGROUP_LUMINANCE_PYRAMID
+#define FFXM_FSR2_OPTION_SUBGROUP_LUMINANCE_PYRAMID 0
+#endif
+/// FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE. If defined, the upsampling reads separable Lanczos weights from a table precomputed per jitter and pixel phase.
+#ifndef FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+#define FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE 0
+#endif
 /// FFXM_SHADER_QUALITY_BALANCED_OR_PERFORMANCE. Helper to identify if any of these profiles is used.
 #define FFXM_SHADER_QUALITY_BALANCED_OR_PERFORMANCE (FFXM_FSR2_OPTION_SHADER_OPT_BALANCED || FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE)
 
@@ -50,6 +66,10 @@
 #define FFXM_SHADER_QUALITY_OPT_TONEMAPPED_RGB_PREPARED_INPUT_COLOR FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE
 /// Performance. Use Catmull-Rom (5 samples) for history reprojection
 #define FFXM_SHADER_QUALITY_OPT_REPROJECT_CATMULL_5TAP FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE
+/// Performance/Ultra Performance. Evaluate the depth clip at half render resolution if FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP is defined
+#define FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP (FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP && (FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE || FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE))
+/// Ultra Performance, and Performance with the half resolution depth clip. The accumulation prepares the input color, the depth clip pass doesn't
+#define FFXM_SHADER_QUALITY_OPT_ACCUMULATE_PREPARES_INPUT_COLOR (FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE || FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP)
 
 #if !defined(FFXM_SHADER_PLATFORM_GLES_3_2)
 #define FFXM_SHADER_PLATFORM_GLES_3_2 (0)
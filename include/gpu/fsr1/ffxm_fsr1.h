@@ -39,10 +39,10 @@
 ///
 /// @ingroup FfxGPUFsr1
 FFXM_STATIC void ffxFsrPopulateEasuConstants(
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con0,
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con1,
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con2,
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con3,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con0,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con1,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con2,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con3,
     FFXM_PARAMETER_IN FfxFloat32 inputViewportInPixelsX,
     FFXM_PARAMETER_IN FfxFloat32 inputViewportInPixelsY,
     FFXM_PARAMETER_IN FfxFloat32 inputSizeInPixelsX,
@@ -105,10 +105,10 @@ FFXM_STATIC void ffxFsrPopulateEasuConstants(
 ///
 /// @ingroup FfxGPUFsr1
 FFXM_STATIC void ffxFsrPopulateEasuConstantsOffset(
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con0,
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con1,
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con2,
-    FFXM_PARAMETER_INOUT FfxUInt32x4 con3,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con0,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con1,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con2,
+    FFXM_PARAMETER_INOUT(FfxUInt32x4) con3,
     FFXM_PARAMETER_IN FfxFloat32 inputViewportInPixelsX,
     FFXM_PARAMETER_IN FfxFloat32 inputViewportInPixelsY,
     FFXM_PARAMETER_IN FfxFloat32 inputSizeInPixelsX,
@@ -143,8 +143,8 @@ FfxFloat32x4 FsrEasuBF(FfxFloat32x2 p);
 
 // Filtering for a given tap for the scalar.
 void fsrEasuTapFloat(
-    FFXM_PARAMETER_INOUT FfxFloat32x3 accumulatedColor,   // Accumulated color, with negative lobe.
-    FFXM_PARAMETER_INOUT FfxFloat32 accumulatedWeight,    // Accumulated weight.
+    FFXM_PARAMETER_INOUT(FfxFloat32x3) accumulatedColor,   // Accumulated color, with negative lobe.
+    FFXM_PARAMETER_INOUT(FfxFloat32) accumulatedWeight,    // Accumulated weight.
     FFXM_PARAMETER_IN FfxFloat32x2 pixelOffset,           // Pixel offset from resolve position to tap.
     FFXM_PARAMETER_IN FfxFloat32x2 gradientDirection,     // Gradient direction.
     FFXM_PARAMETER_IN FfxFloat32x2 length,                // Length.
@@ -187,8 +187,8 @@ void fsrEasuTapFloat(
 
 // Accumulate direction and length.
 void fsrEasuSetFloat(
-    FFXM_PARAMETER_INOUT FfxFloat32x2 direction,
-    FFXM_PARAMETER_INOUT FfxFloat32 length,
+    FFXM_PARAMETER_INOUT(FfxFloat32x2) direction,
+    FFXM_PARAMETER_INOUT(FfxFloat32) length,
     FFXM_PARAMETER_IN FfxFloat32x2 pp,
     FFXM_PARAMETER_IN FfxBoolean biS,
     FFXM_PARAMETER_IN FfxBoolean biT,
@@ -252,7 +252,7 @@ void fsrEasuSetFloat(
 ///
 /// @ingroup FSR
 void ffxFsrEasuFloat(
-    FFXM_PARAMETER_OUT FfxFloat32x3 pix,
+    FFXM_PARAMETER_OUT(FfxFloat32x3) pix,
     FFXM_PARAMETER_IN FfxUInt32x2 ip,
     FFXM_PARAMETER_IN FfxUInt32x4 con0,
     FFXM_PARAMETER_IN FfxUInt32x4 con1,
@@ -395,10 +395,10 @@ FfxFloat16x4 FsrEasuBH(FfxFloat32x2 p);
 
 // This runs 2 taps in parallel.
 void FsrEasuTapH(
-    FFXM_PARAMETER_INOUT FfxFloat16x2 aCR,
-    FFXM_PARAMETER_INOUT FfxFloat16x2 aCG,
-    FFXM_PARAMETER_INOUT FfxFloat16x2 aCB,
-    FFXM_PARAMETER_INOUT FfxFloat16x2 aW,
+    FFXM_PARAMETER_INOUT(FfxFloat16x2) aCR,
+    FFXM_PARAMETER_INOUT(FfxFloat16x2) aCG,
+    FFXM_PARAMETER_INOUT(FfxFloat16x2) aCB,
+    FFXM_PARAMETER_INOUT(FfxFloat16x2) aW,
     FFXM_PARAMETER_IN FfxFloat16x2 offX,
     FFXM_PARAMETER_IN FfxFloat16x2 offY,
     FFXM_PARAMETER_IN FfxFloat16x2 dir,
@@ -430,9 +430,9 @@ void FsrEasuTapH(
 
 // This runs 2 taps in parallel.
 void FsrEasuSetH(
-    FFXM_PARAMETER_INOUT FfxFloat16x2 dirPX,
-    FFXM_PARAMETER_INOUT FfxFloat16x2  dirPY,
-    FFXM_PARAMETER_INOUT FfxFloat16x2 lenP,
+    FFXM_PARAMETER_INOUT(FfxFloat16x2) dirPX,
+    FFXM_PARAMETER_INOUT(FfxFloat16x2)  dirPY,
+    FFXM_PARAMETER_INOUT(FfxFloat16x2) lenP,
     FFXM_PARAMETER_IN FfxFloat16x2 pp,
     FFXM_PARAMETER_IN FfxBoolean biST,
     FFXM_PARAMETER_IN FfxBoolean biUV,
@@ -473,7 +473,7 @@ void FsrEasuSetH(
 }
 
 void FsrEasuH(
-    FFXM_PARAMETER_OUT FfxFloat16x3 pix,
+    FFXM_PARAMETER_OUT(FfxFloat16x3) pix,
     FFXM_PARAMETER_IN FfxUInt32x2 ip,
     FFXM_PARAMETER_IN FfxUInt32x4 con0,
     FFXM_PARAMETER_IN FfxUInt32x4 con1,
@@ -630,7 +630,7 @@ void FsrEasuH(
 //  GLSL example for the required callbacks :
 //
 //  FfxFloat16x4 FsrRcasLoadH(FfxInt16x2 p){return FfxFloat16x4(imageLoad(imgSrc,FfxInt32x2(p)));}
-//  void FsrRcasInputH(inout FfxFloat16 r,inout FfxFloat16 g,inout FfxFloat16 b)
+//  void FsrRcasInputH(FFXM_PARAMETER_INOUT(FfxFloat16) r,FFXM_PARAMETER_INOUT(FfxFloat16) g,FFXM_PARAMETER_INOUT(FfxFloat16) b)
 //  {
 //    //do any simple input color conversions here or leave empty if none needed
 //  }
@@ -678,13 +678,13 @@ void FsrEasuH(
 #if defined(FFXM_GPU)&&defined(FSR_RCAS_F)
  // Input callback prototypes that need to be implemented by calling shader
  FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p);
- void FsrRcasInputF(inout FfxFloat32 r,inout FfxFloat32 g,inout FfxFloat32 b);
+ void FsrRcasInputF(FFXM_PARAMETER_INOUT(FfxFloat32) r,FFXM_PARAMETER_INOUT(FfxFloat32) g,FFXM_PARAMETER_INOUT(FfxFloat32) b);
 //------------------------------------------------------------------------------------------------------------------------------
- void FsrRcasF(out FfxFloat32 pixR,  // Output values, non-vector so port between RcasFilter() and RcasFilterH() is easy.
-               out FfxFloat32 pixG,
-               out FfxFloat32 pixB,
+ void FsrRcasF(FFXM_PARAMETER_OUT(FfxFloat32) pixR,  // Output values, non-vector so port between RcasFilter() and RcasFilterH() is easy.
+               FFXM_PARAMETER_OUT(FfxFloat32) pixG,
+               FFXM_PARAMETER_OUT(FfxFloat32) pixB,
 #ifdef FSR_RCAS_PASSTHROUGH_ALPHA
-               out FfxFloat32 pixA,
+               FFXM_PARAMETER_OUT(FfxFloat32) pixA,
 #endif
                FfxUInt32x2 ip,  // Integer pixel position in output.
                FfxUInt32x4 con)
@@ -779,14 +779,14 @@ void FsrEasuH(
 #if defined(FFXM_GPU) && FFXM_HALF == 1 && defined(FSR_RCAS_H)
  // Input callback prototypes that need to be implemented by calling shader
  FfxFloat16x4 FsrRcasLoadH(FfxInt16x2 p);
- void FsrRcasInputH(inout FfxFloat16 r,inout FfxFloat16 g,inout FfxFloat16 b);
+ void FsrRcasInputH(FFXM_PARAMETER_INOUT(FfxFloat16) r,FFXM_PARAMETER_INOUT(FfxFloat16) g,FFXM_PARAMETER_INOUT(FfxFloat16) b);
 //------------------------------------------------------------------------------------------------------------------------------
  void FsrRcasH(
- out FfxFloat16 pixR, // Output values, non-vector so port between RcasFilter() and RcasFilterH() is easy.
- out FfxFloat16 pixG,
- out FfxFloat16 pixB,
+ FFXM_PARAMETER_OUT(FfxFloat16) pixR, // Output values, non-vector so port between RcasFilter() and RcasFilterH() is easy.
+ FFXM_PARAMETER_OUT(FfxFloat16) pixG,
+ FFXM_PARAMETER_OUT(FfxFloat16) pixB,
  #ifdef FSR_RCAS_PASSTHROUGH_ALPHA
-  out FfxFloat16 pixA,
+  FFXM_PARAMETER_OUT(FfxFloat16) pixA,
  #endif
  FfxUInt32x2 ip, // Integer pixel position in output.
  FfxUInt32x4 con){ // Constant generated by RcasSetup().
@@ -877,10 +877,10 @@ void FsrEasuH(
 #if defined(FFXM_GPU)&& FFXM_HALF == 1 && defined(FSR_RCAS_HX2)
  // Input callback prototypes that need to be implemented by the calling shader
  FfxFloat16x4 FsrRcasLoadHx2(FfxInt16x2 p);
- void FsrRcasInputHx2(inout FfxFloat16x2 r,inout FfxFloat16x2 g,inout FfxFloat16x2 b);
+ void FsrRcasInputHx2(FFXM_PARAMETER_INOUT(FfxFloat16x2) r,FFXM_PARAMETER_INOUT(FfxFloat16x2) g,FFXM_PARAMETER_INOUT(FfxFloat16x2) b);
 //------------------------------------------------------------------------------------------------------------------------------
  // Can be used to convert from packed Structures of Arrays to Arrays of Structures for store.
- void FsrRcasDepackHx2(out FfxFloat16x4 pix0,out FfxFloat16x4 pix1,FfxFloat16x2 pixR,FfxFloat16x2 pixG,FfxFloat16x2 pixB){
+ void FsrRcasDepackHx2(FFXM_PARAMETER_OUT(FfxFloat16x4) pix0,FFXM_PARAMETER_OUT(FfxFloat16x4) pix1,FfxFloat16x2 pixR,FfxFloat16x2 pixG,FfxFloat16x2 pixB){
   #ifdef FFXM_HLSL
    // Invoke a slower path for DX only, since it won't allow uninitialized values.
    pix0.a=pix1.a=0.0;
@@ -893,11 +893,11 @@ void FsrEasuH(
  //  pix<R,G,B>.x =  left 8x8 tile
  //  pix<R,G,B>.y = right 8x8 tile
  // This enables later processing to easily be packed as well.
- out FfxFloat16x2 pixR,
- out FfxFloat16x2 pixG,
- out FfxFloat16x2 pixB,
+ FFXM_PARAMETER_OUT(FfxFloat16x2) pixR,
+ FFXM_PARAMETER_OUT(FfxFloat16x2) pixG,
+ FFXM_PARAMETER_OUT(FfxFloat16x2) pixB,
  #ifdef FSR_RCAS_PASSTHROUGH_ALPHA
-  out FfxFloat16x2 pixA,
+  FFXM_PARAMETER_OUT(FfxFloat16x2) pixA,
  #endif
  FfxUInt32x2 ip, // Integer pixel position in output.
  FfxUInt32x4 con){ // Constant generated by RcasSetup().
@@ -1014,7 +1014,7 @@ void FsrEasuH(
 //==============================================================================================================================
 #if defined(FFXM_GPU)
  // Maximum grain is the minimum distance to the signal limit.
- void FsrLfgaF(inout FfxFloat32x3 c, FfxFloat32x3 t, FfxFloat32 a)
+ void FsrLfgaF(FFXM_PARAMETER_INOUT(FfxFloat32x3) c, FfxFloat32x3 t, FfxFloat32 a)
  {
      c += (t * ffxBroadcast3(a)) * ffxMin(ffxBroadcast3(1.0) - c, c);
  }
@@ -1022,13 +1022,13 @@ void FsrEasuH(
 //==============================================================================================================================
 #if defined(FFXM_GPU)&& FFXM_HALF == 1
  // Half precision version (slower).
- void FsrLfgaH(inout FfxFloat16x3 c, FfxFloat16x3 t, FfxFloat16 a)
+ void FsrLfgaH(FFXM_PARAMETER_INOUT(FfxFloat16x3) c, FfxFloat16x3 t, FfxFloat16 a)
  {
      c += (t * FFXM_BROADCAST_FLOAT16X3(a)) * min(FFXM_BROADCAST_FLOAT16X3(1.0) - c, c);
  }
  //------------------------------------------------------------------------------------------------------------------------------
  // Packed half precision version (faster).
- void FsrLfgaHx2(inout FfxFloat16x2 cR,inout FfxFloat16x2 cG,inout FfxFloat16x2 cB,FfxFloat16x2 tR,FfxFloat16x2 tG,FfxFloat16x2 tB,FfxFloat16 a){
+ void FsrLfgaHx2(FFXM_PARAMETER_INOUT(FfxFloat16x2) cR,FFXM_PARAMETER_INOUT(FfxFloat16x2) cG,FFXM_PARAMETER_INOUT(FfxFloat16x2) cB,FfxFloat16x2 tR,FfxFloat16x2 tG,FfxFloat16x2 tB,FfxFloat16 a){
   cR+=(tR*FFXM_BROADCAST_FLOAT16X2(a))*min(FFXM_BROADCAST_FLOAT16X2(1.0)-cR,cR);cG+=(tG*FFXM_BROADCAST_FLOAT16X2(a))*min(FFXM_BROADCAST_FLOAT16X2(1.0)-cG,cG);cB+=(tB*FFXM_BROADCAST_FLOAT16X2(a))*min(FFXM_BROADCAST_FLOAT16X2(1.0)-cB,cB);}
 #endif
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1049,32 +1049,32 @@ void FsrEasuH(
 //  FsrSrtmInv*(color); // {0 to 1} converted into {0 to 32768, output peak safe for FP16}.
 //==============================================================================================================================
 #if defined(FFXM_GPU)
- void FsrSrtmF(inout FfxFloat32x3 c)
+ void FsrSrtmF(FFXM_PARAMETER_INOUT(FfxFloat32x3) c)
  {
      c *= ffxBroadcast3(rcp(ffxMax3(c.r, c.g, c.b) + FfxFloat32(1.0)));
  }
  // The extra max solves the c=1.0 case (which is a /0).
- void FsrSrtmInvF(inout FfxFloat32x3 c){c*=ffxBroadcast3(rcp(max(FfxFloat32(1.0/32768.0),FfxFloat32(1.0)-ffxMax3(c.r,c.g,c.b))));}
+ void FsrSrtmInvF(FFXM_PARAMETER_INOUT(FfxFloat32x3) c){c*=ffxBroadcast3(rcp(max(FfxFloat32(1.0/32768.0),FfxFloat32(1.0)-ffxMax3(c.r,c.g,c.b))));}
 #endif
 //==============================================================================================================================
 #if defined(FFXM_GPU )&& FFXM_HALF == 1
- void FsrSrtmH(inout FfxFloat16x3 c)
+ void FsrSrtmH(FFXM_PARAMETER_INOUT(FfxFloat16x3) c)
  {
      c *= FFXM_BROADCAST_FLOAT16X3(ffxReciprocalHalf(ffxMax3Half(c.r, c.g, c.b) + FFXM_BROADCAST_FLOAT16(1.0)));
  }
- void FsrSrtmInvH(inout FfxFloat16x3 c)
+ void FsrSrtmInvH(FFXM_PARAMETER_INOUT(FfxFloat16x3) c)
  {
      c *= FFXM_BROADCAST_FLOAT16X3(ffxReciprocalHalf(max(FFXM_BROADCAST_FLOAT16(1.0 / 32768.0), FFXM_BROADCAST_FLOAT16(1.0) - ffxMax3Half(c.r, c.g, c.b))));
  }
  //------------------------------------------------------------------------------------------------------------------------------
- void FsrSrtmHx2(inout FfxFloat16x2 cR, inout FfxFloat16x2 cG, inout FfxFloat16x2 cB)
+ void FsrSrtmHx2(FFXM_PARAMETER_INOUT(FfxFloat16x2) cR, FFXM_PARAMETER_INOUT(FfxFloat16x2) cG, FFXM_PARAMETER_INOUT(FfxFloat16x2) cB)
  {
      FfxFloat16x2 rcp = ffxReciprocalHalf(ffxMax3Half(cR, cG, cB) + FFXM_BROADCAST_FLOAT16X2(1.0));
      cR *= rcp;
      cG *= rcp;
      cB *= rcp;
  }
- void FsrSrtmInvHx2(inout FfxFloat16x2 cR,inout FfxFloat16x2 cG,inout FfxFloat16x2 cB)
+ void FsrSrtmInvHx2(FFXM_PARAMETER_INOUT(FfxFloat16x2) cR,FFXM_PARAMETER_INOUT(FfxFloat16x2) cG,FFXM_PARAMETER_INOUT(FfxFloat16x2) cB)
  {
      FfxFloat16x2 rcp=ffxReciprocalHalf(max(FFXM_BROADCAST_FLOAT16X2(1.0/32768.0),FFXM_BROADCAST_FLOAT16X2(1.0)-ffxMax3Half(cR,cG,cB)));
      cR*=rcp;
@@ -1126,7 +1126,7 @@ void FsrEasuH(
  // This version is 8-bit gamma 2.0.
  // The 'c' input is {0 to 1}.
  // Output is {0 to 1} ready for image store.
- void FsrTepdC8F(inout FfxFloat32x3 c, FfxFloat32 dit)
+ void FsrTepdC8F(FFXM_PARAMETER_INOUT(FfxFloat32x3) c, FfxFloat32 dit)
  {
      FfxFloat32x3 n = ffxSqrt(c);
      n              = floor(n * ffxBroadcast3(255.0)) * ffxBroadcast3(1.0 / 255.0);
@@ -1145,7 +1145,7 @@ void FsrEasuH(
  // This version is 10-bit gamma 2.0.
  // The 'c' input is {0 to 1}.
  // Output is {0 to 1} ready for image store.
- void FsrTepdC10F(inout FfxFloat32x3 c, FfxFloat32 dit)
+ void FsrTepdC10F(FFXM_PARAMETER_INOUT(FfxFloat32x3) c, FfxFloat32 dit)
  {
      FfxFloat32x3 n = ffxSqrt(c);
      n              = floor(n * ffxBroadcast3(1023.0)) * ffxBroadcast3(1.0 / 1023.0);
@@ -1168,7 +1168,7 @@ void FsrEasuH(
      return FfxFloat16(ffxFract(x));
  }
  //------------------------------------------------------------------------------------------------------------------------------
- void FsrTepdC8H(inout FfxFloat16x3 c, FfxFloat16 dit)
+ void FsrTepdC8H(FFXM_PARAMETER_INOUT(FfxFloat16x3) c, FfxFloat16 dit)
  {
      FfxFloat16x3 n = sqrt(c);
      n     = floor(n * FFXM_BROADCAST_FLOAT16X3(255.0)) * FFXM_BROADCAST_FLOAT16X3(1.0 / 255.0);
@@ -1179,7 +1179,7 @@ void FsrEasuH(
      c     = ffxSaturate(n + ffxIsGreaterThanZeroHalf(FFXM_BROADCAST_FLOAT16X3(dit) - r) * FFXM_BROADCAST_FLOAT16X3(1.0 / 255.0));
  }
  //------------------------------------------------------------------------------------------------------------------------------
- void FsrTepdC10H(inout FfxFloat16x3 c, FfxFloat16 dit)
+ void FsrTepdC10H(FFXM_PARAMETER_INOUT(FfxFloat16x3) c, FfxFloat16 dit)
  {
      FfxFloat16x3 n = sqrt(c);
      n     = floor(n * FFXM_BROADCAST_FLOAT16X3(1023.0)) * FFXM_BROADCAST_FLOAT16X3(1.0 / 1023.0);
@@ -1203,7 +1203,7 @@ void FsrEasuH(
      return FfxFloat16x2(ffxFract(x));
  }
  //------------------------------------------------------------------------------------------------------------------------------
- void FsrTepdC8Hx2(inout FfxFloat16x2 cR, inout FfxFloat16x2 cG, inout FfxFloat16x2 cB, FfxFloat16x2 dit)
+ void FsrTepdC8Hx2(FFXM_PARAMETER_INOUT(FfxFloat16x2) cR, FFXM_PARAMETER_INOUT(FfxFloat16x2) cG, FFXM_PARAMETER_INOUT(FfxFloat16x2) cB, FfxFloat16x2 dit)
  {
      FfxFloat16x2 nR = sqrt(cR);
      FfxFloat16x2 nG = sqrt(cG);
@@ -1228,7 +1228,7 @@ void FsrEasuH(
      cB     = ffxSaturate(nB + ffxIsGreaterThanZeroHalf(dit - rB) * FFXM_BROADCAST_FLOAT16X2(1.0 / 255.0));
  }
  //------------------------------------------------------------------------------------------------------------------------------
- void FsrTepdC10Hx2(inout FfxFloat16x2 cR,inout FfxFloat16x2 cG,inout FfxFloat16x2 cB,FfxFloat16x2 dit){
+ void FsrTepdC10Hx2(FFXM_PARAMETER_INOUT(FfxFloat16x2) cR,FFXM_PARAMETER_INOUT(FfxFloat16x2) cG,FFXM_PARAMETER_INOUT(FfxFloat16x2) cB,FfxFloat16x2 dit){
   FfxFloat16x2 nR=sqrt(cR);
   FfxFloat16x2 nG=sqrt(cG);
   FfxFloat16x2 nB=sqrt(cB);
@@ -53,10 +53,10 @@ FFXM_MIN16_F GetPxHrVelocity(FFXM_MIN16_F2 fMotionVector)
 }
 #endif
 
-void Accumulate(const AccumulationPassCommonParams params, FFXM_PARAMETER_INOUT FfxFloat32x3 fHistoryColor, FfxFloat32x3 fAccumulation, FFXM_PARAMETER_IN FfxFloat32x4 fUpsampledColorAndWeight)
+void Accumulate(const AccumulationPassCommonParams params, FFXM_PARAMETER_INOUT(FfxFloat32x3) fHistoryColor, FfxFloat32x3 fAccumulation, FFXM_PARAMETER_IN FfxFloat32x4 fUpsampledColorAndWeight)
 {
     // Aviod invalid values when accumulation and upsampled weight is 0
-    fAccumulation = ffxMax(FSR2_EPSILON.xxx, fAccumulation + fUpsampledColorAndWeight.www);
+    fAccumulation = ffxMax(ffxBroadcast3(FSR2_EPSILON), fAccumulation + fUpsampledColorAndWeight.www);
 
 #if FFXM_FSR2_OPTION_HDR_COLOR_INPUT
 #if FFXM_SHADER_QUALITY_OPT_TONEMAPPED_RGB_PREPARED_INPUT_COLOR
@@ -84,8 +84,8 @@ void Accumulate(const AccumulationPassCommonParams params, FFXM_PARAMETER_INOUT
 void RectifyHistory(
     const AccumulationPassCommonParams params,
     RectificationBoxMin16 clippingBox,
-    FFXM_PARAMETER_INOUT FfxFloat32x3 fHistoryColor,
-    FFXM_PARAMETER_INOUT FfxFloat32x3 fAccumulation,
+    FFXM_PARAMETER_INOUT(FfxFloat32x3) fHistoryColor,
+    FFXM_PARAMETER_INOUT(FfxFloat32x3) fAccumulation,
     FfxFloat32 fLockContributionThisFrame,
     FfxFloat32 fTemporalReactiveFactor,
     FfxFloat32 fLumaInstabilityFactor)
@@ -93,8 +93,8 @@ void RectifyHistory(
 void RectifyHistory(
     const AccumulationPassCommonParams params,
     RectificationBox clippingBox,
-    FFXM_PARAMETER_INOUT FfxFloat32x3 fHistoryColor,
-    FFXM_PARAMETER_INOUT FfxFloat32x3 fAccumulation,
+    FFXM_PARAMETER_INOUT(FfxFloat32x3) fHistoryColor,
+    FFXM_PARAMETER_INOUT(FfxFloat32x3) fAccumulation,
     FfxFloat32 fLockContributionThisFrame,
     FfxFloat32 fTemporalReactiveFactor,
     FfxFloat32 fLumaInstabilityFactor)
@@ -123,7 +123,7 @@ void RectifyHistory(
 
         const FfxFloat32x3 fClampedHistoryColor = clamp(fHistoryColor, boxMin, boxMax);
 
-        FfxFloat32x3 fHistoryContribution = ffxMax(fLumaInstabilityFactor, fLockContributionThisFrame).xxx;
+        FfxFloat32x3 fHistoryContribution = ffxBroadcast3(ffxMax(fLumaInstabilityFactor, fLockContributionThisFrame));
 
         const FfxFloat32 fReactiveFactor = params.fDilatedReactiveFactor;
         const FfxFloat32 fReactiveContribution = 1.0f - ffxPow(fReactiveFactor, 1.0f / 2.0f);
@@ -138,7 +138,7 @@ void RectifyHistory(
     }
 }
 
-void FinalizeLockStatus(const AccumulationPassCommonParams params, FfxFloat32x2 fLockStatus, FfxFloat32 fUpsampledWeight, FFXM_PARAMETER_INOUT AccumulateOutputs result)
+void FinalizeLockStatus(const AccumulationPassCommonParams params, FfxFloat32x2 fLockStatus, FfxFloat32 fUpsampledWeight, FFXM_PARAMETER_INOUT(AccumulateOutputs) result)
 {
     // we expect similar motion for next frame
     // kill lock if that location is outside screen, avoid locks to be clamped to screen borders
@@ -166,14 +166,14 @@ FfxFloat32x3 ComputeBaseAccumulationWeight(const AccumulationPassCommonParams pa
 
     fBaseAccumulation = ffxMin(fBaseAccumulation, ffxLerp(fBaseAccumulation, fUpsampledWeight, ffxSaturate(params.fHrVelocity / FfxFloat32(20))));
 
-    return fBaseAccumulation.xxx;
+    return ffxBroadcast3(fBaseAccumulation);
 }
 
 #if !FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
 #if FFXM_HALF
-FfxFloat32 ComputeLumaInstabilityFactor(const AccumulationPassCommonParams params, RectificationBoxMin16 clippingBox, FfxFloat32 fThisFrameReactiveFactor, FfxFloat32 fLuminanceDiff, FFXM_PARAMETER_INOUT AccumulateOutputs result)
+FfxFloat32 ComputeLumaInstabilityFactor(const AccumulationPassCommonParams params, RectificationBoxMin16 clippingBox, FfxFloat32 fThisFrameReactiveFactor, FfxFloat32 fLuminanceDiff, FFXM_PARAMETER_INOUT(AccumulateOutputs) result)
 #else
-FfxFloat32 ComputeLumaInstabilityFactor(const AccumulationPassCommonParams params, RectificationBox clippingBox, FfxFloat32 fThisFrameReactiveFactor, FfxFloat32 fLuminanceDiff, FFXM_PARAMETER_INOUT AccumulateOutputs result)
+FfxFloat32 ComputeLumaInstabilityFactor(const AccumulationPassCommonParams params, RectificationBox clippingBox, FfxFloat32 fThisFrameReactiveFactor, FfxFloat32 fLuminanceDiff, FFXM_PARAMETER_INOUT(AccumulateOutputs) result)
 #endif
 {
     const FfxFloat32 fUnormThreshold = 1.0f / 255.0f;
@@ -249,28 +249,107 @@ FfxFloat32 ComputeTemporalReactiveFactor(const AccumulationPassCommonParams para
     return fNewFactor;
 }
 
-void initReactiveMaskFactors(FFXM_PARAMETER_INOUT AccumulationPassCommonParams params)
+#if FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP
+// Edge aware upsample of the outputs of the half resolution depth clip pass, the dilated reactive masks and the depth
+// clip of the performance preset. Where the 4 nearest texels differ, their bilinear weights are lowered with the view
+// space depth difference between the nearest depth of the 2x2 render pixels of each texel and the sampled pixel, so
+// that disocclusions do not bleed across depth edges.
+FfxFloat32x3 SampleHalfResDepthClipOutputs(FfxFloat32x2 fLrUv)
 {
+    const FfxFloat32 fDepthSensitivity = 64.0f;
+    const FfxFloat32 fThreshold = 1.0f / 255.0f;
+
+    const FfxInt32x2 iRenderSize = RenderSize();
+    const FfxInt32x2 iHalfSize = (iRenderSize + 1) / 2;
+    const FfxFloat32x2 fLrPos = fLrUv * FfxFloat32x2(iRenderSize);
+
+    // Texel i covers render pixels 2i and 2i + 1, it is centered at 2i + 1
+    const FfxFloat32x2 fHalfPos = fLrPos * 0.5f - 0.5f;
+    const FfxFloat32x2 fHalfBase = floor(fHalfPos);
+    const FfxFloat32x2 fFract = fHalfPos - fHalfBase;
+    const FfxInt32x2 iHalfBase = FfxInt32x2(fHalfBase);
+
+    FfxInt32x2 iSamplePos[4];
+    FfxFloat32x3 fSampleValues[4];
+    FfxFloat32 fSampleWeights[4];
+    FfxFloat32x3 fValuesMin = FfxFloat32x3(1.0f, 1.0f, 1.0f);
+    FfxFloat32x3 fValuesMax = FfxFloat32x3(0.0f, 0.0f, 0.0f);
+    for (FfxInt32 iSampleIndex = 0; iSampleIndex < 4; iSampleIndex++)
+    {
+        const FfxInt32x2 iOffset = FfxInt32x2(iSampleIndex & 1, iSampleIndex >> 1);
+        const FfxFloat32x2 fBilinear = ffxLerp(FfxFloat32x2(1.0f, 1.0f) - fFract, fFract, FfxFloat32x2(iOffset));
+
+        iSamplePos[iSampleIndex] = clamp(iHalfBase + iOffset, FfxInt32x2(0, 0), iHalfSize - 1);
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+        // The depth clip is stored with the masks
+        const FfxFloat32 fSampleDepthClip = 0.0f;
+#else
+        const FfxFloat32 fSampleDepthClip = LoadDepthClip(iSamplePos[iSampleIndex]);
+#endif
+        fSampleValues[iSampleIndex] = FfxFloat32x3(LoadDilatedReactiveMasks(iSamplePos[iSampleIndex]), fSampleDepthClip);
+        fSampleWeights[iSampleIndex] = fBilinear.x * fBilinear.y;
+
+        fValuesMin = ffxMin(fValuesMin, fSampleValues[iSampleIndex]);
+        fValuesMax = ffxMax(fValuesMax, fSampleValues[iSampleIndex]);
+    }
+
+    const FfxFloat32x3 fValuesRange = fValuesMax - fValuesMin;
+    if (ffxMax(fValuesRange.x, ffxMax(fValuesRange.y, fValuesRange.z)) > fThreshold)
+    {
+        const FfxInt32x2 iLrPos = clamp(FfxInt32x2(fLrPos), FfxInt32x2(0, 0), iRenderSize - 1);
+        const FfxFloat32 fCenterDepth = GetViewSpaceDepth(LoadDilatedDepth(iLrPos));
+
+        for (FfxInt32 iSampleIndex = 0; iSampleIndex < 4; iSampleIndex++)
+        {
+            const FfxFloat32 fSampleDepth = GetViewSpaceDepth(LoadHalfResDilatedDepth(iSamplePos[iSampleIndex]));
+            const FfxFloat32 fDepthDiff = abs(fSampleDepth - fCenterDepth) / ffxMax(ffxMax(abs(fSampleDepth), abs(fCenterDepth)), FSR2_EPSILON);
+            fSampleWeights[iSampleIndex] /= 1.0f + fDepthDiff * fDepthSensitivity;
+        }
+    }
+
+    FfxFloat32x3 fValues = FfxFloat32x3(0.0f, 0.0f, 0.0f);
+    FfxFloat32 fWeightSum = 0.0f;
+    for (FfxInt32 iSampleIndex = 0; iSampleIndex < 4; iSampleIndex++)
+    {
+        fValues += fSampleValues[iSampleIndex] * fSampleWeights[iSampleIndex];
+        fWeightSum += fSampleWeights[iSampleIndex];
+    }
+
+    return fValues / ffxMax(fWeightSum, FSR2_EPSILON);
+}
+#endif
+
+void initReactiveMaskFactors(FFXM_PARAMETER_INOUT(AccumulationPassCommonParams) params)
+{
+#if FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP
+    const FfxFloat32x3 fDepthClipOutputs = SampleHalfResDepthClipOutputs(params.fLrUv_HwSampler);
+    const FFXM_MIN16_F2 fDilatedReactiveMasks = FFXM_MIN16_F2(fDepthClipOutputs.xy);
+#else
     const FFXM_MIN16_F2 fDilatedReactiveMasks = FFXM_MIN16_F2(SampleDilatedReactiveMasks(params.fLrUv_HwSampler));
+#endif
 #if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
     params.fDilatedReactiveFactor = 0.0;
+    // The depth clip is stored with the masks
+    params.fDepthClipFactor = fDilatedReactiveMasks.x;
 #else
     params.fDilatedReactiveFactor = fDilatedReactiveMasks.x;
+#if FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP
+    params.fDepthClipFactor = FFXM_MIN16_F(ffxSaturate(fDepthClipOutputs.z));
+#endif
 #endif
     params.fAccumulationMask = fDilatedReactiveMasks.y;
 }
 
-void initDepthClipFactors(FFXM_PARAMETER_INOUT AccumulationPassCommonParams params)
+void initDepthClipFactors(FFXM_PARAMETER_INOUT(AccumulationPassCommonParams) params)
 {
-#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
-    const FFXM_MIN16_F2 fDilatedReactiveMasks = FFXM_MIN16_F2(SampleDilatedReactiveMasks(params.fLrUv_HwSampler));
-    params.fDepthClipFactor = fDilatedReactiveMasks.x;
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE || FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP
+    // Already read with the masks by initReactiveMaskFactors
 #else
     params.fDepthClipFactor = FFXM_MIN16_F(ffxSaturate(SampleDepthClip(params.fLrUv_HwSampler)));
 #endif
 }
 
-void initIsNewSample(FFXM_PARAMETER_INOUT AccumulationPassCommonParams params)
+void initIsNewSample(FFXM_PARAMETER_INOUT(AccumulationPassCommonParams) params)
 {
     const FfxBoolean bIsResetFrame = (0 == FrameIndex());
     params.bIsNewSample = (params.bIsExistingSample == false || bIsResetFrame);
@@ -290,6 +369,7 @@ AccumulationPassCommonParams InitParams(FfxInt32x2 iPxHrPos)
 
     params.fMotionVector = GetMotionVector(iPxHrPos, fHrUv);
     params.fHrVelocity = GetPxHrVelocity(params.fMotionVector);
+    params.bIsFoveationPeriphery = IsFoveationPeriphery(fHrUv);
 
     ComputeReprojectedUVs(params, params.fReprojectedHrUv, params.bIsExistingSample);
 
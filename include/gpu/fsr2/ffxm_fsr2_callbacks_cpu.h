@@ -0,0 +1,1247 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "./fsr2/ffxm_fsr2_resources.h"
+
+#if defined(FFXM_GPU)
+#include "./ffxm_core.h"
+#endif // #if defined(FFXM_GPU)
+
+#if defined(FFXM_GPU)
+
+// The resources and constant buffers are bound for each host thread running the pass, see BindCpuResources.
+#define FFXM_FSR2_RESOURCE thread_local
+#define FFXM_FSR2_CONSTANT_BUFFER thread_local
+
+#if FFXM_SHADER_PLATFORM_GLES_3_2
+#define FFXM_UAV_RG_QUALIFIER FfxFloat32x4
+#else
+#define FFXM_UAV_RG_QUALIFIER FfxFloat32x2
+#endif
+
+#if defined(FSR2_BIND_CB_FSR2)
+FFXM_FSR2_CONSTANT_BUFFER struct
+{
+    FfxInt32x2    iRenderSize;
+    FfxInt32x2    iMaxRenderSize;
+    FfxInt32x2    iDisplaySize;
+    FfxInt32x2    iInputColorResourceDimensions;
+    FfxInt32x2    iLumaMipDimensions;
+    FfxInt32      iLumaMipLevelToUse;
+    FfxInt32      iFrameIndex;
+
+    FfxFloat32x4  fDeviceToViewDepth;
+    FfxFloat32x2  fJitter;
+    FfxFloat32x2  fMotionVectorScale;
+    FfxFloat32x2  fDownscaleFactor;
+    FfxFloat32x2  fMotionVectorJitterCancellation;
+    FfxFloat32    fPreExposure;
+    FfxFloat32    fPreviousFramePreExposure;
+    FfxFloat32    fTanHalfFOV;
+    FfxFloat32    fJitterSequenceLength;
+    FfxFloat32    fDeltaTime;
+    FfxFloat32    fDynamicResChangeFactor;
+    FfxFloat32    fViewSpaceToMetersFactor;
+    FfxInt32      iFoveationCenterCount;
+
+    FfxFloat32x4  fFoveationCenters;
+    FfxFloat32x2  fFoveationRadiusAndFalloff;
+    FfxInt32x2    iLanczosTableSourceStep;
+    FfxInt32x4    iLanczosTableInfo;
+} cbFSR2;
+
+#define FFXM_FSR2_CONSTANT_BUFFER_1_SIZE (sizeof(cbFSR2) / 4)  // Number of 32-bit values. This must be kept in sync with the cbFSR2 size.
+
+/* Define getter functions in the order they are defined in the CB! */
+FfxInt32x2 RenderSize()
+{
+    return cbFSR2.iRenderSize;
+}
+
+FfxInt32x2 MaxRenderSize()
+{
+    return cbFSR2.iMaxRenderSize;
+}
+
+FfxInt32x2 DisplaySize()
+{
+    return cbFSR2.iDisplaySize;
+}
+
+FfxInt32x2 InputColorResourceDimensions()
+{
+    return cbFSR2.iInputColorResourceDimensions;
+}
+
+FfxInt32x2 LumaMipDimensions()
+{
+    return cbFSR2.iLumaMipDimensions;
+}
+
+FfxInt32  LumaMipLevelToUse()
+{
+    return cbFSR2.iLumaMipLevelToUse;
+}
+
+FfxInt32 FrameIndex()
+{
+    return cbFSR2.iFrameIndex;
+}
+
+FfxFloat32x2 Jitter()
+{
+    return cbFSR2.fJitter;
+}
+
+FfxFloat32x4 DeviceToViewSpaceTransformFactors()
+{
+    return cbFSR2.fDeviceToViewDepth;
+}
+
+FfxFloat32x2 MotionVectorScale()
+{
+    return cbFSR2.fMotionVectorScale;
+}
+
+FfxFloat32x2 DownscaleFactor()
+{
+    return cbFSR2.fDownscaleFactor;
+}
+
+FfxFloat32x2 MotionVectorJitterCancellation()
+{
+    return cbFSR2.fMotionVectorJitterCancellation;
+}
+
+FfxFloat32 PreExposure()
+{
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    return 1.0;
+#else
+    return cbFSR2.fPreExposure;
+#endif
+}
+
+FfxFloat32 PreviousFramePreExposure()
+{
+    return cbFSR2.fPreviousFramePreExposure;
+}
+
+FfxFloat32 TanHalfFoV()
+{
+    return cbFSR2.fTanHalfFOV;
+}
+
+FfxFloat32 JitterSequenceLength()
+{
+    return cbFSR2.fJitterSequenceLength;
+}
+
+FfxFloat32 DeltaTime()
+{
+    return cbFSR2.fDeltaTime;
+}
+
+FfxFloat32 DynamicResChangeFactor()
+{
+    return cbFSR2.fDynamicResChangeFactor;
+}
+
+FfxFloat32 ViewSpaceToMetersFactor()
+{
+    return cbFSR2.fViewSpaceToMetersFactor;
+}
+
+FfxInt32 FoveationCenterCount()
+{
+    return cbFSR2.iFoveationCenterCount;
+}
+
+FfxFloat32x4 FoveationCenters()
+{
+    return cbFSR2.fFoveationCenters;
+}
+
+FfxFloat32x2 FoveationRadiusAndFalloff()
+{
+    return cbFSR2.fFoveationRadiusAndFalloff;
+}
+
+FfxInt32x2 LanczosTableSourceStep()
+{
+    return cbFSR2.iLanczosTableSourceStep;
+}
+
+// x: first row of the jitter phase or -1 without a matching table, y/z: phase period of each axis, w: table height
+FfxInt32x4 LanczosTableInfo()
+{
+    return cbFSR2.iLanczosTableInfo;
+}
+#endif // #if defined(FSR2_BIND_CB_FSR2)
+
+#define FFXM_FSR2_CONSTANT_BUFFER_2_SIZE 6  // Number of 32-bit values. This must be kept in sync with max( cbRCAS , cbSPD) size.
+
+#if defined(FSR2_BIND_CB_RCAS)
+FFXM_FSR2_CONSTANT_BUFFER struct
+{
+    FfxUInt32x4 rcasConfig;
+} cbRCAS;
+
+FfxUInt32x4 RCASConfig()
+{
+    return cbRCAS.rcasConfig;
+}
+#endif // #if defined(FSR2_BIND_CB_RCAS)
+
+#if defined(FSR2_BIND_CB_REACTIVE)
+FFXM_FSR2_CONSTANT_BUFFER struct
+{
+    FfxFloat32   gen_reactive_scale;
+    FfxFloat32   gen_reactive_threshold;
+    FfxFloat32   gen_reactive_binaryValue;
+    FfxUInt32    gen_reactive_flags;
+} cbGenerateReactive;
+
+FfxFloat32 GenReactiveScale()
+{
+    return cbGenerateReactive.gen_reactive_scale;
+}
+
+FfxFloat32 GenReactiveThreshold()
+{
+    return cbGenerateReactive.gen_reactive_threshold;
+}
+
+FfxFloat32 GenReactiveBinaryValue()
+{
+    return cbGenerateReactive.gen_reactive_binaryValue;
+}
+
+FfxUInt32 GenReactiveFlags()
+{
+    return cbGenerateReactive.gen_reactive_flags;
+}
+#endif // #if defined(FSR2_BIND_CB_REACTIVE)
+
+#if defined(FSR2_BIND_CB_SPD)
+FFXM_FSR2_CONSTANT_BUFFER struct
+{
+    FfxUInt32   mips;
+    FfxUInt32   numWorkGroups;
+    FfxUInt32x2 workGroupOffset;
+    FfxUInt32x2 renderSize;
+} cbSPD;
+
+FfxUInt32 MipCount()
+{
+    return cbSPD.mips;
+}
+
+FfxUInt32 NumWorkGroups()
+{
+    return cbSPD.numWorkGroups;
+}
+
+FfxUInt32x2 WorkGroupOffset()
+{
+    return cbSPD.workGroupOffset;
+}
+
+FfxUInt32x2 SPD_RenderSize()
+{
+    return cbSPD.renderSize;
+}
+#endif // #if defined(FSR2_BIND_CB_SPD)
+
+    // SRVs
+    #if defined FSR2_BIND_SRV_INPUT_COLOR
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_input_color_jittered;
+    #endif
+    #if defined FSR2_BIND_SRV_INPUT_OPAQUE_ONLY
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_input_opaque_only;
+    #endif
+    #if defined FSR2_BIND_SRV_INPUT_MOTION_VECTORS
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_input_motion_vectors;
+    #endif
+    #if defined FSR2_BIND_SRV_INPUT_DEPTH
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_input_depth;
+    #endif
+    #if defined FSR2_BIND_SRV_INPUT_EXPOSURE
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x2> r_input_exposure;
+    #endif
+    #if defined FSR2_BIND_SRV_AUTO_EXPOSURE
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x2> r_auto_exposure;
+    #endif
+    #if defined FSR2_BIND_SRV_REACTIVE_MASK
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_reactive_mask;
+    #endif
+    #if defined FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_transparency_and_composition_mask;
+    #endif
+    #if defined FSR2_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxUInt32> r_reconstructed_previous_nearest_depth;
+    #endif
+    #if defined FSR2_BIND_SRV_DILATED_MOTION_VECTORS
+       FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x2> r_dilated_motion_vectors;
+    #endif
+    #if defined FSR2_BIND_SRV_PREVIOUS_DILATED_MOTION_VECTORS
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x2> r_previous_dilated_motion_vectors;
+    #endif
+    #if defined FSR2_BIND_SRV_DILATED_DEPTH
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_dilatedDepth;
+    #endif
+    #if defined FSR2_BIND_SRV_INTERNAL_UPSCALED
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_internal_upscaled_color;
+    #endif
+    #if defined FSR2_BIND_SRV_LOCK_STATUS
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x2> r_lock_status;
+    #endif
+    #if defined FSR2_BIND_SRV_LOCK_INPUT_LUMA
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_lock_input_luma;
+    #endif
+    #if defined FSR2_BIND_SRV_NEW_LOCKS
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_new_locks;
+    #endif
+    #if defined FSR2_BIND_SRV_PREPARED_INPUT_COLOR
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_prepared_input_color;
+    #endif
+    #if defined FSR2_BIND_SRV_LUMA_HISTORY
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_luma_history;
+    #endif
+    #if defined FSR2_BIND_SRV_RCAS_INPUT
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_rcas_input;
+    #endif
+    #if defined FSR2_BIND_SRV_LANCZOS_LUT
+    #if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_lanczos_lut;
+    #else
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_lanczos_lut;
+    #endif
+    #endif
+    #if defined FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_imgMips;
+    #endif
+    #if defined FSR2_BIND_SRV_UPSCALE_MAXIMUM_BIAS_LUT
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_upsample_maximum_bias_lut;
+    #endif
+    #if defined FSR2_BIND_SRV_DILATED_REACTIVE_MASKS
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x2> r_dilated_reactive_masks;
+    #endif
+
+    #if defined FSR2_BIND_SRV_TEMPORAL_REACTIVE
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32> r_internal_temporal_reactive;
+    #endif
+
+    #if defined FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_dilated_depth_motion_vectors_input_luma;
+    #endif
+    #if defined FSR2_BIND_SRV_PREV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA
+        FFXM_FSR2_RESOURCE FfxmTexture2D<FfxFloat32x4> r_prev_dilated_depth_motion_vectors_input_luma;
+    #endif
+
+    // UAV declarations
+    #if defined FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxUInt32> rw_reconstructed_previous_nearest_depth;
+    #endif
+    #if defined FSR2_BIND_UAV_DILATED_MOTION_VECTORS
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x2> rw_dilated_motion_vectors;
+    #endif
+    #if defined FSR2_BIND_UAV_DILATED_DEPTH
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32> rw_dilatedDepth;
+    #endif
+    #if defined FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x4> rw_dilated_depth_motion_vectors_input_luma;
+    #endif
+    #if defined FSR2_BIND_UAV_INTERNAL_UPSCALED
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x4> rw_internal_upscaled_color;
+    #endif
+    #if defined FSR2_BIND_UAV_LOCK_STATUS
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x2> rw_lock_status;
+    #endif
+    #if defined FSR2_BIND_UAV_LOCK_INPUT_LUMA
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32> rw_lock_input_luma;
+    #endif
+    #if defined FSR2_BIND_UAV_NEW_LOCKS
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32> rw_new_locks;
+    #endif
+    #if defined FSR2_BIND_UAV_PREPARED_INPUT_COLOR
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x4> rw_prepared_input_color;
+    #endif
+    #if defined FSR2_BIND_UAV_LUMA_HISTORY
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x4> rw_luma_history;
+    #endif
+    #if defined FSR2_BIND_UAV_UPSCALED_OUTPUT
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x4> rw_upscaled_output;
+    #endif
+    #if defined FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32> rw_img_mip_shading_change;
+    #endif
+    #if defined FSR2_BIND_UAV_EXPOSURE_MIP_5
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32> rw_img_mip_5;
+    #endif
+    #if defined FSR2_BIND_UAV_DILATED_REACTIVE_MASKS
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxFloat32x2> rw_dilated_reactive_masks;
+    #endif
+    #if defined FSR2_BIND_UAV_EXPOSURE
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FFXM_UAV_RG_QUALIFIER> rw_exposure;
+    #endif
+    #if defined FSR2_BIND_UAV_AUTO_EXPOSURE
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FFXM_UAV_RG_QUALIFIER> rw_auto_exposure;
+    #endif
+    #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<FfxUInt32> rw_spd_global_atomic;
+    #endif
+
+    #if defined FSR2_BIND_UAV_AUTOREACTIVE
+        FFXM_FSR2_RESOURCE FfxmRWTexture2D<float> rw_output_autoreactive;
+    #endif
+
+void BindCpuResources()
+{
+#if defined(FSR2_BIND_SRV_INPUT_COLOR)
+    r_input_color_jittered = ffxmCpuBindTexture(L"r_input_color_jittered");
+#endif
+#if defined(FSR2_BIND_SRV_INPUT_OPAQUE_ONLY)
+    r_input_opaque_only = ffxmCpuBindTexture(L"r_input_opaque_only");
+#endif
+#if defined(FSR2_BIND_SRV_INPUT_MOTION_VECTORS)
+    r_input_motion_vectors = ffxmCpuBindTexture(L"r_input_motion_vectors");
+#endif
+#if defined(FSR2_BIND_SRV_INPUT_DEPTH)
+    r_input_depth = ffxmCpuBindTexture(L"r_input_depth");
+#endif
+#if defined(FSR2_BIND_SRV_INPUT_EXPOSURE)
+    r_input_exposure = ffxmCpuBindTexture(L"r_input_exposure");
+#endif
+#if defined(FSR2_BIND_SRV_AUTO_EXPOSURE)
+    r_auto_exposure = ffxmCpuBindTexture(L"r_auto_exposure");
+#endif
+#if defined(FSR2_BIND_SRV_REACTIVE_MASK)
+    r_reactive_mask = ffxmCpuBindTexture(L"r_reactive_mask");
+#endif
+#if defined(FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK)
+    r_transparency_and_composition_mask = ffxmCpuBindTexture(L"r_transparency_and_composition_mask");
+#endif
+#if defined(FSR2_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
+    r_reconstructed_previous_nearest_depth = ffxmCpuBindTexture(L"r_reconstructed_previous_nearest_depth");
+#endif
+#if defined(FSR2_BIND_SRV_DILATED_MOTION_VECTORS)
+    r_dilated_motion_vectors = ffxmCpuBindTexture(L"r_dilated_motion_vectors");
+#endif
+#if defined(FSR2_BIND_SRV_PREVIOUS_DILATED_MOTION_VECTORS)
+    r_previous_dilated_motion_vectors = ffxmCpuBindTexture(L"r_previous_dilated_motion_vectors");
+#endif
+#if defined(FSR2_BIND_SRV_DILATED_DEPTH)
+    r_dilatedDepth = ffxmCpuBindTexture(L"r_dilatedDepth");
+#endif
+#if defined(FSR2_BIND_SRV_INTERNAL_UPSCALED)
+    r_internal_upscaled_color = ffxmCpuBindTexture(L"r_internal_upscaled_color");
+#endif
+#if defined(FSR2_BIND_SRV_LOCK_STATUS)
+    r_lock_status = ffxmCpuBindTexture(L"r_lock_status");
+#endif
+#if defined(FSR2_BIND_SRV_LOCK_INPUT_LUMA)
+    r_lock_input_luma = ffxmCpuBindTexture(L"r_lock_input_luma");
+#endif
+#if defined(FSR2_BIND_SRV_NEW_LOCKS)
+    r_new_locks = ffxmCpuBindTexture(L"r_new_locks");
+#endif
+#if defined(FSR2_BIND_SRV_PREPARED_INPUT_COLOR)
+    r_prepared_input_color = ffxmCpuBindTexture(L"r_prepared_input_color");
+#endif
+#if defined(FSR2_BIND_SRV_LUMA_HISTORY)
+    r_luma_history = ffxmCpuBindTexture(L"r_luma_history");
+#endif
+#if defined(FSR2_BIND_SRV_RCAS_INPUT)
+    r_rcas_input = ffxmCpuBindTexture(L"r_rcas_input");
+#endif
+#if defined(FSR2_BIND_SRV_LANCZOS_LUT)
+    r_lanczos_lut = ffxmCpuBindTexture(L"r_lanczos_lut");
+#endif
+#if defined(FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS)
+    r_imgMips = ffxmCpuBindTexture(L"r_imgMips");
+#endif
+#if defined(FSR2_BIND_SRV_UPSCALE_MAXIMUM_BIAS_LUT)
+    r_upsample_maximum_bias_lut = ffxmCpuBindTexture(L"r_upsample_maximum_bias_lut");
+#endif
+#if defined(FSR2_BIND_SRV_DILATED_REACTIVE_MASKS)
+    r_dilated_reactive_masks = ffxmCpuBindTexture(L"r_dilated_reactive_masks");
+#endif
+#if defined(FSR2_BIND_SRV_TEMPORAL_REACTIVE)
+    r_internal_temporal_reactive = ffxmCpuBindTexture(L"r_internal_temporal_reactive");
+#endif
+#if defined(FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    r_dilated_depth_motion_vectors_input_luma = ffxmCpuBindTexture(L"r_dilated_depth_motion_vectors_input_luma");
+#endif
+#if defined(FSR2_BIND_SRV_PREV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    r_prev_dilated_depth_motion_vectors_input_luma = ffxmCpuBindTexture(L"r_prev_dilated_depth_motion_vectors_input_luma");
+#endif
+#if defined(FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
+    rw_reconstructed_previous_nearest_depth = ffxmCpuBindTexture(L"rw_reconstructed_previous_nearest_depth");
+#endif
+#if defined(FSR2_BIND_UAV_DILATED_MOTION_VECTORS)
+    rw_dilated_motion_vectors = ffxmCpuBindTexture(L"rw_dilated_motion_vectors");
+#endif
+#if defined(FSR2_BIND_UAV_DILATED_DEPTH)
+    rw_dilatedDepth = ffxmCpuBindTexture(L"rw_dilatedDepth");
+#endif
+#if defined(FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    rw_dilated_depth_motion_vectors_input_luma = ffxmCpuBindTexture(L"rw_dilated_depth_motion_vectors_input_luma");
+#endif
+#if defined(FSR2_BIND_UAV_INTERNAL_UPSCALED)
+    rw_internal_upscaled_color = ffxmCpuBindTexture(L"rw_internal_upscaled_color");
+#endif
+#if defined(FSR2_BIND_UAV_LOCK_STATUS)
+    rw_lock_status = ffxmCpuBindTexture(L"rw_lock_status");
+#endif
+#if defined(FSR2_BIND_UAV_LOCK_INPUT_LUMA)
+    rw_lock_input_luma = ffxmCpuBindTexture(L"rw_lock_input_luma");
+#endif
+#if defined(FSR2_BIND_UAV_NEW_LOCKS)
+    rw_new_locks = ffxmCpuBindTexture(L"rw_new_locks");
+#endif
+#if defined(FSR2_BIND_UAV_PREPARED_INPUT_COLOR)
+    rw_prepared_input_color = ffxmCpuBindTexture(L"rw_prepared_input_color");
+#endif
+#if defined(FSR2_BIND_UAV_LUMA_HISTORY)
+    rw_luma_history = ffxmCpuBindTexture(L"rw_luma_history");
+#endif
+#if defined(FSR2_BIND_UAV_UPSCALED_OUTPUT)
+    rw_upscaled_output = ffxmCpuBindTexture(L"rw_upscaled_output");
+#endif
+#if defined(FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE)
+    rw_img_mip_shading_change = ffxmCpuBindTexture(L"rw_img_mip_shading_change");
+#endif
+#if defined(FSR2_BIND_UAV_EXPOSURE_MIP_5)
+    rw_img_mip_5 = ffxmCpuBindTexture(L"rw_img_mip_5");
+#endif
+#if defined(FSR2_BIND_UAV_DILATED_REACTIVE_MASKS)
+    rw_dilated_reactive_masks = ffxmCpuBindTexture(L"rw_dilated_reactive_masks");
+#endif
+#if defined(FSR2_BIND_UAV_EXPOSURE)
+    rw_exposure = ffxmCpuBindTexture(L"rw_exposure");
+#endif
+#if defined(FSR2_BIND_UAV_AUTO_EXPOSURE)
+    rw_auto_exposure = ffxmCpuBindTexture(L"rw_auto_exposure");
+#endif
+#if defined(FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC)
+    rw_spd_global_atomic = ffxmCpuBindTexture(L"rw_spd_global_atomic");
+#endif
+#if defined(FSR2_BIND_UAV_AUTOREACTIVE)
+    rw_output_autoreactive = ffxmCpuBindTexture(L"rw_output_autoreactive");
+#endif
+#if defined(FSR2_BIND_CB_FSR2)
+    ffxmCpuBindConstants(L"cbFSR2", &cbFSR2, sizeof(cbFSR2));
+#endif
+#if defined(FSR2_BIND_CB_RCAS)
+    ffxmCpuBindConstants(L"cbRCAS", &cbRCAS, sizeof(cbRCAS));
+#endif
+#if defined(FSR2_BIND_CB_REACTIVE)
+    ffxmCpuBindConstants(L"cbGenerateReactive", &cbGenerateReactive, sizeof(cbGenerateReactive));
+#endif
+#if defined(FSR2_BIND_CB_SPD)
+    ffxmCpuBindConstants(L"cbSPD", &cbSPD, sizeof(cbSPD));
+#endif
+}
+
+#if defined(FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS)
+FfxFloat32 LoadMipLuma(FfxUInt32x2 iPxPos, FfxUInt32 mipLevel)
+{
+    return r_imgMips.mips[mipLevel][iPxPos];
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS)
+FfxFloat32 SampleMipLuma(FfxFloat32x2 fUV, FfxUInt32 mipLevel)
+{
+    return r_imgMips.SampleLevel(s_LinearClamp, fUV, mipLevel);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INPUT_DEPTH)
+FfxFloat32 LoadInputDepth(FfxUInt32x2 iPxPos)
+{
+    return r_input_depth[iPxPos];
+}
+/*
+   dd00 (-1,1)  *------* dd10 (0,-1)
+                |      |
+                |      |
+   dd01 (-1,0)  *------* dd11 (0,0)
+*/
+void GatherInputDepthRQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd11)
+{
+    FfxFloat32x4 rrrr = r_input_depth.GatherRed(s_PointClamp, fUV);
+    dd01 = FfxFloat32(rrrr.x);
+    dd11 = FfxFloat32(rrrr.y);
+    dd10 = FfxFloat32(rrrr.z);
+    dd00 = FfxFloat32(rrrr.w);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INPUT_DEPTH)
+FfxFloat32 SampleInputDepth(FfxFloat32x2 fUV)
+{
+    return r_input_depth.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+FfxFloat32 LoadReactiveMask(FfxUInt32x2 iPxPos)
+{
+#if defined(FSR2_BIND_SRV_REACTIVE_MASK)
+    return r_reactive_mask[iPxPos];
+#else
+    return 0.0;
+#endif
+}
+/*
+   col00 (-1,1) *------* col10 (0,-1)
+                |      |
+                |      |
+   col01 (-1,0) *------* col11 (0,0)
+*/
+void GatherReactiveRQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
+{
+#if defined(FSR2_BIND_SRV_REACTIVE_MASK)
+    FFXM_MIN16_F4 rrrr = r_reactive_mask.GatherRed(s_PointClamp, fUV);
+    col01 = FFXM_MIN16_F(rrrr.x);
+    col11 = FFXM_MIN16_F(rrrr.y);
+    col10 = FFXM_MIN16_F(rrrr.z);
+    col00 = FFXM_MIN16_F(rrrr.w);
+#endif
+}
+
+FfxFloat32 LoadTransparencyAndCompositionMask(FfxUInt32x2 iPxPos)
+{
+#if defined(FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK)
+    return r_transparency_and_composition_mask[iPxPos];
+#else
+    return 0.0;
+#endif
+}
+/*
+   col00 (-1,1) *------* col10 (0,-1)
+                |      |
+                |      |
+   col01 (-1,0) *------* col11 (0,0)
+*/
+void GatherTransparencyAndCompositionMaskRQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
+{
+#if defined(FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK)
+    FFXM_MIN16_F4 rrrr = r_transparency_and_composition_mask.GatherRed(s_PointClamp, fUV);
+    col01 = FFXM_MIN16_F(rrrr.x);
+    col11 = FFXM_MIN16_F(rrrr.y);
+    col10 = FFXM_MIN16_F(rrrr.z);
+    col00 = FFXM_MIN16_F(rrrr.w);
+#endif
+}
+
+#if defined(FSR2_BIND_SRV_INPUT_COLOR)
+FFXM_MIN16_F3 LoadInputColor(FfxUInt32x2 iPxPos)
+{
+    return r_input_color_jittered[iPxPos].rgb;
+}
+/*
+   col00 (-1,1) *------* col10 (0,-1)
+                |      |
+                |      |
+   col01 (-1,0) *------* col11 (0,0)
+*/
+void GatherInputColorRGBQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col11)
+{
+    FFXM_MIN16_F4 rrrr = r_input_color_jittered.GatherRed(s_PointClamp, fUV);
+    FFXM_MIN16_F4 gggg = r_input_color_jittered.GatherGreen(s_PointClamp, fUV);
+    FFXM_MIN16_F4 bbbb = r_input_color_jittered.GatherBlue(s_PointClamp, fUV);
+    col01 = FFXM_MIN16_F3(rrrr.x, gggg.x, bbbb.x);
+    col11 = FFXM_MIN16_F3(rrrr.y, gggg.y, bbbb.y);
+    col10 = FFXM_MIN16_F3(rrrr.z, gggg.z, bbbb.z);
+    col00 = FFXM_MIN16_F3(rrrr.w, gggg.w, bbbb.w);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INPUT_COLOR)
+FFXM_MIN16_F3 SampleInputColor(FfxFloat32x2 fUV)
+{
+    return r_input_color_jittered.SampleLevel(s_LinearClamp, fUV, 0).rgb;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_PREPARED_INPUT_COLOR)
+FFXM_MIN16_F3 LoadPreparedInputColor(FfxUInt32x2 iPxPos)
+{
+    return r_prepared_input_color[iPxPos].xyz;
+}
+FFXM_MIN16_F3 SamplePreparedInputColor(FfxFloat32x2 fUV)
+{
+    return r_prepared_input_color.SampleLevel(s_PointClamp, fUV, 0).xyz;
+}
+/*
+   col00 (-1,1) *------* col10 (0,-1)
+                |      |
+                |      |
+   col01 (-1,0) *------* col11 (0,0)
+*/
+void GatherPreparedInputColorRGBQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col11)
+{
+    FFXM_MIN16_F4 rrrr = r_prepared_input_color.GatherRed(s_PointClamp, fUV);
+    FFXM_MIN16_F4 gggg = r_prepared_input_color.GatherGreen(s_PointClamp, fUV);
+    FFXM_MIN16_F4 bbbb = r_prepared_input_color.GatherBlue(s_PointClamp, fUV);
+    col01 = FFXM_MIN16_F3(rrrr.x, gggg.x, bbbb.x);
+    col11 = FFXM_MIN16_F3(rrrr.y, gggg.y, bbbb.y);
+    col10 = FFXM_MIN16_F3(rrrr.z, gggg.z, bbbb.z);
+    col00 = FFXM_MIN16_F3(rrrr.w, gggg.w, bbbb.w);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INPUT_MOTION_VECTORS)
+FFXM_MIN16_F2 LoadInputMotionVector(FfxUInt32x2 iPxDilatedMotionVectorPos)
+{
+    FFXM_MIN16_F2 fSrcMotionVector = r_input_motion_vectors[iPxDilatedMotionVectorPos].xy;
+
+    FFXM_MIN16_F2 fUvMotionVector = fSrcMotionVector * MotionVectorScale();
+
+#if FFXM_FSR2_OPTION_JITTERED_MOTION_VECTORS
+    fUvMotionVector -= MotionVectorJitterCancellation();
+#endif
+
+    return fUvMotionVector;
+}
+/*
+   col00 (-1,1) *------* col10 (0,-1)
+                |      |
+                |      |
+   col01 (-1,0) *------* col11 (0,0)
+*/
+void GatherInputMotionVectorRGQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col11)
+{
+    FFXM_MIN16_F4 rrrr = r_input_motion_vectors.GatherRed(s_PointClamp, fUV);
+    FFXM_MIN16_F4 gggg = r_input_motion_vectors.GatherGreen(s_PointClamp, fUV);
+    col01 = FFXM_MIN16_F2(rrrr.x, gggg.x) * MotionVectorScale();
+    col11 = FFXM_MIN16_F2(rrrr.y, gggg.y) * MotionVectorScale();
+    col10 = FFXM_MIN16_F2(rrrr.z, gggg.z) * MotionVectorScale();
+    col00 = FFXM_MIN16_F2(rrrr.w, gggg.w) * MotionVectorScale();
+#if FFXM_FSR2_OPTION_JITTERED_MOTION_VECTORS
+    col01 -= MotionVectorJitterCancellation();
+    col11 -= MotionVectorJitterCancellation();
+    col10 -= MotionVectorJitterCancellation();
+    col00 -= MotionVectorJitterCancellation();
+#endif
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INTERNAL_UPSCALED)
+FFXM_MIN16_F4 LoadHistory(FfxUInt32x2 iPxHistory)
+{
+    return r_internal_upscaled_color[iPxHistory];
+}
+FFXM_MIN16_F4 SampleUpscaledHistory(FfxFloat32x2 fUV)
+{
+    return r_internal_upscaled_color.SampleLevel(s_LinearClamp, fUV, 0);
+}
+/*
+   col00 (-1,1) *------* col10 (0,-1)
+                |      |
+                |      |
+   col01 (-1,0) *------* col11 (0,0)
+*/
+void GatherHistoryColorRGBQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col11)
+{
+    FFXM_MIN16_F4 rrrr = r_internal_upscaled_color.GatherRed(s_PointClamp, fUV);
+    FFXM_MIN16_F4 gggg = r_internal_upscaled_color.GatherGreen(s_PointClamp, fUV);
+    FFXM_MIN16_F4 bbbb = r_internal_upscaled_color.GatherBlue(s_PointClamp, fUV);
+    col01 = FFXM_MIN16_F4(rrrr.x, gggg.x, bbbb.x, 0.0f);
+    col11 = FFXM_MIN16_F4(rrrr.y, gggg.y, bbbb.y, 0.0f);
+    col10 = FFXM_MIN16_F4(rrrr.z, gggg.z, bbbb.z, 0.0f);
+    col00 = FFXM_MIN16_F4(rrrr.w, gggg.w, bbbb.w, 0.0f);
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_LUMA_HISTORY)
+void StoreLumaHistory(FfxUInt32x2 iPxPos, FfxFloat32x4 fLumaHistory)
+{
+    rw_luma_history[iPxPos] = fLumaHistory;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_LUMA_HISTORY)
+FFXM_MIN16_F4 SampleLumaHistory(FfxFloat32x2 fUV)
+{
+    return r_luma_history.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+FFXM_MIN16_F4 LoadRCAS_Input(FfxInt32x2 iPxPos)
+{
+#if defined(FSR2_BIND_SRV_RCAS_INPUT)
+    return r_rcas_input.Load(FfxInt32x3(iPxPos, 0));
+#else
+    return 0.0;
+#endif
+}
+
+#if defined(FSR2_BIND_UAV_INTERNAL_UPSCALED)
+void StoreReprojectedHistory(FfxUInt32x2 iPxHistory, FfxFloat32x4 fHistory)
+{
+    rw_internal_upscaled_color[iPxHistory] = fHistory;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_INTERNAL_UPSCALED)
+void StoreInternalColorAndWeight(FfxUInt32x2 iPxPos, FfxFloat32x4 fColorAndWeight)
+{
+    rw_internal_upscaled_color[iPxPos] = fColorAndWeight;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_UPSCALED_OUTPUT)
+void StoreUpscaledOutput(FfxUInt32x2 iPxPos, FfxFloat32x3 fColor)
+{
+    rw_upscaled_output[iPxPos] = FfxFloat32x4(fColor, 1.f);
+}
+#endif
+
+//LOCK_LIFETIME_REMAINING == 0
+//Should make LockInitialLifetime() return a const 1.0f later
+#if defined(FSR2_BIND_SRV_LOCK_STATUS)
+FfxFloat32x2 LoadLockStatus(FfxUInt32x2 iPxPos)
+{
+    return r_lock_status[iPxPos];
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_LOCK_STATUS)
+void StoreLockStatus(FfxUInt32x2 iPxPos, FfxFloat32x2 fLockStatus)
+{
+    rw_lock_status[iPxPos] = fLockStatus;
+}
+#endif
+
+FFXM_MIN16_F LoadLockInputLuma(FfxUInt32x2 iPxPos)
+{
+#if defined(FSR2_BIND_SRV_LOCK_INPUT_LUMA)
+    return r_lock_input_luma[iPxPos];
+#elif defined(FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    return r_dilated_depth_motion_vectors_input_luma[iPxPos].w;
+#else
+    return 0.0;
+#endif
+}
+/*
+   col00 (-1,1) *------* col10 (0,-1)
+                |      |
+                |      |
+   col01 (-1,0) *------* col11 (0,0)
+*/
+void GatherLockInputLumaRQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
+{
+    FFXM_MIN16_F4 rrrr;
+#if defined(FSR2_BIND_SRV_LOCK_INPUT_LUMA)
+    rrrr = r_lock_input_luma.GatherRed(s_PointClamp, fUV);
+#elif defined(FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    rrrr = r_dilated_depth_motion_vectors_input_luma.GatherAlpha(s_PointClamp, fUV);
+#endif
+    col01 = FFXM_MIN16_F(rrrr.x);
+    col11 = FFXM_MIN16_F(rrrr.y);
+    col10 = FFXM_MIN16_F(rrrr.z);
+    col00 = FFXM_MIN16_F(rrrr.w);
+}
+
+#if defined(FSR2_BIND_SRV_NEW_LOCKS)
+FfxFloat32 LoadNewLocks(FfxUInt32x2 iPxPos)
+{
+    return r_new_locks[iPxPos];
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_NEW_LOCKS)
+FFXM_MIN16_F LoadRwNewLocks(FfxUInt32x2 iPxPos)
+{
+    return FFXM_MIN16_F(rw_new_locks[iPxPos]);
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_NEW_LOCKS)
+void StoreNewLocks(FfxUInt32x2 iPxPos, FfxFloat32 newLock)
+{
+    rw_new_locks[iPxPos] = newLock;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_PREPARED_INPUT_COLOR)
+FfxFloat32 SampleDepthClip(FfxFloat32x2 fUV)
+{
+    return r_prepared_input_color.SampleLevel(s_LinearClamp, fUV, 0).w;
+}
+
+FfxFloat32 LoadDepthClip(FfxUInt32x2 iPxPos)
+{
+    return r_prepared_input_color[iPxPos].w;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_LOCK_STATUS)
+FFXM_MIN16_F2 SampleLockStatus(FfxFloat32x2 fUV)
+{
+    FFXM_MIN16_F2 fLockStatus = r_lock_status.SampleLevel(s_LinearClamp, fUV, 0);
+    return fLockStatus;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
+FfxFloat32 LoadReconstructedPrevDepth(FfxUInt32x2 iPxPos)
+{
+    return asfloat(r_reconstructed_previous_nearest_depth[iPxPos]);
+}
+/*
+   d00 (-1,1) *------* d10 (0,-1)
+              |      |
+              |      |
+   d01 (-1,0) *------* d11 (0,0)
+*/
+void GatherReconstructedPreviousDepthRQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d11)
+{
+    FfxUInt32x4 rrrr = r_reconstructed_previous_nearest_depth.GatherRed(s_PointClamp, fUV);
+    d01 = FfxFloat32(asfloat(rrrr.x));
+    d11 = FfxFloat32(asfloat(rrrr.y));
+    d10 = FfxFloat32(asfloat(rrrr.z));
+    d00 = FfxFloat32(asfloat(rrrr.w));
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
+void StoreReconstructedDepth(FfxUInt32x2 iPxSample, FfxFloat32 fDepth)
+{
+    FfxUInt32 uDepth = asuint(fDepth);
+
+    #if FFXM_FSR2_OPTION_INVERTED_DEPTH
+        InterlockedMax(rw_reconstructed_previous_nearest_depth[iPxSample], uDepth);
+    #else
+        InterlockedMin(rw_reconstructed_previous_nearest_depth[iPxSample], uDepth); // min for standard, max for inverted depth
+    #endif
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
+void SetReconstructedDepth(FfxUInt32x2 iPxSample, const FfxUInt32 uValue)
+{
+    rw_reconstructed_previous_nearest_depth[iPxSample] = uValue;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_DILATED_DEPTH)
+void StoreDilatedDepth(FFXM_PARAMETER_IN FfxUInt32x2 iPxPos, FFXM_PARAMETER_IN FfxFloat32 fDepth)
+{
+    rw_dilatedDepth[iPxPos] = fDepth;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_DILATED_MOTION_VECTORS)
+void StoreDilatedMotionVector(FFXM_PARAMETER_IN FfxUInt32x2 iPxPos, FFXM_PARAMETER_IN FfxFloat32x2 fMotionVector)
+{
+    rw_dilated_motion_vectors[iPxPos] = fMotionVector;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+void StoreDilatedDepthMotionVectorsInputLuma(FFXM_PARAMETER_IN FfxUInt32x2 iPxPos, FFXM_PARAMETER_IN FfxFloat32x4 fDepthMotionVectorLuma)
+{
+    rw_dilated_depth_motion_vectors_input_luma[iPxPos] = fDepthMotionVectorLuma;
+}
+#endif
+
+FFXM_MIN16_F2 LoadDilatedMotionVector(FfxUInt32x2 iPxInput)
+{
+#if defined(FSR2_BIND_SRV_DILATED_MOTION_VECTORS)
+    return r_dilated_motion_vectors[iPxInput].xy;
+#elif defined(FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    return r_dilated_depth_motion_vectors_input_luma[iPxInput].yz;
+#else
+    return FFXM_MIN16_F2(0.0, 0.0);
+#endif
+}
+
+#if defined(FSR2_BIND_SRV_PREVIOUS_DILATED_MOTION_VECTORS)
+FFXM_MIN16_F2 LoadPreviousDilatedMotionVector(FfxUInt32x2 iPxInput)
+{
+    return r_previous_dilated_motion_vectors[iPxInput].xy;
+}
+#endif
+
+FFXM_MIN16_F2 SamplePreviousDilatedMotionVector(FfxFloat32x2 uv)
+{
+#if defined(FSR2_BIND_SRV_PREVIOUS_DILATED_MOTION_VECTORS)
+    return r_previous_dilated_motion_vectors.SampleLevel(s_LinearClamp, uv, 0).xy;
+#elif defined(FSR2_BIND_SRV_PREV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    return r_prev_dilated_depth_motion_vectors_input_luma.SampleLevel(s_LinearClamp, uv, 0).yz;
+#else
+    return FFXM_MIN16_F2(0.0, 0.0);
+#endif
+}
+
+FfxFloat32 LoadDilatedDepth(FfxUInt32x2 iPxInput)
+{
+#if defined(FSR2_BIND_SRV_DILATED_DEPTH)
+    return r_dilatedDepth[iPxInput];
+#elif defined(FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    return r_dilated_depth_motion_vectors_input_luma[iPxInput].x; // R16 cast to R32
+#else
+    return 0.0;
+#endif
+}
+/*
+   dd00 (-1,1)  *------* dd10 (0,-1)
+                |      |
+                |      |
+   dd01 (-1,0)  *------* dd11 (0,0)
+*/
+void GatherDilatedDepthRQuad(FfxFloat32x2 fUV,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd11)
+{
+    FfxFloat32x4 rrrr;
+#if defined(FSR2_BIND_SRV_DILATED_DEPTH)
+    rrrr = r_dilatedDepth.GatherRed(s_PointClamp, fUV);
+#elif defined(FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    rrrr = r_dilated_depth_motion_vectors_input_luma.GatherRed(s_PointClamp, fUV);
+#endif
+    dd01 = FfxFloat32(rrrr.x);
+    dd11 = FfxFloat32(rrrr.y);
+    dd10 = FfxFloat32(rrrr.z);
+    dd00 = FfxFloat32(rrrr.w);
+}
+
+#if defined(FSR2_BIND_SRV_INPUT_EXPOSURE)
+FfxFloat32 Exposure()
+{
+    FfxFloat32 exposure = r_input_exposure[FfxUInt32x2(0, 0)].x;
+
+    if (exposure == 0.0f) {
+        exposure = 1.0f;
+    }
+
+    return exposure;
+}
+#elif defined(FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE)
+FfxFloat32 Exposure()
+{
+    return 1.0;
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_AUTO_EXPOSURE)
+FfxFloat32 AutoExposure()
+{
+    FfxFloat32 exposure = r_auto_exposure[FfxUInt32x2(0, 0)].x;
+
+    if (exposure == 0.0f) {
+        exposure = 1.0f;
+    }
+
+    return exposure;
+}
+#endif
+
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+// The weight table takes the binding of the 1D lut
+FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
+{
+    return 0.f;
+}
+
+FfxFloat32x4 SampleLanczosWeightTable(FfxFloat32x2 fUv)
+{
+#if defined(FSR2_BIND_SRV_LANCZOS_LUT)
+    return r_lanczos_lut.SampleLevel(s_LinearClamp, fUv, 0);
+#else
+    return FfxFloat32x4(0.f, 0.f, 0.f, 0.f);
+#endif
+}
+#else
+FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
+{
+#if defined(FSR2_BIND_SRV_LANCZOS_LUT)
+    return r_lanczos_lut.SampleLevel(s_LinearClamp, FfxFloat32x2(x / 2, 0.5f), 0);
+#else
+    return 0.f;
+#endif
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_UPSCALE_MAXIMUM_BIAS_LUT)
+FfxFloat32 SampleUpsampleMaximumBias(FfxFloat32x2 uv)
+{
+    // Stored as a SNORM, so make sure to multiply by 2 to retrieve the actual expected range.
+    return FfxFloat32(2.0) * r_upsample_maximum_bias_lut.SampleLevel(s_LinearClamp, abs(uv) * 2.0, 0);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_TEMPORAL_REACTIVE)
+FfxFloat32 SampleTemporalReactive(FfxFloat32x2 fUV)
+{
+    return r_internal_temporal_reactive.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_DILATED_REACTIVE_MASKS)
+FFXM_MIN16_F2 SampleDilatedReactiveMasks(FfxFloat32x2 fUV)
+{
+	return r_dilated_reactive_masks.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_DILATED_REACTIVE_MASKS)
+FFXM_MIN16_F2 LoadDilatedReactiveMasks(FFXM_PARAMETER_IN FfxUInt32x2 iPxPos)
+{
+    return r_dilated_reactive_masks[iPxPos];
+}
+#endif
+
+#if defined(FSR2_BIND_SRV_INPUT_OPAQUE_ONLY)
+FfxFloat32x3 LoadOpaqueOnly(FFXM_PARAMETER_IN FFXM_MIN16_I2 iPxPos)
+{
+    return r_input_opaque_only[iPxPos].xyz;
+}
+#endif
+
+FfxFloat32x2 SPD_LoadExposureBuffer()
+{
+#if defined FSR2_BIND_UAV_AUTO_EXPOSURE
+    return FFXM_UAV_RG_QUALIFIER(rw_auto_exposure[FfxInt32x2(0, 0)]).rg;
+#else
+    return FfxFloat32x2(0.f, 0.f);
+#endif // #if defined FSR2_BIND_UAV_AUTO_EXPOSURE
+}
+
+void SPD_SetExposureBuffer(FfxFloat32x2 value)
+{
+#if defined FSR2_BIND_UAV_AUTO_EXPOSURE
+#if FFXM_SHADER_PLATFORM_GLES_3_2
+    rw_auto_exposure[FfxInt32x2(0, 0)] = FfxInt32x4(value, 0.0f, 0.0f);
+#else
+    rw_auto_exposure[FfxInt32x2(0, 0)] = value;
+#endif
+#endif // #if defined FSR2_BIND_UAV_AUTO_EXPOSURE
+}
+
+FfxFloat32x4 SPD_LoadMipmap5(FfxInt32x2 iPxPos)
+{
+#if defined FSR2_BIND_UAV_EXPOSURE_MIP_5
+    return FfxFloat32x4(FfxFloat32(rw_img_mip_5[iPxPos]), 0, 0, 0);
+#else
+    return FfxFloat32x4(0.f, 0.f, 0.f, 0.f);
+#endif // #if defined FSR2_BIND_UAV_EXPOSURE_MIP_5
+}
+
+void SPD_SetMipmap(FfxInt32x2 iPxPos, FfxUInt32 slice, FfxFloat32 value)
+{
+    switch (slice)
+    {
+    case FFXM_FSR2_SHADING_CHANGE_MIP_LEVEL:
+#if defined FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE
+        rw_img_mip_shading_change[iPxPos] = value;
+#endif // #if defined FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE
+        break;
+    case 5:
+#if defined FSR2_BIND_UAV_EXPOSURE_MIP_5
+        rw_img_mip_5[iPxPos] = value;
+#endif // #if defined FSR2_BIND_UAV_EXPOSURE_MIP_5
+        break;
+    default:
+
+        // avoid flattened side effect
+#if defined(FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE)
+        rw_img_mip_shading_change[iPxPos] = FfxFloat32(rw_img_mip_shading_change[iPxPos]);
+#elif defined(FSR2_BIND_UAV_EXPOSURE_MIP_5)
+        rw_img_mip_5[iPxPos] = FfxFloat32(rw_img_mip_5[iPxPos]);
+#endif // #if defined FSR2_BIND_UAV_EXPOSURE_MIP_5
+        break;
+    }
+}
+
+void SPD_IncreaseAtomicCounter(FFXM_PARAMETER_INOUT(FfxUInt32) spdCounter)
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    InterlockedAdd(rw_spd_global_atomic[FfxInt32x2(0, 0)], 1, spdCounter);
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
+void SPD_ResetAtomicCounter()
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    rw_spd_global_atomic[FfxInt32x2(0, 0)] = 0;
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
+FfxUInt32 SPD_LoadAtomicCounter()
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    return FfxUInt32(rw_spd_global_atomic[FfxInt32x2(0, 0)]);
+#else
+    return 0;
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
+void SPD_StoreAtomicCounter(FfxUInt32 value)
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    rw_spd_global_atomic[FfxInt32x2(0, 0)] = value;
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
+#endif // #if defined(FFXM_GPU)
@@ -62,6 +62,12 @@
 		FfxFloat32    fDeltaTime;
 		FfxFloat32    fDynamicResChangeFactor;
 		FfxFloat32    fViewSpaceToMetersFactor;
+		FfxInt32      iFoveationCenterCount;
+
+		FfxFloat32x4  fFoveationCenters;
+		FfxFloat32x2  fFoveationRadiusAndFalloff;
+		FfxInt32x2    iLanczosTableSourceStep;
+		FfxInt32x4    iLanczosTableInfo;
 	} cbFSR2;
 
 
@@ -160,6 +166,32 @@ FfxFloat32 ViewSpaceToMetersFactor()
     return cbFSR2.fViewSpaceToMetersFactor;
 }
 
+FfxInt32 FoveationCenterCount()
+{
+    return cbFSR2.iFoveationCenterCount;
+}
+
+FfxFloat32x4 FoveationCenters()
+{
+    return cbFSR2.fFoveationCenters;
+}
+
+FfxFloat32x2 FoveationRadiusAndFalloff()
+{
+    return cbFSR2.fFoveationRadiusAndFalloff;
+}
+
+FfxInt32x2 LanczosTableSourceStep()
+{
+    return cbFSR2.iLanczosTableSourceStep;
+}
+
+// x: first row of the jitter phase or -1 without a matching table, y/z: phase period of each axis, w: table height
+FfxInt32x4 LanczosTableInfo()
+{
+    return cbFSR2.iLanczosTableInfo;
+}
+
 #endif // #if defined(FSR2_BIND_CB_FSR2)
 
 #if defined(FSR2_BIND_CB_RCAS)
@@ -321,7 +353,7 @@ layout (set = 0, binding = 1) uniform sampler s_LinearClamp;
 	layout (set = 1, binding = FSR2_BIND_UAV_DILATED_MOTION_VECTORS, rg16f)           writeonly uniform image2D  rw_dilated_motion_vectors;
 #endif
 #if defined FSR2_BIND_UAV_DILATED_DEPTH
-	layout (set = 1, binding = FSR2_BIND_UAV_DILATED_DEPTH, r16f)                     writeonly uniform image2D  rw_dilatedDepth;
+	layout (set = 1, binding = FSR2_BIND_UAV_DILATED_DEPTH, r32f)                     writeonly uniform image2D  rw_dilatedDepth;
 #endif
 #if defined FSR2_BIND_UAV_INTERNAL_UPSCALED
 	layout (set = 1, binding = FSR2_BIND_UAV_INTERNAL_UPSCALED, rgba16f)              writeonly uniform image2D  rw_internal_upscaled_color;
@@ -401,10 +433,10 @@ FfxFloat32 LoadReactiveMask(FfxInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherReactiveRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
 {
     FFXM_MIN16_F4 rrrr = FFXM_MIN16_F4(textureGather(sampler2D(r_reactive_mask, s_PointClamp), fUV, 0));
     col01 = FFXM_MIN16_F(rrrr.w);
@@ -427,10 +459,10 @@ FfxFloat32 LoadTransparencyAndCompositionMask(FfxUInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherTransparencyAndCompositionMaskRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
 {
     FFXM_MIN16_F4 rrrr = FFXM_MIN16_F4(textureGather(sampler2D(r_transparency_and_composition_mask, s_PointClamp), fUV, 0));
     col01 = FFXM_MIN16_F(rrrr.w);
@@ -453,10 +485,10 @@ FFXM_MIN16_F3 LoadInputColor(FfxInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherInputColorRGBQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col11)
 {
     FFXM_MIN16_F4 rrrr = FFXM_MIN16_F4(textureGather(sampler2D(r_input_color_jittered, s_PointClamp), fUV, 0));
     FFXM_MIN16_F4 gggg = FFXM_MIN16_F4(textureGather(sampler2D(r_input_color_jittered, s_PointClamp), fUV, 1));
@@ -488,10 +520,10 @@ FFXM_MIN16_F3 LoadPreparedInputColor(FfxInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherPreparedInputColorRGBQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col11)
 {
     FFXM_MIN16_F4 rrrr = FFXM_MIN16_F4(textureGather(sampler2D(r_prepared_input_color, s_PointClamp), fUV, 0));
     FFXM_MIN16_F4 gggg = FFXM_MIN16_F4(textureGather(sampler2D(r_prepared_input_color, s_PointClamp), fUV, 1));
@@ -524,10 +556,10 @@ FFXM_MIN16_F2 LoadInputMotionVector(FfxInt32x2 iPxDilatedMotionVectorPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherInputMotionVectorRGQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col11)
 {
     FFXM_MIN16_F4 rrrr = FFXM_MIN16_F4(textureGather(sampler2D(r_input_motion_vectors, s_PointClamp), fUV, 0));
     FFXM_MIN16_F4 gggg = FFXM_MIN16_F4(textureGather(sampler2D(r_input_motion_vectors, s_PointClamp), fUV, 1));
@@ -562,10 +594,10 @@ FFXM_MIN16_F4 SampleUpscaledHistory(FfxFloat32x2 fUV)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherHistoryColorRGBQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col11)
 {
     FFXM_MIN16_F4 rrrr = FFXM_MIN16_F4(textureGather(sampler2D(r_internal_upscaled_color, s_PointClamp), fUV, 0));
     FFXM_MIN16_F4 gggg = FFXM_MIN16_F4(textureGather(sampler2D(r_internal_upscaled_color, s_PointClamp), fUV, 1));
@@ -650,10 +682,10 @@ FFXM_MIN16_F LoadLockInputLuma(FfxInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherLockInputLumaRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
 {
     FFXM_MIN16_F4 rrrr = FFXM_MIN16_F4(textureGather(sampler2D(r_lock_input_luma, s_PointClamp), fUV, 0));
     col01 = FFXM_MIN16_F(rrrr.w);
@@ -703,6 +735,11 @@ FfxFloat32 SampleDepthClip(FfxFloat32x2 fUV)
 {
 	return textureLod(sampler2D(r_prepared_input_color, s_LinearClamp), fUV, 0.0f).w;
 }
+
+FfxFloat32 LoadDepthClip(FfxInt32x2 iPxPos)
+{
+	return texelFetch(r_prepared_input_color, iPxPos, 0).w;
+}
 #endif
 
 #if defined(FSR2_BIND_SRV_LOCK_STATUS)
@@ -733,10 +770,10 @@ FfxFloat32 LoadReconstructedPrevDepth(FfxInt32x2 iPxPos)
    d01 (-1,0) *------* d11 (0,0)
 */
 void GatherReconstructedPreviousDepthRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FfxFloat32 d00,
-    FFXM_PARAMETER_INOUT FfxFloat32 d10,
-    FFXM_PARAMETER_INOUT FfxFloat32 d01,
-    FFXM_PARAMETER_INOUT FfxFloat32 d11)
+    FFXM_PARAMETER_INOUT(FfxFloat32) d00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d11)
 {
     FfxUInt32x4 rrrr = textureGather(usampler2D(r_reconstructed_previous_nearest_depth, s_PointClamp), fUV, 0);
     d01 = FfxFloat32(uintBitsToFloat(rrrr.w));
@@ -820,10 +857,10 @@ FfxFloat32 LoadDilatedDepth(FfxInt32x2 iPxInput)
    dd01 (-1,0)  *------* dd11 (0,0)
 */
 void GatherDilatedDepthRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd00,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd10,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd01,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd11)
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd11)
 {
     FfxFloat32x4 rrrr = textureGather(sampler2D(r_dilatedDepth, s_PointClamp), fUV, 0);
     dd01 = FfxFloat32(rrrr.w);
@@ -859,6 +896,22 @@ FfxFloat32 AutoExposure()
 }
 #endif
 
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+// The weight table takes the binding of the 1D lut
+FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
+{
+    return 0.f;
+}
+
+FfxFloat32x4 SampleLanczosWeightTable(FfxFloat32x2 fUv)
+{
+#if defined(FSR2_BIND_SRV_LANCZOS_LUT)
+	return textureLod(sampler2D(r_lanczos_lut, s_LinearClamp), fUv, 0.0f);
+#else
+    return FfxFloat32x4(0.f, 0.f, 0.f, 0.f);
+#endif
+}
+#else
 FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
 {
 #if defined(FSR2_BIND_SRV_LANCZOS_LUT)
@@ -867,6 +920,7 @@ FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
     return 0.f;
 #endif
 }
+#endif
 
 #if defined(FSR2_BIND_SRV_UPSCALE_MAXIMUM_BIAS_LUT)
 FfxFloat32 SampleUpsampleMaximumBias(FfxFloat32x2 uv)
@@ -980,4 +1034,20 @@ void SPD_ResetAtomicCounter()
 #endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
 }
 
+FfxUInt32 SPD_LoadAtomicCounter()
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    return imageLoad(rw_spd_global_atomic, ivec2(0, 0)).x;
+#else
+    return 0u;
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
+void SPD_StoreAtomicCounter(FfxUInt32 value)
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    imageStore(rw_spd_global_atomic, ivec2(0, 0), uvec4(value));
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
 #endif // #if defined(FFXM_GPU)
@@ -79,6 +79,12 @@
         FfxFloat32    fDeltaTime;
         FfxFloat32    fDynamicResChangeFactor;
         FfxFloat32    fViewSpaceToMetersFactor;
+        FfxInt32      iFoveationCenterCount;
+
+        FfxFloat32x4  fFoveationCenters;
+        FfxFloat32x2  fFoveationRadiusAndFalloff;
+        FfxInt32x2    iLanczosTableSourceStep;
+        FfxInt32x4    iLanczosTableInfo;
     };
 
 #define FFXM_FSR2_CONSTANT_BUFFER_1_SIZE (sizeof(cbFSR2) / 4)  // Number of 32-bit values. This must be kept in sync with the cbFSR2 size.
@@ -182,6 +188,32 @@ FfxFloat32 ViewSpaceToMetersFactor()
 {
     return fViewSpaceToMetersFactor;
 }
+
+FfxInt32 FoveationCenterCount()
+{
+    return iFoveationCenterCount;
+}
+
+FfxFloat32x4 FoveationCenters()
+{
+    return fFoveationCenters;
+}
+
+FfxFloat32x2 FoveationRadiusAndFalloff()
+{
+    return fFoveationRadiusAndFalloff;
+}
+
+FfxInt32x2 LanczosTableSourceStep()
+{
+    return iLanczosTableSourceStep;
+}
+
+// x: first row of the jitter phase or -1 without a matching table, y/z: phase period of each axis, w: table height
+FfxInt32x4 LanczosTableInfo()
+{
+    return iLanczosTableInfo;
+}
 #endif // #if defined(FSR2_BIND_CB_FSR2)
 
 #define FFXM_FSR2_ROOTSIG_STRINGIFY(p) FFXM_FSR2_ROOTSIG_STR(p)
@@ -363,8 +395,12 @@ FfxUInt32x2 SPD_RenderSize()
         [[vk::binding(FSR2_BIND_SRV_RCAS_INPUT, 1)]] Texture2D<FfxFloat32x4> r_rcas_input : FFXM_FSR2_DECLARE_SRV(FSR2_BIND_SRV_RCAS_INPUT);
     #endif
     #if defined FSR2_BIND_SRV_LANCZOS_LUT
+    #if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+        [[vk::binding(FSR2_BIND_SRV_LANCZOS_LUT, 1)]] Texture2D<FfxFloat32x4> r_lanczos_lut : FFXM_FSR2_DECLARE_SRV(FSR2_BIND_SRV_LANCZOS_LUT);
+    #else
         [[vk::binding(FSR2_BIND_SRV_LANCZOS_LUT, 1)]] Texture2D<FfxFloat32> r_lanczos_lut : FFXM_FSR2_DECLARE_SRV(FSR2_BIND_SRV_LANCZOS_LUT);
     #endif
+    #endif
     #if defined FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS
         [[vk::binding(FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS, 1)]] Texture2D<FfxFloat32> r_imgMips : FFXM_FSR2_DECLARE_SRV(FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS);
     #endif
@@ -396,6 +432,9 @@ FfxUInt32x2 SPD_RenderSize()
     #if defined FSR2_BIND_UAV_DILATED_DEPTH
         [[vk::binding(FSR2_BIND_UAV_DILATED_DEPTH, 1)]] RWTexture2D<FfxFloat32> rw_dilatedDepth : FFXM_FSR2_DECLARE_UAV(FSR2_BIND_UAV_DILATED_DEPTH);
     #endif
+    #if defined FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA
+        [[vk::binding(FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA, 1)]] RWTexture2D<FfxFloat32x4> rw_dilated_depth_motion_vectors_input_luma : FFXM_FSR2_DECLARE_UAV(FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA);
+    #endif
     #if defined FSR2_BIND_UAV_INTERNAL_UPSCALED
         [[vk::binding(FSR2_BIND_UAV_INTERNAL_UPSCALED, 1)]] RWTexture2D<FfxFloat32x4> rw_internal_upscaled_color : FFXM_FSR2_DECLARE_UAV(FSR2_BIND_UAV_INTERNAL_UPSCALED);
     #endif
@@ -466,10 +505,10 @@ FfxFloat32 LoadInputDepth(FfxUInt32x2 iPxPos)
    dd01 (-1,0)  *------* dd11 (0,0)
 */
 void GatherInputDepthRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd00,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd10,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd01,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd11)
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd11)
 {
     FfxFloat32x4 rrrr = r_input_depth.GatherRed(s_PointClamp, fUV);
     dd01 = FfxFloat32(rrrr.x);
@@ -501,10 +540,10 @@ FfxFloat32 LoadReactiveMask(FfxUInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherReactiveRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
 {
 #if defined(FSR2_BIND_SRV_REACTIVE_MASK)
     FFXM_MIN16_F4 rrrr = r_reactive_mask.GatherRed(s_PointClamp, fUV);
@@ -530,10 +569,10 @@ FfxFloat32 LoadTransparencyAndCompositionMask(FfxUInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherTransparencyAndCompositionMaskRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
 {
 #if defined(FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK)
     FFXM_MIN16_F4 rrrr = r_transparency_and_composition_mask.GatherRed(s_PointClamp, fUV);
@@ -556,10 +595,10 @@ FFXM_MIN16_F3 LoadInputColor(FfxUInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherInputColorRGBQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col11)
 {
     FFXM_MIN16_F4 rrrr = r_input_color_jittered.GatherRed(s_PointClamp, fUV);
     FFXM_MIN16_F4 gggg = r_input_color_jittered.GatherGreen(s_PointClamp, fUV);
@@ -594,10 +633,10 @@ FFXM_MIN16_F3 SamplePreparedInputColor(FfxFloat32x2 fUV)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherPreparedInputColorRGBQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F3 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) col11)
 {
     FFXM_MIN16_F4 rrrr = r_prepared_input_color.GatherRed(s_PointClamp, fUV);
     FFXM_MIN16_F4 gggg = r_prepared_input_color.GatherGreen(s_PointClamp, fUV);
@@ -629,10 +668,10 @@ FFXM_MIN16_F2 LoadInputMotionVector(FfxUInt32x2 iPxDilatedMotionVectorPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherInputMotionVectorRGQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F2 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) col11)
 {
     FFXM_MIN16_F4 rrrr = r_input_motion_vectors.GatherRed(s_PointClamp, fUV);
     FFXM_MIN16_F4 gggg = r_input_motion_vectors.GatherGreen(s_PointClamp, fUV);
@@ -665,10 +704,10 @@ FFXM_MIN16_F4 SampleUpscaledHistory(FfxFloat32x2 fUV)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherHistoryColorRGBQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F4 col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F4) col11)
 {
     FFXM_MIN16_F4 rrrr = r_internal_upscaled_color.GatherRed(s_PointClamp, fUV);
     FFXM_MIN16_F4 gggg = r_internal_upscaled_color.GatherGreen(s_PointClamp, fUV);
@@ -757,10 +796,10 @@ FFXM_MIN16_F LoadLockInputLuma(FfxUInt32x2 iPxPos)
    col01 (-1,0) *------* col11 (0,0)
 */
 void GatherLockInputLumaRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col00,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col10,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col01,
-    FFXM_PARAMETER_INOUT FFXM_MIN16_F col11)
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col00,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col10,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col01,
+    FFXM_PARAMETER_INOUT(FFXM_MIN16_F) col11)
 {
     FFXM_MIN16_F4 rrrr;
 #if defined(FSR2_BIND_SRV_LOCK_INPUT_LUMA)
@@ -800,6 +839,11 @@ FfxFloat32 SampleDepthClip(FfxFloat32x2 fUV)
 {
     return r_prepared_input_color.SampleLevel(s_LinearClamp, fUV, 0).w;
 }
+
+FfxFloat32 LoadDepthClip(FfxUInt32x2 iPxPos)
+{
+    return r_prepared_input_color[iPxPos].w;
+}
 #endif
 
 #if defined(FSR2_BIND_SRV_LOCK_STATUS)
@@ -822,10 +866,10 @@ FfxFloat32 LoadReconstructedPrevDepth(FfxUInt32x2 iPxPos)
    d01 (-1,0) *------* d11 (0,0)
 */
 void GatherReconstructedPreviousDepthRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FfxFloat32 d00,
-    FFXM_PARAMETER_INOUT FfxFloat32 d10,
-    FFXM_PARAMETER_INOUT FfxFloat32 d01,
-    FFXM_PARAMETER_INOUT FfxFloat32 d11)
+    FFXM_PARAMETER_INOUT(FfxFloat32) d00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) d11)
 {
     FfxUInt32x4 rrrr = r_reconstructed_previous_nearest_depth.GatherRed(s_PointClamp, fUV);
     d01 = FfxFloat32(asfloat(rrrr.x));
@@ -855,6 +899,27 @@ void SetReconstructedDepth(FfxUInt32x2 iPxSample, const FfxUInt32 uValue)
 }
 #endif
 
+#if defined(FSR2_BIND_UAV_DILATED_DEPTH)
+void StoreDilatedDepth(FFXM_PARAMETER_IN FfxUInt32x2 iPxPos, FFXM_PARAMETER_IN FfxFloat32 fDepth)
+{
+    rw_dilatedDepth[iPxPos] = fDepth;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_DILATED_MOTION_VECTORS)
+void StoreDilatedMotionVector(FFXM_PARAMETER_IN FfxUInt32x2 iPxPos, FFXM_PARAMETER_IN FfxFloat32x2 fMotionVector)
+{
+    rw_dilated_motion_vectors[iPxPos] = fMotionVector;
+}
+#endif
+
+#if defined(FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+void StoreDilatedDepthMotionVectorsInputLuma(FFXM_PARAMETER_IN FfxUInt32x2 iPxPos, FFXM_PARAMETER_IN FfxFloat32x4 fDepthMotionVectorLuma)
+{
+    rw_dilated_depth_motion_vectors_input_luma[iPxPos] = fDepthMotionVectorLuma;
+}
+#endif
+
 FFXM_MIN16_F2 LoadDilatedMotionVector(FfxUInt32x2 iPxInput)
 {
 #if defined(FSR2_BIND_SRV_DILATED_MOTION_VECTORS)
@@ -901,10 +966,10 @@ FfxFloat32 LoadDilatedDepth(FfxUInt32x2 iPxInput)
    dd01 (-1,0)  *------* dd11 (0,0)
 */
 void GatherDilatedDepthRQuad(FfxFloat32x2 fUV,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd00,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd10,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd01,
-    FFXM_PARAMETER_INOUT FfxFloat32 dd11)
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd00,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd10,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd01,
+    FFXM_PARAMETER_INOUT(FfxFloat32) dd11)
 {
     FfxFloat32x4 rrrr;
 #if defined(FSR2_BIND_SRV_DILATED_DEPTH)
@@ -949,6 +1014,22 @@ FfxFloat32 AutoExposure()
 }
 #endif
 
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+// The weight table takes the binding of the 1D lut
+FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
+{
+    return 0.f;
+}
+
+FfxFloat32x4 SampleLanczosWeightTable(FfxFloat32x2 fUv)
+{
+#if defined(FSR2_BIND_SRV_LANCZOS_LUT)
+    return r_lanczos_lut.SampleLevel(s_LinearClamp, fUv, 0);
+#else
+    return FfxFloat32x4(0.f, 0.f, 0.f, 0.f);
+#endif
+}
+#else
 FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
 {
 #if defined(FSR2_BIND_SRV_LANCZOS_LUT)
@@ -957,6 +1038,7 @@ FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
     return 0.f;
 #endif
 }
+#endif
 
 #if defined(FSR2_BIND_SRV_UPSCALE_MAXIMUM_BIAS_LUT)
 FfxFloat32 SampleUpsampleMaximumBias(FfxFloat32x2 uv)
@@ -1063,4 +1145,20 @@ void SPD_ResetAtomicCounter()
 #endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
 }
 
+FfxUInt32 SPD_LoadAtomicCounter()
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    return rw_spd_global_atomic[FfxInt32x2(0, 0)];
+#else
+    return 0;
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
+void SPD_StoreAtomicCounter(FfxUInt32 value)
+{
+#if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+    rw_spd_global_atomic[FfxInt32x2(0, 0)] = value;
+#endif // #if defined FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC
+}
+
 #endif // #if defined(FFXM_GPU)
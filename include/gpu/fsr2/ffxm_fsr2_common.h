@@ -79,6 +79,7 @@ struct AccumulationPassCommonParams
     //FfxBoolean bIsResetFrame;
     FfxBoolean bIsExistingSample;
     FfxBoolean bIsNewSample;
+    FfxBoolean bIsFoveationPeriphery;
 };
 
 struct LockState
@@ -87,26 +88,26 @@ struct LockState
     FfxBoolean WasLockedPrevFrame; //Set to identify if the pixel was already locked (relock)
 };
 
-void InitializeNewLockSample(FFXM_PARAMETER_OUT FfxFloat32x2 fLockStatus)
+void InitializeNewLockSample(FFXM_PARAMETER_OUT(FfxFloat32x2) fLockStatus)
 {
     fLockStatus = FfxFloat32x2(0, 0);
 }
 
 #if FFXM_HALF
-void InitializeNewLockSample(FFXM_PARAMETER_OUT FFXM_MIN16_F2 fLockStatus)
+void InitializeNewLockSample(FFXM_PARAMETER_OUT(FFXM_MIN16_F2) fLockStatus)
 {
     fLockStatus = FFXM_MIN16_F2(0, 0);
 }
 #endif
 
 
-void KillLock(FFXM_PARAMETER_INOUT FfxFloat32x2 fLockStatus)
+void KillLock(FFXM_PARAMETER_INOUT(FfxFloat32x2) fLockStatus)
 {
     fLockStatus[LOCK_LIFETIME_REMAINING] = 0;
 }
 
 #if FFXM_HALF
-void KillLock(FFXM_PARAMETER_INOUT FFXM_MIN16_F2 fLockStatus)
+void KillLock(FFXM_PARAMETER_INOUT(FFXM_MIN16_F2) fLockStatus)
 {
     fLockStatus[LOCK_LIFETIME_REMAINING] = FFXM_MIN16_F(0);
 }
@@ -131,7 +132,7 @@ struct RectificationBoxMin16
 };
 #endif
 
-void RectificationBoxReset(FFXM_PARAMETER_INOUT RectificationBox rectificationBox)
+void RectificationBoxReset(FFXM_PARAMETER_INOUT(RectificationBox) rectificationBox)
 {
     rectificationBox.fBoxCenterWeight = FfxFloat32(0);
 
@@ -141,7 +142,7 @@ void RectificationBoxReset(FFXM_PARAMETER_INOUT RectificationBox rectificationBo
     rectificationBox.aabbMax = -FfxFloat32x3(FSR2_FLT_MAX, FSR2_FLT_MAX, FSR2_FLT_MAX);
 }
 #if FFXM_HALF
-void RectificationBoxReset(FFXM_PARAMETER_INOUT RectificationBoxMin16 rectificationBox)
+void RectificationBoxReset(FFXM_PARAMETER_INOUT(RectificationBoxMin16) rectificationBox)
 {
     rectificationBox.fBoxCenterWeight = FFXM_MIN16_F(0);
 
@@ -152,7 +153,7 @@ void RectificationBoxReset(FFXM_PARAMETER_INOUT RectificationBoxMin16 rectificat
 }
 #endif
 
-void RectificationBoxAddInitialSample(FFXM_PARAMETER_INOUT RectificationBox rectificationBox, const FfxFloat32x3 colorSample, const FfxFloat32 fSampleWeight)
+void RectificationBoxAddInitialSample(FFXM_PARAMETER_INOUT(RectificationBox) rectificationBox, const FfxFloat32x3 colorSample, const FfxFloat32 fSampleWeight)
 {
     rectificationBox.aabbMin = colorSample;
     rectificationBox.aabbMax = colorSample;
@@ -163,7 +164,7 @@ void RectificationBoxAddInitialSample(FFXM_PARAMETER_INOUT RectificationBox rect
     rectificationBox.fBoxCenterWeight = fSampleWeight;
 }
 
-void RectificationBoxAddSample(FfxBoolean bInitialSample, FFXM_PARAMETER_INOUT RectificationBox rectificationBox, const FfxFloat32x3 colorSample, const FfxFloat32 fSampleWeight)
+void RectificationBoxAddSample(FfxBoolean bInitialSample, FFXM_PARAMETER_INOUT(RectificationBox) rectificationBox, const FfxFloat32x3 colorSample, const FfxFloat32 fSampleWeight)
 {
     if (bInitialSample) {
         RectificationBoxAddInitialSample(rectificationBox, colorSample, fSampleWeight);
@@ -178,7 +179,7 @@ void RectificationBoxAddSample(FfxBoolean bInitialSample, FFXM_PARAMETER_INOUT R
     }
 }
 #if FFXM_HALF
-void RectificationBoxAddInitialSample(FFXM_PARAMETER_INOUT RectificationBoxMin16 rectificationBox, const FFXM_MIN16_F3 colorSample, const FFXM_MIN16_F fSampleWeight)
+void RectificationBoxAddInitialSample(FFXM_PARAMETER_INOUT(RectificationBoxMin16) rectificationBox, const FFXM_MIN16_F3 colorSample, const FFXM_MIN16_F fSampleWeight)
 {
     rectificationBox.aabbMin = colorSample;
     rectificationBox.aabbMax = colorSample;
@@ -189,7 +190,7 @@ void RectificationBoxAddInitialSample(FFXM_PARAMETER_INOUT RectificationBoxMin16
     rectificationBox.fBoxCenterWeight = fSampleWeight;
 }
 
-void RectificationBoxAddSample(FfxBoolean bInitialSample, FFXM_PARAMETER_INOUT RectificationBoxMin16 rectificationBox, const FFXM_MIN16_F3 colorSample, const FFXM_MIN16_F fSampleWeight)
+void RectificationBoxAddSample(FfxBoolean bInitialSample, FFXM_PARAMETER_INOUT(RectificationBoxMin16) rectificationBox, const FFXM_MIN16_F3 colorSample, const FFXM_MIN16_F fSampleWeight)
 {
     if (bInitialSample) {
         RectificationBoxAddInitialSample(rectificationBox, colorSample, fSampleWeight);
@@ -205,7 +206,7 @@ void RectificationBoxAddSample(FfxBoolean bInitialSample, FFXM_PARAMETER_INOUT R
 }
 #endif
 
-void RectificationBoxComputeVarianceBoxData(FFXM_PARAMETER_INOUT RectificationBox rectificationBox)
+void RectificationBoxComputeVarianceBoxData(FFXM_PARAMETER_INOUT(RectificationBox) rectificationBox)
 {
     rectificationBox.fBoxCenterWeight = (abs(rectificationBox.fBoxCenterWeight) > FfxFloat32(FSR2_EPSILON) ? rectificationBox.fBoxCenterWeight : FfxFloat32(1.f));
     rectificationBox.boxCenter /= rectificationBox.fBoxCenterWeight;
@@ -214,7 +215,7 @@ void RectificationBoxComputeVarianceBoxData(FFXM_PARAMETER_INOUT RectificationBo
     rectificationBox.boxVec = stdDev;
 }
 #if FFXM_HALF
-void RectificationBoxComputeVarianceBoxData(FFXM_PARAMETER_INOUT RectificationBoxMin16 rectificationBox)
+void RectificationBoxComputeVarianceBoxData(FFXM_PARAMETER_INOUT(RectificationBoxMin16) rectificationBox)
 {
     rectificationBox.fBoxCenterWeight = (abs(rectificationBox.fBoxCenterWeight) > FFXM_MIN16_F(FSR2_EPSILON) ? rectificationBox.fBoxCenterWeight : FFXM_MIN16_F(1.f));
     rectificationBox.boxCenter /= rectificationBox.fBoxCenterWeight;
@@ -343,12 +344,12 @@ FFXM_MIN16_F RGBToPerceivedLuma(FFXM_MIN16_F3 fLinearRgb)
 
 FfxFloat32x3 Tonemap(FfxFloat32x3 fRgb)
 {
-    return fRgb / (ffxMax(ffxMax(0.f, fRgb.r), ffxMax(fRgb.g, fRgb.b)) + 1.f).xxx;
+    return fRgb / ffxBroadcast3(ffxMax(ffxMax(0.f, fRgb.r), ffxMax(fRgb.g, fRgb.b)) + 1.f);
 }
 
 FfxFloat32x3 InverseTonemap(FfxFloat32x3 fRgb)
 {
-    return fRgb / ffxMax(FSR2_TONEMAP_EPSILON, 1.f - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b))).xxx;
+    return fRgb / ffxBroadcast3(ffxMax(FSR2_TONEMAP_EPSILON, 1.f - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b))));
 }
 
 #if FFXM_HALF
@@ -454,6 +455,29 @@ FFXM_MIN16_I2 ComputeHrPosFromLrPos(FFXM_MIN16_I2 iPxLrPos)
 }
 #endif
 
+// 1 in the full quality areas of a foveated output, fading to 0 in its periphery. The distances are in output heights.
+FfxFloat32 ComputeFoveationWeight(FfxFloat32x2 fUv)
+{
+    if (FoveationCenterCount() == 0)
+    {
+        return 1.0f;
+    }
+
+    const FfxFloat32x2 fAspect = FfxFloat32x2(FfxFloat32(DisplaySize().x) / FfxFloat32(DisplaySize().y), 1.0f);
+    const FfxFloat32x4 fCenters = FoveationCenters();
+    const FfxFloat32x2 fRadiusAndFalloff = FoveationRadiusAndFalloff();
+
+    // The host copies the first center over the unused one
+    const FfxFloat32 fDistance = ffxMin(length((fUv - fCenters.xy) * fAspect), length((fUv - fCenters.zw) * fAspect));
+
+    return 1.0f - ffxSaturate((fDistance - fRadiusAndFalloff.x) / ffxMax(fRadiusAndFalloff.y, FSR2_EPSILON));
+}
+
+FfxBoolean IsFoveationPeriphery(FfxFloat32x2 fUv)
+{
+    return ComputeFoveationWeight(fUv) == 0.0f;
+}
+
 FfxFloat32x2 ComputeNdc(FfxFloat32x2 fPxPos, FfxInt32x2 iSize)
 {
     return fPxPos / FfxFloat32x2(iSize) * FfxFloat32x2(2.0f, -2.0f) + FfxFloat32x2(-1.0f, 1.0f);
@@ -499,6 +523,27 @@ FfxFloat32 GetMaxDistanceInMeters()
 #endif
 }
 
+#if FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP
+// Nearest dilated depth of the 2x2 render pixels covered by a texel of the half resolution depth clip
+FfxFloat32 LoadHalfResDilatedDepth(FfxInt32x2 iPxHalfPos)
+{
+#if defined(FSR2_BIND_SRV_DILATED_DEPTH) || defined(FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA)
+    const FfxFloat32x2 fBlockCenterUv = FfxFloat32x2(iPxHalfPos * 2 + 1) / FfxFloat32x2(RenderSize());
+
+    FfxFloat32 fDepthSamples[4];
+    GatherDilatedDepthRQuad(fBlockCenterUv, fDepthSamples[0], fDepthSamples[1], fDepthSamples[2], fDepthSamples[3]);
+
+#if FFXM_FSR2_OPTION_INVERTED_DEPTH
+    return ffxMax(ffxMax(fDepthSamples[0], fDepthSamples[1]), ffxMax(fDepthSamples[2], fDepthSamples[3]));
+#else
+    return ffxMin(ffxMin(fDepthSamples[0], fDepthSamples[1]), ffxMin(fDepthSamples[2], fDepthSamples[3]));
+#endif
+#else
+    return 0.0f;
+#endif
+}
+#endif
+
 FfxFloat32x3 PrepareRgb(FfxFloat32x3 fRgb, FfxFloat32 fExposure, FfxFloat32 fPreExposure)
 {
 #if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
@@ -19,6 +19,226 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+FfxFloat32 ComputeLogLuma(FfxFloat32x2 tex)
+{
+    FfxFloat32x2 fUv = (tex + 0.5f + Jitter()) / RenderSize();
+    fUv = ClampUv(fUv, RenderSize(), InputColorResourceDimensions());
+    FfxFloat32x3 fRgb = SampleInputColor(fUv);
+
+    fRgb /= PreExposure();
+
+    //compute log luma
+    const FfxFloat32 fLogLuma = log(ffxMax(FSR2_EPSILON, RGBToLuma(fRgb)));
+
+    // Make sure out of screen pixels contribute no value to the end result
+    return all(FFXM_LESS_THAN(tex, RenderSize())) ? fLogLuma : 0.0f;
+}
+
+#if FFXM_FSR2_OPTION_SUBGROUP_LUMINANCE_PYRAMID
+
+// Each work group reduces a 64x64 tile of log luma with subgroup operations into the 2x2 texels of the shading change
+// mip and one texel of mip 5. Mip 5 then carries the tile sums to the last work group, which averages them into the
+// exposure. No other level of the pyramid is written.
+#if FFXM_FSR2_SHADING_CHANGE_MIP_LEVEL != 4
+#error The subgroup luminance pyramid writes the shading change mip from 32x32 pixel blocks, mip level 4.
+#endif
+
+#if defined(FFXM_GLSL)
+#extension GL_KHR_shader_subgroup_basic:require
+#extension GL_KHR_shader_subgroup_arithmetic:require
+#endif
+
+// The SPD atomic counter keeps in its top bit whether the exposure has converged. Converged work groups skip the
+// exposure reduction, which is then only refreshed every FSR2_EXPOSURE_CONVERGED_UPDATE_INTERVAL frames.
+#define FSR2_EXPOSURE_CONVERGED_BIT             0x80000000u
+#define FSR2_EXPOSURE_CONVERGED_UPDATE_INTERVAL 4
+#define FSR2_EXPOSURE_CONVERGED_THRESHOLD       0.01f
+
+// One entry per subgroup, subgroups have at least 4 invocations as SPD relies on quad operations
+FFXM_GROUPSHARED FfxFloat32x4 gs_LumaSubgroupSums[64];
+FFXM_GROUPSHARED FfxFloat32 gs_ExposureSubgroupSums[64];
+FFXM_GROUPSHARED FfxUInt32 gs_ExposureState;
+FFXM_GROUPSHARED FfxUInt32 gs_ExposureCounter;
+
+#if defined(FFXM_GLSL)
+FfxUInt32 SubgroupIndex(FfxUInt32 LocalThreadIndex)
+{
+    return gl_SubgroupID;
+}
+
+FfxUInt32 SubgroupCount()
+{
+    return gl_NumSubgroups;
+}
+
+FfxBoolean SubgroupIsFirstInvocation()
+{
+    return subgroupElect();
+}
+
+FfxFloat32 SubgroupSum(FfxFloat32 fValue)
+{
+    return subgroupAdd(fValue);
+}
+
+FfxFloat32x4 SubgroupSum(FfxFloat32x4 fValue)
+{
+    return subgroupAdd(fValue);
+}
+#elif defined(FFXM_HLSL) || defined(FFXM_CPU)
+FfxUInt32 SubgroupIndex(FfxUInt32 LocalThreadIndex)
+{
+    return LocalThreadIndex / WaveGetLaneCount();
+}
+
+FfxUInt32 SubgroupCount()
+{
+    return (256 + WaveGetLaneCount() - 1) / WaveGetLaneCount();
+}
+
+FfxBoolean SubgroupIsFirstInvocation()
+{
+    return WaveIsFirstLane();
+}
+
+FfxFloat32 SubgroupSum(FfxFloat32 fValue)
+{
+    return WaveActiveSum(fValue);
+}
+
+FfxFloat32x4 SubgroupSum(FfxFloat32x4 fValue)
+{
+    return WaveActiveSum(fValue);
+}
+#endif
+
+void ComputeAutoExposure(FfxUInt32x3 WorkGroupId, FfxUInt32 LocalThreadIndex)
+{
+    const FfxUInt32x2 uTile = WorkGroupId.xy + WorkGroupOffset();
+    const FfxUInt32 uSubgroup = SubgroupIndex(LocalThreadIndex);
+
+    // The 1x1 level of SPD averages the [0, 2^mips) square of the render, out of screen pixels counting as 0
+    const FfxUInt32 uExposureCoverage = 1u << MipCount();
+
+    // Each quarter of the work group covers a 32x32 block, each thread 4x4 pixels of it
+    const FfxUInt32 uQuarter = LocalThreadIndex >> 6;
+    const FfxUInt32 uQuarterThread = LocalThreadIndex & 63;
+    const FfxUInt32x2 uOrigin = uTile * 64 + FfxUInt32x2(uQuarter & 1, uQuarter >> 1) * 32 + FfxUInt32x2(uQuarterThread & 7, uQuarterThread >> 3) * 4;
+
+    FfxFloat32 fLumaSum = 0.0f;
+    FfxFloat32 fExposureSum = 0.0f;
+    for (FfxUInt32 y = 0; y < 4; ++y)
+    {
+        for (FfxUInt32 x = 0; x < 4; ++x)
+        {
+            const FfxUInt32x2 uPos = uOrigin + FfxUInt32x2(x, y);
+            const FfxFloat32 fLogLuma = ComputeLogLuma(FfxFloat32x2(uPos));
+
+            fLumaSum += fLogLuma;
+            fExposureSum += all(FFXM_LESS_THAN(uPos, FfxUInt32x2(uExposureCoverage, uExposureCoverage))) ? fLogLuma : 0.0f;
+        }
+    }
+
+    FfxFloat32x4 fQuarterSums = FfxFloat32x4(0.0f, 0.0f, 0.0f, 0.0f);
+    fQuarterSums[uQuarter] = fLumaSum;
+    fQuarterSums = SubgroupSum(fQuarterSums);
+    fExposureSum = SubgroupSum(fExposureSum);
+
+    if (SubgroupIsFirstInvocation())
+    {
+        gs_LumaSubgroupSums[uSubgroup] = fQuarterSums;
+        gs_ExposureSubgroupSums[uSubgroup] = fExposureSum;
+    }
+    if (LocalThreadIndex == 0)
+    {
+        gs_ExposureState = SPD_LoadAtomicCounter();
+    }
+    FFXM_GROUP_MEMORY_BARRIER();
+
+    if (LocalThreadIndex < 4)
+    {
+        FfxFloat32 fSum = 0.0f;
+        for (FfxUInt32 uIndex = 0; uIndex < SubgroupCount(); ++uIndex)
+        {
+            fSum += gs_LumaSubgroupSums[uIndex][LocalThreadIndex];
+        }
+        const FfxInt32x2 iMipPos = FfxInt32x2(uTile * 2 + FfxUInt32x2(LocalThreadIndex & 1, LocalThreadIndex >> 1));
+        SPD_SetMipmap(iMipPos, FFXM_FSR2_SHADING_CHANGE_MIP_LEVEL, fSum * (1.0f / 1024.0f));
+    }
+
+    const FfxBoolean bConverged = (gs_ExposureState & FSR2_EXPOSURE_CONVERGED_BIT) != 0;
+    if (bConverged && (FfxUInt32(FrameIndex()) % FSR2_EXPOSURE_CONVERGED_UPDATE_INTERVAL) != 0)
+    {
+        return;
+    }
+
+    if (LocalThreadIndex == 0)
+    {
+        FfxFloat32 fSum = 0.0f;
+        for (FfxUInt32 uIndex = 0; uIndex < SubgroupCount(); ++uIndex)
+        {
+            fSum += gs_ExposureSubgroupSums[uIndex];
+        }
+        if (all(FFXM_LESS_THAN(uTile * 64, FfxUInt32x2(uExposureCoverage, uExposureCoverage))))
+        {
+            SPD_SetMipmap(FfxInt32x2(uTile), 5, fSum * (1.0f / 4096.0f));
+        }
+        SPD_IncreaseAtomicCounter(gs_ExposureCounter);
+    }
+    FFXM_GROUP_MEMORY_BARRIER();
+
+    // Only the last work group proceeds
+    if ((gs_ExposureCounter & ~FSR2_EXPOSURE_CONVERGED_BIT) != NumWorkGroups() - 1)
+    {
+        return;
+    }
+
+    const FfxUInt32 uCoverageTiles = (uExposureCoverage + 63) / 64;
+    const FfxUInt32x2 uTiles = ffxMin((SPD_RenderSize() + 63) / 64, FfxUInt32x2(uCoverageTiles, uCoverageTiles));
+
+    FfxFloat32 fTileSum = 0.0f;
+    for (FfxUInt32 uIndex = LocalThreadIndex; uIndex < uTiles.x * uTiles.y; uIndex += 256)
+    {
+        fTileSum += SPD_LoadMipmap5(FfxInt32x2(uIndex % uTiles.x, uIndex / uTiles.x)).x;
+    }
+    fTileSum = SubgroupSum(fTileSum);
+    if (SubgroupIsFirstInvocation())
+    {
+        gs_ExposureSubgroupSums[uSubgroup] = fTileSum;
+    }
+    FFXM_GROUP_MEMORY_BARRIER();
+
+    if (LocalThreadIndex == 0)
+    {
+        FfxFloat32 fSum = 0.0f;
+        for (FfxUInt32 uIndex = 0; uIndex < SubgroupCount(); ++uIndex)
+        {
+            fSum += gs_ExposureSubgroupSums[uIndex];
+        }
+        const FfxFloat32 fLavg = fSum * (4096.0f / (FfxFloat32(uExposureCoverage) * FfxFloat32(uExposureCoverage)));
+
+        const FfxFloat32 fPrev = SPD_LoadExposureBuffer().y;
+        FfxFloat32 fResult = fLavg;
+
+        // If running with GLES 3.2, remove the smooth exposure transition.
+#if !FFXM_SHADER_PLATFORM_GLES_3_2
+        if (fPrev < resetAutoExposureAverageSmoothing) // Compare Lavg, so small or negative values
+        {
+            // Converged updates account for the frames skipped since the previous one
+            const FfxFloat32 fRate = 1.0f;
+            const FfxFloat32 fElapsed = DeltaTime() * FfxFloat32(bConverged ? FSR2_EXPOSURE_CONVERGED_UPDATE_INTERVAL : 1);
+            fResult = fPrev + (fLavg - fPrev) * (1 - exp(-fElapsed * fRate));
+        }
+#endif
+        SPD_SetExposureBuffer(FfxFloat32x2(ComputeAutoExposureFromLavg(fResult), fResult));
+
+        const FfxBoolean bNowConverged = fPrev < resetAutoExposureAverageSmoothing && abs(fLavg - fPrev) < FSR2_EXPOSURE_CONVERGED_THRESHOLD;
+        SPD_StoreAtomicCounter(bNowConverged ? FSR2_EXPOSURE_CONVERGED_BIT : 0u);
+    }
+}
+
+#else
+
 FFXM_GROUPSHARED FfxUInt32 spdCounter;
 
 void SpdIncreaseAtomicCounter(FfxUInt32 slice)
@@ -44,19 +264,7 @@ FFXM_GROUPSHARED FfxFloat32 spdIntermediateA[16][16];
 
 FfxFloat32x4 SpdLoadSourceImage(FfxFloat32x2 tex, FfxUInt32 slice)
 {
-    FfxFloat32x2 fUv = (tex + 0.5f + Jitter()) / RenderSize();
-    fUv = ClampUv(fUv, RenderSize(), InputColorResourceDimensions());
-    FfxFloat32x3 fRgb = SampleInputColor(fUv);
-
-    fRgb /= PreExposure();
-
-    //compute log luma
-    const FfxFloat32 fLogLuma = log(ffxMax(FSR2_EPSILON, RGBToLuma(fRgb)));
-
-    // Make sure out of screen pixels contribute no value to the end result
-    const FfxFloat32 result = all(FFXM_LESS_THAN(tex, RenderSize())) ? fLogLuma : 0.0f;
-
-    return FfxFloat32x4(result, 0, 0, 0);
+    return FfxFloat32x4(ComputeLogLuma(tex), 0, 0, 0);
 }
 
 FfxFloat32x4 SpdLoad(FfxInt32x2 tex, FfxUInt32 slice)
@@ -209,3 +417,5 @@ void ComputeAutoExposure(FfxUInt32x3 WorkGroupId, FfxUInt32 LocalThreadIndex)
         FfxUInt32x2(WorkGroupOffset()));
 #endif
 }
+
+#endif // #if FFXM_FSR2_OPTION_SUBGROUP_LUMINANCE_PYRAMID
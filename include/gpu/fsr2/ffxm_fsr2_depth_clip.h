@@ -205,12 +205,12 @@ FfxFloat32 ComputeTemporalMotionDivergence(FfxInt32x2 iPxPos)
 }
 
 #if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
-void PreProcessReactiveMasks(FfxInt32x2 iPxLrPos, FfxFloat32 fMotionDivergence, FFXM_PARAMETER_INOUT DepthClipOutputs results)
+void PreProcessReactiveMasks(FfxInt32x2 iPxLrPos, FfxFloat32 fMotionDivergence, FFXM_PARAMETER_INOUT(DepthClipOutputs) results)
 {
     results.fDilatedReactiveMasks = FfxInt32x2(0.0, fMotionDivergence);
 }
 #else
-void PreProcessReactiveMasks(FfxInt32x2 iPxLrPos, FfxFloat32 fMotionDivergence, FFXM_PARAMETER_INOUT DepthClipOutputs results)
+void PreProcessReactiveMasks(FfxInt32x2 iPxLrPos, FfxFloat32 fMotionDivergence, FFXM_PARAMETER_INOUT(DepthClipOutputs) results)
 {
     // Compensate for bilinear sampling in accumulation pass
 
@@ -321,26 +321,50 @@ FfxFloat32 EvaluateSurface(FfxInt32x2 iPxPos, FfxFloat32x2 fMotionVector)
     return 1.0f - FfxFloat32(((d0 - d1) > (d1 * 0.01f)) && ((d1 - d2) > (d2 * 0.01f)));
 }
 
-DepthClipOutputs DepthClip(FfxInt32x2 iPxPos)
+DepthClipOutputs DepthClip(FfxInt32x2 iPxFragmentPos)
 {
+#if FFXM_SHADER_QUALITY_OPT_HALF_RES_DEPTH_CLIP
+    // One fragment per 2x2 render pixels. The depth clip is evaluated at the center of the block, with the nearest
+    // depth and the average motion of its pixels, and the surface test of its diagonal pixels. The reactive masks and
+    // the divergences are dilated from its top left pixel.
+    const FfxInt32x2 iPxPos = iPxFragmentPos * 2;
+    const FfxInt32x2 iRenderSize = RenderSize();
+
+    FfxFloat32x2 fDepthUv = FfxFloat32x2(iPxPos + 1) / FfxFloat32x2(iRenderSize);
+    FfxFloat32x2 fMotionVector = (LoadDilatedMotionVector(iPxPos)
+        + LoadDilatedMotionVector(ClampLoad(iPxPos, FfxInt32x2(1, 0), iRenderSize))
+        + LoadDilatedMotionVector(ClampLoad(iPxPos, FfxInt32x2(0, 1), iRenderSize))
+        + LoadDilatedMotionVector(ClampLoad(iPxPos, FfxInt32x2(1, 1), iRenderSize))) * 0.25f;
+    const FfxFloat32 fDilatedDepth = LoadHalfResDilatedDepth(iPxFragmentPos);
+    const FfxFloat32 fSurface = (EvaluateSurface(iPxPos, fMotionVector) + EvaluateSurface(ClampLoad(iPxPos, FfxInt32x2(1, 1), iRenderSize), fMotionVector)) * 0.5f;
+#else
+    const FfxInt32x2 iPxPos = iPxFragmentPos;
+
     FfxFloat32x2 fDepthUv = (iPxPos + 0.5f) / RenderSize();
     FfxFloat32x2 fMotionVector = LoadDilatedMotionVector(iPxPos);
+    const FfxFloat32 fDilatedDepth = LoadDilatedDepth(iPxPos);
+    const FfxFloat32 fSurface = EvaluateSurface(iPxPos, fMotionVector);
+#endif
 
     // Discard tiny mvs
     fMotionVector *= FfxFloat32(length(fMotionVector * DisplaySize()) > 0.01f);
 
     const FfxFloat32x2 fDilatedUv = fDepthUv + fMotionVector;
-    const FfxFloat32 fDilatedDepth = LoadDilatedDepth(iPxPos);
     const FfxFloat32 fCurrentDepthViewSpace = GetViewSpaceDepth(LoadInputDepth(iPxPos));
 
     DepthClipOutputs results;
     results.fDilatedReactiveMasks = FfxFloat32x2(0.0, 0.0);
 
     // Compute prepared input color and depth clip
-    FfxFloat32 fDepthClip = ComputeDepthClip(fDilatedUv, fDilatedDepth) * EvaluateSurface(iPxPos, fMotionVector);
+    FfxFloat32 fDepthClip = ComputeDepthClip(fDilatedUv, fDilatedDepth) * fSurface;
 #if !FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#if FFXM_SHADER_QUALITY_OPT_ACCUMULATE_PREPARES_INPUT_COLOR
+    // The accumulation prepares the input color, only the depth clip is written
+    results.fTonemapped = FfxFloat32x4(0.0f, 0.0f, 0.0f, fDepthClip);
+#else
     FfxFloat32x3 fPreparedYCoCg = ComputePreparedInputColor(iPxPos);
     results.fTonemapped = FfxFloat32x4(fPreparedYCoCg, fDepthClip);
+#endif
 #endif
 
     // Compute dilated reactive mask
@@ -22,7 +22,7 @@
 #ifndef FFXM_FSR2_LOCK_H
 #define FFXM_FSR2_LOCK_H
 
-void ClearResourcesForNextFrame(in FfxInt32x2 iPxHrPos)
+void ClearResourcesForNextFrame(FFXM_PARAMETER_IN FfxInt32x2 iPxHrPos)
 {
     if (all(FFXM_LESS_THAN(iPxHrPos, FfxInt32x2(RenderSize()))))
     {
@@ -35,11 +35,11 @@ void ClearResourcesForNextFrame(in FfxInt32x2 iPxHrPos)
     }
 }
 
-FfxBoolean ComputeThinFeatureConfidence(FfxInt32x2 pos)
+FfxBoolean ComputeThinFeatureConfidence(FFXM_MIN16_F lumaSamples[9])
 {
     const FfxInt32 RADIUS = 1;
 
-    FFXM_MIN16_F fNucleus = LoadLockInputLuma(pos);
+    FFXM_MIN16_F fNucleus = lumaSamples[4];
 
     FFXM_MIN16_F similar_threshold = FFXM_MIN16_F(1.05f);
     FFXM_MIN16_F dissimilarLumaMin = FFXM_MIN16_F(FSR2_FP16_MAX);
@@ -63,22 +63,6 @@ FfxBoolean ComputeThinFeatureConfidence(FfxInt32x2 pos)
         SETBIT(4) | SETBIT(5) | SETBIT(7) | SETBIT(8), //Lower right
     };
 
-    FFXM_MIN16_F lumaSamples [9];
-    FFXM_MIN16_F fTmpDummy = FFXM_MIN16_F(0.0f);
-    const FfxFloat32x2 fInputLumaSize = FfxFloat32x2(RenderSize());
-    const FfxFloat32x2 fPxBaseUv = FfxFloat32x2(pos) / fInputLumaSize;
-    const FfxFloat32x2 fUnitUv = FfxFloat32x2(1.0f, 1.0f) / fInputLumaSize;
-
-    // Gather samples
-    GatherLockInputLumaRQuad(fPxBaseUv,
-        lumaSamples[0], lumaSamples[1],
-        lumaSamples[3], lumaSamples[4]);
-    GatherLockInputLumaRQuad(fUnitUv + fPxBaseUv,
-        fTmpDummy, lumaSamples[5],
-        lumaSamples[7], lumaSamples[8]);
-    lumaSamples[2] = LoadLockInputLuma(pos + FfxInt32x2(1, -1));
-    lumaSamples[6] = LoadLockInputLuma(pos + FfxInt32x2(-1, 1));
-
     FfxInt32 idx = 0;
     FFXM_UNROLL
     for (FfxInt32 y = -RADIUS; y <= RADIUS; y++) {
@@ -118,14 +102,92 @@ FfxBoolean ComputeThinFeatureConfidence(FfxInt32x2 pos)
     return true;
 }
 
-void ComputeLock(FfxInt32x2 iPxLrPos)
+void ComputeNewLock(FfxInt32x2 iPxLrPos, FFXM_MIN16_F lumaSamples[9])
 {
-    if (ComputeThinFeatureConfidence(iPxLrPos))
+    // The periphery of a foveated output is not locked
+    const FfxFloat32x2 fLrUv = (FfxFloat32x2(iPxLrPos) + 0.5f) / FfxFloat32x2(RenderSize());
+    if (IsFoveationPeriphery(fLrUv) == false)
     {
-        StoreNewLocks(ComputeHrPosFromLrPos(iPxLrPos), 1.f);
+        if (ComputeThinFeatureConfidence(lumaSamples))
+        {
+            StoreNewLocks(ComputeHrPosFromLrPos(iPxLrPos), 1.f);
+        }
+    }
+}
+
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+
+// Lock input luma of the thread group and of a one pixel border around it
+#define FSR2_LOCK_TILE_WIDTH (FFXM_FSR2_THREAD_GROUP_WIDTH + 2)
+#define FSR2_LOCK_TILE_HEIGHT (FFXM_FSR2_THREAD_GROUP_HEIGHT + 2)
+FFXM_GROUPSHARED FfxFloat32 gs_LockInputLuma[FSR2_LOCK_TILE_HEIGHT][FSR2_LOCK_TILE_WIDTH];
+
+// Dilates the inputs, reconstructs the previous depth and computes the new locks of one thread group.
+// The reconstructed depth is reset by a clear ahead of this pass rather than after the depth clip.
+void ReconstructAndLock(FfxInt32x2 iGroupOrigin, FfxInt32x2 iGroupThreadId)
+{
+    const FfxInt32 iThreadIndex = iGroupThreadId.y * FFXM_FSR2_THREAD_GROUP_WIDTH + iGroupThreadId.x;
+    for (FfxInt32 iTileIndex = iThreadIndex; iTileIndex < FSR2_LOCK_TILE_WIDTH * FSR2_LOCK_TILE_HEIGHT; iTileIndex += FFXM_FSR2_THREAD_GROUP_WIDTH * FFXM_FSR2_THREAD_GROUP_HEIGHT)
+    {
+        const FfxInt32x2 iTilePos = FfxInt32x2(iTileIndex % FSR2_LOCK_TILE_WIDTH, iTileIndex / FSR2_LOCK_TILE_WIDTH);
+        const FfxInt32x2 iPxPos = clamp(iGroupOrigin + iTilePos - FfxInt32x2(1, 1), FfxInt32x2(0, 0), FfxInt32x2(RenderSize()) - FfxInt32x2(1, 1));
+        gs_LockInputLuma[iTilePos.y][iTilePos.x] = ComputeLockInputLuma(iPxPos);
+    }
+    FFXM_GROUP_MEMORY_BARRIER();
+
+    const FfxInt32x2 iPxLrPos = iGroupOrigin + iGroupThreadId;
+    if (IsOnScreen(iPxLrPos, RenderSize()))
+    {
+        FfxFloat32 fDilatedDepth;
+        FfxFloat32x2 fDilatedMotionVector;
+        DilateAndReconstructPrevDepth(iPxLrPos, fDilatedDepth, fDilatedMotionVector);
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+        const FfxFloat32 fLockInputLuma = gs_LockInputLuma[iGroupThreadId.y + 1][iGroupThreadId.x + 1];
+        StoreDilatedDepthMotionVectorsInputLuma(iPxLrPos, FfxFloat32x4(fDilatedDepth, fDilatedMotionVector, fLockInputLuma));
+#else
+        StoreDilatedDepth(iPxLrPos, fDilatedDepth);
+        StoreDilatedMotionVector(iPxLrPos, fDilatedMotionVector);
+#endif
+
+        FFXM_MIN16_F lumaSamples[9];
+        FFXM_UNROLL
+        for (FfxInt32 y = 0; y < 3; y++) {
+            FFXM_UNROLL
+            for (FfxInt32 x = 0; x < 3; x++) {
+                lumaSamples[y * 3 + x] = FFXM_MIN16_F(gs_LockInputLuma[iGroupThreadId.y + y][iGroupThreadId.x + x]);
+            }
+        }
+
+        ComputeNewLock(iPxLrPos, lumaSamples);
     }
+}
+
+#else
+
+void ComputeLock(FfxInt32x2 iPxLrPos)
+{
+    FFXM_MIN16_F lumaSamples [9];
+    FFXM_MIN16_F fTmpDummy = FFXM_MIN16_F(0.0f);
+    const FfxFloat32x2 fInputLumaSize = FfxFloat32x2(RenderSize());
+    const FfxFloat32x2 fPxBaseUv = FfxFloat32x2(iPxLrPos) / fInputLumaSize;
+    const FfxFloat32x2 fUnitUv = FfxFloat32x2(1.0f, 1.0f) / fInputLumaSize;
+
+    // Gather samples
+    GatherLockInputLumaRQuad(fPxBaseUv,
+        lumaSamples[0], lumaSamples[1],
+        lumaSamples[3], fTmpDummy);
+    GatherLockInputLumaRQuad(fUnitUv + fPxBaseUv,
+        fTmpDummy, lumaSamples[5],
+        lumaSamples[7], lumaSamples[8]);
+    lumaSamples[2] = LoadLockInputLuma(iPxLrPos + FfxInt32x2(1, -1));
+    lumaSamples[4] = LoadLockInputLuma(iPxLrPos);
+    lumaSamples[6] = LoadLockInputLuma(iPxLrPos + FfxInt32x2(-1, 1));
+
+    ComputeNewLock(iPxLrPos, lumaSamples);
 
     ClearResourcesForNextFrame(iPxLrPos);
 }
 
+#endif // FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+
 #endif // FFXM_FSR2_LOCK_H
@@ -61,10 +61,10 @@ FfxFloat32 GetShadingChangeLuma(FfxInt32x2 iPxHrPos, FfxFloat32x2 fUvCoord)
 }
 
 void UpdateLockStatus(AccumulationPassCommonParams params,
-    FFXM_PARAMETER_INOUT FfxFloat32 fReactiveFactor, LockState state,
-    FFXM_PARAMETER_INOUT FfxFloat32x2 fLockStatus,
-    FFXM_PARAMETER_OUT FfxFloat32 fLockContributionThisFrame,
-    FFXM_PARAMETER_OUT FfxFloat32 fLuminanceDiff) {
+    FFXM_PARAMETER_INOUT(FfxFloat32) fReactiveFactor, LockState state,
+    FFXM_PARAMETER_INOUT(FfxFloat32x2) fLockStatus,
+    FFXM_PARAMETER_OUT(FfxFloat32) fLockContributionThisFrame,
+    FFXM_PARAMETER_OUT(FfxFloat32) fLuminanceDiff) {
 
     const FfxFloat32 fShadingChangeLuma = GetShadingChangeLuma(params.iPxHrPos, params.fHrUv);
 
@@ -43,7 +43,7 @@ FfxFloat16x4 FsrRcasLoadH(FfxInt16x2 p)
     fColor.rgb = FfxFloat16x3(PrepareRgb(fColor.rgb, Exposure(), PreExposure()));
     return fColor;
 }
-void FsrRcasInputH(inout FfxFloat16 r,inout FfxFloat16 g,inout FfxFloat16 b)
+void FsrRcasInputH(FFXM_PARAMETER_INOUT(FfxFloat16) r,FFXM_PARAMETER_INOUT(FfxFloat16) g,FFXM_PARAMETER_INOUT(FfxFloat16) b)
 {
 
 }
@@ -58,13 +58,21 @@ FfxFloat32x4 FsrRcasLoadF(FfxInt32x2 p)
 
     return fColor;
 }
-void FsrRcasInputF(inout FfxFloat32 r, inout FfxFloat32 g, inout FfxFloat32 b) {}
+void FsrRcasInputF(FFXM_PARAMETER_INOUT(FfxFloat32) r, FFXM_PARAMETER_INOUT(FfxFloat32) g, FFXM_PARAMETER_INOUT(FfxFloat32) b) {}
 #endif
 
 #include "./fsr1/ffxm_fsr1.h"
 
-void CurrFilter(FFXM_MIN16_U2 pos, FFXM_PARAMETER_INOUT RCASOutputs results)
+void CurrFilter(FFXM_MIN16_U2 pos, FFXM_PARAMETER_INOUT(RCASOutputs) results)
 {
+    // The periphery of a foveated output is left unsharpened, the sharpening fades out towards it
+    const FfxFloat32 fFoveationWeight = ComputeFoveationWeight((FfxFloat32x2(pos) + 0.5f) / FfxFloat32x2(DisplaySize()));
+    if (fFoveationWeight == 0.0f)
+    {
+        results.fUpscaledColor = FfxFloat32x3(LoadRCAS_Input(FfxInt32x2(pos)).rgb);
+        return;
+    }
+
 #if USE_FSR_RCASH
     FfxFloat16x3 c;
     FsrRcasH(c.r, c.g, c.b, pos, RCASConfig());
@@ -77,6 +85,11 @@ void CurrFilter(FFXM_MIN16_U2 pos, FFXM_PARAMETER_INOUT RCASOutputs results)
     c = UnprepareRgb(c, Exposure());
 #endif
     results.fUpscaledColor = c;
+
+    if (fFoveationWeight < 1.0f)
+    {
+        results.fUpscaledColor = ffxLerp(FfxFloat32x3(LoadRCAS_Input(FfxInt32x2(pos)).rgb), results.fUpscaledColor, fFoveationWeight);
+    }
 }
 
 RCASOutputs RCAS(FfxUInt32x2 gxy)
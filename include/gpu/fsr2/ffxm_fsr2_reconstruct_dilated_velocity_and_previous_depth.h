@@ -56,7 +56,7 @@ void ReconstructPrevDepth(FfxInt32x2 iPxPos, FfxFloat32 fDepth, FfxFloat32x2 fMo
     }
 }
 
-void FindNearestDepth(FFXM_PARAMETER_IN FfxInt32x2 iPxPos, FFXM_PARAMETER_IN FfxInt32x2 iPxSize, FFXM_PARAMETER_OUT FfxFloat32 fNearestDepth, FFXM_PARAMETER_OUT FfxInt32x2 fNearestDepthCoord)
+void FindNearestDepth(FFXM_PARAMETER_IN FfxInt32x2 iPxPos, FFXM_PARAMETER_IN FfxInt32x2 iPxSize, FFXM_PARAMETER_OUT(FfxFloat32) fNearestDepth, FFXM_PARAMETER_OUT(FfxInt32x2) fNearestDepthCoord)
 {
     const FfxInt32 iSampleCount = 9;
     const FfxInt32x2 iSampleOffsets[iSampleCount] = {
@@ -123,9 +123,8 @@ FfxFloat32 ComputeLockInputLuma(FfxInt32x2 iPxLrPos)
     return fLockInputLuma;
 }
 
-ReconstructPrevDepthOutputs ReconstructAndDilate(FfxInt32x2 iPxLrPos)
+void DilateAndReconstructPrevDepth(FfxInt32x2 iPxLrPos, FFXM_PARAMETER_OUT(FfxFloat32) fDilatedDepth, FFXM_PARAMETER_OUT(FfxFloat32x2) fDilatedMotionVector)
 {
-    FfxFloat32 fDilatedDepth;
     FfxInt32x2 iNearestDepthCoord;
 
     FindNearestDepth(iPxLrPos, RenderSize(), fDilatedDepth, iNearestDepthCoord);
@@ -138,13 +137,16 @@ ReconstructPrevDepthOutputs ReconstructAndDilate(FfxInt32x2 iPxLrPos)
     FfxInt32x2 iMotionVectorPos = ComputeHrPosFromLrPos(iNearestDepthCoord);
 #endif
 
-    FfxFloat32x2 fDilatedMotionVector = LoadInputMotionVector(iMotionVectorPos);
+    fDilatedMotionVector = LoadInputMotionVector(iMotionVectorPos);
+
+    ReconstructPrevDepth(iPxLrPos, fDilatedDepth, fDilatedMotionVector, RenderSize());
+}
 
+ReconstructPrevDepthOutputs ReconstructAndDilate(FfxInt32x2 iPxLrPos)
+{
     ReconstructPrevDepthOutputs results;
 
-    results.fDepth = fDilatedDepth;
-    results.fMotionVector = fDilatedMotionVector;
-    ReconstructPrevDepth(iPxLrPos, fDilatedDepth, fDilatedMotionVector, RenderSize());
+    DilateAndReconstructPrevDepth(iPxLrPos, results.fDepth, results.fMotionVector);
     FfxFloat32 fLockInputLuma = ComputeLockInputLuma(iPxLrPos);
     results.fLuma = fLockInputLuma;
 
@@ -70,7 +70,7 @@ struct CatmullRomSamples9Tap
     FFXM_MIN16_F FinalMultiplier;
 };
 
-CatmullRomSamples9Tap Get2DCatmullRom9Kernel(FfxFloat32x2 uv, FfxFloat32x2 size, in FfxFloat32x2 invSize)
+CatmullRomSamples9Tap Get2DCatmullRom9Kernel(FfxFloat32x2 uv, FfxFloat32x2 size, FFXM_PARAMETER_IN FfxFloat32x2 invSize)
 {
     CatmullRomSamples9Tap catmullSamples;
     FfxFloat32x2 samplePos = uv * size;
@@ -152,7 +152,7 @@ struct CatmullRomSamples
     FFXM_MIN16_F FinalMultiplier;
 };
 
-void Bicubic2DCatmullRom(in FfxFloat32x2 uv, in FfxFloat32x2 size, in FfxFloat32x2 invSize, FFXM_PARAMETER_OUT FfxFloat32x2 samples[3], FFXM_PARAMETER_OUT FfxFloat32x2 weights[3])
+void Bicubic2DCatmullRom(FFXM_PARAMETER_IN FfxFloat32x2 uv, FFXM_PARAMETER_IN FfxFloat32x2 size, FFXM_PARAMETER_IN FfxFloat32x2 invSize, FFXM_PARAMETER_OUT_ARRAY(FfxFloat32x2, samples, 3), FFXM_PARAMETER_OUT_ARRAY(FfxFloat32x2, weights, 3))
 {
     uv *= size;
     FfxFloat32x2 tc = floor(uv - 0.5) + 0.5;
@@ -176,7 +176,7 @@ void Bicubic2DCatmullRom(in FfxFloat32x2 uv, in FfxFloat32x2 size, in FfxFloat32
     weights[2] = w3;
 }
 
-CatmullRomSamples GetBicubic2DCatmullRomSamples(FfxFloat32x2 uv, FfxFloat32x2 size, in FfxFloat32x2 invSize)
+CatmullRomSamples GetBicubic2DCatmullRomSamples(FfxFloat32x2 uv, FfxFloat32x2 size, FFXM_PARAMETER_IN FfxFloat32x2 invSize)
 {
     FfxFloat32x2 weights[3];
     FfxFloat32x2 samples[3];
@@ -305,7 +305,7 @@ FfxBoolean IsUvInside(FfxFloat32x2 fUv)
     return (fUv.x >= 0.0f && fUv.x <= 1.0f) && (fUv.y >= 0.0f && fUv.y <= 1.0f);
 }
 
-void ComputeReprojectedUVs(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT FfxFloat32x2 fReprojectedHrUv, FFXM_PARAMETER_OUT FfxBoolean bIsExistingSample)
+void ComputeReprojectedUVs(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT(FfxFloat32x2) fReprojectedHrUv, FFXM_PARAMETER_OUT(FfxBoolean) bIsExistingSample)
 {
     fReprojectedHrUv = params.fHrUv + params.fMotionVector;
 
@@ -313,9 +313,18 @@ void ComputeReprojectedUVs(const AccumulationPassCommonParams params, FFXM_PARAM
 }
 
 #if !FFXM_HALF
-void ReprojectHistoryColor(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT FfxFloat32x3 fHistoryColor, FFXM_PARAMETER_OUT FfxFloat32 fTemporalReactiveFactor, FFXM_PARAMETER_OUT FfxBoolean bInMotionLastFrame)
+void ReprojectHistoryColor(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT(FfxFloat32x3) fHistoryColor, FFXM_PARAMETER_OUT(FfxFloat32) fTemporalReactiveFactor, FFXM_PARAMETER_OUT(FfxBoolean) bInMotionLastFrame)
 {
-    FfxFloat32x4 fHistory = HistorySample(params.fReprojectedHrUv, DisplaySize());
+    // The periphery of a foveated output makes do with a bilinear fetch
+    FfxFloat32x4 fHistory;
+    if (params.bIsFoveationPeriphery)
+    {
+        fHistory = FfxFloat32x4(SampleHistory(params.fReprojectedHrUv));
+    }
+    else
+    {
+        fHistory = HistorySample(params.fReprojectedHrUv, DisplaySize());
+    }
 
     fHistoryColor = PrepareRgb(fHistory.rgb, Exposure(), PreviousFramePreExposure());
 
@@ -324,11 +333,17 @@ void ReprojectHistoryColor(const AccumulationPassCommonParams params, FFXM_PARAM
 #endif
 
     //Compute temporal reactivity info
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    fTemporalReactiveFactor = 0.0;
+#elif FFXM_SHADER_QUALITY_OPT_SEPARATE_TEMPORAL_REACTIVE
+    fTemporalReactiveFactor = ffxSaturate(abs(SampleTemporalReactive(params.fReprojectedHrUv)));
+#else
     fTemporalReactiveFactor = ffxSaturate(abs(fHistory.w));
+#endif
     bInMotionLastFrame = (fHistory.w < 0.0f);
 }
 
-LockState ReprojectHistoryLockStatus(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT FfxFloat32x2 fReprojectedLockStatus)
+LockState ReprojectHistoryLockStatus(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT(FfxFloat32x2) fReprojectedLockStatus)
 {
     LockState state = { FFXM_FALSE, FFXM_FALSE };
     const FfxFloat32 fNewLockIntensity = LoadRwNewLocks(params.iPxHrPos);
@@ -346,9 +361,18 @@ LockState ReprojectHistoryLockStatus(const AccumulationPassCommonParams params,
 }
 #else //FFXM_HALF
 
-void ReprojectHistoryColor(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT FfxFloat16x3 fHistoryColor, FFXM_PARAMETER_OUT FfxFloat16 fTemporalReactiveFactor, FFXM_PARAMETER_OUT FfxBoolean bInMotionLastFrame)
+void ReprojectHistoryColor(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT(FfxFloat16x3) fHistoryColor, FFXM_PARAMETER_OUT(FfxFloat16) fTemporalReactiveFactor, FFXM_PARAMETER_OUT(FfxBoolean) bInMotionLastFrame)
 {
-    FfxFloat16x4 fHistory = HistorySample(params.fReprojectedHrUv, DisplaySize());
+    // The periphery of a foveated output makes do with a bilinear fetch
+    FfxFloat16x4 fHistory;
+    if (params.bIsFoveationPeriphery)
+    {
+        fHistory = FfxFloat16x4(SampleHistory(params.fReprojectedHrUv));
+    }
+    else
+    {
+        fHistory = HistorySample(params.fReprojectedHrUv, DisplaySize());
+    }
 
     fHistoryColor = FfxFloat16x3(PrepareRgb(fHistory.rgb, Exposure(), PreviousFramePreExposure()));
 
@@ -367,7 +391,7 @@ void ReprojectHistoryColor(const AccumulationPassCommonParams params, FFXM_PARAM
     bInMotionLastFrame = (fHistory.w < 0.0f);
 }
 
-LockState ReprojectHistoryLockStatus(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT FfxFloat16x2 fReprojectedLockStatus)
+LockState ReprojectHistoryLockStatus(const AccumulationPassCommonParams params, FFXM_PARAMETER_OUT(FfxFloat16x2) fReprojectedLockStatus)
 {
     LockState state = { FFXM_FALSE, FFXM_FALSE };
     const FfxFloat16 fNewLockIntensity = FfxFloat16(LoadRwNewLocks(params.iPxHrPos));
@@ -99,6 +99,12 @@
 #define FFXM_FSR2_AUTOREACTIVEFLAGS_APPLY_THRESHOLD                                  4
 #define FFXM_FSR2_AUTOREACTIVEFLAGS_USE_COMPONENTS_MAX                               8
 
+// Lanczos weight table: the kernel bias levels along the width, one row per jitter phase and output pixel phase
+#define FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS                                          32
+#define FFXM_FSR2_LANCZOS_TABLE_BIAS_MIN                                             0.5f
+#define FFXM_FSR2_LANCZOS_TABLE_BIAS_MAX                                             2.0f
+#define FFXM_FSR2_LANCZOS_TABLE_MAX_HEIGHT                                           4096
+
 #endif // #if defined(FFXM_CPU) || defined(FFXM_GPU)
 
 #endif //!defined( FFXM_FSR2_RESOURCES_H )
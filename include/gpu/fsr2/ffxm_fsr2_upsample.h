@@ -34,12 +34,12 @@ FFXM_STATIC const FfxUInt32 iLanczos2SampleCount = 16;
 #endif
 
 
-void Deringing(RectificationBox clippingBox, FFXM_PARAMETER_INOUT FfxFloat32x3 fColor)
+void Deringing(RectificationBox clippingBox, FFXM_PARAMETER_INOUT(FfxFloat32x3) fColor)
 {
     fColor = clamp(fColor, clippingBox.aabbMin, clippingBox.aabbMax);
 }
 #if FFXM_HALF
-void Deringing(RectificationBoxMin16 clippingBox, FFXM_PARAMETER_INOUT FFXM_MIN16_F3 fColor)
+void Deringing(RectificationBoxMin16 clippingBox, FFXM_PARAMETER_INOUT(FFXM_MIN16_F3) fColor)
 {
     fColor = clamp(fColor, clippingBox.aabbMin, clippingBox.aabbMax);
 }
@@ -47,7 +47,7 @@ void Deringing(RectificationBoxMin16 clippingBox, FFXM_PARAMETER_INOUT FFXM_MIN1
 
 FfxFloat32 GetUpsampleLanczosWeight(FfxFloat32x2 fSrcSampleOffset, FfxFloat32 fKernelWeight)
 {
-    FfxFloat32x2 fSrcSampleOffsetBiased = fSrcSampleOffset * fKernelWeight.xx;
+    FfxFloat32x2 fSrcSampleOffsetBiased = fSrcSampleOffset * ffxBroadcast2(fKernelWeight);
     FfxFloat32 fSampleWeight = Lanczos2ApproxSq(dot(fSrcSampleOffsetBiased, fSrcSampleOffsetBiased));
     return fSampleWeight;
 }
@@ -61,6 +61,19 @@ FFXM_MIN16_F GetUpsampleLanczosWeight(FFXM_MIN16_F2 fSrcSampleOffset, FFXM_MIN16
 }
 #endif
 
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+// The table holds separable weights, the tap offsets are in [-1, 1] on both axes
+FFXM_MIN16_F GetUpsampleSampleWeight(FfxBoolean bUseTable, FFXM_MIN16_F3 fTableWeightsX, FFXM_MIN16_F3 fTableWeightsY,
+    FfxInt32x2 iTapOffset, FFXM_MIN16_F2 fSrcSampleOffset, FFXM_MIN16_F fKernelBias)
+{
+    if (bUseTable)
+    {
+        return fTableWeightsX[iTapOffset.x + 1] * fTableWeightsY[iTapOffset.y + 1];
+    }
+    return FFXM_MIN16_F(GetUpsampleLanczosWeight(fSrcSampleOffset, fKernelBias));
+}
+#endif
+
 FfxFloat32 ComputeMaxKernelWeight() {
     const FfxFloat32 fKernelSizeBias = 1.0f;
 
@@ -69,7 +82,7 @@ FfxFloat32 ComputeMaxKernelWeight() {
     return ffxMin(FfxFloat32(1.99f), fKernelWeight);
 }
 
-#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#if FFXM_SHADER_QUALITY_OPT_ACCUMULATE_PREPARES_INPUT_COLOR
 FfxFloat32x3 ComputePreparedInputColor(FfxInt32x2 iPxLrPos)
 {
     //We assume linear data. if non-linear input (sRGB, ...),
@@ -90,10 +103,10 @@ FfxFloat32x3 ComputePreparedInputColor(FfxInt32x2 iPxLrPos)
 
 #if FFXM_HALF
 FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams params,
-    FFXM_PARAMETER_INOUT RectificationBoxMin16 clippingBox, FfxFloat32 fReactiveFactor)
+    FFXM_PARAMETER_INOUT(RectificationBoxMin16) clippingBox, FfxFloat32 fReactiveFactor)
 #else
 FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams params,
-    FFXM_PARAMETER_INOUT RectificationBox clippingBox, FfxFloat32 fReactiveFactor)
+    FFXM_PARAMETER_INOUT(RectificationBox) clippingBox, FfxFloat32 fReactiveFactor)
 #endif
 {
     // We compute a sliced lanczos filter with 2 lobes (other slices are accumulated temporaly)
@@ -120,6 +133,33 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
 
     const FFXM_MIN16_F fRectificationCurveBias = FFXM_MIN16_F(ffxLerp(-2.0f, -3.0f, ffxSaturate(params.fHrVelocity / 50.0f)));
 
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+    // Each row of the table holds the weights of one axis for a jitter phase and an output pixel phase, the source
+    // position repeats every period so its floor within the period comes from the table as well. The rows are only
+    // valid for the render size and the jitter sequence the table was built for, other frames compute the weights.
+    const FfxInt32x4 iLanczosTableInfo = LanczosTableInfo();
+    const FfxBoolean bUseLanczosTable = iLanczosTableInfo.x >= 0;
+    FFXM_MIN16_F3 fTableWeightsX = FFXM_MIN16_F3(0.0f, 0.0f, 0.0f);
+    FFXM_MIN16_F3 fTableWeightsY = FFXM_MIN16_F3(0.0f, 0.0f, 0.0f);
+    if (bUseLanczosTable)
+    {
+        const FfxInt32x2 iPhasePeriod = iLanczosTableInfo.yz;
+        const FfxInt32x2 iPhase = params.iPxHrPos % iPhasePeriod;
+        const FfxFloat32x2 fRows = FfxFloat32x2(iLanczosTableInfo.xx + FfxInt32x2(0, iPhasePeriod.x) + iPhase) + FFXM_BROADCAST_FLOAT32X2(0.5f);
+        const FfxFloat32 fBias = ffxSaturate((FfxFloat32(fKernelBias) - FFXM_FSR2_LANCZOS_TABLE_BIAS_MIN) / (FFXM_FSR2_LANCZOS_TABLE_BIAS_MAX - FFXM_FSR2_LANCZOS_TABLE_BIAS_MIN));
+        const FfxFloat32 fBiasU = (fBias * FfxFloat32(FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS - 1) + 0.5f) / FfxFloat32(FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS);
+
+        const FfxFloat32x4 fTableX = SampleLanczosWeightTable(FfxFloat32x2(fBiasU, fRows.x / FfxFloat32(iLanczosTableInfo.w)));
+        const FfxFloat32x4 fTableY = SampleLanczosWeightTable(FfxFloat32x2(fBiasU, fRows.y / FfxFloat32(iLanczosTableInfo.w)));
+        fTableWeightsX = FFXM_MIN16_F3(fTableX.xyz);
+        fTableWeightsY = FFXM_MIN16_F3(fTableY.xyz);
+
+        iSrcInputPos = (params.iPxHrPos / iPhasePeriod) * LanczosTableSourceStep() + FfxInt32x2(round(FfxFloat32x2(fTableX.w, fTableY.w)));
+        iSrcInputUv = (FfxFloat32x2(iSrcInputPos) + FFXM_BROADCAST_FLOAT32X2(0.5f)) / FfxFloat32x2(RenderSize());
+        fBaseSampleOffset = FFXM_MIN16_F2((FfxFloat32x2(iSrcInputPos) + FFXM_BROADCAST_FLOAT32X2(0.5f)) - Jitter() - fSrcOutputPos);
+    }
+#endif
+
     FFXM_MIN16_F2 offsetTL;
     offsetTL.x = FFXM_MIN16_F(-1);
     offsetTL.y = FFXM_MIN16_F(-1);
@@ -131,25 +171,27 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
     // Collect samples
     GatherPreparedInputColorRGBQuad(FfxFloat32x2(-0.5, -0.5) * unitOffsetUv + iSrcInputUv,
         fSamples[0], fSamples[1], fSamples[4], fSamples[5]);
-    fSamples[2] =  LoadPreparedInputColor(FfxInt32x2(1, -1) + iSrcInputPos);
     fSamples[6] =  LoadPreparedInputColor(FfxInt32x2(1, 0)  + iSrcInputPos);
-    fSamples[8] =  LoadPreparedInputColor(FfxInt32x2(-1, 1) + iSrcInputPos);
     fSamples[9] =  LoadPreparedInputColor(FfxInt32x2(0, 1)  + iSrcInputPos);
-    fSamples[10] = LoadPreparedInputColor(FfxInt32x2(1, 1)  + iSrcInputPos);
 
-    FFXM_UNROLL
-    for (FfxInt32 row = 0; row < 3; row++)
+    if (params.bIsFoveationPeriphery)
     {
+        // The periphery of a foveated output only uses the cross of the 5 tap kernel, the corners are not loaded
+        const FfxInt32 iCrossSampleIndices[5] = { 1, 4, 5, 6, 9 };
+
         FFXM_UNROLL
-        for (FfxInt32 col = 0; col < 3; col++)
+        for (FfxInt32 idx = 0; idx < 5; idx++)
         {
-            FfxInt32 iSampleIndex = col + (row << 2);
-            const FfxInt32x2 sampleColRow = FfxInt32x2(col, row);
+            const FfxInt32 iSampleIndex = iCrossSampleIndices[idx];
+            const FfxInt32x2 sampleColRow = FfxInt32x2(iSampleIndex & 3, iSampleIndex >> 2);
             const FFXM_MIN16_F2 fOffset = fOffsetTL + FFXM_MIN16_F2(sampleColRow);
             FFXM_MIN16_F2 fSrcSampleOffset = fBaseSampleOffset + fOffset;
 
-            FfxInt32x2 iSrcSamplePos = FfxInt32x2(iSrcInputPos) + FfxInt32x2(offsetTL) + sampleColRow;
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+            FFXM_MIN16_F fSampleWeight = GetUpsampleSampleWeight(bUseLanczosTable, fTableWeightsX, fTableWeightsY, FfxInt32x2(offsetTL) + sampleColRow, fSrcSampleOffset, fKernelBias);
+#else
             FFXM_MIN16_F fSampleWeight = FFXM_MIN16_F(GetUpsampleLanczosWeight(fSrcSampleOffset, fKernelBias));
+#endif
 
             fColorAndWeight += FFXM_MIN16_F4(fSamples[iSampleIndex] * fSampleWeight, fSampleWeight);
 
@@ -158,17 +200,54 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
                 const FFXM_MIN16_F fSrcSampleOffsetSq = dot(fSrcSampleOffset, fSrcSampleOffset);
                 const FFXM_MIN16_F fBoxSampleWeight = exp(fRectificationCurveBias * fSrcSampleOffsetSq);
 
-                const FfxBoolean bInitialSample = (row == 0) && (col == 0);
+                const FfxBoolean bInitialSample = (idx == 0);
                 RectificationBoxAddSample(bInitialSample, clippingBox, fSamples[iSampleIndex], fBoxSampleWeight);
             }
         }
     }
+    else
+    {
+        fSamples[2] =  LoadPreparedInputColor(FfxInt32x2(1, -1) + iSrcInputPos);
+        fSamples[8] =  LoadPreparedInputColor(FfxInt32x2(-1, 1) + iSrcInputPos);
+        fSamples[10] = LoadPreparedInputColor(FfxInt32x2(1, 1)  + iSrcInputPos);
+
+        FFXM_UNROLL
+        for (FfxInt32 row = 0; row < 3; row++)
+        {
+            FFXM_UNROLL
+            for (FfxInt32 col = 0; col < 3; col++)
+            {
+                FfxInt32 iSampleIndex = col + (row << 2);
+                const FfxInt32x2 sampleColRow = FfxInt32x2(col, row);
+                const FFXM_MIN16_F2 fOffset = fOffsetTL + FFXM_MIN16_F2(sampleColRow);
+                FFXM_MIN16_F2 fSrcSampleOffset = fBaseSampleOffset + fOffset;
+
+                FfxInt32x2 iSrcSamplePos = FfxInt32x2(iSrcInputPos) + FfxInt32x2(offsetTL) + sampleColRow;
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+                FFXM_MIN16_F fSampleWeight = GetUpsampleSampleWeight(bUseLanczosTable, fTableWeightsX, fTableWeightsY, FfxInt32x2(offsetTL) + sampleColRow, fSrcSampleOffset, fKernelBias);
+#else
+                FFXM_MIN16_F fSampleWeight = FFXM_MIN16_F(GetUpsampleLanczosWeight(fSrcSampleOffset, fKernelBias));
+#endif
+
+                fColorAndWeight += FFXM_MIN16_F4(fSamples[iSampleIndex] * fSampleWeight, fSampleWeight);
+
+                // Update rectification box
+                {
+                    const FFXM_MIN16_F fSrcSampleOffsetSq = dot(fSrcSampleOffset, fSrcSampleOffset);
+                    const FFXM_MIN16_F fBoxSampleWeight = exp(fRectificationCurveBias * fSrcSampleOffsetSq);
+
+                    const FfxBoolean bInitialSample = (row == 0) && (col == 0);
+                    RectificationBoxAddSample(bInitialSample, clippingBox, fSamples[iSampleIndex], fBoxSampleWeight);
+                }
+            }
+        }
+    }
 #elif FFXM_FSR2_UPSAMPLE_KERNEL == FFXM_FSR2_UPSAMPLE_USE_LANCZOS_5_TAP || FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
 
     FFXM_MIN16_F3 fSamples[iLanczos2SampleCount];
     // Collect samples
     FfxInt32x2 rowCol [iLanczos2SampleCount] = {FfxInt32x2(0, -1), FfxInt32x2(-1, 0), FfxInt32x2(0, 0), FfxInt32x2(1, 0), FfxInt32x2(0, 1)};
-#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#if FFXM_SHADER_QUALITY_OPT_ACCUMULATE_PREPARES_INPUT_COLOR
     fSamples[0] = ComputePreparedInputColor(rowCol[0] + iSrcInputPos);
     fSamples[1] = ComputePreparedInputColor(rowCol[1] + iSrcInputPos);
     fSamples[2] = ComputePreparedInputColor(rowCol[2] + iSrcInputPos);
@@ -189,7 +268,11 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
         FFXM_MIN16_F2 fSrcSampleOffset = fBaseSampleOffset + fOffset;
 
         FfxInt32x2 iSrcSamplePos = FfxInt32x2(iSrcInputPos) + FfxInt32x2(offsetTL) + sampleColRow;
+#if FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE
+        FFXM_MIN16_F fSampleWeight = GetUpsampleSampleWeight(bUseLanczosTable, fTableWeightsX, fTableWeightsY, sampleColRow, fSrcSampleOffset, fKernelBias);
+#else
         FFXM_MIN16_F fSampleWeight = FFXM_MIN16_F(GetUpsampleLanczosWeight(fSrcSampleOffset, fKernelBias));
+#endif
 
         fColorAndWeight += FFXM_MIN16_F4(fSamples[idx] * fSampleWeight, fSampleWeight);
 
@@ -214,7 +297,9 @@ FfxFloat32x4 ComputeUpsampledColorAndWeight(const AccumulationPassCommonParams p
         fColorAndWeight.xyz = fColorAndWeight.xyz / fColorAndWeight.w;
         fColorAndWeight.w = FFXM_MIN16_F(fColorAndWeight.w*fUpsampleLanczosWeightScale);
 
-        Deringing(clippingBox, fColorAndWeight.xyz);
+        FFXM_MIN16_F3 fDeringedColor = fColorAndWeight.xyz;
+        Deringing(clippingBox, fDeringedColor);
+        fColorAndWeight.xyz = fDeringedColor;
     }
     return fColorAndWeight;
 }
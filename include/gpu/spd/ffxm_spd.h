@@ -33,7 +33,7 @@
 /// @param [in] mips                                optional: if -1, calculate based on rect width and height
 ///
 /// @ingroup FfxGPUSpd
-#if defined(FFXM_CPU)
+#if defined(FFXM_CPU) && !defined(FFXM_GPU)
 FFXM_STATIC void ffxSpdSetup(FfxUInt32x2    dispatchThreadGroupCountXY,
                          FfxUInt32x2    workGroupOffset,
                          FfxUInt32x2    numWorkGroupsAndMips,
@@ -83,7 +83,7 @@ FFXM_STATIC void ffxSpdSetup(FfxUInt32x2 dispatchThreadGroupCountXY,
 {
     ffxSpdSetup(dispatchThreadGroupCountXY, workGroupOffset, numWorkGroupsAndMips, rectInfo, -1);
 }
-#endif // #if defined(FFXM_CPU)
+#endif // #if defined(FFXM_CPU) && !defined(FFXM_GPU)
 
 
 //==============================================================================================================================
@@ -0,0 +1,125 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// @defgroup CPUBackend CPU Backend
+/// Arm ASR reference backend running every pass on the host CPU.
+///
+/// All resources live in host memory, jobs are executed synchronously in
+/// <c><i>fpExecuteGpuJobs</i></c> and the work of each pass is split in rows
+/// across a pool of worker threads. It is meant for validation, headless
+/// tooling and platforms without a supported GPU API.
+///
+/// @ingroup Backends
+
+#pragma once
+
+#include <host/ffxm_interface.h>
+
+namespace arm
+{
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // #if defined(__cplusplus)
+
+/// Query how much memory is required for the CPU backend's scratch buffer.
+///
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+///
+/// @returns
+/// The size (in bytes) of the required scratch memory buffer for the CPU backend.
+///
+/// @ingroup CPUBackend
+FFXM_API size_t ffxmGetScratchMemorySizeCPU(size_t maxContexts);
+
+/// Convenience structure to hold the CPU device configuration
+typedef struct CpuDeviceContext {
+    uint32_t                threadCount;        /// Number of worker threads to use, 0 to use the hardware concurrency
+} CpuDeviceContext;
+
+/// Create a <c><i>FfxmDevice</i></c> from a <c><i>CpuDeviceContext</i></c>.
+///
+/// @param [in] cpuDeviceContext            A pointer to a CpuDeviceContext that holds the device configuration.
+///                                         The structure must outlive the backend interface.
+///
+/// @returns
+/// An abstract FidelityFX device.
+///
+/// @ingroup CPUBackend
+FFXM_API FfxmDevice ffxmGetDeviceCPU(CpuDeviceContext* cpuDeviceContext);
+
+/// Populate an interface with pointers for the CPU backend.
+///
+/// @param [out] backendInterface           A pointer to a <c><i>FfxmInterface</i></c> structure to populate with pointers.
+/// @param [in] device                      A device created with <c><i>ffxmGetDeviceCPU</i></c>.
+/// @param [in] scratchBuffer               A pointer to a buffer of memory which can be used by the CPU backend.
+/// @param [in] scratchBufferSize           The size (in bytes) of the buffer pointed to by <c><i>scratchBuffer</i></c>.
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_CODE_INVALID_POINTER          The <c><i>interface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup CPUBackend
+FFXM_API FfxmErrorCode ffxmGetInterfaceCPU(
+    FfxmInterface* backendInterface,
+    FfxmDevice device,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    size_t maxContexts);
+
+/// Create a <c><i>FfxmCommandList</i></c> for the CPU backend.
+///
+/// The CPU backend executes jobs immediately, so the command list is an
+/// opaque value that is only forwarded back to the caller.
+///
+/// @param [in] cmdList                     An application defined handle, may be <c><i>NULL</i></c>.
+///
+/// @returns
+/// An abstract FidelityFX command list.
+///
+/// @ingroup CPUBackend
+FFXM_API FfxmCommandList ffxmGetCommandListCPU(void* cmdList);
+
+/// Fetch a <c><i>FfxmResource</i></c> from host memory.
+///
+/// @param [in] hostPixels                  A pointer to tightly packed pixels of mip 0, laid out in <c><i>ffxmResDescription.format</i></c>.
+/// @param [in] ffxmResDescription           An <c><i>FfxmResourceDescription</i></c> for the resource representation.
+/// @param [in] ffxmResName                  (optional) A name string to identify the resource in debug mode.
+/// @param [in] state                       The state the resource is currently in.
+///
+/// @returns
+/// An abstract FidelityFX resources.
+///
+/// @ingroup CPUBackend
+FFXM_API FfxmResource ffxmGetResourceCPU(void*  hostPixels,
+    FfxmResourceDescription                  ffxmResDescription,
+    wchar_t*                                ffxmResName,
+    FfxmResourceStates                       state = FFXM_RESOURCE_STATE_COMPUTE_READ);
+
+#if defined(__cplusplus)
+}
+#endif // #if defined(__cplusplus)
+
+} // namespace arm
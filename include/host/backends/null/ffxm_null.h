@@ -0,0 +1,173 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// @defgroup NullBackend Null Backend
+/// Arm ASR backend that records the calls of an effect without doing any work.
+///
+/// Every resource, pipeline and job call is accepted and appended to a compact
+/// trace owned by the application, no memory is allocated for resources and
+/// nothing is executed. It is meant for measuring the host side cost of an
+/// effect and for checking the work it submits without a device.
+///
+/// @ingroup Backends
+
+#pragma once
+
+#include <host/ffxm_interface.h>
+
+namespace arm
+{
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // #if defined(__cplusplus)
+
+/// The backend calls recorded by the null backend.
+///
+/// The meaning of the arguments of each <c><i>FfxmNullTraceEntry</i></c> is given per call.
+///
+/// @ingroup NullBackend
+typedef enum FfxmNullTraceCall {
+
+    FFXM_NULL_TRACE_CREATE_BACKEND_CONTEXT,     ///< No arguments.
+    FFXM_NULL_TRACE_DESTROY_BACKEND_CONTEXT,    ///< No arguments.
+    FFXM_NULL_TRACE_CREATE_RESOURCE,            ///< Internal index, width and height of the resource.
+    FFXM_NULL_TRACE_CREATE_ALIASED_RESOURCES,   ///< Number of resources and internal index of the first one.
+    FFXM_NULL_TRACE_DESTROY_RESOURCE,           ///< Internal index of the resource.
+    FFXM_NULL_TRACE_REGISTER_RESOURCE,          ///< Internal index, width and height of the resource.
+    FFXM_NULL_TRACE_UNREGISTER_RESOURCES,       ///< Number of resources unregistered.
+    FFXM_NULL_TRACE_CREATE_PIPELINE,            ///< Pass, permutation options, and 1 for a graphics pipeline or 0 for a compute pipeline.
+    FFXM_NULL_TRACE_DESTROY_PIPELINE,           ///< Pass of the pipeline.
+    FFXM_NULL_TRACE_SCHEDULE_CLEAR_JOB,         ///< Internal index of the cleared resource.
+    FFXM_NULL_TRACE_SCHEDULE_COPY_JOB,          ///< Internal index of the source and of the destination resources.
+    FFXM_NULL_TRACE_SCHEDULE_COMPUTE_JOB,       ///< Pass, and dispatch size in thread groups along X and Y.
+    FFXM_NULL_TRACE_SCHEDULE_FRAGMENT_JOB,      ///< Pass, and viewport width and height.
+    FFXM_NULL_TRACE_EXECUTE_GPU_JOBS,           ///< Number of jobs executed.
+
+    FFXM_NULL_TRACE_CALL_COUNT                  ///< The number of call types.
+} FfxmNullTraceCall;
+
+/// A single recorded backend call.
+///
+/// @ingroup NullBackend
+typedef struct FfxmNullTraceEntry {
+
+    uint16_t                call;               ///< The <c><i>FfxmNullTraceCall</i></c> recorded.
+    uint16_t                effectContextId;    ///< The effect context the call was made for, 0 for <c><i>FFXM_NULL_TRACE_EXECUTE_GPU_JOBS</i></c>.
+    uint32_t                arguments[3];       ///< Call arguments, unused ones are zero.
+} FfxmNullTraceEntry;
+
+/// Convenience structure to hold the null device configuration and the recorded trace.
+///
+/// The trace is a ring: once <c><i>traceCapacity</i></c> entries have been recorded
+/// the oldest ones are overwritten, the entry of call <c><i>n</i></c> being at index
+/// <c><i>n % traceCapacity</i></c>.
+///
+/// @ingroup NullBackend
+typedef struct NullDeviceContext {
+    FfxmNullTraceEntry*     traceEntries;                           /// Storage for the trace, may be NULL to only count the calls
+    uint32_t                traceCapacity;                          /// Number of entries in traceEntries
+    uint64_t                traceCount;                             /// Number of calls recorded since the trace was last reset
+    uint64_t                callCounts[FFXM_NULL_TRACE_CALL_COUNT]; /// Number of calls recorded per call type since the trace was last reset
+} NullDeviceContext;
+
+/// Query how much memory is required for the null backend's scratch buffer.
+///
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+///
+/// @returns
+/// The size (in bytes) of the required scratch memory buffer for the null backend.
+///
+/// @ingroup NullBackend
+FFXM_API size_t ffxmGetScratchMemorySizeNull(size_t maxContexts);
+
+/// Create a <c><i>FfxmDevice</i></c> from a <c><i>NullDeviceContext</i></c>.
+///
+/// @param [in] nullDeviceContext           A pointer to a NullDeviceContext that receives the trace.
+///                                         The structure must outlive the backend interface.
+///
+/// @returns
+/// An abstract FidelityFX device.
+///
+/// @ingroup NullBackend
+FFXM_API FfxmDevice ffxmGetDeviceNull(NullDeviceContext* nullDeviceContext);
+
+/// Populate an interface with pointers for the null backend.
+///
+/// @param [out] backendInterface           A pointer to a <c><i>FfxmInterface</i></c> structure to populate with pointers.
+/// @param [in] device                      A device created with <c><i>ffxmGetDeviceNull</i></c>.
+/// @param [in] scratchBuffer               A pointer to a buffer of memory which can be used by the null backend.
+/// @param [in] scratchBufferSize           The size (in bytes) of the buffer pointed to by <c><i>scratchBuffer</i></c>.
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_CODE_INVALID_POINTER          The <c><i>interface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup NullBackend
+FFXM_API FfxmErrorCode ffxmGetInterfaceNull(
+    FfxmInterface* backendInterface,
+    FfxmDevice device,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    size_t maxContexts);
+
+/// Create a <c><i>FfxmCommandList</i></c> for the null backend.
+///
+/// @param [in] cmdList                     An application defined handle, must not be <c><i>NULL</i></c>.
+///
+/// @returns
+/// An abstract FidelityFX command list.
+///
+/// @ingroup NullBackend
+FFXM_API FfxmCommandList ffxmGetCommandListNull(void* cmdList);
+
+/// Fetch a <c><i>FfxmResource</i></c> for the null backend.
+///
+/// @param [in] handle                      An application defined handle identifying the resource, must not be <c><i>NULL</i></c> for a bound resource.
+/// @param [in] ffxmResDescription           An <c><i>FfxmResourceDescription</i></c> for the resource representation.
+/// @param [in] ffxmResName                  (optional) A name string to identify the resource in debug mode.
+/// @param [in] state                       The state the resource is currently in.
+///
+/// @returns
+/// An abstract FidelityFX resources.
+///
+/// @ingroup NullBackend
+FFXM_API FfxmResource ffxmGetResourceNull(void*  handle,
+    FfxmResourceDescription                  ffxmResDescription,
+    wchar_t*                                ffxmResName,
+    FfxmResourceStates                       state = FFXM_RESOURCE_STATE_COMPUTE_READ);
+
+/// Clear the trace and the call counts of a <c><i>NullDeviceContext</i></c>.
+///
+/// @param [in] nullDeviceContext           A pointer to the NullDeviceContext to reset.
+///
+/// @ingroup NullBackend
+FFXM_API void ffxmResetTraceNull(NullDeviceContext* nullDeviceContext);
+
+#if defined(__cplusplus)
+}
+#endif // #if defined(__cplusplus)
+
+} // namespace arm
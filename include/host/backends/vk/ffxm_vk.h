@@ -80,19 +80,79 @@ typedef struct VkDeviceContext {
 /// @ingroup VKBackend
 FFXM_API FfxmDevice ffxmGetDeviceVK(VkDeviceContext* vkDeviceContext);
 
+/// A range of device memory handed out by <c><i>FfxmAllocatorCallbacksVK</i></c>.
+typedef struct FfxmAllocationVK {
+    VkDeviceMemory          deviceMemory;       /// The memory object the range belongs to
+    VkDeviceSize            offset;             /// The offset (in bytes) of the range within <c><i>deviceMemory</i></c>
+    VkMemoryPropertyFlags   memoryProperties;   /// The property flags of the memory type of <c><i>deviceMemory</i></c>
+    void*                   pMappedData;        /// Host address of the range, required when host visible memory was requested
+    void*                   pUserAllocation;    /// Opaque handle of the allocation, for use by the application
+} FfxmAllocationVK;
+
+/// Allocate a range of device memory.
+///
+/// @param [in] pUserData                   The <c><i>pUserData</i></c> member of the <c><i>FfxmAllocatorCallbacksVK</i></c>.
+/// @param [in] memRequirements             The size, alignment and allowed memory types of the range.
+/// @param [in] requiredMemoryProperties    The property flags the memory type must have.
+/// @param [out] outAllocation              A pointer to a <c><i>FfxmAllocationVK</i></c> receiving the range.
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_OUT_OF_MEMORY                 The range could not be allocated.
+///
+/// @ingroup VKBackend
+typedef FfxmErrorCode (*FfxmAllocateMemoryFuncVK)(
+    void* pUserData,
+    const VkMemoryRequirements* memRequirements,
+    VkMemoryPropertyFlags requiredMemoryProperties,
+    FfxmAllocationVK* outAllocation);
+
+/// Free a range of device memory allocated through <c><i>FfxmAllocateMemoryFuncVK</i></c>.
+///
+/// @param [in] pUserData                   The <c><i>pUserData</i></c> member of the <c><i>FfxmAllocatorCallbacksVK</i></c>.
+/// @param [in] allocation                  A pointer to the <c><i>FfxmAllocationVK</i></c> to free.
+///
+/// @ingroup VKBackend
+typedef void (*FfxmFreeMemoryFuncVK)(
+    void* pUserData,
+    const FfxmAllocationVK* allocation);
+
+/// Application provided device memory allocator, e.g. wrapping the
+/// Vulkan Memory Allocator library.
+///
+/// Ranges may hold buffers as well as optimally tiled images, the allocator
+/// is expected to honor <c><i>bufferImageGranularity</i></c> between them.
+/// Host visible ranges must stay mapped until they are freed.
+///
+/// @ingroup VKBackend
+typedef struct FfxmAllocatorCallbacksVK {
+    void*                       pUserData;          /// Passed back to the callbacks
+    FfxmAllocateMemoryFuncVK    fpAllocateMemory;   /// Called for every allocation of the backend
+    FfxmFreeMemoryFuncVK        fpFreeMemory;       /// Called when a resource of the backend gets destroyed
+} FfxmAllocatorCallbacksVK;
+
 /// Populate an interface with pointers for the VK backend.
 ///
+/// Unless <c><i>allocatorCallbacks</i></c> are provided, the backend sub-allocates
+/// the memory of its resources from large blocks shared by all effect contexts,
+/// one set of blocks per memory type.
+///
 /// @param [out] backendInterface           A pointer to a <c><i>FfxmInterface</i></c> structure to populate with pointers.
 /// @param [in] device                      A pointer to the VkDevice device.
 /// @param [in] scratchBuffer               A pointer to a buffer of memory which can be used by the DirectX(R)12 backend.
 /// @param [in] scratchBufferSize           The size (in bytes) of the buffer pointed to by <c><i>scratchBuffer</i></c>.
 /// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
 ///                                         (Note that some effects contain internal contexts which count towards this maximum)
+/// @param [in] allocatorCallbacks          (optional) A pointer to a <c><i>FfxmAllocatorCallbacksVK</i></c> used for all device memory
+///                                         allocations of the resources of the backend. Copied, the pointer does not need to stay valid.
 ///
 /// @retval
 /// FFXM_OK                                  The operation completed successfully.
 /// @retval
 /// FFXM_ERROR_CODE_INVALID_POINTER          The <c><i>interface</i></c> pointer was <c><i>NULL</i></c>.
+/// @retval
+/// FFXM_ERROR_INVALID_ARGUMENT              One of the <c><i>allocatorCallbacks</i></c> function pointers was <c><i>NULL</i></c>.
 ///
 /// @ingroup VKBackend
 FFXM_API FfxmErrorCode ffxmGetInterfaceVK(
@@ -100,7 +160,8 @@ FFXM_API FfxmErrorCode ffxmGetInterfaceVK(
     FfxmDevice device,
     void* scratchBuffer,
     size_t scratchBufferSize,
-    size_t maxContexts);
+    size_t maxContexts,
+    const FfxmAllocatorCallbacksVK* allocatorCallbacks = nullptr);
 
 /// Create a <c><i>FfxmCommandList</i></c> from a <c><i>VkCommandBuffer</i></c>.
 ///
@@ -128,6 +189,153 @@ FFXM_API FfxmResource ffxmGetResourceVK(void*  vkResource,
     wchar_t*                                ffxmResName,
     FfxmResourceStates                       state = FFXM_RESOURCE_STATE_COMPUTE_READ);
 
+/// Retrieve the contents of the pipeline cache used by the VK backend.
+///
+/// The data can be written to disk and handed back through
+/// <c><i>ffxmSetPipelineCacheDataVK</i></c> on the next run to skip shader
+/// compilation when the effect pipelines get created. Follows the Vulkan
+/// convention: when <c><i>data</i></c> is <c><i>NULL</i></c> the required size
+/// is returned in <c><i>dataSize</i></c>.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxmInterface</i></c> populated by <c><i>ffxmGetInterfaceVK</i></c>.
+/// @param [inout] dataSize                 The size (in bytes) of the buffer pointed to by <c><i>data</i></c>, updated with the size written.
+/// @param [out] data                       (optional) A pointer to a buffer receiving the cache data.
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INSUFFICIENT_MEMORY           The buffer was too small, only part of the data was written.
+/// @retval
+/// FFXM_ERROR_BACKEND_API_ERROR             No effect context is alive, or the call to Vulkan failed.
+///
+/// @ingroup VKBackend
+FFXM_API FfxmErrorCode ffxmGetPipelineCacheDataVK(FfxmInterface* backendInterface, size_t* dataSize, void* data);
+
+/// Provide pipeline cache data previously retrieved with <c><i>ffxmGetPipelineCacheDataVK</i></c>.
+///
+/// When called before the first effect context is created, the data seeds the
+/// pipeline cache of the VK backend and must stay valid until that context has
+/// been created. Otherwise the data is merged into the live cache. Data produced
+/// by another driver or device is ignored.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxmInterface</i></c> populated by <c><i>ffxmGetInterfaceVK</i></c>.
+/// @param [in] data                        A pointer to the cache data.
+/// @param [in] dataSize                    The size (in bytes) of the buffer pointed to by <c><i>data</i></c>.
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_BACKEND_API_ERROR             The data could not be merged into the live cache.
+///
+/// @ingroup VKBackend
+FFXM_API FfxmErrorCode ffxmSetPipelineCacheDataVK(FfxmInterface* backendInterface, const void* data, size_t dataSize);
+
+/// Release the views the VK backend keeps for an application resource.
+///
+/// The image views of the resources handed to the effect (color, depth, motion
+/// vectors, output, ...) are created on first use and reused across frames as
+/// long as the image and its description stay the same. Vulkan gives no way to
+/// detect that an image was destroyed and its handle reused, so the application
+/// must call this function once the GPU no longer uses the image, before
+/// destroying it.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxmInterface</i></c> populated by <c><i>ffxmGetInterfaceVK</i></c>.
+/// @param [in] vkResource                  A pointer to the (agnostic) VK resource, as given to <c><i>ffxmGetResourceVK</i></c>.
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_CODE_INVALID_POINTER          The <c><i>backendInterface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup VKBackend
+FFXM_API FfxmErrorCode ffxmInvalidateResourceVK(FfxmInterface* backendInterface, void* vkResource);
+
+/// Usage of the caches holding one class of objects of the VK backend.
+///
+/// Render passes, image views, framebuffers and graphics pipelines depend on
+/// the render targets of fragment passes, they are created on first use and
+/// cached per pass. Each cache evicts its least recently used object once full.
+///
+/// @ingroup VKBackend
+typedef struct FfxmObjectCacheStatsVK {
+    uint64_t                hits;               /// Lookups which found the object in the cache
+    uint64_t                misses;             /// Lookups which had to create the object
+    uint64_t                evictions;          /// Objects destroyed to make room for new ones
+    uint32_t                count;              /// Objects currently alive, over all passes
+    uint32_t                capacity;           /// Maximum number of objects of a single pass
+} FfxmObjectCacheStatsVK;
+
+/// Statistics of the VK backend, accumulated since the first effect context was created.
+///
+/// @ingroup VKBackend
+typedef struct FfxmBackendStatsVK {
+    FfxmObjectCacheStatsVK  renderPasses;
+    FfxmObjectCacheStatsVK  imageViews;
+    FfxmObjectCacheStatsVK  frameBuffers;
+    FfxmObjectCacheStatsVK  graphicsPipelines;
+} FfxmBackendStatsVK;
+
+/// Retrieve the statistics of the VK backend.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxmInterface</i></c> populated by <c><i>ffxmGetInterfaceVK</i></c>.
+/// @param [out] stats                      A pointer to a <c><i>FfxmBackendStatsVK</i></c> receiving the statistics.
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_CODE_INVALID_POINTER          The <c><i>backendInterface</i></c> or <c><i>stats</i></c> pointer was <c><i>NULL</i></c>.
+/// @retval
+/// FFXM_ERROR_BACKEND_API_ERROR             No effect context is alive.
+///
+/// @ingroup VKBackend
+FFXM_API FfxmErrorCode ffxmGetBackendStatsVK(FfxmInterface* backendInterface, FfxmBackendStatsVK* stats);
+
+/// Set the queue families of the graphics and asynchronous compute command lists.
+///
+/// When the two families differ, the backend creates its resources with concurrent sharing
+/// between them, and the application resources read on the compute queue (the input color)
+/// must be created the same way. Using the same family for both queues avoids concurrent
+/// sharing, which can disable the compression of the images on some devices.
+///
+/// The families are kept in the scratch memory of the interface, so they only apply to the
+/// contexts created with that interface. <c><i>ffxmGetInterfaceVK</i></c> resets them.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxmInterface</i></c> populated by <c><i>ffxmGetInterfaceVK</i></c>.
+/// @param [in] graphicsQueueFamilyIndex    The queue family of the command list passed to the dispatch.
+/// @param [in] asyncComputeQueueFamilyIndex The queue family of the asynchronous compute command list passed to the dispatch.
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_CODE_INVALID_POINTER          The <c><i>backendInterface</i></c> pointer was <c><i>NULL</i></c>.
+/// @retval
+/// FFXM_ERROR_BACKEND_API_ERROR             An effect context is alive, the families must be set before the first one is created.
+///
+/// @ingroup VKBackend
+FFXM_API FfxmErrorCode ffxmSetAsyncComputeQueueFamiliesVK(FfxmInterface* backendInterface, uint32_t graphicsQueueFamilyIndex, uint32_t asyncComputeQueueFamilyIndex);
+
+/// Retrieve the semaphore ordering the asynchronous compute command list of the last dispatch
+/// before its graphics command list.
+///
+/// The application submits the asynchronous compute command list after the work producing the
+/// dispatch inputs, signalling the semaphore, and the graphics command list waits on it with
+/// <c><i>waitStageMask</i></c>. The semaphore is <c><i>VK_NULL_HANDLE</i></c> when no job was recorded
+/// on the asynchronous compute command list, and nothing must wait on it then.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxmInterface</i></c> populated by <c><i>ffxmGetInterfaceVK</i></c>.
+/// @param [out] semaphore                  A pointer to a <c><i>VkSemaphore</i></c> receiving the semaphore.
+/// @param [out] waitStageMask              An optional pointer receiving the stages of the graphics command list waiting on the semaphore.
+///
+/// @retval
+/// FFXM_OK                                  The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_CODE_INVALID_POINTER          The <c><i>backendInterface</i></c> or <c><i>semaphore</i></c> pointer was <c><i>NULL</i></c>.
+/// @retval
+/// FFXM_ERROR_BACKEND_API_ERROR             No effect context is alive.
+///
+/// @ingroup VKBackend
+FFXM_API FfxmErrorCode ffxmGetAsyncComputeSemaphoreVK(FfxmInterface* backendInterface, VkSemaphore* semaphore, VkPipelineStageFlags* waitStageMask);
+
 #if defined(__cplusplus)
 }
 #endif // #if defined(__cplusplus)
@@ -59,6 +59,21 @@ namespace arm
 /// @ingroup ffxmFsr2
 #define FFXM_FSR2_CONTEXT_SIZE (24576)
 
+/// The size of the dynamic resolution controller specified in 32bit values.
+///
+/// @ingroup ffxmFsr2
+#define FFXM_FSR2_DRS_CONTROLLER_SIZE (64)
+
+/// The maximum number of display regions of a dispatch.
+///
+/// @ingroup ffxmFsr2
+#define FFXM_FSR2_MAX_DISPATCH_REGIONS (FFXM_MAX_NUM_SCISSOR_RECTS)
+
+/// The maximum number of gaze centers of a foveated dispatch.
+///
+/// @ingroup ffxmFsr2
+#define FFXM_FSR2_MAX_FOVEATION_CENTERS (2)
+
 #if defined(__cplusplus)
 extern "C" {
 #endif // #if defined(__cplusplus)
@@ -149,6 +164,14 @@ typedef enum FfxmFsr2InitializationFlagBits {
     FFXM_FSR2_ENABLE_TEXTURE1D_USAGE                     = (1<<7),   ///< A bit indicating that the backend should use 1D textures.
     FFXM_FSR2_ENABLE_DEBUG_CHECKING                      = (1<<8),   ///< A bit indicating that the runtime should check some API values and report issues.
 	FFXM_FSR2_OPENGL_ES_3_2							     = (1<<9),   ///< A bit indicating that Arm ASR should run in a GLES 3.2 friendly manner
+    FFXM_FSR2_ENABLE_PIPELINE_PREWARM                    = (1<<10),  ///< A bit indicating that the render state of all pipelines should be built at context creation rather than at first dispatch.
+    FFXM_FSR2_ENABLE_RESOURCE_ALIASING                   = (1<<11),  ///< A bit indicating that internal resources with disjoint lifetimes within a frame should share memory, when the backend supports it. Saves little outside of the 'Ultra Performance' shader quality mode.
+    FFXM_FSR2_ENABLE_SUBPASS_MERGING                     = (1<<12),  ///< A bit indicating that consecutive render resolution fragment passes should be recorded as subpasses of one render pass, when the backend supports it.
+    FFXM_FSR2_ENABLE_GPU_TIMINGS                         = (1<<13),  ///< A bit indicating that the GPU time of each pass should be measured, when the backend supports it.
+    FFXM_FSR2_ENABLE_HALF_RES_DEPTH_CLIP                 = (1<<14),  ///< A bit indicating that disocclusion and motion divergence should be evaluated at half render resolution, used with the 'Performance' and 'Ultra Performance' shader quality modes.
+    FFXM_FSR2_ENABLE_FUSED_RECONSTRUCT_AND_LOCK          = (1<<15),  ///< A bit indicating that the previous depth reconstruction should run within the lock compute pass rather than as a separate fragment pass.
+    FFXM_FSR2_ENABLE_SUBGROUP_LUMINANCE_PYRAMID          = (1<<16),  ///< A bit indicating that the luminance pyramid should be reduced with subgroup operations, producing only the levels the upscaler reads. Requires subgroup arithmetic support.
+    FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE                = (1<<17),  ///< A bit indicating that the upsampling kernel weights should be read from a table precomputed for the upscaling ratio and the jitter sequence, when the ratio allows it.
 } FfxmFsr2InitializationFlagBits;
 
 /// An enumeration of bit flags used when creating a reactive mask
@@ -186,8 +209,27 @@ typedef struct FfxmFsr2ContextDescription {
     FfxmDimensions2D             displaySize;                        ///< The size of the presentation resolution targeted by the upscaling process.
     FfxmInterface                backendInterface;                   ///< A set of pointers to the backend implementation for FidelityFX SDK
     FfxmFsr2Message              fpMessage;                          ///< A pointer to a function that can receive messages from the runtime.
+    FfxmSurfaceFormat            outputFormat;                       ///< The format of the output resource, only used, and then required, when <c><i>FFXM_FSR2_ENABLE_PIPELINE_PREWARM</i></c> is set.
+    uint32_t                    viewCount;                          ///< The number of views upscaled together by <c><i>ffxmFsr2ContextDispatchMultiView</i></c>, up to <c><i>FFXM_MAX_VIEW_COUNT</i></c>. 0 is the same as 1.
 } FfxmFsr2ContextDescription;
 
+/// A structure describing the foveation of a dispatch.
+///
+/// The pixels of the output further than <c><i>radius</i></c> plus
+/// <c><i>falloff</i></c> from every gaze center are upscaled with a cheaper
+/// reconstruction and are neither locked nor sharpened. The sharpening fades
+/// out over the <c><i>falloff</i></c>. Distances are expressed as fractions of
+/// the output height, so the foveated areas stay circular on the display.
+///
+/// @ingroup ffxmFsr2
+typedef struct FfxmFsr2FoveationDescription {
+
+    FfxmFloatCoords2D            centers[FFXM_FSR2_MAX_FOVEATION_CENTERS]; ///< The gaze centers, in normalized coordinates of the output.
+    uint32_t                    centerCount;                        ///< The number of <c><i>centers</i></c>, up to <c><i>FFXM_FSR2_MAX_FOVEATION_CENTERS</i></c>. 0 disables the foveation.
+    float                       radius;                             ///< The radius of the full quality area around each center.
+    float                       falloff;                            ///< The width of the transition band around the full quality areas.
+} FfxmFsr2FoveationDescription;
+
 /// A structure encapsulating the parameters for dispatching the various passes
 /// of FidelityFX Super Resolution 2.
 ///
@@ -214,6 +256,11 @@ typedef struct FfxmFsr2DispatchDescription {
     float                       cameraFar;                          ///< The distance to the far plane of the camera.
     float                       cameraFovAngleVertical;             ///< The camera angle field of view in the vertical direction (expressed in radians).
     float                       viewSpaceToMetersFactor;            ///< The scale factor to convert view space units to meters
+    FfxmCommandList              asyncComputeCommandList;            ///< (optional) A <c><i>FfxmCommandList</i></c> of an asynchronous compute queue to record the luminance pyramid into, when the backend implements <c><i>fpExecuteGpuJobsAsync</i></c>.
+    const FfxmRect2D*            regions;                            ///< (optional) An array of <c><i>regionCount</i></c> rectangles of the output (at presentation resolution) to upscale, the rest of the output and of the history is left untouched.
+    uint32_t                    regionCount;                        ///< The number of <c><i>regions</i></c>, up to <c><i>FFXM_FSR2_MAX_DISPATCH_REGIONS</i></c>. 0 upscales the whole output.
+    FfxmFsr2FoveationDescription foveation;                         ///< (optional) The gaze centers of a foveated output, see <c><i>FfxmFsr2FoveationDescription</i></c>.
+    uint32_t                    jitterIndex;                        ///< (optional) The index passed to <c><i>ffxmFsr2GetJitterOffset</i></c> to compute <c><i>jitterOffset</i></c>, it selects the weights of the frame with <c><i>FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE</i></c>.
 } FfxmFsr2DispatchDescription;
 
 /// A structure encapsulating the parameters for automatic generation of a reactive mask
@@ -249,6 +296,35 @@ typedef struct FfxmFsr2Context
     uint32_t data[FFXM_FSR2_CONTEXT_SIZE * 2];  ///< An opaque set of <c>uint32_t</c> which contain the data for the context.
 } FfxmFsr2Context;
 
+/// A structure encapsulating the parameters of a dynamic resolution controller.
+///
+/// @ingroup ffxmFsr2
+typedef struct FfxmFsr2DrsControllerDescription {
+    FfxmDimensions2D             maxRenderSize;                      ///< The largest render size, usually the <c><i>maxRenderSize</i></c> of the FSR2 context.
+    FfxmDimensions2D             minRenderSize;                      ///< The smallest render size. 0 selects half of <c><i>maxRenderSize</i></c>.
+    float                       targetFrameTime;                    ///< The GPU frame time budget in milliseconds.
+    float                       hysteresis;                         ///< The distance below the budget, relative to it, within which the render size is kept. 0 selects 0.05.
+    uint32_t                    sizeStep;                           ///< The render sizes are multiples of this number of pixels. 0 selects 8.
+    uint32_t                    latencyFrames;                      ///< The number of frames between a render size change and the first GPU timing measured at the new size.
+    float                       proportionalGain;                   ///< The gain applied to the change of the frame time error. Defaults are used when the three gains are 0.
+    float                       integralGain;                       ///< The gain applied to the frame time error.
+    float                       derivativeGain;                     ///< The gain applied to the second difference of the frame time error.
+} FfxmFsr2DrsControllerDescription;
+
+/// A dynamic resolution controller.
+///
+/// The controller picks the render size of the next frame from the GPU time
+/// of the previous ones, to keep the frame within a budget. It does not hold
+/// any GPU object, and is independent from the FSR2 context; the context
+/// must be created with <c><i>FFXM_FSR2_ENABLE_DYNAMIC_RESOLUTION</i></c>
+/// and a <c><i>maxRenderSize</i></c> covering the sizes of the controller.
+///
+/// @ingroup ffxmFsr2
+typedef struct FfxmFsr2DrsController
+{
+    uint32_t data[FFXM_FSR2_DRS_CONTROLLER_SIZE];  ///< An opaque set of <c>uint32_t</c> which contain the data for the controller.
+} FfxmFsr2DrsController;
+
 
 /// Create a FidelityFX Super Resolution 2 context from the parameters
 /// programmed to the <c><i>FfxmFsr2CreateParams</i></c> structure.
@@ -291,6 +367,9 @@ typedef struct FfxmFsr2Context
 /// @retval
 /// FFXM_ERROR_INCOMPLETE_INTERFACE      The operation failed because the <c><i>FfxmFsr2ContextDescription.callbacks</i></c>  was not fully specified.
 /// @retval
+/// FFXM_ERROR_INVALID_ARGUMENT          The operation failed because <c><i>FfxmFsr2ContextDescription.viewCount</i></c> was larger than <c><i>FFXM_MAX_VIEW_COUNT</i></c>,
+///                                      or because <c><i>FFXM_FSR2_ENABLE_PIPELINE_PREWARM</i></c> was set without an <c><i>outputFormat</i></c>.
+/// @retval
 /// FFXM_ERROR_BACKEND_API_ERROR         The operation failed because of an error returned from the backend.
 ///
 /// @ingroup ffxmFsr2
@@ -320,6 +399,20 @@ FFXM_API FfxmErrorCode ffxmFsr2ContextCreate(FfxmFsr2Context* pContext, const Ff
 /// documentation for <c><i>ffxmFsr2GetJitterOffset</i></c> as well as the
 /// accompanying overview documentation for FSR2.
 ///
+/// When the <c><i>regions</i></c> of the <c><i>dispatchDescription</i></c> are
+/// set, only those rectangles of the output are upscaled: the render resolution
+/// passes cover the matching input rectangles plus a border for the filter
+/// footprints and the jitter, and the rest of the output and of the history is
+/// left untouched. The whole output is still upscaled for two frames after the
+/// regions change, so the history is valid wherever the next regions land.
+///
+/// When the <c><i>foveation</i></c> of the <c><i>dispatchDescription</i></c>
+/// has gaze centers, the periphery of the output uses a 5 tap upsampling
+/// kernel, a bilinear history fetch and no locks or sharpening, while the
+/// areas around the centers keep the full quality path. This suits head
+/// mounted displays, where most of the display resolution pixels of the
+/// accumulation are peripheral.
+///
 /// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
 /// @param [in] pDispatchDescription     A pointer to a <c><i>FfxmFsr2DispatchDescription</i></c> structure.
 ///
@@ -330,6 +423,8 @@ FFXM_API FfxmErrorCode ffxmFsr2ContextCreate(FfxmFsr2Context* pContext, const Ff
 /// @retval
 /// FFXM_ERROR_OUT_OF_RANGE              The operation failed because <c><i>dispatchDescription.renderSize</i></c> was larger than the maximum render resolution.
 /// @retval
+/// FFXM_ERROR_INVALID_ARGUMENT          The operation failed because <c><i>dispatchDescription.regionCount</i></c> was larger than <c><i>FFXM_FSR2_MAX_DISPATCH_REGIONS</i></c>, <c><i>regions</i></c> was <c><i>NULL</i></c> with a non zero count, a region was empty or outside the output, <c><i>foveation.centerCount</i></c> was larger than <c><i>FFXM_FSR2_MAX_FOVEATION_CENTERS</i></c>, or the foveation <c><i>radius</i></c> or <c><i>falloff</i></c> was negative.
+/// @retval
 /// FFXM_ERROR_NULL_DEVICE               The operation failed because the device inside the context was <c><i>NULL</i></c>.
 /// @retval
 /// FFXM_ERROR_BACKEND_API_ERROR         The operation failed because of an error returned from the backend.
@@ -337,6 +432,37 @@ FFXM_API FfxmErrorCode ffxmFsr2ContextCreate(FfxmFsr2Context* pContext, const Ff
 /// @ingroup ffxmFsr2
 FFXM_API FfxmErrorCode ffxmFsr2ContextDispatch(FfxmFsr2Context* pContext, const FfxmFsr2DispatchDescription* pDispatchDescription);
 
+/// Dispatch the FSR2 passes of several views, such as the eyes of a stereo
+/// rendering or the players of a split-screen game, in one call.
+///
+/// The views share the pipelines and the lookup tables of the context, and
+/// their jobs are executed together. This is not a batched dispatch: every
+/// view takes one effect context of the backend for its internal resources,
+/// and each pass is scheduled once per view with its own constants. Each view
+/// keeps its own history, so a view must always be dispatched at the same
+/// index. The context must have been created with a <c><i>viewCount</i></c>
+/// of at least <c><i>viewCount</i></c>.
+/// All the dispatch descriptions must record into the same command lists.
+/// <c><i>ffxmFsr2ContextDispatch</i></c> dispatches the first view only.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
+/// @param [in] pDispatchDescriptions    An array of <c><i>viewCount</i></c> <c><i>FfxmFsr2DispatchDescription</i></c> structures, one per view.
+/// @param [in] viewCount                The number of views to upscale.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_CODE_NULL_POINTER         The operation failed because either <c><i>context</i></c> or <c><i>dispatchDescriptions</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFXM_ERROR_INVALID_ARGUMENT          The operation failed because <c><i>viewCount</i></c> was 0 or larger than the view count of the context, the command lists of the views differ, or the regions or the foveation of a view are invalid.
+/// @retval
+/// FFXM_ERROR_OUT_OF_RANGE              The operation failed because the <c><i>renderSize</i></c> of a view was larger than the maximum render resolution.
+/// @retval
+/// FFXM_ERROR_NULL_DEVICE               The operation failed because the device inside the context was <c><i>NULL</i></c>.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2ContextDispatchMultiView(FfxmFsr2Context* pContext, const FfxmFsr2DispatchDescription* pDispatchDescriptions, uint32_t viewCount);
+
 /// A helper function generate a Reactive mask from an opaque only texure and one containing translucent objects.
 ///
 /// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
@@ -360,6 +486,133 @@ FFXM_API FfxmErrorCode ffxmFsr2ContextGenerateReactiveMask(FfxmFsr2Context* pCon
 /// @ingroup ffxmFsr2
 FFXM_API FfxmErrorCode ffxmFsr2ContextDestroy(FfxmFsr2Context* pContext);
 
+/// Query the amount of memory saved by aliasing internal resources.
+///
+/// Only non-zero when the context was created with
+/// <c><i>FFXM_FSR2_ENABLE_RESOURCE_ALIASING</i></c> and the backend
+/// implements <c><i>fpCreateAliasedResources</i></c>. Outside of the 'Ultra
+/// Performance' mode, the saving is bounded by the size of the new locks,
+/// which are then cleared every frame: about 2 MiB at a 1920x1080 display
+/// size.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
+/// @param [out] pSavedMemorySize        A pointer to a <c>size_t</c> which will hold the number of bytes saved.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           Either <c><i>pContext</i></c> or <c><i>pSavedMemorySize</i></c> was <c>NULL</c>.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2ContextGetAliasedMemorySavings(FfxmFsr2Context* pContext, size_t* pSavedMemorySize);
+
+/// Query the GPU time spent in each pass.
+///
+/// Requires a context created with <c><i>FFXM_FSR2_ENABLE_GPU_TIMINGS</i></c>
+/// and a backend implementing <c><i>fpEnableGpuTimings</i></c> and
+/// <c><i>fpGetGpuTimings</i></c>. The results are read without waiting for
+/// the GPU, so they are those of the frame dispatched
+/// <c><i>FFXM_MAX_QUEUED_FRAMES</i></c> frames before the last dispatch,
+/// which has completed. The timings of the views dispatched together are
+/// summed.
+///
+/// The timings are indexed by <c><i>FfxmFsr2Pass</i></c>. Passes which did
+/// not run in that frame are reported as 0, as well as the jobs recorded on
+/// an asynchronous compute command list, which overlap other work. When
+/// <c><i>FFXM_FSR2_ENABLE_SUBPASS_MERGING</i></c> is set, the time of the
+/// merged render pass is reported for its first pass.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
+/// @param [out] pPassTimings            A pointer to <c><i>FFXM_FSR2_PASS_COUNT</i></c> <c>uint64_t</c> receiving the time of each pass in nanoseconds.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           Either <c><i>pContext</i></c> or <c><i>pPassTimings</i></c> was <c>NULL</c>.
+/// @retval
+/// FFXM_ERROR_INCOMPLETE_INTERFACE      The context does not measure GPU timings.
+/// @retval
+/// FFXM_ERROR_BACKEND_API_ERROR         The backend could not read the timings back.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2ContextGetPassTimings(FfxmFsr2Context* pContext, uint64_t* pPassTimings);
+
+/// Get the flags a context runs with.
+///
+/// These are the <c><i>FfxmFsr2InitializationFlagBits</i></c> of the
+/// context description, without the features that were not available at the
+/// creation of the context.
+///
+/// The prebuilt shaders and the shader archives don't have the permutations
+/// of <c><i>FFXM_FSR2_ENABLE_HALF_RES_DEPTH_CLIP</i></c>,
+/// <c><i>FFXM_FSR2_ENABLE_FUSED_RECONSTRUCT_AND_LOCK</i></c>,
+/// <c><i>FFXM_FSR2_ENABLE_SUBGROUP_LUMINANCE_PYRAMID</i></c> and
+/// <c><i>FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE</i></c>. When the backend
+/// reads its shaders from them, the context drops these flags: the depth
+/// clip runs at full render resolution, the previous depth is reconstructed
+/// by its own pass, SPD reduces the luminance and the accumulation reads the
+/// 1D Lanczos LUT.
+/// <c><i>FFXM_FSR2_ENABLE_SUBGROUP_LUMINANCE_PYRAMID</i></c> is also dropped
+/// when the device has no subgroup arithmetic in compute shaders, and
+/// <c><i>FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE</i></c> when the table of the
+/// upscaling ratio would be too large.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
+/// @param [out] pFlags                  A pointer to a <c>uint32_t</c> receiving the flags.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           Either <c><i>pContext</i></c> or <c><i>pFlags</i></c> was <c>NULL</c>.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2ContextGetFlags(FfxmFsr2Context* pContext, uint32_t* pFlags);
+
+/// Start writing the dispatches of a context to a capture file.
+///
+/// Each following call to <c><i>ffxmFsr2ContextDispatch</i></c> appends its
+/// parameters, its input textures and the upscaled output to the file, in the
+/// format described by <c><i>ffxm_fsr2_capture.h</i></c>, until
+/// <c><i>ffxmFsr2ContextEndCapture</i></c> is called. The textures are read
+/// back right after the jobs of the dispatch are executed, which requires a
+/// backend implementing <c><i>fpReadResource</i></c>. Dispatches of more than
+/// one view are not captured, and make <c><i>ffxmFsr2ContextEndCapture</i></c>
+/// fail.
+///
+/// Captures are meant for debugging and regression testing, reading the
+/// textures back stalls the dispatch.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
+/// @param [in] pFilePath                The path of the capture file, overwritten if it exists.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           Either <c><i>pContext</i></c> or <c><i>pFilePath</i></c> was <c>NULL</c>.
+/// @retval
+/// FFXM_ERROR_INCOMPLETE_INTERFACE      The backend cannot read resources back.
+/// @retval
+/// FFXM_ERROR_INVALID_PATH              The capture file could not be created.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2ContextBeginCapture(FfxmFsr2Context* pContext, const char* pFilePath);
+
+/// Stop capturing the dispatches of a context and close the capture file.
+///
+/// Calling this function on a context which is not capturing does nothing.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxmFsr2Context</i></c> structure.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           <c><i>pContext</i></c> was <c>NULL</c>.
+/// @retval
+/// FFXM_ERROR_INVALID_PATH              The capture file could not be written completely, or a dispatch of more than one view was not captured.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2ContextEndCapture(FfxmFsr2Context* pContext);
+
 /// Get the upscale ratio from the quality mode.
 ///
 /// The following table enumerates the mapping of the quality modes to
@@ -409,6 +662,66 @@ FFXM_API FfxmErrorCode ffxmFsr2GetRenderResolutionFromUpscalingRatio(
     uint32_t displayHeight,
     FfxmFsr2UpscalingRatio upscalingRatio);
 
+/// Create a dynamic resolution controller.
+///
+/// The controller starts at <c><i>maxRenderSize</i></c>.
+///
+/// @param [out] pController            A pointer to a <c><i>FfxmFsr2DrsController</i></c> structure to populate.
+/// @param [in]  pDescription           A pointer to a <c><i>FfxmFsr2DrsControllerDescription</i></c> structure.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           Either <c><i>pController</i></c> or <c><i>pDescription</i></c> was <c>NULL</c>.
+/// @retval
+/// FFXM_ERROR_INVALID_ARGUMENT          The budget is not positive, or the sizes are empty or not ordered.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2DrsControllerCreate(FfxmFsr2DrsController* pController, const FfxmFsr2DrsControllerDescription* pDescription);
+
+/// Feed the GPU time of a frame to a dynamic resolution controller and get
+/// the render size of the next frame.
+///
+/// The controller runs a PID loop on the frame time error relative to the
+/// budget, in velocity form, so that the render scale does not wind up while
+/// it is clamped. Frame times within the hysteresis band below the budget
+/// leave the scale unchanged.
+/// The render size only changes once the scale has moved most of a size step
+/// away from the current size, which avoids reallocating the application's
+/// render targets every frame. After a change, the next
+/// <c><i>latencyFrames</i></c> timings are ignored since they were measured
+/// at the previous size.
+///
+/// The result only depends on the sequence of timings, so traces can be
+/// replayed to tune the parameters.
+///
+/// @param [inout] pController          A pointer to a <c><i>FfxmFsr2DrsController</i></c> structure.
+/// @param [in]    gpuFrameTime         The GPU time of the last frame in milliseconds.
+/// @param [out]   pRenderSize          A pointer to a <c><i>FfxmDimensions2D</i></c> receiving the render size of the next frame.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           Either <c><i>pController</i></c> or <c><i>pRenderSize</i></c> was <c>NULL</c>.
+/// @retval
+/// FFXM_ERROR_INVALID_ARGUMENT          The frame time was negative or not a number.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2DrsControllerUpdate(FfxmFsr2DrsController* pController, float gpuFrameTime, FfxmDimensions2D* pRenderSize);
+
+/// Reset a dynamic resolution controller to <c><i>maxRenderSize</i></c>,
+/// for instance after a camera cut to a scene with a different cost.
+///
+/// @param [inout] pController          A pointer to a <c><i>FfxmFsr2DrsController</i></c> structure.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_POINTER           <c><i>pController</i></c> was <c>NULL</c>.
+///
+/// @ingroup ffxmFsr2
+FFXM_API FfxmErrorCode ffxmFsr2DrsControllerReset(FfxmFsr2DrsController* pController);
+
 /// A helper function to calculate the jitter phase count from display
 /// resolution.
 ///
@@ -0,0 +1,157 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <stdint.h>
+
+namespace arm
+{
+
+/// @defgroup ffxmFsr2Capture FSR2 capture file format
+/// The binary layout of the files written by <c><i>ffxmFsr2ContextBeginCapture</i></c>.
+///
+/// A capture starts with a <c><i>FfxmFsr2CaptureFileHeader</i></c> followed by
+/// a sequence of chunks, each made of a <c><i>FfxmFsr2CaptureChunkHeader</i></c>
+/// and <c><i>size</i></c> bytes of payload. The first chunk describes the
+/// context, then each dispatch writes a frame chunk, a regions chunk when the
+/// dispatch has regions, a foveation chunk when it is foveated, and one texture
+/// chunk per resource set in its
+/// <c><i>textureMask</i></c>, the output last.
+/// All values are little endian and chunks are not padded, readers skip the
+/// chunks they do not know.
+///
+/// @ingroup ffxmFsr2
+
+/// The magic number at the start of a capture file, "ASRC".
+///
+/// @ingroup ffxmFsr2Capture
+#define FFXM_FSR2_CAPTURE_MAGIC     (0x43525341u)
+
+/// The version of the capture file format.
+///
+/// @ingroup ffxmFsr2Capture
+#define FFXM_FSR2_CAPTURE_VERSION   (2)
+
+/// An enumeration of the chunks of a capture file.
+///
+/// @ingroup ffxmFsr2Capture
+typedef enum FfxmFsr2CaptureChunkType {
+
+    FFXM_FSR2_CAPTURE_CHUNK_CONTEXT = 1,                ///< A <c><i>FfxmFsr2CaptureContextChunk</i></c>.
+    FFXM_FSR2_CAPTURE_CHUNK_FRAME   = 2,                ///< A <c><i>FfxmFsr2CaptureFrameChunk</i></c>.
+    FFXM_FSR2_CAPTURE_CHUNK_TEXTURE = 3,                ///< A <c><i>FfxmFsr2CaptureTextureChunk</i></c> followed by the texels.
+    FFXM_FSR2_CAPTURE_CHUNK_REGIONS = 4,                ///< The <c><i>FfxmFsr2DispatchDescription::regions</i></c> of the frame, 4 <c><i>uint32_t</i></c> per region: x, y, width and height.
+    FFXM_FSR2_CAPTURE_CHUNK_FOVEATION = 5,              ///< A <c><i>FfxmFsr2CaptureFoveationChunk</i></c>.
+} FfxmFsr2CaptureChunkType;
+
+/// An enumeration of the textures of a dispatch stored in a capture.
+///
+/// @ingroup ffxmFsr2Capture
+typedef enum FfxmFsr2CaptureTexture {
+
+    FFXM_FSR2_CAPTURE_TEXTURE_COLOR,                    ///< <c><i>FfxmFsr2DispatchDescription::color</i></c>.
+    FFXM_FSR2_CAPTURE_TEXTURE_DEPTH,                    ///< <c><i>FfxmFsr2DispatchDescription::depth</i></c>.
+    FFXM_FSR2_CAPTURE_TEXTURE_MOTION_VECTORS,           ///< <c><i>FfxmFsr2DispatchDescription::motionVectors</i></c>.
+    FFXM_FSR2_CAPTURE_TEXTURE_EXPOSURE,                 ///< <c><i>FfxmFsr2DispatchDescription::exposure</i></c>.
+    FFXM_FSR2_CAPTURE_TEXTURE_REACTIVE,                 ///< <c><i>FfxmFsr2DispatchDescription::reactive</i></c>.
+    FFXM_FSR2_CAPTURE_TEXTURE_TRANSPARENCY_AND_COMPOSITION, ///< <c><i>FfxmFsr2DispatchDescription::transparencyAndComposition</i></c>.
+    FFXM_FSR2_CAPTURE_TEXTURE_OUTPUT,                   ///< <c><i>FfxmFsr2DispatchDescription::output</i></c>, after the dispatch.
+
+    FFXM_FSR2_CAPTURE_TEXTURE_COUNT
+} FfxmFsr2CaptureTexture;
+
+/// The header at the start of a capture file.
+///
+/// @ingroup ffxmFsr2Capture
+typedef struct FfxmFsr2CaptureFileHeader {
+
+    uint32_t                    magic;                              ///< <c><i>FFXM_FSR2_CAPTURE_MAGIC</i></c>.
+    uint32_t                    version;                            ///< <c><i>FFXM_FSR2_CAPTURE_VERSION</i></c>.
+} FfxmFsr2CaptureFileHeader;
+
+/// The header of each chunk of a capture file.
+///
+/// @ingroup ffxmFsr2Capture
+typedef struct FfxmFsr2CaptureChunkHeader {
+
+    uint32_t                    type;                               ///< A <c><i>FfxmFsr2CaptureChunkType</i></c>.
+    uint32_t                    size;                               ///< The size of the payload following the header, in bytes.
+} FfxmFsr2CaptureChunkHeader;
+
+/// The creation parameters of the captured context.
+///
+/// @ingroup ffxmFsr2Capture
+typedef struct FfxmFsr2CaptureContextChunk {
+
+    uint32_t                    qualityMode;                        ///< The <c><i>FfxmFsr2ShaderQualityMode</i></c> of the context.
+    uint32_t                    flags;                              ///< The <c><i>FfxmFsr2InitializationFlagBits</i></c> of the context.
+    uint32_t                    maxRenderSize[2];                   ///< The maximum render size of the context.
+    uint32_t                    displaySize[2];                     ///< The display size of the context.
+} FfxmFsr2CaptureContextChunk;
+
+/// The parameters of one captured dispatch.
+///
+/// @ingroup ffxmFsr2Capture
+typedef struct FfxmFsr2CaptureFrameChunk {
+
+    uint32_t                    frameIndex;                         ///< The index of the dispatch since the start of the capture.
+    uint32_t                    textureMask;                        ///< A bit per <c><i>FfxmFsr2CaptureTexture</i></c> stored for this frame.
+    float                       jitterOffset[2];
+    float                       motionVectorScale[2];
+    uint32_t                    renderSize[2];
+    uint32_t                    enableSharpening;
+    float                       sharpness;
+    float                       frameTimeDelta;
+    float                       preExposure;
+    uint32_t                    reset;
+    float                       cameraNear;
+    float                       cameraFar;
+    float                       cameraFovAngleVertical;
+    float                       viewSpaceToMetersFactor;
+    uint32_t                    jitterIndex;
+} FfxmFsr2CaptureFrameChunk;
+
+/// The <c><i>FfxmFsr2DispatchDescription::foveation</i></c> of a captured dispatch.
+///
+/// @ingroup ffxmFsr2Capture
+typedef struct FfxmFsr2CaptureFoveationChunk {
+
+    uint32_t                    centerCount;
+    float                       centers[4];                         ///< The x and y of the 2 gaze centers, the unused ones are 0.
+    float                       radius;
+    float                       falloff;
+} FfxmFsr2CaptureFoveationChunk;
+
+/// The description of a captured texture, followed by the texels of mip 0,
+/// tightly packed row after row.
+///
+/// @ingroup ffxmFsr2Capture
+typedef struct FfxmFsr2CaptureTextureChunk {
+
+    uint32_t                    texture;                            ///< A <c><i>FfxmFsr2CaptureTexture</i></c>.
+    uint32_t                    format;                             ///< The <c><i>FfxmSurfaceFormat</i></c> of the texels.
+    uint32_t                    width;
+    uint32_t                    height;
+} FfxmFsr2CaptureTextureChunk;
+
+} // namespace arm
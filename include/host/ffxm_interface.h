@@ -201,6 +201,39 @@ typedef FfxmErrorCode (*FfxmCreateResourceFunc)(
     FfxmUInt32 effectContextId,
     FfxmResourceInternal* outResource);
 
+/// Create a set of transient resources which may share memory.
+///
+/// Resources given the same alias slot are placed in the same memory
+/// allocation. The caller guarantees that the lifetimes of resources sharing a
+/// slot never overlap within a frame, and that each of them is fully written
+/// before being read. The backend is responsible for the aliasing barriers
+/// needed when the memory of a slot changes hands, the content of a resource is
+/// undefined at the start of its lifetime. Resources with initial data cannot
+/// be aliased. This callback is optional and may be <c><i>NULL</i></c>.
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [in] createResourceDescriptions          An array of <c><i>resourceCount</i></c> resource descriptions.
+/// @param [in] aliasSlots                          The alias slot of each resource, less than <c><i>FFXM_MAX_ALIAS_HEAPS</i></c>.
+/// @param [in] resourceCount                       The number of resources to create.
+/// @param [in] effectContextId                     The context space to be used for the effect in question.
+/// @param [out] outResources                       An array of <c><i>resourceCount</i></c> <c><i>FfxmResourceInternal</i></c> objects.
+/// @param [out] outSavedMemorySize                 The amount of memory (in bytes) saved compared to dedicated allocations.
+///
+/// @retval
+/// FFXM_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxmInterface
+typedef FfxmErrorCode (*FfxmCreateAliasedResourcesFunc)(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescriptions,
+    const FfxmUInt32* aliasSlots,
+    FfxmUInt32 resourceCount,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResources,
+    size_t* outSavedMemorySize);
+
 /// Register a resource in the backend for the current frame.
 ///
 /// Since the FfxmInterface and the backends are not aware how many different
@@ -326,6 +359,30 @@ typedef FfxmErrorCode (*FfxmCreatePipelineFunc)(
     FfxmUInt32 effectContextId,
     FfxmPipelineState* outPipeline);
 
+/// Build the render state of a graphics pipeline ahead of its first use.
+///
+/// Render passes and pipeline objects of graphics pipelines depend on the
+/// formats of the render targets, which are otherwise only known when the
+/// first job using the pipeline is executed. This callback is optional and
+/// may be <c><i>NULL</i></c>.
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [inout] pipeline                         A pointer to a <c><i>FfxmPipelineState</i></c> created with <c><i>fpCreateGraphicsPipeline</i></c>.
+/// @param [in] rtDescriptions                      The descriptions of the render targets the pipeline will write, in binding order.
+/// @param [in] rtCount                             The number of entries in <c><i>rtDescriptions</i></c>.
+///
+/// @retval
+/// FFXM_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxmInterface
+typedef FfxmErrorCode (*FfxmPrewarmGraphicsPipelineFunc)(
+    FfxmInterface* backendInterface,
+    FfxmPipelineState* pipeline,
+    const FfxmResourceDescription* rtDescriptions,
+    FfxmUInt32 rtCount);
+
 /// Destroy a render pipeline.
 ///
 /// @param [in] backendInterface                    A pointer to the backend interface.
@@ -389,6 +446,94 @@ typedef FfxmErrorCode (*FfxmExecuteGpuJobsFunc)(
     FfxmInterface* backendInterface,
     FfxmCommandList commandList);
 
+/// Execute scheduled render jobs, recording the compute jobs marked
+/// <c><i>asyncCompute</i></c> on a command list of an asynchronous compute queue.
+///
+/// The backend records the synchronization between the two command lists
+/// which it can express itself, and reports what is left to the application
+/// for the submission of the command lists (e.g. the semaphore of the VK backend).
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [in] commandList                         A pointer to a <c><i>FfxmCommandList</i></c> structure.
+/// @param [in] asyncComputeCommandList             A pointer to a <c><i>FfxmCommandList</i></c> structure of the asynchronous compute queue.
+///
+/// @retval
+/// FFXM_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxmInterface
+typedef FfxmErrorCode (*FfxmExecuteGpuJobsAsyncFunc)(
+    FfxmInterface* backendInterface,
+    FfxmCommandList commandList,
+    FfxmCommandList asyncComputeCommandList);
+
+/// Start measuring the GPU time of the jobs of an effect context.
+///
+/// The backend records timestamps around the jobs whose pipeline belongs to
+/// the effect context, and accumulates them per pass of the pipeline. This
+/// callback is optional and may be <c><i>NULL</i></c>.
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [in] effectContextId                     The context space to be used for the effect in question.
+///
+/// @retval
+/// FFXM_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxmInterface
+typedef FfxmErrorCode (*FfxmEnableGpuTimingsFunc)(
+    FfxmInterface* backendInterface,
+    FfxmUInt32 effectContextId);
+
+/// Read back the GPU time of each pass of an effect context.
+///
+/// The results are those of the most recent frame known to have completed,
+/// <c><i>FFXM_MAX_QUEUED_FRAMES</i></c> frames before the last one. This
+/// callback is optional and may be <c><i>NULL</i></c>.
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [in] effectContextId                     The context space to be used for the effect in question.
+/// @param [out] passTimings                        The time of each pass in nanoseconds, indexed by the pass given to the pipeline creation.
+/// @param [in] passCount                           The number of entries in <c><i>passTimings</i></c>.
+///
+/// @retval
+/// FFXM_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxmInterface
+typedef FfxmErrorCode (*FfxmGetGpuTimingsFunc)(
+    FfxmInterface* backendInterface,
+    FfxmUInt32 effectContextId,
+    FfxmUInt64* passTimings,
+    FfxmUInt32 passCount);
+
+/// Read the texels of mip 0 of a resource back to host memory.
+///
+/// The texels are written tightly packed, row after row, in the format of the
+/// resource. The jobs writing the resource must have completed, so this is
+/// only implemented by backends executing their jobs synchronously. This
+/// callback is optional and may be <c><i>NULL</i></c>.
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [in] resource                            The resource to read.
+/// @param [out] data                               A pointer to the host memory receiving the texels, or <c><i>NULL</i></c> to query the size.
+/// @param [inout] dataSize                         The size of <c><i>data</i></c> in bytes, set to the size of mip 0 when <c><i>data</i></c> is <c><i>NULL</i></c>.
+///
+/// @retval
+/// FFXM_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxmInterface
+typedef FfxmErrorCode (*FfxmReadResourceFunc)(
+    FfxmInterface* backendInterface,
+    FfxmResourceInternal resource,
+    void* data,
+    size_t* dataSize);
+
 /// A structure encapsulating the interface between the core implementation of
 /// the FfxmInterface and any graphics API that it should ultimately call.
 ///
@@ -403,6 +548,7 @@ typedef FfxmErrorCode (*FfxmExecuteGpuJobsFunc)(
 ///     <c><i>FfxmGetDeviceCapabilitiesFunc</i></c>
 ///     <c><i>FfxmDestroyDeviceFunc</i></c>
 ///     <c><i>FfxmCreateResourceFunc</i></c>
+///     <c><i>FfxmCreateAliasedResourcesFunc</i></c>
 ///     <c><i>FfxmRegisterResourceFunc</i></c>
 ///     <c><i>FfxmGetResourceFunc</i></c>
 ///     <c><i>FfxmUnregisterResourcesFunc</i></c>
@@ -441,6 +587,7 @@ typedef struct FfxmInterface {
     FfxmGetDeviceCapabilitiesFunc    fpGetDeviceCapabilities;   ///< A callback function to query device capabilities.
     FfxmDestroyBackendContextFunc    fpDestroyBackendContext;   ///< A callback function to destroy the backend context. This also dereferences the device.
     FfxmCreateResourceFunc           fpCreateResource;          ///< A callback function to create a resource.
+    FfxmCreateAliasedResourcesFunc   fpCreateAliasedResources;  ///< (optional) A callback function to create transient resources sharing memory.
     FfxmRegisterResourceFunc         fpRegisterResource;        ///< A callback function to register an external resource.
     FfxmGetResourceFunc              fpGetResource;             ///< A callback function to convert an internal resource to external resource type
     FfxmUnregisterResourcesFunc      fpUnregisterResources;     ///< A callback function to unregister external resource.
@@ -448,9 +595,14 @@ typedef struct FfxmInterface {
     FfxmDestroyResourceFunc          fpDestroyResource;         ///< A callback function to destroy a resource.
     FfxmCreatePipelineFunc           fpCreateComputePipeline;   ///< A callback function to create a compute pipeline.
     FfxmCreatePipelineFunc           fpCreateGraphicsPipeline;  ///< A callback function to create a render pipeline.
+    FfxmPrewarmGraphicsPipelineFunc  fpPrewarmGraphicsPipeline; ///< (optional) A callback function to build the render state of a render pipeline ahead of its first use.
     FfxmDestroyPipelineFunc          fpDestroyPipeline;         ///< A callback function to destroy a render or compute pipeline.
     FfxmScheduleGpuJobFunc           fpScheduleGpuJob;          ///< A callback function to schedule a render job.
     FfxmExecuteGpuJobsFunc           fpExecuteGpuJobs;          ///< A callback function to execute all queued render jobs.
+    FfxmExecuteGpuJobsAsyncFunc      fpExecuteGpuJobsAsync;     ///< (optional) A callback function to execute all queued render jobs, some of them on an asynchronous compute queue.
+    FfxmEnableGpuTimingsFunc         fpEnableGpuTimings;        ///< (optional) A callback function to start measuring the GPU time of the passes of an effect context.
+    FfxmGetGpuTimingsFunc            fpGetGpuTimings;           ///< (optional) A callback function to read back the GPU time of the passes of an effect context.
+    FfxmReadResourceFunc             fpReadResource;            ///< (optional) A callback function to read the texels of a resource back to host memory.
 
     void*                           scratchBuffer;             ///< A preallocated buffer for memory utilized internally by the backend.
     size_t                          scratchBufferSize;         ///< Size of the buffer pointed to by <c><i>scratchBuffer</i></c>.
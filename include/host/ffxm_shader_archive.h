@@ -0,0 +1,70 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include "ffxm_types.h"
+#include "ffxm_error.h"
+
+namespace arm
+{
+
+/// @defgroup ffxmShaderArchive Shader archive
+/// Load the shader blobs of the backends from a compressed archive.
+///
+/// A backend built with <c><i>FFXM_USE_ARM_ASR_SHADER_ARCHIVE</i></c> does not link the
+/// prebuilt shader headers. It reads the permutations from an archive written
+/// by the <c><i>Arm_ASR_shader_pack</i></c> tool instead, and only decompresses
+/// the permutations the contexts create pipelines for.
+///
+/// @ingroup SDKComponents
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // #if defined(__cplusplus)
+
+/// Set the archive the shader blobs are loaded from.
+///
+/// The archive must be set before creating a context, and its memory must stay
+/// valid and unchanged until another archive is set. It can be a mapping of the
+/// archive file, in which case only the pages holding the tables and the
+/// requested permutations are read. The permutations decompressed from the
+/// previous archive are released, passing <c>NULL</c> only releases them.
+///
+/// @param [in] pData                    A pointer to the archive, 4 byte aligned, or <c>NULL</c>.
+/// @param [in] dataSize                 The size of the archive in bytes.
+///
+/// @retval
+/// FFXM_OK                              The operation completed successfully.
+/// @retval
+/// FFXM_ERROR_INVALID_ALIGNMENT         <c><i>pData</i></c> is not 4 byte aligned.
+/// @retval
+/// FFXM_ERROR_MALFORMED_DATA            The data is not an archive of this version of the library.
+///
+/// @ingroup ffxmShaderArchive
+FFXM_API FfxmErrorCode ffxmSetShaderArchive(const void* pData, size_t dataSize);
+
+#if defined(__cplusplus)
+}
+#endif // #if defined(__cplusplus)
+
+} // namespace arm
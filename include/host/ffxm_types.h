@@ -69,6 +69,11 @@ namespace arm
 /// @ingroup Defines
 #define FFXM_MAX_NUM_RTS				8
 
+/// Maximum number of scissor rectangles of a fragment job, or of thread group rectangles of a compute job.
+///
+/// @ingroup Defines
+#define FFXM_MAX_NUM_SCISSOR_RECTS   8
+
 /// Maximum number of constant buffers bound.
 ///
 /// @ingroup Defines
@@ -82,16 +87,36 @@ namespace arm
 /// @ingroup Defines
 #define FFXM_RESOURCE_NAME_SIZE      64
 
+/// When defined while building the library, the GPU job descriptions are given the binding names of
+/// their pipeline, to make them easier to inspect while debugging. The name fields are always part of
+/// the descriptions and stay <c>NULL</c> otherwise, so the layout doesn't depend on the define.
+/// Enabled by default in debug builds.
+///
+/// @ingroup Defines
+#if defined(_DEBUG) && !defined(FFXM_DEBUG_CHECKING)
+#define FFXM_DEBUG_CHECKING
+#endif // #if defined(_DEBUG) && !defined(FFXM_DEBUG_CHECKING)
+
 /// Maximum number of queued frames in the backend
 ///
 /// @ingroup Defines
 #define FFXM_MAX_QUEUED_FRAMES          (4)
 
+/// Maximum number of views upscaled together by an effect component
+///
+/// @ingroup Defines
+#define FFXM_MAX_VIEW_COUNT             (4)
+
 /// Maximum number of resources per effect context
 ///
 /// @ingroup Defines
 #define FFXM_MAX_RESOURCE_COUNT         (64)
 
+/// Maximum number of shared memory allocations for aliased resources per effect context
+///
+/// @ingroup Defines
+#define FFXM_MAX_ALIAS_HEAPS            (8)
+
 /// Maximum number of passes per effect component
 ///
 /// @ingroup Defines
@@ -477,6 +502,7 @@ typedef struct FfxmDeviceCapabilities {
     uint32_t                        waveLaneCountMax;                       ///< The maximum supported wavefront width.
     bool                            fp16Supported;                          ///< The device supports FP16 in hardware.
     bool                            raytracingSupported;                    ///< The device supports ray tracing.
+    bool                            sourcePermutationsSupported;            ///< The backend has the optional shader permutations only compiled from source.
 } FfxmDeviceCapabilities;
 
 /// A structure encapsulating a 2-dimensional point, using 32bit unsigned integers.
@@ -488,6 +514,17 @@ typedef struct FfxmDimensions2D {
     uint32_t                        height;                                 ///< The height of a 2-dimensional range.
 } FfxmDimensions2D;
 
+/// A structure encapsulating a 2-dimensional rectangle, using 32bit unsigned integers.
+///
+/// @ingroup SDKTypes
+typedef struct FfxmRect2D {
+
+    uint32_t                        x;                                      ///< The left edge of the rectangle.
+    uint32_t                        y;                                      ///< The top edge of the rectangle.
+    uint32_t                        width;                                  ///< The width of the rectangle.
+    uint32_t                        height;                                 ///< The height of the rectangle.
+} FfxmRect2D;
+
 /// A structure encapsulating a 2-dimensional point.
 ///
 /// @ingroup SDKTypes
@@ -723,6 +760,18 @@ typedef struct FfxmConstantBuffer {
     uint32_t                        data[FFXM_MAX_CONST_SIZE];               ///< Constant buffer data
 }FfxmConstantBuffer;
 
+/// A structure referencing the constant buffer data of a render job.
+///
+/// The data is only read while the job is scheduled, the backend copies it to its
+/// own constant buffer storage (e.g. a ring buffer) at that point.
+///
+/// @ingroup SDKTypes
+typedef struct FfxmConstantBufferReference {
+
+    const uint32_t*                 data;                                   ///< Constant buffer data, must stay valid until the job has been scheduled.
+    uint32_t                        num32BitEntries;                        ///< The size (expressed in 32-bit chunks) of data.
+} FfxmConstantBufferReference;
+
 /// A structure describing a clear render job.
 ///
 /// @ingroup SDKTypes
@@ -737,21 +786,22 @@ typedef struct FfxmClearFloatJobDescription {
 /// @ingroup SDKTypes
 typedef struct FfxmComputeJobDescription {
 
-    FfxmPipelineState                pipeline;                               ///< Compute pipeline for the render job.
+    FfxmPipelineState*               pipeline;                               ///< Compute pipeline for the render job.
     uint32_t                        dimensions[3];                          ///< Dispatch dimensions.
+    FfxmRect2D                       groupRects[FFXM_MAX_NUM_SCISSOR_RECTS];  ///< Rectangles of thread groups to dispatch in the X and Y dimensions, the shaders see the group IDs of the rectangles.
+    uint32_t                        groupRectCount;                         ///< The number of thread group rectangles, 0 dispatches all the <c><i>dimensions</i></c>.
     FfxmResourceInternal             cmdArgument;                            ///< Dispatch indirect cmd argument buffer
     uint32_t                        cmdArgumentOffset;                      ///< Dispatch indirect offset within the cmd argument buffer
-    FfxmResourceInternal             srvTextures[FFXM_MAX_NUM_SRVS];          ///< SRV texture resources to be bound in the compute job.
-    wchar_t                         srvTextureNames[FFXM_MAX_NUM_SRVS][64];
-    FfxmResourceInternal             uavTextures[FFXM_MAX_NUM_UAVS];          ///< UAV texture resources to be bound in the compute job.
+    FfxmResourceInternal             srvTextures[FFXM_MAX_NUM_SRVS];          ///< SRV texture resources to be bound in the compute job, in the order of the pipeline SRV texture bindings.
+    FfxmResourceInternal             uavTextures[FFXM_MAX_NUM_UAVS];          ///< UAV texture resources to be bound in the compute job, in the order of the pipeline UAV texture bindings.
     uint32_t                        uavTextureMips[FFXM_MAX_NUM_UAVS];       ///< Mip level of UAV texture resources to be bound in the compute job.
-    wchar_t                         uavTextureNames[FFXM_MAX_NUM_UAVS][64];
     FfxmResourceInternal             srvBuffers[FFXM_MAX_NUM_SRVS];           ///< SRV buffer resources to be bound in the compute job.
-    wchar_t                         srvBufferNames[FFXM_MAX_NUM_SRVS][64];
     FfxmResourceInternal             uavBuffers[FFXM_MAX_NUM_UAVS];           ///< UAV buffer resources to be bound in the compute job.
-    wchar_t                         uavBufferNames[FFXM_MAX_NUM_UAVS][64];
-    FfxmConstantBuffer               cbs[FFXM_MAX_NUM_CONST_BUFFERS];         ///< Constant buffers to be bound in the compute job.
-    wchar_t                         cbNames[FFXM_MAX_NUM_CONST_BUFFERS][64];
+    FfxmConstantBufferReference      cbs[FFXM_MAX_NUM_CONST_BUFFERS];         ///< Constant buffers to be bound in the compute job, in the order of the pipeline constant buffer bindings.
+    bool                            asyncCompute;                           ///< Allows the backend to record the job on the asynchronous compute command list. No earlier job of the same execution may use its resources.
+    const wchar_t*                  srvTextureNames[FFXM_MAX_NUM_SRVS];      ///< Names of the SRV texture bindings, only set with <c><i>FFXM_DEBUG_CHECKING</i></c>.
+    const wchar_t*                  uavTextureNames[FFXM_MAX_NUM_UAVS];      ///< Names of the UAV texture bindings, only set with <c><i>FFXM_DEBUG_CHECKING</i></c>.
+    const wchar_t*                  cbNames[FFXM_MAX_NUM_CONST_BUFFERS];     ///< Names of the constant buffer bindings, only set with <c><i>FFXM_DEBUG_CHECKING</i></c>.
 } FfxmComputeJobDescription;
 
 /// A structure describing a fragment render job.
@@ -761,15 +811,18 @@ typedef struct FfxmFragmentJobDescription
 {
 	FfxmPipelineState *pipeline;								///< Fragment pipeline for the render job.
 	uint32_t viewport[2];									///< Viewport dimensions.
-	FfxmResourceInternal srvTextures[FFXM_MAX_NUM_SRVS];		///< SRV texture resources to be bound in the fragment job.
-	wchar_t srvTextureNames[FFXM_MAX_NUM_SRVS][64];
-	FfxmResourceInternal uavTextures[FFXM_MAX_NUM_UAVS];		///< UAV texture resources to be bound in the fragment job.
+	FfxmRect2D scissorRects[FFXM_MAX_NUM_SCISSOR_RECTS];	///< Rectangles of the viewport to rasterize, the render targets keep their content elsewhere.
+	uint32_t scissorRectCount;								///< The number of scissor rectangles, 0 rasterizes the whole viewport.
+	FfxmResourceInternal srvTextures[FFXM_MAX_NUM_SRVS];		///< SRV texture resources to be bound in the fragment job, in the order of the pipeline SRV texture bindings.
+	FfxmResourceInternal uavTextures[FFXM_MAX_NUM_UAVS];		///< UAV texture resources to be bound in the fragment job, in the order of the pipeline UAV texture bindings.
 	uint32_t uavTextureMips[FFXM_MAX_NUM_UAVS];				///< Mip level of UAV texture resources to be bound in the fragment job.
-	wchar_t uavTextureNames[FFXM_MAX_NUM_UAVS][64];
-	FfxmResourceInternal rtTextures[FFXM_MAX_NUM_RTS];		///< RenderTargets to be bound in the fragment job
-	wchar_t rtTextureNames[FFXM_MAX_NUM_RTS][64];
-	FfxmConstantBuffer cbs[FFXM_MAX_NUM_CONST_BUFFERS];		///< Constant buffers to be bound in the fragment job.
-	wchar_t cbNames[FFXM_MAX_NUM_CONST_BUFFERS][64];
+	FfxmResourceInternal rtTextures[FFXM_MAX_NUM_RTS];		///< RenderTargets to be bound in the fragment job, in the order of the pipeline render target bindings.
+	FfxmConstantBufferReference cbs[FFXM_MAX_NUM_CONST_BUFFERS];	///< Constant buffers to be bound in the fragment job, in the order of the pipeline constant buffer bindings.
+	bool mergeWithNextJob;									///< Allows the backend to record this job and the following fragment job of the same viewport as subpasses of one render pass.
+	const wchar_t* srvTextureNames[FFXM_MAX_NUM_SRVS];		///< Names of the SRV texture bindings, only set with <c><i>FFXM_DEBUG_CHECKING</i></c>.
+	const wchar_t* uavTextureNames[FFXM_MAX_NUM_UAVS];		///< Names of the UAV texture bindings, only set with <c><i>FFXM_DEBUG_CHECKING</i></c>.
+	const wchar_t* rtTextureNames[FFXM_MAX_NUM_RTS];		///< Names of the render target bindings, only set with <c><i>FFXM_DEBUG_CHECKING</i></c>.
+	const wchar_t* cbNames[FFXM_MAX_NUM_CONST_BUFFERS];		///< Names of the constant buffer bindings, only set with <c><i>FFXM_DEBUG_CHECKING</i></c>.
 } FfxmFragmentJobDescription;
 
 /// A structure describing a copy render job.
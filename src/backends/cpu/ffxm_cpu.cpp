@@ -0,0 +1,1245 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <host/ffxm_interface.h>
+#include <host/ffxm_util.h>
+#include <host/ffxm_assert.h>
+#include <host/ffxm_fsr2.h>
+#include <host/backends/cpu/ffxm_cpu.h>
+#include <ffxm_shader_blobs.h>
+#include <fsr2/ffxm_fsr2_private.h>
+#include "ffxm_cpu_fsr2_passes.h"
+#include <codecvt>
+#include <string.h>
+#include <math.h>
+#include <stdlib.h>
+#include <locale>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Constant buffer storage needed by the jobs of a single submission
+#define CONSTANT_DATA_ENTRIES   (FFXM_MAX_GPU_JOBS * FFXM_MAX_NUM_CONST_BUFFERS * FFXM_MAX_CONST_SIZE)
+
+namespace arm
+{
+
+// prototypes for functions in the interface
+FfxmUInt32              GetSDKVersionCPU(FfxmInterface* backendInterface);
+FfxmErrorCode           CreateBackendContextCPU(FfxmInterface* backendInterface, FfxmUInt32* effectContextId);
+FfxmErrorCode           GetDeviceCapabilitiesCPU(FfxmInterface* backendInterface, FfxmDeviceCapabilities* deviceCapabilities);
+FfxmErrorCode           DestroyBackendContextCPU(FfxmInterface* backendInterface, FfxmUInt32 effectContextId);
+FfxmErrorCode           CreateResourceCPU(FfxmInterface* backendInterface, const FfxmCreateResourceDescription* desc, FfxmUInt32 effectContextId, FfxmResourceInternal* outTexture);
+FfxmErrorCode           CreateAliasedResourcesCPU(FfxmInterface* backendInterface, const FfxmCreateResourceDescription* descs, const FfxmUInt32* aliasSlots, FfxmUInt32 resourceCount, FfxmUInt32 effectContextId, FfxmResourceInternal* outTextures, size_t* outSavedMemorySize);
+FfxmErrorCode           DestroyResourceCPU(FfxmInterface* backendInterface, FfxmResourceInternal resource);
+FfxmErrorCode           RegisterResourceCPU(FfxmInterface* backendInterface, const FfxmResource* inResource, FfxmUInt32 effectContextId, FfxmResourceInternal* outResourceInternal);
+FfxmResource            GetResourceCPU(FfxmInterface* backendInterface, FfxmResourceInternal resource);
+FfxmErrorCode           UnregisterResourcesCPU(FfxmInterface* backendInterface, FfxmCommandList commandList, FfxmUInt32 effectContextId);
+FfxmResourceDescription GetResourceDescriptionCPU(FfxmInterface* backendInterface, FfxmResourceInternal resource);
+FfxmErrorCode           CreatePipelineCPU(FfxmInterface* backendInterface, FfxmEffect effect, FfxmPass passId, FfxmShaderQuality qualityPreset, FfxmUInt32 permutationOptions, const FfxmPipelineDescription* desc, FfxmUInt32 effectContextId, FfxmPipelineState* outPass);
+FfxmErrorCode           DestroyPipelineCPU(FfxmInterface* backendInterface, FfxmPipelineState* pipeline, FfxmUInt32 effectContextId);
+FfxmErrorCode           ScheduleGpuJobCPU(FfxmInterface* backendInterface, const FfxmGpuJobDescription* job);
+FfxmErrorCode           ExecuteGpuJobsCPU(FfxmInterface* backendInterface, FfxmCommandList commandList);
+FfxmErrorCode           ReadResourceCPU(FfxmInterface* backendInterface, FfxmResourceInternal resource, void* data, size_t* dataSize);
+
+static FfxmUInt32 s_BackendRefCount = 0;
+static FfxmUInt32 s_MaxEffectContexts = 0;
+
+// Worker threads shared by all the effect contexts of the backend. Rows of a pass are handed out in small
+// batches through an atomic counter, the calling thread takes part in the work and returns once all rows are done.
+class CpuThreadPool {
+public:
+
+    explicit CpuThreadPool(uint32_t threadCount)
+    {
+        // the calling thread is one of the workers
+        for (uint32_t i = 1; i < threadCount; ++i) {
+            m_threads.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~CpuThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_exit = true;
+        }
+        m_wakeCondition.notify_all();
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void parallelFor(uint32_t rowCount, const CpuRowFunc& rowFunc)
+    {
+        if (rowCount == 0) {
+            return;
+        }
+
+        const uint32_t workerCount = uint32_t(m_threads.size()) + 1;
+        if (workerCount == 1) {
+            rowFunc(0, rowCount);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_rowFunc = &rowFunc;
+            m_rowCount = rowCount;
+            m_batchSize = FFXM_MAXIMUM(1u, rowCount / (workerCount * 4));
+            m_nextRow.store(0);
+            m_pendingWorkers = uint32_t(m_threads.size());
+            ++m_generation;
+        }
+        m_wakeCondition.notify_all();
+
+        processRows();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCondition.wait(lock, [this]() { return m_pendingWorkers == 0; });
+        m_rowFunc = nullptr;
+    }
+
+private:
+
+    void processRows()
+    {
+        for (;;) {
+            const uint32_t rowBegin = m_nextRow.fetch_add(m_batchSize);
+            if (rowBegin >= m_rowCount) {
+                break;
+            }
+            (*m_rowFunc)(rowBegin, FFXM_MINIMUM(rowBegin + m_batchSize, m_rowCount));
+        }
+    }
+
+    void workerLoop()
+    {
+        uint64_t seenGeneration = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeCondition.wait(lock, [&]() { return m_exit || m_generation != seenGeneration; });
+                if (m_exit) {
+                    return;
+                }
+                seenGeneration = m_generation;
+            }
+
+            processRows();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_pendingWorkers;
+            }
+            m_doneCondition.notify_one();
+        }
+    }
+
+    std::vector<std::thread>    m_threads;
+    std::mutex                  m_mutex;
+    std::condition_variable     m_wakeCondition;
+    std::condition_variable     m_doneCondition;
+    const CpuRowFunc*           m_rowFunc = nullptr;
+    uint32_t                    m_rowCount = 0;
+    uint32_t                    m_batchSize = 1;
+    std::atomic<uint32_t>       m_nextRow{ 0 };
+    uint32_t                    m_pendingWorkers = 0;
+    uint64_t                    m_generation = 0;
+    bool                        m_exit = false;
+};
+
+typedef struct BackendContext_CPU {
+
+    // store for resources
+    typedef struct Resource
+    {
+#ifdef _DEBUG
+        wchar_t                 resourceName[64];
+#endif
+        CpuTexture              texture;
+        void*                   hostMemory;             // memory owned by the backend, null for registered and aliased resources
+
+        FfxmResourceDescription  resourceDescription;
+        FfxmResourceStates       initialState;
+        FfxmResourceStates       currentState;
+
+        bool                    dynamic;
+    } Resource;
+
+    typedef struct PipelineLayout {
+
+        FfxmEffect              effect;
+        FfxmPass                pass;
+        FfxmUInt32              permutationOptions;
+        CpuFsr2ShaderFunc       shader;
+
+        wchar_t                 name[64];
+        FfxmUInt32              effectContextId;
+    } PipelineLayout;
+
+    FfxmGpuJobDescription*   pGpuJobs;
+    FfxmUInt32               gpuJobCount;
+
+    // Constant buffer data of the scheduled jobs, referenced by their cbs until they are executed
+    FfxmUInt32*              pConstantData;
+    FfxmUInt32               constantDataCount;
+
+    PipelineLayout*         pPipelineLayouts;
+
+    typedef struct alignas(32) EffectContext {
+
+        // Resource allocation
+        FfxmUInt32              nextStaticResource;
+        FfxmUInt32              nextDynamicResource;
+
+        // Pipeline layout
+        FfxmUInt32              nextPipelineLayout;
+
+        // Memory shared by aliased resources
+        void*                   aliasHeaps[FFXM_MAX_ALIAS_HEAPS];
+
+        // Usage
+        bool                    active;
+    } EffectContext;
+
+    Resource*               pResources;
+    EffectContext*          pEffectContexts;
+
+    CpuThreadPool*          threadPool;
+
+} BackendContext_CPU;
+
+FFXM_API size_t ffxmGetScratchMemorySizeCPU(size_t maxContexts)
+{
+    FfxmUInt32 gpuJobDescArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_GPU_JOBS * sizeof(FfxmGpuJobDescription), sizeof(FfxmUInt32));
+    FfxmUInt32 constantDataArraySize = FFXM_ALIGN_UP(maxContexts * CONSTANT_DATA_ENTRIES * sizeof(FfxmUInt32), sizeof(FfxmUInt32));
+    FfxmUInt32 pipelineArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_PASS_COUNT * sizeof(BackendContext_CPU::PipelineLayout), sizeof(FfxmUInt32));
+    FfxmUInt32 resourceArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_RESOURCE_COUNT * sizeof(BackendContext_CPU::Resource), sizeof(FfxmUInt32));
+    FfxmUInt32 contextArraySize = FFXM_ALIGN_UP(maxContexts * sizeof(BackendContext_CPU::EffectContext), sizeof(FfxmUInt32));
+
+    return FFXM_ALIGN_UP(sizeof(BackendContext_CPU) + gpuJobDescArraySize + constantDataArraySize + pipelineArraySize + resourceArraySize + contextArraySize, sizeof(uint64_t));
+}
+
+// Create a FfxmDevice from a CpuDeviceContext
+FfxmDevice ffxmGetDeviceCPU(CpuDeviceContext* cpuDeviceContext)
+{
+    return reinterpret_cast<FfxmDevice>(cpuDeviceContext);
+}
+
+FfxmErrorCode ffxmGetInterfaceCPU(
+    FfxmInterface* backendInterface,
+    FfxmDevice device,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    size_t maxContexts)
+{
+    FFXM_RETURN_ON_ERROR(
+        !s_BackendRefCount,
+        FFXM_ERROR_BACKEND_API_ERROR);
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        scratchBuffer,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        scratchBufferSize >= ffxmGetScratchMemorySizeCPU(maxContexts),
+        FFXM_ERROR_INSUFFICIENT_MEMORY);
+
+    backendInterface->fpGetSDKVersion = GetSDKVersionCPU;
+    backendInterface->fpCreateBackendContext = CreateBackendContextCPU;
+    backendInterface->fpGetDeviceCapabilities = GetDeviceCapabilitiesCPU;
+    backendInterface->fpDestroyBackendContext = DestroyBackendContextCPU;
+    backendInterface->fpCreateResource = CreateResourceCPU;
+    backendInterface->fpCreateAliasedResources = CreateAliasedResourcesCPU;
+    backendInterface->fpDestroyResource = DestroyResourceCPU;
+    backendInterface->fpRegisterResource = RegisterResourceCPU;
+    backendInterface->fpGetResource = GetResourceCPU;
+    backendInterface->fpUnregisterResources = UnregisterResourcesCPU;
+    backendInterface->fpGetResourceDescription = GetResourceDescriptionCPU;
+    backendInterface->fpCreateComputePipeline = CreatePipelineCPU;
+    backendInterface->fpCreateGraphicsPipeline = CreatePipelineCPU;
+    backendInterface->fpPrewarmGraphicsPipeline = nullptr;
+    backendInterface->fpDestroyPipeline = DestroyPipelineCPU;
+    backendInterface->fpScheduleGpuJob = ScheduleGpuJobCPU;
+    backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsCPU;
+    backendInterface->fpExecuteGpuJobsAsync = nullptr;
+    backendInterface->fpEnableGpuTimings = nullptr;
+    backendInterface->fpGetGpuTimings = nullptr;
+    backendInterface->fpReadResource = ReadResourceCPU;
+
+    // Memory assignments
+    backendInterface->scratchBuffer = scratchBuffer;
+    backendInterface->scratchBufferSize = scratchBufferSize;
+
+    // Map the device
+    backendInterface->device = device;
+
+    // Assign the max number of contexts we'll be using
+    s_MaxEffectContexts = static_cast<FfxmUInt32>(maxContexts);
+
+    return FFXM_OK;
+}
+
+FfxmCommandList ffxmGetCommandListCPU(void* cmdList)
+{
+    return reinterpret_cast<FfxmCommandList>(cmdList);
+}
+
+FfxmResource ffxmGetResourceCPU(void* hostPixels,
+    FfxmResourceDescription          ffxmResDescription,
+    [[maybe_unused]] wchar_t* ffxmResName,
+    FfxmResourceStates               state /*=FFXM_RESOURCE_STATE_COMPUTE_READ*/)
+{
+    FfxmResource resource = {};
+    resource.resource = hostPixels;
+    resource.state = state;
+    resource.description = ffxmResDescription;
+
+#ifdef _DEBUG
+    if (ffxmResName) {
+        wcscpy(resource.name, ffxmResName);
+    }
+#endif
+
+    return resource;
+}
+
+FfxmUInt32 getDynamicResourcesStartIndex(FfxmUInt32 effectContextId)
+{
+    // dynamic resources are tracked from the max index
+    return (effectContextId * FFXM_MAX_RESOURCE_COUNT) + FFXM_MAX_RESOURCE_COUNT - 1;
+}
+
+FfxmUInt32 getStaticResourcesStartIndex(FfxmUInt32 effectContextId)
+{
+    // index 0 is reserved for the NULL resource so that unbound slots read as zero
+    return (effectContextId * FFXM_MAX_RESOURCE_COUNT) + 1;
+}
+
+CpuTexture* getTexture(BackendContext_CPU* backendContext, FfxmResourceInternal resource)
+{
+    if (resource.internalIndex <= 0) {
+        return nullptr;
+    }
+
+    BackendContext_CPU::Resource& backendResource = backendContext->pResources[resource.internalIndex];
+    return backendResource.texture.data ? &backendResource.texture : nullptr;
+}
+
+FfxmUInt32 GetSDKVersionCPU([[maybe_unused]] FfxmInterface* backendInterface)
+{
+    return FFXM_SDK_MAKE_VERSION(FFXM_SDK_VERSION_MAJOR, FFXM_SDK_VERSION_MINOR, FFXM_SDK_VERSION_PATCH);
+}
+
+FfxmErrorCode CreateBackendContextCPU(FfxmInterface* backendInterface, FfxmUInt32* effectContextId)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    CpuDeviceContext* cpuDeviceContext = reinterpret_cast<CpuDeviceContext*>(backendInterface->device);
+    FFXM_ASSERT(NULL != cpuDeviceContext);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    // Set things up if this is the first invocation
+    if (!s_BackendRefCount) {
+
+        // clear out mem prior to initializing
+        memset(backendContext, 0, sizeof(BackendContext_CPU));
+
+        // Map all of our pointers
+        FfxmUInt32 gpuJobDescArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_GPU_JOBS * sizeof(FfxmGpuJobDescription), sizeof(FfxmUInt32));
+        FfxmUInt32 constantDataArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * CONSTANT_DATA_ENTRIES * sizeof(FfxmUInt32), sizeof(FfxmUInt32));
+        FfxmUInt32 pipelineArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_PASS_COUNT * sizeof(BackendContext_CPU::PipelineLayout), sizeof(FfxmUInt32));
+        FfxmUInt32 resourceArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * sizeof(BackendContext_CPU::Resource), sizeof(FfxmUInt32));
+        FfxmUInt32 contextArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * sizeof(BackendContext_CPU::EffectContext), sizeof(FfxmUInt32));
+        uint8_t* pMem = (uint8_t*)((BackendContext_CPU*)(backendContext + 1));
+
+        // Map gpu job array
+        backendContext->pGpuJobs = (FfxmGpuJobDescription*)pMem;
+        memset(backendContext->pGpuJobs, 0, gpuJobDescArraySize);
+        pMem += gpuJobDescArraySize;
+
+        // Map the constant buffer data
+        backendContext->pConstantData = (FfxmUInt32*)pMem;
+        memset(backendContext->pConstantData, 0, constantDataArraySize);
+        pMem += constantDataArraySize;
+
+        // Map the pipeline layouts
+        backendContext->pPipelineLayouts = (BackendContext_CPU::PipelineLayout*)(pMem);
+        memset(backendContext->pPipelineLayouts, 0, pipelineArraySize);
+        pMem += pipelineArraySize;
+
+        // Map the resources
+        backendContext->pResources = (BackendContext_CPU::Resource*)(pMem);
+        memset(backendContext->pResources, 0, resourceArraySize);
+        pMem += resourceArraySize;
+
+        // Map the effect contexts
+        backendContext->pEffectContexts = reinterpret_cast<BackendContext_CPU::EffectContext*>(pMem);
+        memset(backendContext->pEffectContexts, 0, contextArraySize);
+
+        // Spin up the workers
+        const uint32_t threadCount = cpuDeviceContext->threadCount ? cpuDeviceContext->threadCount : FFXM_MAXIMUM(1u, std::thread::hardware_concurrency());
+        backendContext->threadPool = new CpuThreadPool(threadCount);
+    }
+
+    // Increment the ref count
+    ++s_BackendRefCount;
+
+    // Get an available context id
+    for (FfxmUInt32 i = 0; i < s_MaxEffectContexts; ++i)
+    {
+        if (!backendContext->pEffectContexts[i].active)
+        {
+            *effectContextId = i;
+
+            // Reset everything accordingly
+            BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[i];
+            effectContext.active = true;
+            effectContext.nextStaticResource = getStaticResourcesStartIndex(i);
+            effectContext.nextDynamicResource = getDynamicResourcesStartIndex(i);
+            effectContext.nextPipelineLayout = (i * FFXM_MAX_PASS_COUNT);
+            break;
+        }
+    }
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode GetDeviceCapabilitiesCPU([[maybe_unused]] FfxmInterface* backendInterface, FfxmDeviceCapabilities* deviceCapabilities)
+{
+    // The passes are run in fp32, the wave operations of shader model 6.0 are emulated on the lanes of a work group
+    deviceCapabilities->minimumSupportedShaderModel = FFXM_SHADER_MODEL_6_0;
+    deviceCapabilities->waveLaneCountMin = 32;
+    deviceCapabilities->waveLaneCountMax = 32;
+    deviceCapabilities->fp16Supported = false;
+    deviceCapabilities->raytracingSupported = false;
+    // The options only compiled from source are compiled for the CPU as well
+    deviceCapabilities->sourcePermutationsSupported = true;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode DestroyBackendContextCPU(FfxmInterface* backendInterface, FfxmUInt32 effectContextId)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    // Delete any resources allocated by this context
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    for (FfxmUInt32 currentStaticResourceIndex = getStaticResourcesStartIndex(effectContextId); currentStaticResourceIndex < effectContext.nextStaticResource; ++currentStaticResourceIndex)
+    {
+        if (backendContext->pResources[currentStaticResourceIndex].hostMemory) {
+            FFXM_ASSERT_MESSAGE(false, "ffxmInterface: CPU: SDK Resource was not destroyed prior to destroying the backend context. There is a resource leak.");
+            FfxmResourceInternal internalResource = { int32_t(currentStaticResourceIndex) };
+            DestroyResourceCPU(backendInterface, internalResource);
+        }
+    }
+
+    for (FfxmUInt32 heapIndex = 0; heapIndex < FFXM_MAX_ALIAS_HEAPS; ++heapIndex)
+    {
+        free(effectContext.aliasHeaps[heapIndex]);
+        effectContext.aliasHeaps[heapIndex] = nullptr;
+    }
+
+    // Free up for use by another context
+    effectContext.nextStaticResource = 0;
+    effectContext.active = false;
+
+    // Decrement ref count
+    --s_BackendRefCount;
+
+    if (!s_BackendRefCount) {
+        delete backendContext->threadPool;
+        backendContext->threadPool = nullptr;
+    }
+
+    return FFXM_OK;
+}
+
+static FfxmResourceDescription getCreatedResourceDescription(const FfxmCreateResourceDescription* createResourceDescription)
+{
+    FfxmResourceDescription resourceDesc = createResourceDescription->resourceDescription;
+    if (resourceDesc.type == FFXM_RESOURCE_TYPE_TEXTURE1D) {
+        resourceDesc.height = 1;
+    }
+
+    if (resourceDesc.mipCount == 0) {
+        resourceDesc.mipCount = (FfxmUInt32)(1 + floor(log2(FFXM_MAXIMUM(resourceDesc.width, resourceDesc.height))));
+    }
+
+    return resourceDesc;
+}
+
+// create a resource, either in its own memory or in the given alias heap
+static FfxmErrorCode createResource(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescription,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResource,
+    void* aliasHeap)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != createResourceDescription);
+    FFXM_ASSERT(NULL != outResource);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    FFXM_RETURN_ON_ERROR(
+        createResourceDescription->resourceDescription.type != FFXM_RESOURCE_TYPE_BUFFER,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    // Setup the resource description
+    const FfxmResourceDescription resourceDesc = getCreatedResourceDescription(createResourceDescription);
+    FFXM_RETURN_ON_ERROR(
+        resourceDesc.mipCount <= FFXM_CPU_MAX_MIP_COUNT,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    FFXM_ASSERT(effectContext.nextStaticResource + 1 < effectContext.nextDynamicResource);
+    outResource->internalIndex = effectContext.nextStaticResource++;
+    BackendContext_CPU::Resource* backendResource = &backendContext->pResources[outResource->internalIndex];
+    backendResource->dynamic = false;
+    backendResource->resourceDescription = resourceDesc;
+    backendResource->initialState = createResourceDescription->initalState;
+    backendResource->currentState = createResourceDescription->initalState;
+
+#ifdef _DEBUG
+    if (createResourceDescription->name) {
+        wcsncpy(backendResource->resourceName, createResourceDescription->name, 63);
+    }
+#endif
+
+    const size_t textureSize = ffxmCpuInitTextureLayout(&backendResource->texture, resourceDesc.format, resourceDesc.width, resourceDesc.height, resourceDesc.mipCount);
+    if (aliasHeap)
+    {
+        backendResource->hostMemory = nullptr;
+        backendResource->texture.data = static_cast<uint8_t*>(aliasHeap);
+        return FFXM_OK;
+    }
+
+    backendResource->hostMemory = calloc(1, textureSize);
+    FFXM_RETURN_ON_ERROR(
+        backendResource->hostMemory,
+        FFXM_ERROR_OUT_OF_MEMORY);
+    backendResource->texture.data = static_cast<uint8_t*>(backendResource->hostMemory);
+
+    // Initial data covers mip 0 only, the memory is host visible so no copy job is needed
+    if (createResourceDescription->initData)
+    {
+        memcpy(backendResource->texture.data, createResourceDescription->initData, FFXM_MINIMUM(size_t(createResourceDescription->initDataSize), textureSize));
+    }
+
+    return FFXM_OK;
+}
+
+// create a internal resource that will stay alive until effect gets shut down
+FfxmErrorCode CreateResourceCPU(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescription,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResource)
+{
+    return createResource(backendInterface, createResourceDescription, effectContextId, outResource, nullptr);
+}
+
+// create transient resources, those sharing an alias slot are placed in the same host allocation
+FfxmErrorCode CreateAliasedResourcesCPU(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescriptions,
+    const FfxmUInt32* aliasSlots,
+    FfxmUInt32 resourceCount,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResources,
+    size_t* outSavedMemorySize)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != createResourceDescriptions);
+    FFXM_ASSERT(NULL != aliasSlots);
+    FFXM_ASSERT(NULL != outResources);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    // Size each heap to the largest resource placed in it
+    size_t heapSizes[FFXM_MAX_ALIAS_HEAPS] = {};
+    size_t dedicatedSize = 0;
+    for (FfxmUInt32 resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex)
+    {
+        const FfxmCreateResourceDescription& createResourceDescription = createResourceDescriptions[resourceIndex];
+        FFXM_RETURN_ON_ERROR(
+            aliasSlots[resourceIndex] < FFXM_MAX_ALIAS_HEAPS && !createResourceDescription.initData,
+            FFXM_ERROR_INVALID_ARGUMENT);
+        FFXM_RETURN_ON_ERROR(
+            !effectContext.aliasHeaps[aliasSlots[resourceIndex]],
+            FFXM_ERROR_INVALID_ARGUMENT);
+
+        const FfxmResourceDescription resourceDesc = getCreatedResourceDescription(&createResourceDescription);
+        FFXM_RETURN_ON_ERROR(
+            resourceDesc.mipCount <= FFXM_CPU_MAX_MIP_COUNT,
+            FFXM_ERROR_INVALID_ARGUMENT);
+
+        CpuTexture texture = {};
+        const size_t textureSize = ffxmCpuInitTextureLayout(&texture, resourceDesc.format, resourceDesc.width, resourceDesc.height, resourceDesc.mipCount);
+        heapSizes[aliasSlots[resourceIndex]] = FFXM_MAXIMUM(heapSizes[aliasSlots[resourceIndex]], textureSize);
+        dedicatedSize += textureSize;
+    }
+
+    size_t aliasedSize = 0;
+    for (FfxmUInt32 heapIndex = 0; heapIndex < FFXM_MAX_ALIAS_HEAPS; ++heapIndex)
+    {
+        if (heapSizes[heapIndex])
+        {
+            effectContext.aliasHeaps[heapIndex] = calloc(1, heapSizes[heapIndex]);
+            FFXM_RETURN_ON_ERROR(
+                effectContext.aliasHeaps[heapIndex],
+                FFXM_ERROR_OUT_OF_MEMORY);
+            aliasedSize += heapSizes[heapIndex];
+        }
+    }
+
+    for (FfxmUInt32 resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex)
+    {
+        FfxmErrorCode errorCode = createResource(backendInterface, &createResourceDescriptions[resourceIndex], effectContextId, &outResources[resourceIndex], effectContext.aliasHeaps[aliasSlots[resourceIndex]]);
+        FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+    }
+
+    if (outSavedMemorySize)
+        *outSavedMemorySize = dedicatedSize - aliasedSize;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode DestroyResourceCPU(FfxmInterface* backendInterface, FfxmResourceInternal resource)
+{
+    FFXM_ASSERT(backendInterface != nullptr);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    if (resource.internalIndex > 0)
+    {
+        BackendContext_CPU::Resource& backendResource = backendContext->pResources[resource.internalIndex];
+
+        free(backendResource.hostMemory);
+        backendResource.hostMemory = nullptr;
+        backendResource.texture.data = nullptr;
+    }
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode RegisterResourceCPU(
+    FfxmInterface* backendInterface,
+    const FfxmResource* inFfxmResource,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outFfxmResourceInternal
+)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)(backendInterface->scratchBuffer);
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    if (inFfxmResource->resource == nullptr) {
+
+        outFfxmResourceInternal->internalIndex = 0; // Always maps to FFXM_<feature>_RESOURCE_IDENTIFIER_NULL;
+        return FFXM_OK;
+    }
+
+    FFXM_RETURN_ON_ERROR(
+        inFfxmResource->description.type != FFXM_RESOURCE_TYPE_BUFFER,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    FFXM_ASSERT(effectContext.nextDynamicResource > effectContext.nextStaticResource);
+    outFfxmResourceInternal->internalIndex = effectContext.nextDynamicResource--;
+
+    BackendContext_CPU::Resource* backendResource = &backendContext->pResources[outFfxmResourceInternal->internalIndex];
+    backendResource->resourceDescription = inFfxmResource->description;
+    if (backendResource->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE1D) {
+        backendResource->resourceDescription.height = 1;
+    }
+
+    // Host pixels only describe mip 0
+    backendResource->resourceDescription.mipCount = 1;
+    backendResource->initialState = inFfxmResource->state;
+    backendResource->currentState = inFfxmResource->state;
+    backendResource->dynamic = true;
+    backendResource->hostMemory = nullptr;
+
+#ifdef _DEBUG
+    wcsncpy(backendResource->resourceName, inFfxmResource->name, 63);
+#endif
+
+    ffxmCpuInitTextureLayout(&backendResource->texture, backendResource->resourceDescription.format,
+        backendResource->resourceDescription.width, backendResource->resourceDescription.height, 1);
+    backendResource->texture.data = static_cast<uint8_t*>(inFfxmResource->resource);
+
+    return FFXM_OK;
+}
+
+FfxmResource GetResourceCPU(FfxmInterface* backendInterface, FfxmResourceInternal inResource)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FfxmResourceDescription ffxmResDescription = backendInterface->fpGetResourceDescription(backendInterface, inResource);
+
+    FfxmResource resource = {};
+    resource.resource = reinterpret_cast<void*>(backendContext->pResources[inResource.internalIndex].texture.data);
+    resource.state = backendContext->pResources[inResource.internalIndex].currentState;
+    resource.description = ffxmResDescription;
+
+#ifdef _DEBUG
+    wcscpy(resource.name, backendContext->pResources[inResource.internalIndex].resourceName);
+#endif
+
+    return resource;
+}
+
+FfxmErrorCode UnregisterResourcesCPU(FfxmInterface* backendInterface, [[maybe_unused]] FfxmCommandList commandList, FfxmUInt32 effectContextId)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)(backendInterface->scratchBuffer);
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    // Walk back all the resources that don't belong to us, jobs have already been executed so the host pixels are no longer referenced
+    const FfxmUInt32 dynamicResourceIndexStart = getDynamicResourcesStartIndex(effectContextId);
+    for (FfxmUInt32 resourceIndex = ++effectContext.nextDynamicResource; resourceIndex <= dynamicResourceIndexStart; ++resourceIndex)
+    {
+        BackendContext_CPU::Resource* backendResource = &backendContext->pResources[resourceIndex];
+        backendResource->texture.data = nullptr;
+        backendResource->currentState = backendResource->initialState;
+    }
+
+    effectContext.nextDynamicResource = dynamicResourceIndexStart;
+
+    return FFXM_OK;
+}
+
+FfxmResourceDescription GetResourceDescriptionCPU(FfxmInterface* backendInterface, FfxmResourceInternal resource)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FfxmResourceDescription resourceDescription = backendContext->pResources[resource.internalIndex].resourceDescription;
+    return resourceDescription;
+}
+
+FfxmErrorCode ReadResourceCPU(FfxmInterface* backendInterface, FfxmResourceInternal resource, void* data, size_t* dataSize)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_RETURN_ON_ERROR(dataSize, FFXM_ERROR_INVALID_POINTER);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    // jobs complete within fpExecuteGpuJobs, the texels of mip 0 are always up to date and tightly packed
+    const CpuTexture& texture = backendContext->pResources[resource.internalIndex].texture;
+    FFXM_RETURN_ON_ERROR(texture.data, FFXM_ERROR_INVALID_ARGUMENT);
+    const size_t mipSize = size_t(texture.width) * texture.height * ffxmCpuGetSurfaceFormatSize(texture.format);
+
+    if (!data)
+    {
+        *dataSize = mipSize;
+        return FFXM_OK;
+    }
+
+    FFXM_RETURN_ON_ERROR(*dataSize >= mipSize, FFXM_ERROR_INVALID_SIZE);
+    memcpy(data, texture.data + texture.mipOffsets[0], mipSize);
+    *dataSize = mipSize;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode CreatePipelineCPU(FfxmInterface* backendInterface,
+    FfxmEffect effect,
+    FfxmPass pass,
+    [[maybe_unused]] FfxmShaderQuality qualityPreset,
+    FfxmUInt32 permutationOptions,
+    const FfxmPipelineDescription* pipelineDescription,
+    FfxmUInt32 effectContextId,
+    FfxmPipelineState* outPipeline)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != pipelineDescription);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    FFXM_RETURN_ON_ERROR(
+        effect == FFXM_EFFECT_FSR2,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    const CpuFsr2ShaderFunc shader = ffxmCpuGetFsr2Shader(pass, permutationOptions);
+    FFXM_RETURN_ON_ERROR(
+        shader,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    // The shader blob is only used for its reflection data, the effect binds resources by name. The passes are
+    // compiled for the CPU with the options missing from the prebuilt shaders, their bindings are patched below.
+    const FfxmUInt32 blobPermutationOptions = permutationOptions & ~FfxmUInt32(FSR2_SHADER_PERMUTATION_SOURCE_ONLY);
+    FfxmShaderBlob shaderBlob = { };
+    FFXM_VALIDATE(ffxmGetPermutationBlobByIndex(effect, pass, blobPermutationOptions, &shaderBlob));
+    FFXM_ASSERT(shaderBlob.data && shaderBlob.size);
+
+    //////////////////////////////////////////////////////////////////////////
+    // One pipeline layout per pipeline
+    FFXM_ASSERT_MESSAGE(effectContext.nextPipelineLayout < (effectContextId * FFXM_MAX_PASS_COUNT) + FFXM_MAX_PASS_COUNT, "ffxmInterface: CPU: Ran out of pipeline layouts. Please increase FFXM_MAX_PASS_COUNT");
+    BackendContext_CPU::PipelineLayout* pPipelineLayout = &backendContext->pPipelineLayouts[effectContext.nextPipelineLayout++];
+    pPipelineLayout->effect = effect;
+    pPipelineLayout->pass = pass;
+    pPipelineLayout->permutationOptions = permutationOptions;
+    pPipelineLayout->shader = shader;
+    pPipelineLayout->effectContextId = effectContextId;
+    wcscpy(pPipelineLayout->name, pipelineDescription->name);
+
+    outPipeline->rootSignature = reinterpret_cast<FfxmRootSignature>(pPipelineLayout);
+    outPipeline->pipeline = reinterpret_cast<FfxmPipeline>(pPipelineLayout);
+    outPipeline->cmdSignature = nullptr;
+
+    // populate the pipeline information for this pass
+    outPipeline->srvTextureCount = shaderBlob.srvTextureCount;
+    outPipeline->srvBufferCount  = shaderBlob.srvBufferCount;
+    outPipeline->uavTextureCount = shaderBlob.uavTextureCount;
+    outPipeline->uavBufferCount = shaderBlob.uavBufferCount;
+    outPipeline->constCount = shaderBlob.cbvCount;
+    outPipeline->rtCount = shaderBlob.rtTextureCount;
+    outPipeline->descriptorSetCount = 0;
+
+    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+    for (FfxmUInt32 srvIndex = 0; srvIndex < outPipeline->srvTextureCount; ++srvIndex)
+    {
+        outPipeline->srvTextureBindings[srvIndex].slotIndex = shaderBlob.boundSRVTextures[srvIndex];
+        outPipeline->srvTextureBindings[srvIndex].bindCount = shaderBlob.boundSRVTextureCounts[srvIndex];
+        outPipeline->srvTextureBindings[srvIndex].bindSet = shaderBlob.boundSRVTextureSets[srvIndex];
+        wcscpy(outPipeline->srvTextureBindings[srvIndex].name, converter.from_bytes(shaderBlob.boundSRVTextureNames[srvIndex]).c_str());
+    }
+    for (FfxmUInt32 srvIndex = 0; srvIndex < outPipeline->srvBufferCount; ++srvIndex)
+    {
+        outPipeline->srvBufferBindings[srvIndex].slotIndex = shaderBlob.boundSRVBuffers[srvIndex];
+        outPipeline->srvBufferBindings[srvIndex].bindCount = shaderBlob.boundSRVBufferCounts[srvIndex];
+        outPipeline->srvBufferBindings[srvIndex].bindSet = shaderBlob.boundSRVBufferSets[srvIndex];
+        wcscpy(outPipeline->srvBufferBindings[srvIndex].name, converter.from_bytes(shaderBlob.boundSRVBufferNames[srvIndex]).c_str());
+    }
+    for (FfxmUInt32 uavIndex = 0; uavIndex < outPipeline->uavTextureCount; ++uavIndex)
+    {
+        outPipeline->uavTextureBindings[uavIndex].slotIndex = shaderBlob.boundUAVTextures[uavIndex];
+        outPipeline->uavTextureBindings[uavIndex].bindCount = shaderBlob.boundUAVTextureCounts[uavIndex];
+        outPipeline->uavTextureBindings[uavIndex].bindSet = shaderBlob.boundUAVTextureSets[uavIndex];
+        wcscpy(outPipeline->uavTextureBindings[uavIndex].name, converter.from_bytes(shaderBlob.boundUAVTextureNames[uavIndex]).c_str());
+    }
+    for (FfxmUInt32 uavIndex = 0; uavIndex < outPipeline->uavBufferCount; ++uavIndex)
+    {
+        outPipeline->uavBufferBindings[uavIndex].slotIndex = shaderBlob.boundUAVBuffers[uavIndex];
+        outPipeline->uavBufferBindings[uavIndex].bindCount = shaderBlob.boundUAVBufferCounts[uavIndex];
+        outPipeline->uavBufferBindings[uavIndex].bindSet = shaderBlob.boundUAVBufferSets[uavIndex];
+        wcscpy(outPipeline->uavBufferBindings[uavIndex].name, converter.from_bytes(shaderBlob.boundUAVBufferNames[uavIndex]).c_str());
+    }
+    for (FfxmUInt32 rtIndex = 0; rtIndex < outPipeline->rtCount; ++rtIndex)
+    {
+        outPipeline->rtBindings[rtIndex].slotIndex = shaderBlob.boundRTTextures[rtIndex];
+        wcscpy(outPipeline->rtBindings[rtIndex].name, converter.from_bytes(shaderBlob.boundRTTextureNames[rtIndex]).c_str());
+    }
+    for (FfxmUInt32 cbIndex = 0; cbIndex < outPipeline->constCount; ++cbIndex)
+    {
+        outPipeline->constantBufferBindings[cbIndex].slotIndex = shaderBlob.boundConstantBuffers[cbIndex];
+        outPipeline->constantBufferBindings[cbIndex].bindCount = shaderBlob.boundConstantBufferCounts[cbIndex];
+        outPipeline->constantBufferBindings[cbIndex].bindSet = shaderBlob.boundConstantBufferSets[cbIndex];
+        wcscpy(outPipeline->constantBufferBindings[cbIndex].name, converter.from_bytes(shaderBlob.boundConstantBufferNames[cbIndex]).c_str());
+    }
+
+    auto appendSrvTextureBinding = [outPipeline](const wchar_t* name) {
+        for (FfxmUInt32 srvIndex = 0; srvIndex < outPipeline->srvTextureCount; ++srvIndex)
+        {
+            if (0 == wcscmp(outPipeline->srvTextureBindings[srvIndex].name, name))
+                return;
+        }
+
+        FFXM_ASSERT(outPipeline->srvTextureCount < FFXM_MAX_NUM_SRVS);
+        FfxmResourceBinding& binding = outPipeline->srvTextureBindings[outPipeline->srvTextureCount];
+        binding.slotIndex = outPipeline->srvTextureCount;
+        binding.bindCount = 1;
+        binding.bindSet = 0;
+        wcscpy(binding.name, name);
+        ++outPipeline->srvTextureCount;
+    };
+
+    // The accumulation passes of the prebuilt shaders compute the Lanczos weights, their reflection has no weight table
+    const bool accumulatePass = pass == FFXM_FSR2_PASS_ACCUMULATE || pass == FFXM_FSR2_PASS_ACCUMULATE_SHARPEN;
+    if (accumulatePass && (permutationOptions & FSR2_SHADER_PERMUTATION_LANCZOS_WEIGHT_TABLE))
+        appendSrvTextureBinding(L"r_lanczos_lut");
+
+    // With the half resolution depth clip, the performance accumulation prepares the input color and upsamples
+    // the depth clip along the dilated depth, which the prebuilt shaders don't read
+    const bool performanceOpt = (permutationOptions & FSR2_SHADER_PERMUTATION_APPLY_PERFORMANCE_OPT) && !(permutationOptions & FSR2_SHADER_PERMUTATION_APPLY_ULTRA_PERFORMANCE_OPT);
+    if (accumulatePass && performanceOpt && (permutationOptions & FSR2_SHADER_PERMUTATION_HALF_RES_DEPTH_CLIP))
+    {
+        appendSrvTextureBinding(L"r_input_color_jittered");
+        appendSrvTextureBinding(L"r_dilatedDepth");
+    }
+
+    // The prebuilt shaders have no fused reconstruction and lock permutation: merge the reflection of the
+    // reconstruction into the one of the lock pass. Its render targets are written as storage images and the
+    // lock input luma is kept in the tile of the work group instead of being read back.
+    if (pass == FFXM_FSR2_PASS_LOCK && (permutationOptions & FSR2_SHADER_PERMUTATION_FUSED_RECONSTRUCT_AND_LOCK))
+    {
+        FfxmShaderBlob reconstructBlob = { };
+        FFXM_VALIDATE(ffxmGetPermutationBlobByIndex(effect, FFXM_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, blobPermutationOptions, &reconstructBlob));
+        FFXM_ASSERT(reconstructBlob.data && reconstructBlob.size);
+
+        auto findBinding = [](const FfxmResourceBinding* bindings, uint32_t count, const wchar_t* name) {
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                if (0 == wcscmp(bindings[index].name, name))
+                    return true;
+            }
+            return false;
+        };
+        auto appendBinding = [&](FfxmResourceBinding* bindings, uint32_t& count, const char* name) {
+            const std::wstring wideName = converter.from_bytes(name);
+            if (findBinding(bindings, count, wideName.c_str()))
+                return;
+            bindings[count].slotIndex = count;
+            bindings[count].bindCount = 1;
+            bindings[count].bindSet = 0;
+            wcscpy(bindings[count].name, wideName.c_str());
+            ++count;
+        };
+
+        // drop the lock input the fused pass computes itself
+        uint32_t srvCount = 0;
+        for (FfxmUInt32 srvIndex = 0; srvIndex < outPipeline->srvTextureCount; ++srvIndex)
+        {
+            const wchar_t* name = outPipeline->srvTextureBindings[srvIndex].name;
+            if (0 == wcscmp(name, L"r_lock_input_luma") || 0 == wcscmp(name, L"r_dilated_depth_motion_vectors_input_luma"))
+                continue;
+            outPipeline->srvTextureBindings[srvCount++] = outPipeline->srvTextureBindings[srvIndex];
+        }
+        for (FfxmUInt32 srvIndex = 0; srvIndex < reconstructBlob.srvTextureCount; ++srvIndex)
+        {
+            appendBinding(outPipeline->srvTextureBindings, srvCount, reconstructBlob.boundSRVTextureNames[srvIndex]);
+        }
+        outPipeline->srvTextureCount = srvCount;
+
+        uint32_t uavCount = outPipeline->uavTextureCount;
+        for (FfxmUInt32 uavIndex = 0; uavIndex < reconstructBlob.uavTextureCount; ++uavIndex)
+        {
+            appendBinding(outPipeline->uavTextureBindings, uavCount, reconstructBlob.boundUAVTextureNames[uavIndex]);
+        }
+        for (FfxmUInt32 rtIndex = 0; rtIndex < reconstructBlob.rtTextureCount; ++rtIndex)
+        {
+            if (0 == strcmp(reconstructBlob.boundRTTextureNames[rtIndex], "rw_lock_input_luma"))
+                continue;
+            appendBinding(outPipeline->uavTextureBindings, uavCount, reconstructBlob.boundRTTextureNames[rtIndex]);
+        }
+        outPipeline->uavTextureCount = uavCount;
+    }
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode DestroyPipelineCPU(FfxmInterface* backendInterface, FfxmPipelineState* pipeline, [[maybe_unused]] FfxmUInt32 effectContextId)
+{
+    FFXM_ASSERT(backendInterface != nullptr);
+    if (!pipeline)
+        return FFXM_OK;
+
+    // Pipeline layouts are recycled with the effect context, just drop the references
+    BackendContext_CPU::PipelineLayout* pPipelineLayout = reinterpret_cast<BackendContext_CPU::PipelineLayout*>(pipeline->pipeline);
+    if (pPipelineLayout) {
+        memset(pPipelineLayout, 0, sizeof(BackendContext_CPU::PipelineLayout));
+    }
+
+    pipeline->pipeline = nullptr;
+    pipeline->rootSignature = nullptr;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ScheduleGpuJobCPU(FfxmInterface* backendInterface, const FfxmGpuJobDescription* job)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != job);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FFXM_ASSERT(backendContext->gpuJobCount < FFXM_MAX_GPU_JOBS);
+
+    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+
+    // the constant buffer data only needs to be valid while scheduling, keep a copy until the job is executed
+    FfxmConstantBufferReference* cbs = nullptr;
+    FfxmUInt32                   constCount = 0;
+    if (job->jobType == FFXM_GPU_JOB_COMPUTE)
+    {
+        cbs = backendContext->pGpuJobs[backendContext->gpuJobCount].computeJobDescriptor.cbs;
+        constCount = job->computeJobDescriptor.pipeline->constCount;
+    }
+    else if (job->jobType == FFXM_GPU_JOB_FRAGMENT)
+    {
+        cbs = backendContext->pGpuJobs[backendContext->gpuJobCount].fragmentJobDescription.cbs;
+        constCount = job->fragmentJobDescription.pipeline->constCount;
+    }
+    for (FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < constCount; ++currentRootConstantIndex)
+    {
+        FfxmConstantBufferReference& cb = cbs[currentRootConstantIndex];
+        FFXM_ASSERT(cb.num32BitEntries <= FFXM_MAX_CONST_SIZE);
+        FFXM_ASSERT(backendContext->constantDataCount + cb.num32BitEntries <= s_MaxEffectContexts * CONSTANT_DATA_ENTRIES);
+
+        FfxmUInt32* constantData = backendContext->pConstantData + backendContext->constantDataCount;
+        if (cb.data != nullptr)
+            memcpy(constantData, cb.data, cb.num32BitEntries * sizeof(FfxmUInt32));
+        else
+            memset(constantData, 0, cb.num32BitEntries * sizeof(FfxmUInt32));
+        cb.data = constantData;
+        backendContext->constantDataCount += cb.num32BitEntries;
+    }
+
+    backendContext->gpuJobCount++;
+
+    return FFXM_OK;
+}
+
+static void addTextureBinding(BackendContext_CPU* backendContext, CpuTextureBinding* bindings, uint32_t* bindingCount,
+    const wchar_t* name, FfxmResourceInternal resource, uint32_t mip)
+{
+    CpuTextureBinding& binding = bindings[(*bindingCount)++];
+    binding.name = name;
+    binding.texture = getTexture(backendContext, resource);
+    binding.mip = mip;
+}
+
+static FfxmErrorCode executeGpuJobFsr2Pass(BackendContext_CPU* backendContext, CpuFsr2PassDescription* passDescription, const FfxmPipelineState* pipeline)
+{
+    const BackendContext_CPU::PipelineLayout* pPipelineLayout = reinterpret_cast<const BackendContext_CPU::PipelineLayout*>(pipeline->pipeline);
+    FFXM_RETURN_ON_ERROR(
+        pPipelineLayout,
+        FFXM_ERROR_NULL_DEVICE);
+
+    passDescription->pass = pPipelineLayout->pass;
+    passDescription->permutationOptions = pPipelineLayout->permutationOptions;
+    passDescription->shader = pPipelineLayout->shader;
+
+    CpuThreadPool* threadPool = backendContext->threadPool;
+    return ffxmCpuExecuteFsr2Pass(passDescription, [threadPool](uint32_t rowCount, const CpuRowFunc& rowFunc) {
+        threadPool->parallelFor(rowCount, rowFunc);
+    });
+}
+
+// Runs the pass over each rectangle, or over its whole dimensions without rectangles.
+static FfxmErrorCode executeGpuJobFsr2PassRects(BackendContext_CPU* backendContext, CpuFsr2PassDescription* passDescription, const FfxmPipelineState* pipeline,
+    const FfxmRect2D* rects, uint32_t rectCount)
+{
+    if (!rectCount)
+        return executeGpuJobFsr2Pass(backendContext, passDescription, pipeline);
+
+    for (uint32_t rectIndex = 0; rectIndex < rectCount; ++rectIndex)
+    {
+        passDescription->offset[0] = rects[rectIndex].x;
+        passDescription->offset[1] = rects[rectIndex].y;
+        passDescription->dimensions[0] = rects[rectIndex].width;
+        passDescription->dimensions[1] = rects[rectIndex].height;
+
+        const FfxmErrorCode errorCode = executeGpuJobFsr2Pass(backendContext, passDescription, pipeline);
+        FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+    }
+
+    return FFXM_OK;
+}
+
+static FfxmErrorCode executeGpuJobCompute(BackendContext_CPU* backendContext, FfxmGpuJobDescription* job)
+{
+    const FfxmComputeJobDescription& computeJob = job->computeJobDescriptor;
+    const FfxmPipelineState&         pipeline = *computeJob.pipeline;
+
+    CpuFsr2PassDescription passDescription = {};
+    passDescription.dimensions[0] = computeJob.dimensions[0];
+    passDescription.dimensions[1] = computeJob.dimensions[1];
+
+    for (FfxmUInt32 currentPipelineUavIndex = 0; currentPipelineUavIndex < pipeline.uavTextureCount; ++currentPipelineUavIndex)
+    {
+        addTextureBinding(backendContext, passDescription.uavTextures, &passDescription.uavTextureCount,
+            pipeline.uavTextureBindings[currentPipelineUavIndex].name, computeJob.uavTextures[currentPipelineUavIndex], computeJob.uavTextureMips[currentPipelineUavIndex]);
+    }
+    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < pipeline.srvTextureCount; ++currentPipelineSrvIndex)
+    {
+        addTextureBinding(backendContext, passDescription.srvTextures, &passDescription.srvTextureCount,
+            pipeline.srvTextureBindings[currentPipelineSrvIndex].name, computeJob.srvTextures[currentPipelineSrvIndex], 0);
+    }
+    for (FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < pipeline.constCount; ++currentRootConstantIndex)
+    {
+        CpuConstantBufferBinding& binding = passDescription.constantBuffers[passDescription.constantBufferCount++];
+        binding.name = pipeline.constantBufferBindings[currentRootConstantIndex].name;
+        binding.data = computeJob.cbs[currentRootConstantIndex].data;
+        binding.num32BitEntries = computeJob.cbs[currentRootConstantIndex].num32BitEntries;
+    }
+
+    return executeGpuJobFsr2PassRects(backendContext, &passDescription, computeJob.pipeline, computeJob.groupRects, computeJob.groupRectCount);
+}
+
+static FfxmErrorCode executeGpuJobFragment(BackendContext_CPU* backendContext, FfxmGpuJobDescription* job)
+{
+    const FfxmFragmentJobDescription& fragmentJob = job->fragmentJobDescription;
+    const FfxmPipelineState*          pipeline = fragmentJob.pipeline;
+    FFXM_ASSERT(NULL != pipeline);
+
+    CpuFsr2PassDescription passDescription = {};
+    passDescription.dimensions[0] = fragmentJob.viewport[0];
+    passDescription.dimensions[1] = fragmentJob.viewport[1];
+
+    for (FfxmUInt32 currentPipelineUavIndex = 0; currentPipelineUavIndex < pipeline->uavTextureCount; ++currentPipelineUavIndex)
+    {
+        addTextureBinding(backendContext, passDescription.uavTextures, &passDescription.uavTextureCount,
+            pipeline->uavTextureBindings[currentPipelineUavIndex].name, fragmentJob.uavTextures[currentPipelineUavIndex], fragmentJob.uavTextureMips[currentPipelineUavIndex]);
+    }
+    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < pipeline->srvTextureCount; ++currentPipelineSrvIndex)
+    {
+        addTextureBinding(backendContext, passDescription.srvTextures, &passDescription.srvTextureCount,
+            pipeline->srvTextureBindings[currentPipelineSrvIndex].name, fragmentJob.srvTextures[currentPipelineSrvIndex], 0);
+    }
+    for (FfxmUInt32 currentPipelineRtIndex = 0; currentPipelineRtIndex < pipeline->rtCount; ++currentPipelineRtIndex)
+    {
+        addTextureBinding(backendContext, passDescription.rtTextures, &passDescription.rtTextureCount,
+            pipeline->rtBindings[currentPipelineRtIndex].name, fragmentJob.rtTextures[currentPipelineRtIndex], 0);
+    }
+    for (FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < pipeline->constCount; ++currentRootConstantIndex)
+    {
+        CpuConstantBufferBinding& binding = passDescription.constantBuffers[passDescription.constantBufferCount++];
+        binding.name = pipeline->constantBufferBindings[currentRootConstantIndex].name;
+        binding.data = fragmentJob.cbs[currentRootConstantIndex].data;
+        binding.num32BitEntries = fragmentJob.cbs[currentRootConstantIndex].num32BitEntries;
+    }
+
+    return executeGpuJobFsr2PassRects(backendContext, &passDescription, pipeline, fragmentJob.scissorRects, fragmentJob.scissorRectCount);
+}
+
+static FfxmErrorCode executeGpuJobCopy(BackendContext_CPU* backendContext, FfxmGpuJobDescription* job)
+{
+    CpuTexture* srcTexture = getTexture(backendContext, job->copyJobDescriptor.src);
+    CpuTexture* dstTexture = getTexture(backendContext, job->copyJobDescriptor.dst);
+    FFXM_RETURN_ON_ERROR(
+        srcTexture && dstTexture,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    const uint32_t mipCount = FFXM_MINIMUM(srcTexture->mipCount, dstTexture->mipCount);
+    for (uint32_t mip = 0; mip < mipCount; ++mip)
+    {
+        const int32_t width = int32_t(FFXM_MAXIMUM(1u, FFXM_MINIMUM(srcTexture->width, dstTexture->width) >> mip));
+        const int32_t height = int32_t(FFXM_MAXIMUM(1u, FFXM_MINIMUM(srcTexture->height, dstTexture->height) >> mip));
+        for (int32_t y = 0; y < height; ++y)
+        {
+            for (int32_t x = 0; x < width; ++x)
+            {
+                float texel[4];
+                ffxmCpuLoadTexel(srcTexture, x, y, mip, texel);
+                ffxmCpuStoreTexel(dstTexture, x, y, mip, texel);
+            }
+        }
+    }
+
+    return FFXM_OK;
+}
+
+static FfxmErrorCode executeGpuJobClearFloat(BackendContext_CPU* backendContext, FfxmGpuJobDescription* job)
+{
+    CpuTexture* texture = getTexture(backendContext, job->clearJobDescriptor.target);
+    FFXM_RETURN_ON_ERROR(
+        texture,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    // 32 bit integer targets take the bit pattern of the clear color, as the Vulkan clear color union does,
+    // so the effect can clear the asuint encoded depth targets to a float value
+    const bool rawClear = (texture->format == FFXM_SURFACE_FORMAT_R32_UINT);
+    uint32_t rawValue = 0;
+    memcpy(&rawValue, &job->clearJobDescriptor.color[0], sizeof(rawValue));
+
+    for (uint32_t mip = 0; mip < texture->mipCount; ++mip)
+    {
+        const int32_t width = int32_t(FFXM_MAXIMUM(1u, texture->width >> mip));
+        const int32_t height = int32_t(FFXM_MAXIMUM(1u, texture->height >> mip));
+        for (int32_t y = 0; y < height; ++y)
+        {
+            for (int32_t x = 0; x < width; ++x)
+            {
+                if (rawClear)
+                {
+                    memcpy(texture->data + texture->mipOffsets[mip] + (size_t(y) * width + x) * sizeof(uint32_t), &rawValue, sizeof(rawValue));
+                }
+                else
+                {
+                    ffxmCpuStoreTexel(texture, x, y, mip, job->clearJobDescriptor.color);
+                }
+            }
+        }
+    }
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ExecuteGpuJobsCPU(FfxmInterface* backendInterface, [[maybe_unused]] FfxmCommandList commandList)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FfxmErrorCode errorCode = FFXM_OK;
+
+    // execute all jobs in submission order, each job completes before the next one starts
+    for (FfxmUInt32 i = 0; i < backendContext->gpuJobCount && errorCode == FFXM_OK; ++i)
+    {
+        FfxmGpuJobDescription* gpuJob = &backendContext->pGpuJobs[i];
+
+        switch (gpuJob->jobType)
+        {
+        case FFXM_GPU_JOB_CLEAR_FLOAT:
+        {
+            errorCode = executeGpuJobClearFloat(backendContext, gpuJob);
+            break;
+        }
+        case FFXM_GPU_JOB_COPY:
+        {
+            errorCode = executeGpuJobCopy(backendContext, gpuJob);
+            break;
+        }
+        case FFXM_GPU_JOB_COMPUTE:
+        {
+            errorCode = executeGpuJobCompute(backendContext, gpuJob);
+            break;
+        }
+        case FFXM_GPU_JOB_FRAGMENT:
+        {
+            errorCode = executeGpuJobFragment(backendContext, gpuJob);
+            break;
+        }
+        default:;
+        }
+    }
+
+    backendContext->gpuJobCount = 0;
+    backendContext->constantDataCount = 0;
+
+    // check the execute function returned cleanly.
+    FFXM_RETURN_ON_ERROR(
+        errorCode == FFXM_OK,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    return FFXM_OK;
+}
+
+} // namespace arm
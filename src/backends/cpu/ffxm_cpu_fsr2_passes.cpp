@@ -0,0 +1,96 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// The bindings of a pass as seen by the passes of include/gpu/fsr2 compiled for the CPU, and the lookup of the
+// permutation running a pipeline. The passes themselves are built from shaders/fsr2 by CMakeShadersFSR2.txt.
+
+#include <host/ffxm_util.h>
+#include <host/ffxm_assert.h>
+#include "ffxm_cpu_fsr2_passes.h"
+
+#include <cwchar>
+
+namespace arm
+{
+
+CpuTexture* ffxmCpuFindPassTexture(const CpuFsr2PassDescription* passDescription, const wchar_t* name, uint32_t* outMip)
+{
+    const CpuTextureBinding* lists[] = { passDescription->srvTextures, passDescription->uavTextures, passDescription->rtTextures };
+    const uint32_t           counts[] = { passDescription->srvTextureCount, passDescription->uavTextureCount, passDescription->rtTextureCount };
+    for (uint32_t list = 0; list < 3; ++list) {
+        for (uint32_t index = 0; index < counts[list]; ++index) {
+            const CpuTextureBinding& binding = lists[list][index];
+            if (binding.name && binding.texture && wcscmp(binding.name, name) == 0) {
+                *outMip = binding.mip;
+                return binding.texture;
+            }
+        }
+    }
+    *outMip = 0;
+    return nullptr;
+}
+
+CpuTexture* ffxmCpuGetPassRenderTarget(const CpuFsr2PassDescription* passDescription, uint32_t index)
+{
+    return index < passDescription->rtTextureCount ? passDescription->rtTextures[index].texture : nullptr;
+}
+
+const uint32_t* ffxmCpuFindPassConstants(const CpuFsr2PassDescription* passDescription, const wchar_t* name, uint32_t* outCount)
+{
+    for (uint32_t index = 0; index < passDescription->constantBufferCount; ++index) {
+        const CpuConstantBufferBinding& binding = passDescription->constantBuffers[index];
+        if (binding.name && binding.data && wcscmp(binding.name, name) == 0) {
+            *outCount = binding.num32BitEntries;
+            return binding.data;
+        }
+    }
+    *outCount = 0;
+    return nullptr;
+}
+
+void ffxmCpuGetPassArea(const CpuFsr2PassDescription* passDescription, uint32_t outOffset[2], uint32_t outDimensions[2])
+{
+    outOffset[0] = passDescription->offset[0];
+    outOffset[1] = passDescription->offset[1];
+    outDimensions[0] = passDescription->dimensions[0];
+    outDimensions[1] = passDescription->dimensions[1];
+}
+
+CpuFsr2ShaderFunc ffxmCpuGetFsr2Shader(FfxmPass pass, uint32_t permutationOptions)
+{
+    for (uint32_t index = 0; index < g_CpuFsr2ShaderPermutationCount; ++index) {
+        const CpuFsr2ShaderPermutation& permutation = g_CpuFsr2ShaderPermutations[index];
+        if (permutation.pass == pass && (permutationOptions & permutation.permutationMask) == permutation.permutationOptions)
+            return permutation.shader;
+    }
+    return nullptr;
+}
+
+FfxmErrorCode ffxmCpuExecuteFsr2Pass(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor)
+{
+    FFXM_RETURN_ON_ERROR(passDescription, FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(passDescription->shader, FFXM_ERROR_INVALID_ARGUMENT);
+
+    passDescription->shader(passDescription, parallelFor);
+    return FFXM_OK;
+}
+
+} // namespace arm
@@ -0,0 +1,98 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <host/ffxm_interface.h>
+#include "ffxm_cpu_shader.h"
+
+namespace arm
+{
+
+#define FFXM_CPU_MAX_MIP_COUNT          (16)
+
+// A host memory texture. Texels are tightly packed in the native surface format, mips are stored back to back.
+typedef struct CpuTexture {
+    uint8_t*                    data;
+    FfxmSurfaceFormat           format;
+    uint32_t                    width;
+    uint32_t                    height;
+    uint32_t                    mipCount;
+    size_t                      mipOffsets[FFXM_CPU_MAX_MIP_COUNT];
+} CpuTexture;
+
+// A named texture binding of a job, as provided by the effect through the job description.
+typedef struct CpuTextureBinding {
+    const wchar_t*              name;
+    CpuTexture*                 texture;
+    uint32_t                    mip;
+} CpuTextureBinding;
+
+// A named constant buffer binding of a job.
+typedef struct CpuConstantBufferBinding {
+    const wchar_t*              name;
+    const uint32_t*             data;
+    uint32_t                    num32BitEntries;
+} CpuConstantBufferBinding;
+
+// Everything needed to run one FSR2 pass on the CPU.
+typedef struct CpuFsr2PassDescription {
+    FfxmPass                    pass;
+    uint32_t                    permutationOptions;
+    CpuFsr2ShaderFunc           shader;                 // Permutation of the pass, see ffxmCpuGetFsr2Shader.
+    uint32_t                    offset[2];              // Origin of the area to run, in pixels for fragment passes and thread groups for compute passes.
+    uint32_t                    dimensions[2];          // Viewport for fragment passes, dispatch size in thread groups for compute passes.
+
+    CpuTextureBinding           srvTextures[FFXM_MAX_NUM_SRVS];
+    uint32_t                    srvTextureCount;
+    CpuTextureBinding           uavTextures[FFXM_MAX_NUM_UAVS];
+    uint32_t                    uavTextureCount;
+    CpuTextureBinding           rtTextures[FFXM_MAX_NUM_RTS];
+    uint32_t                    rtTextureCount;
+    CpuConstantBufferBinding    constantBuffers[FFXM_MAX_NUM_CONST_BUFFERS];
+    uint32_t                    constantBufferCount;
+} CpuFsr2PassDescription;
+
+// Size in bytes of a single texel of the given format.
+uint32_t ffxmCpuGetSurfaceFormatSize(FfxmSurfaceFormat format);
+
+// Fills the mip layout of a texture (data excluded) and returns the storage size it needs.
+size_t ffxmCpuInitTextureLayout(CpuTexture* texture, FfxmSurfaceFormat format, uint32_t width, uint32_t height, uint32_t mipCount);
+
+// A permutation of a pass compiled for the CPU, see CMakeShadersFSR2.txt.
+typedef struct CpuFsr2ShaderPermutation {
+    FfxmPass                    pass;
+    uint32_t                    permutationOptions;     // Options the permutation is compiled with.
+    uint32_t                    permutationMask;        // Options the permutation is selected on, the pass ignores the others.
+    CpuFsr2ShaderFunc           shader;
+} CpuFsr2ShaderPermutation;
+
+// The permutations built, generated by CMakeShadersFSR2.txt.
+extern const CpuFsr2ShaderPermutation g_CpuFsr2ShaderPermutations[];
+extern const uint32_t g_CpuFsr2ShaderPermutationCount;
+
+// The pass compiled for a permutation, null when the permutation is not built for the CPU.
+CpuFsr2ShaderFunc ffxmCpuGetFsr2Shader(FfxmPass pass, uint32_t permutationOptions);
+
+// Runs an FSR2 pass with its shader.
+FfxmErrorCode ffxmCpuExecuteFsr2Pass(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor);
+
+} // namespace arm
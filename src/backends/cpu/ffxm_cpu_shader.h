@@ -0,0 +1,76 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// The part of the CPU backend seen by the passes of include/gpu compiled as C++ (see shaders/ffxm_cpu_shader_main.h).
+// Those sources get their types from the GPU headers, which cannot be mixed with the host headers of
+// include/host in the same translation unit, so everything here is written with plain types.
+//
+// The pass sources include the GPU headers inside a namespace, the standard headers ffxm_core_cpu.h needs are
+// included from here beforehand.
+
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace arm
+{
+
+struct CpuTexture;
+struct CpuFsr2PassDescription;
+
+// Splits [0, rowCount) in ranges and invokes the row function on each of them, possibly from several threads.
+typedef std::function<void(uint32_t rowBegin, uint32_t rowEnd)> CpuRowFunc;
+typedef std::function<void(uint32_t rowCount, const CpuRowFunc& rowFunc)> CpuParallelForFunc;
+
+// A pass compiled for a single permutation, see ffxmCpuGetFsr2Shader.
+typedef void (*CpuFsr2ShaderFunc)(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor);
+
+// Reads a texel and converts it to float. Out of bounds reads return zero.
+void ffxmCpuLoadTexel(const CpuTexture* texture, int32_t x, int32_t y, uint32_t mip, float outValue[4]);
+
+// Converts and writes a texel. Out of bounds writes are dropped.
+void ffxmCpuStoreTexel(CpuTexture* texture, int32_t x, int32_t y, uint32_t mip, const float value[4]);
+
+// Size of a mip, zero for mips the texture does not have.
+void ffxmCpuGetTextureSize(const CpuTexture* texture, uint32_t mip, int32_t outSize[2]);
+
+// Raw access to a texel of a 32-bit single channel format, for the atomics. Null when out of bounds.
+uint32_t* ffxmCpuGetTexelUint(CpuTexture* texture, int32_t x, int32_t y, uint32_t mip);
+
+// Finds a texture binding of the pass by name in its SRVs, UAVs and render targets. Null when not bound.
+CpuTexture* ffxmCpuFindPassTexture(const CpuFsr2PassDescription* passDescription, const wchar_t* name, uint32_t* outMip);
+
+// Render target of the pass bound to the given SV_TARGET index. Null when not bound.
+CpuTexture* ffxmCpuGetPassRenderTarget(const CpuFsr2PassDescription* passDescription, uint32_t index);
+
+// Finds a constant buffer binding of the pass by name. Null when not bound.
+const uint32_t* ffxmCpuFindPassConstants(const CpuFsr2PassDescription* passDescription, const wchar_t* name, uint32_t* outCount);
+
+// Area to run, in pixels for fragment passes and thread groups for compute passes.
+void ffxmCpuGetPassArea(const CpuFsr2PassDescription* passDescription, uint32_t outOffset[2], uint32_t outDimensions[2]);
+
+} // namespace arm
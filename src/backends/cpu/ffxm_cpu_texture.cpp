@@ -0,0 +1,452 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <host/ffxm_util.h>
+#include <host/ffxm_assert.h>
+#include "ffxm_cpu_fsr2_passes.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace arm
+{
+
+namespace
+{
+
+inline float Saturate(float a) { return fminf(fmaxf(a, 0.0f), 1.0f); }
+
+//////////////////////////////////////////////////////////////////////////
+// Surface format conversion.
+
+// Decodes an unsigned float with a 5 bit exponent (bias 15) and the given number of mantissa bits.
+float decodeSmallFloat(uint32_t bits, uint32_t mantissaBits)
+{
+    const uint32_t exponent = (bits >> mantissaBits) & 0x1f;
+    const uint32_t mantissa = bits & ((1u << mantissaBits) - 1);
+    const float    mantissaScale = float(1u << mantissaBits);
+
+    if (exponent == 0) {
+        return ldexpf(float(mantissa) / mantissaScale, -14);
+    }
+    if (exponent == 31) {
+        return mantissa ? NAN : INFINITY;
+    }
+    return ldexpf(1.0f + float(mantissa) / mantissaScale, int32_t(exponent) - 15);
+}
+
+// Encodes a positive value as an unsigned float with a 5 bit exponent, rounding to nearest and saturating to the largest finite value.
+uint32_t encodeSmallFloat(float value, uint32_t mantissaBits)
+{
+    const uint32_t maxFinite = (30u << mantissaBits) | ((1u << mantissaBits) - 1);
+    if (!(value > 0.0f)) {
+        return 0;
+    }
+    if (std::isinf(value)) {
+        return maxFinite;
+    }
+
+    int32_t     exp2 = 0;
+    const float fraction = frexpf(value, &exp2);    // value = fraction * 2^exp2, fraction in [0.5, 1)
+    int32_t     exponent = exp2 + 14;
+
+    if (exponent <= 0) {
+        // denormal, may round up to the smallest normal which has the expected bit pattern
+        return uint32_t(lrintf(ldexpf(value, 14 + int32_t(mantissaBits))));
+    }
+
+    uint32_t mantissa = uint32_t(lrintf((fraction * 2.0f - 1.0f) * float(1u << mantissaBits)));
+    if (mantissa == (1u << mantissaBits)) {
+        mantissa = 0;
+        ++exponent;
+    }
+    if (exponent >= 31) {
+        return maxFinite;
+    }
+    return (uint32_t(exponent) << mantissaBits) | mantissa;
+}
+
+float halfToFloat(uint16_t value)
+{
+    const float magnitude = decodeSmallFloat(value & 0x7fff, 10);
+    return (value & 0x8000) ? -magnitude : magnitude;
+}
+
+uint16_t floatToHalf(float value)
+{
+    if (std::isnan(value)) {
+        return 0x7e00;
+    }
+    const uint16_t sign = std::signbit(value) ? 0x8000 : 0;
+    return uint16_t(sign | encodeSmallFloat(fabsf(value), 10));
+}
+
+float srgbToLinear(float value)
+{
+    return (value <= 0.04045f) ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f);
+}
+
+float linearToSrgb(float value)
+{
+    return (value <= 0.0031308f) ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+}
+
+inline float unormToFloat(uint32_t value, uint32_t maxValue)
+{
+    return float(value) / float(maxValue);
+}
+
+inline uint32_t floatToUnorm(float value, uint32_t maxValue)
+{
+    return uint32_t(lrintf(Saturate(value) * float(maxValue)));
+}
+
+inline float snormToFloat(int32_t value, int32_t maxValue)
+{
+    return fmaxf(-1.0f, float(value) / float(maxValue));
+}
+
+inline int32_t floatToSnorm(float value, int32_t maxValue)
+{
+    return int32_t(lrintf(fminf(fmaxf(value, -1.0f), 1.0f) * float(maxValue)));
+}
+
+inline uint32_t floatToUint(float value, uint32_t maxValue)
+{
+    return (value <= 0.0f) ? 0 : ((value >= float(maxValue)) ? maxValue : uint32_t(value));
+}
+
+} // namespace
+
+uint32_t ffxmCpuGetSurfaceFormatSize(FfxmSurfaceFormat format)
+{
+    switch (format) {
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_UINT:
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        return 16;
+    case FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+    case FFXM_SURFACE_FORMAT_R32G32_FLOAT:
+        return 8;
+    case FFXM_SURFACE_FORMAT_R32_UINT:
+    case FFXM_SURFACE_FORMAT_R32_FLOAT:
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_TYPELESS:
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM:
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SNORM:
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SRGB:
+    case FFXM_SURFACE_FORMAT_R11G11B10_FLOAT:
+    case FFXM_SURFACE_FORMAT_R16G16_FLOAT:
+    case FFXM_SURFACE_FORMAT_R16G16_UINT:
+        return 4;
+    case FFXM_SURFACE_FORMAT_R16_FLOAT:
+    case FFXM_SURFACE_FORMAT_R16_UINT:
+    case FFXM_SURFACE_FORMAT_R16_UNORM:
+    case FFXM_SURFACE_FORMAT_R16_SNORM:
+    case FFXM_SURFACE_FORMAT_R8G8_UNORM:
+        return 2;
+    case FFXM_SURFACE_FORMAT_R8_UINT:
+    case FFXM_SURFACE_FORMAT_R8_UNORM:
+    case FFXM_SURFACE_FORMAT_R8_SNORM:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+size_t ffxmCpuInitTextureLayout(CpuTexture* texture, FfxmSurfaceFormat format, uint32_t width, uint32_t height, uint32_t mipCount)
+{
+    FFXM_ASSERT(texture);
+    FFXM_ASSERT(mipCount > 0 && mipCount <= FFXM_CPU_MAX_MIP_COUNT);
+
+    texture->format = format;
+    texture->width = width;
+    texture->height = height;
+    texture->mipCount = mipCount;
+
+    const uint32_t texelSize = ffxmCpuGetSurfaceFormatSize(format);
+    size_t         offset = 0;
+    for (uint32_t mip = 0; mip < mipCount; ++mip) {
+        // keep every mip 16 byte aligned so texels of the 32 bit formats can be accessed atomically
+        offset = FFXM_ALIGN_UP(offset, 16);
+        texture->mipOffsets[mip] = offset;
+        offset += size_t(FFXM_MAXIMUM(1u, width >> mip)) * FFXM_MAXIMUM(1u, height >> mip) * texelSize;
+    }
+    return offset;
+}
+
+void ffxmCpuLoadTexel(const CpuTexture* texture, int32_t x, int32_t y, uint32_t mip, float outValue[4])
+{
+    outValue[0] = outValue[1] = outValue[2] = 0.0f;
+    outValue[3] = 1.0f;
+
+    const int32_t width = int32_t(FFXM_MAXIMUM(1u, texture->width >> mip));
+    const int32_t height = int32_t(FFXM_MAXIMUM(1u, texture->height >> mip));
+    if (x < 0 || y < 0 || x >= width || y >= height || mip >= texture->mipCount) {
+        outValue[3] = 0.0f;
+        return;
+    }
+
+    const uint32_t texelSize = ffxmCpuGetSurfaceFormatSize(texture->format);
+    const uint8_t* texel = texture->data + texture->mipOffsets[mip] + (size_t(y) * width + x) * texelSize;
+
+    switch (texture->format) {
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        memcpy(outValue, texel, 4 * sizeof(float));
+        break;
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_UINT: {
+        uint32_t values[4];
+        memcpy(values, texel, sizeof(values));
+        for (uint32_t c = 0; c < 4; ++c) {
+            outValue[c] = float(values[c]);
+        }
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT: {
+        uint16_t values[4];
+        memcpy(values, texel, sizeof(values));
+        for (uint32_t c = 0; c < 4; ++c) {
+            outValue[c] = halfToFloat(values[c]);
+        }
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R32G32_FLOAT:
+        memcpy(outValue, texel, 2 * sizeof(float));
+        break;
+    case FFXM_SURFACE_FORMAT_R8_UINT:
+        outValue[0] = float(texel[0]);
+        break;
+    case FFXM_SURFACE_FORMAT_R32_UINT: {
+        uint32_t value;
+        memcpy(&value, texel, sizeof(value));
+        outValue[0] = float(value);
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_TYPELESS:
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM:
+        for (uint32_t c = 0; c < 4; ++c) {
+            outValue[c] = unormToFloat(texel[c], 255);
+        }
+        break;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SNORM:
+        for (uint32_t c = 0; c < 4; ++c) {
+            outValue[c] = snormToFloat(int8_t(texel[c]), 127);
+        }
+        break;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SRGB:
+        for (uint32_t c = 0; c < 3; ++c) {
+            outValue[c] = srgbToLinear(unormToFloat(texel[c], 255));
+        }
+        outValue[3] = unormToFloat(texel[3], 255);
+        break;
+    case FFXM_SURFACE_FORMAT_R11G11B10_FLOAT: {
+        uint32_t value;
+        memcpy(&value, texel, sizeof(value));
+        outValue[0] = decodeSmallFloat(value & 0x7ff, 6);
+        outValue[1] = decodeSmallFloat((value >> 11) & 0x7ff, 6);
+        outValue[2] = decodeSmallFloat((value >> 22) & 0x3ff, 5);
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16G16_FLOAT: {
+        uint16_t values[2];
+        memcpy(values, texel, sizeof(values));
+        outValue[0] = halfToFloat(values[0]);
+        outValue[1] = halfToFloat(values[1]);
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16G16_UINT: {
+        uint16_t values[2];
+        memcpy(values, texel, sizeof(values));
+        outValue[0] = float(values[0]);
+        outValue[1] = float(values[1]);
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16_FLOAT:
+    case FFXM_SURFACE_FORMAT_R16_UINT:
+    case FFXM_SURFACE_FORMAT_R16_UNORM:
+    case FFXM_SURFACE_FORMAT_R16_SNORM: {
+        uint16_t value;
+        memcpy(&value, texel, sizeof(value));
+        if (texture->format == FFXM_SURFACE_FORMAT_R16_FLOAT) {
+            outValue[0] = halfToFloat(value);
+        } else if (texture->format == FFXM_SURFACE_FORMAT_R16_UINT) {
+            outValue[0] = float(value);
+        } else if (texture->format == FFXM_SURFACE_FORMAT_R16_UNORM) {
+            outValue[0] = unormToFloat(value, 65535);
+        } else {
+            outValue[0] = snormToFloat(int16_t(value), 32767);
+        }
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R8_UNORM:
+        outValue[0] = unormToFloat(texel[0], 255);
+        break;
+    case FFXM_SURFACE_FORMAT_R8_SNORM:
+        outValue[0] = snormToFloat(int8_t(texel[0]), 127);
+        break;
+    case FFXM_SURFACE_FORMAT_R8G8_UNORM:
+        outValue[0] = unormToFloat(texel[0], 255);
+        outValue[1] = unormToFloat(texel[1], 255);
+        break;
+    case FFXM_SURFACE_FORMAT_R32_FLOAT:
+        memcpy(outValue, texel, sizeof(float));
+        break;
+    default:
+        FFXM_ASSERT_MESSAGE(false, "ffxmInterface: CPU: Unsupported surface format");
+        break;
+    }
+}
+
+void ffxmCpuStoreTexel(CpuTexture* texture, int32_t x, int32_t y, uint32_t mip, const float value[4])
+{
+    const int32_t width = int32_t(FFXM_MAXIMUM(1u, texture->width >> mip));
+    const int32_t height = int32_t(FFXM_MAXIMUM(1u, texture->height >> mip));
+    if (x < 0 || y < 0 || x >= width || y >= height || mip >= texture->mipCount) {
+        return;
+    }
+
+    const uint32_t texelSize = ffxmCpuGetSurfaceFormatSize(texture->format);
+    uint8_t*       texel = texture->data + texture->mipOffsets[mip] + (size_t(y) * width + x) * texelSize;
+
+    switch (texture->format) {
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        memcpy(texel, value, 4 * sizeof(float));
+        break;
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_UINT: {
+        uint32_t values[4];
+        for (uint32_t c = 0; c < 4; ++c) {
+            values[c] = floatToUint(value[c], UINT32_MAX);
+        }
+        memcpy(texel, values, sizeof(values));
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT: {
+        uint16_t values[4];
+        for (uint32_t c = 0; c < 4; ++c) {
+            values[c] = floatToHalf(value[c]);
+        }
+        memcpy(texel, values, sizeof(values));
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R32G32_FLOAT:
+        memcpy(texel, value, 2 * sizeof(float));
+        break;
+    case FFXM_SURFACE_FORMAT_R8_UINT:
+        texel[0] = uint8_t(floatToUint(value[0], 255));
+        break;
+    case FFXM_SURFACE_FORMAT_R32_UINT: {
+        const uint32_t converted = floatToUint(value[0], UINT32_MAX);
+        memcpy(texel, &converted, sizeof(converted));
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_TYPELESS:
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM:
+        for (uint32_t c = 0; c < 4; ++c) {
+            texel[c] = uint8_t(floatToUnorm(value[c], 255));
+        }
+        break;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SNORM:
+        for (uint32_t c = 0; c < 4; ++c) {
+            texel[c] = uint8_t(int8_t(floatToSnorm(value[c], 127)));
+        }
+        break;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SRGB:
+        for (uint32_t c = 0; c < 3; ++c) {
+            texel[c] = uint8_t(floatToUnorm(linearToSrgb(Saturate(value[c])), 255));
+        }
+        texel[3] = uint8_t(floatToUnorm(value[3], 255));
+        break;
+    case FFXM_SURFACE_FORMAT_R11G11B10_FLOAT: {
+        const uint32_t packed = encodeSmallFloat(value[0], 6) | (encodeSmallFloat(value[1], 6) << 11) | (encodeSmallFloat(value[2], 5) << 22);
+        memcpy(texel, &packed, sizeof(packed));
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16G16_FLOAT: {
+        const uint16_t values[2] = { floatToHalf(value[0]), floatToHalf(value[1]) };
+        memcpy(texel, values, sizeof(values));
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16G16_UINT: {
+        const uint16_t values[2] = { uint16_t(floatToUint(value[0], 65535)), uint16_t(floatToUint(value[1], 65535)) };
+        memcpy(texel, values, sizeof(values));
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R16_FLOAT:
+    case FFXM_SURFACE_FORMAT_R16_UINT:
+    case FFXM_SURFACE_FORMAT_R16_UNORM:
+    case FFXM_SURFACE_FORMAT_R16_SNORM: {
+        uint16_t converted;
+        if (texture->format == FFXM_SURFACE_FORMAT_R16_FLOAT) {
+            converted = floatToHalf(value[0]);
+        } else if (texture->format == FFXM_SURFACE_FORMAT_R16_UINT) {
+            converted = uint16_t(floatToUint(value[0], 65535));
+        } else if (texture->format == FFXM_SURFACE_FORMAT_R16_UNORM) {
+            converted = uint16_t(floatToUnorm(value[0], 65535));
+        } else {
+            converted = uint16_t(int16_t(floatToSnorm(value[0], 32767)));
+        }
+        memcpy(texel, &converted, sizeof(converted));
+        break;
+    }
+    case FFXM_SURFACE_FORMAT_R8_UNORM:
+        texel[0] = uint8_t(floatToUnorm(value[0], 255));
+        break;
+    case FFXM_SURFACE_FORMAT_R8_SNORM:
+        texel[0] = uint8_t(int8_t(floatToSnorm(value[0], 127)));
+        break;
+    case FFXM_SURFACE_FORMAT_R8G8_UNORM:
+        texel[0] = uint8_t(floatToUnorm(value[0], 255));
+        texel[1] = uint8_t(floatToUnorm(value[1], 255));
+        break;
+    case FFXM_SURFACE_FORMAT_R32_FLOAT:
+        memcpy(texel, value, sizeof(float));
+        break;
+    default:
+        FFXM_ASSERT_MESSAGE(false, "ffxmInterface: CPU: Unsupported surface format");
+        break;
+    }
+}
+
+void ffxmCpuGetTextureSize(const CpuTexture* texture, uint32_t mip, int32_t outSize[2])
+{
+    outSize[0] = outSize[1] = 0;
+    if (texture && mip < texture->mipCount) {
+        outSize[0] = int32_t(FFXM_MAXIMUM(1u, texture->width >> mip));
+        outSize[1] = int32_t(FFXM_MAXIMUM(1u, texture->height >> mip));
+    }
+}
+
+uint32_t* ffxmCpuGetTexelUint(CpuTexture* texture, int32_t x, int32_t y, uint32_t mip)
+{
+    if (!texture || ffxmCpuGetSurfaceFormatSize(texture->format) != sizeof(uint32_t)) {
+        return nullptr;
+    }
+
+    int32_t size[2];
+    ffxmCpuGetTextureSize(texture, mip, size);
+    if (x < 0 || y < 0 || x >= size[0] || y >= size[1]) {
+        return nullptr;
+    }
+    return reinterpret_cast<uint32_t*>(texture->data + texture->mipOffsets[mip]) + size_t(y) * size[0] + x;
+}
+
+} // namespace arm
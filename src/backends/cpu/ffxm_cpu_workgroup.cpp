@@ -0,0 +1,348 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <host/ffxm_assert.h>
+#include "ffxm_cpu_workgroup.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#define FFXM_CPU_FIBER_WIN32
+#elif (defined(__x86_64__) || defined(__aarch64__)) && (defined(__ELF__) || defined(__APPLE__))
+#define FFXM_CPU_FIBER_ASM
+#else
+#include <ucontext.h>
+#define FFXM_CPU_FIBER_UCONTEXT
+#endif
+
+namespace arm
+{
+
+#if defined(FFXM_CPU_FIBER_ASM)
+
+// The lanes switch a few times per work group; swapcontext also saves the signal mask with a system call, which
+// costs more than most lanes, so the switch only saves the callee-saved registers the ABI asks for.
+extern "C" void ffxmCpuSwitchFiber(void** fromStack, void* toStack);
+extern "C" void ffxmCpuStartFiber();
+
+#if defined(__APPLE__)
+#define FFXM_CPU_ASM_SYMBOL(name) "_" #name
+#define FFXM_CPU_ASM_DECLARE(name) ".private_extern " FFXM_CPU_ASM_SYMBOL(name) "\n"
+#else
+#define FFXM_CPU_ASM_SYMBOL(name) #name
+#define FFXM_CPU_ASM_DECLARE(name) ".hidden " FFXM_CPU_ASM_SYMBOL(name) "\n.type " FFXM_CPU_ASM_SYMBOL(name) ", %function\n"
+#endif
+
+#if defined(__x86_64__)
+
+// void ffxmCpuSwitchFiber(void** fromStack, void* toStack)
+// A new fiber starts in ffxmCpuStartFiber with its entry point in r13 and its argument in r12. The switch leaves with
+// a jump rather than a return, which the return stack of the CPU would mispredict on every switch.
+asm(".text\n"
+    ".globl " FFXM_CPU_ASM_SYMBOL(ffxmCpuSwitchFiber) "\n"
+    FFXM_CPU_ASM_DECLARE(ffxmCpuSwitchFiber)
+    ".p2align 4\n"
+    FFXM_CPU_ASM_SYMBOL(ffxmCpuSwitchFiber) ":\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    popq %rcx\n"
+    "    jmpq *%rcx\n"
+    ".globl " FFXM_CPU_ASM_SYMBOL(ffxmCpuStartFiber) "\n"
+    FFXM_CPU_ASM_DECLARE(ffxmCpuStartFiber)
+    ".p2align 4\n"
+    FFXM_CPU_ASM_SYMBOL(ffxmCpuStartFiber) ":\n"
+    "    movq %r12, %rdi\n"
+    "    callq *%r13\n"
+    "    ud2\n");
+
+static const uint32_t s_SavedRegisterCount = 6;
+static const uint32_t s_EntryRegister = 2;      // r13
+static const uint32_t s_ArgumentRegister = 3;   // r12
+
+#else
+
+// void ffxmCpuSwitchFiber(void** fromStack, void* toStack)
+// A new fiber starts in ffxmCpuStartFiber with its entry point in x19 and its argument in x20.
+asm(".text\n"
+    ".globl " FFXM_CPU_ASM_SYMBOL(ffxmCpuSwitchFiber) "\n"
+    FFXM_CPU_ASM_DECLARE(ffxmCpuSwitchFiber)
+    ".p2align 4\n"
+    FFXM_CPU_ASM_SYMBOL(ffxmCpuSwitchFiber) ":\n"
+    "    sub sp, sp, #160\n"
+    "    stp x19, x20, [sp, #0]\n"
+    "    stp x21, x22, [sp, #16]\n"
+    "    stp x23, x24, [sp, #32]\n"
+    "    stp x25, x26, [sp, #48]\n"
+    "    stp x27, x28, [sp, #64]\n"
+    "    stp x29, x30, [sp, #80]\n"
+    "    stp d8, d9, [sp, #96]\n"
+    "    stp d10, d11, [sp, #112]\n"
+    "    stp d12, d13, [sp, #128]\n"
+    "    stp d14, d15, [sp, #144]\n"
+    "    mov x2, sp\n"
+    "    str x2, [x0]\n"
+    "    mov sp, x1\n"
+    "    ldp x19, x20, [sp, #0]\n"
+    "    ldp x21, x22, [sp, #16]\n"
+    "    ldp x23, x24, [sp, #32]\n"
+    "    ldp x25, x26, [sp, #48]\n"
+    "    ldp x27, x28, [sp, #64]\n"
+    "    ldp x29, x30, [sp, #80]\n"
+    "    ldp d8, d9, [sp, #96]\n"
+    "    ldp d10, d11, [sp, #112]\n"
+    "    ldp d12, d13, [sp, #128]\n"
+    "    ldp d14, d15, [sp, #144]\n"
+    "    add sp, sp, #160\n"
+    "    ret\n"
+    ".globl " FFXM_CPU_ASM_SYMBOL(ffxmCpuStartFiber) "\n"
+    FFXM_CPU_ASM_DECLARE(ffxmCpuStartFiber)
+    ".p2align 4\n"
+    FFXM_CPU_ASM_SYMBOL(ffxmCpuStartFiber) ":\n"
+    "    mov x0, x20\n"
+    "    blr x19\n"
+    "    brk #0\n");
+
+static const uint32_t s_SavedRegisterCount = 20;
+static const uint32_t s_EntryRegister = 0;      // x19
+static const uint32_t s_ArgumentRegister = 1;   // x20
+static const uint32_t s_ReturnRegister = 11;    // x30
+
+#endif
+
+#endif // #if defined(FFXM_CPU_FIBER_ASM)
+
+typedef void (*CpuFiberEntry)(void* argument);
+
+// An execution context: the calling thread, or a lane with its own stack.
+typedef struct CpuFiber {
+#if defined(FFXM_CPU_FIBER_WIN32)
+    LPVOID                      fiber;
+#elif defined(FFXM_CPU_FIBER_ASM)
+    void*                       stackPointer;
+    void*                       stack;
+#else
+    ucontext_t                  context;
+    void*                       stack;
+#endif
+} CpuFiber;
+
+#if defined(FFXM_CPU_FIBER_UCONTEXT)
+static void startFiber(unsigned int entryLow, unsigned int entryHigh, unsigned int argumentLow, unsigned int argumentHigh)
+{
+    // makecontext only passes int arguments
+    const CpuFiberEntry entry = CpuFiberEntry((uintptr_t(entryHigh) << 16 << 16) | uintptr_t(entryLow));
+    entry((void*)((uintptr_t(argumentHigh) << 16 << 16) | uintptr_t(argumentLow)));
+}
+#endif
+
+static void createFiber(CpuFiber* fiber, CpuFiberEntry entry, void* argument)
+{
+#if defined(FFXM_CPU_FIBER_WIN32)
+    fiber->fiber = CreateFiber(FFXM_CPU_WORK_GROUP_LANE_STACK_SIZE, LPFIBER_START_ROUTINE(entry), argument);
+    FFXM_ASSERT(fiber->fiber);
+#elif defined(FFXM_CPU_FIBER_ASM)
+    fiber->stack = malloc(FFXM_CPU_WORK_GROUP_LANE_STACK_SIZE);
+    FFXM_ASSERT(fiber->stack);
+
+    // the registers restored by the first switch, below the return address
+    uintptr_t* top = reinterpret_cast<uintptr_t*>((uintptr_t(fiber->stack) + FFXM_CPU_WORK_GROUP_LANE_STACK_SIZE) & ~uintptr_t(15));
+#if defined(__x86_64__)
+    // the return address lands 8 bytes below a 16 byte boundary, so the stack is aligned for the call of the entry
+    uintptr_t* registers = top - 1 - s_SavedRegisterCount;
+    memset(registers, 0, (s_SavedRegisterCount + 1) * sizeof(uintptr_t));
+    registers[s_SavedRegisterCount] = uintptr_t(&ffxmCpuStartFiber);
+#else
+    uintptr_t* registers = top - s_SavedRegisterCount;
+    memset(registers, 0, s_SavedRegisterCount * sizeof(uintptr_t));
+    registers[s_ReturnRegister] = uintptr_t(&ffxmCpuStartFiber);
+#endif
+    registers[s_EntryRegister] = uintptr_t(entry);
+    registers[s_ArgumentRegister] = uintptr_t(argument);
+    fiber->stackPointer = registers;
+#else
+    fiber->stack = malloc(FFXM_CPU_WORK_GROUP_LANE_STACK_SIZE);
+    FFXM_ASSERT(fiber->stack);
+    getcontext(&fiber->context);
+    fiber->context.uc_stack.ss_sp = fiber->stack;
+    fiber->context.uc_stack.ss_size = FFXM_CPU_WORK_GROUP_LANE_STACK_SIZE;
+    fiber->context.uc_link = nullptr;
+    makecontext(&fiber->context, (void (*)())startFiber, 4,
+        unsigned(uintptr_t(entry)), unsigned(uintptr_t(entry) >> 16 >> 16),
+        unsigned(uintptr_t(argument)), unsigned(uintptr_t(argument) >> 16 >> 16));
+#endif
+}
+
+static void destroyFiber(CpuFiber* fiber)
+{
+#if defined(FFXM_CPU_FIBER_WIN32)
+    DeleteFiber(fiber->fiber);
+#else
+    free(fiber->stack);
+#endif
+}
+
+static void switchFiber(CpuFiber* from, CpuFiber* to)
+{
+#if defined(FFXM_CPU_FIBER_WIN32)
+    (void)from;
+    SwitchToFiber(to->fiber);
+#elif defined(FFXM_CPU_FIBER_ASM)
+    ffxmCpuSwitchFiber(&from->stackPointer, to->stackPointer);
+#else
+    swapcontext(&from->context, &to->context);
+#endif
+}
+
+// The lanes of the work groups run by a thread. Lane stacks are created on first use and kept until the thread exits,
+// a lane loops over the work groups: it runs its part of one, then switches back to the thread and waits for the next.
+class CpuWorkGroup {
+public:
+
+    ~CpuWorkGroup()
+    {
+        for (uint32_t laneIndex = 0; laneIndex < m_createdLaneCount; ++laneIndex) {
+            destroyFiber(&m_lanes[laneIndex].fiber);
+        }
+    }
+
+    void run(uint32_t laneCount, CpuLaneFunc laneFunc, void* userData)
+    {
+        FFXM_ASSERT(laneCount <= FFXM_CPU_WORK_GROUP_MAX_LANE_COUNT);
+        FFXM_ASSERT(!m_laneFunc);
+
+#if defined(FFXM_CPU_FIBER_WIN32)
+        const bool convertThread = !IsThreadAFiber();
+        if (convertThread) {
+            m_thread.fiber = ConvertThreadToFiber(nullptr);
+        } else {
+            m_thread.fiber = GetCurrentFiber();
+        }
+#endif
+
+        while (m_createdLaneCount < laneCount) {
+            Lane& lane = m_lanes[m_createdLaneCount];
+            lane.group = this;
+            lane.index = m_createdLaneCount++;
+            createFiber(&lane.fiber, laneEntry, &lane);
+        }
+
+        m_laneFunc = laneFunc;
+        m_userData = userData;
+        for (uint32_t laneIndex = 0; laneIndex < laneCount; ++laneIndex) {
+            m_lanes[laneIndex].running = true;
+        }
+
+        // each round moves the lanes from a barrier to the next one, until they all return
+        for (uint32_t runningLaneCount = laneCount; runningLaneCount;) {
+            runningLaneCount = 0;
+            for (uint32_t laneIndex = 0; laneIndex < laneCount; ++laneIndex) {
+                Lane& lane = m_lanes[laneIndex];
+                if (lane.running) {
+                    m_currentLane = &lane;
+                    switchFiber(&m_thread, &lane.fiber);
+                    runningLaneCount += lane.running;
+                }
+            }
+        }
+
+        m_currentLane = nullptr;
+        m_laneFunc = nullptr;
+        m_userData = nullptr;
+
+#if defined(FFXM_CPU_FIBER_WIN32)
+        if (convertThread) {
+            ConvertFiberToThread();
+        }
+#endif
+    }
+
+    void barrier()
+    {
+        FFXM_ASSERT_MESSAGE(m_currentLane, "ffxmInterface: CPU: Group barrier outside of a work group");
+        switchFiber(&m_currentLane->fiber, &m_thread);
+    }
+
+    uint32_t laneIndex() const
+    {
+        FFXM_ASSERT_MESSAGE(m_currentLane, "ffxmInterface: CPU: Lane index outside of a work group");
+        return m_currentLane->index;
+    }
+
+private:
+
+    typedef struct Lane {
+        CpuFiber                fiber;
+        CpuWorkGroup*           group;
+        uint32_t                index;
+        bool                    running;
+    } Lane;
+
+    static void laneEntry(void* argument)
+    {
+        Lane* lane = static_cast<Lane*>(argument);
+        for (;;) {
+            lane->group->m_laneFunc(lane->group->m_userData, lane->index);
+            lane->running = false;
+            switchFiber(&lane->fiber, &lane->group->m_thread);
+        }
+    }
+
+    CpuFiber                    m_thread = {};
+    Lane                        m_lanes[FFXM_CPU_WORK_GROUP_MAX_LANE_COUNT] = {};
+    uint32_t                    m_createdLaneCount = 0;
+    Lane*                       m_currentLane = nullptr;
+    CpuLaneFunc                 m_laneFunc = nullptr;
+    void*                       m_userData = nullptr;
+};
+
+static thread_local CpuWorkGroup s_WorkGroup;
+
+void ffxmCpuRunWorkGroup(uint32_t laneCount, CpuLaneFunc laneFunc, void* userData)
+{
+    s_WorkGroup.run(laneCount, laneFunc, userData);
+}
+
+void ffxmCpuWorkGroupBarrier()
+{
+    s_WorkGroup.barrier();
+}
+
+uint32_t ffxmCpuWorkGroupLaneIndex()
+{
+    return s_WorkGroup.laneIndex();
+}
+
+} // namespace arm
@@ -0,0 +1,48 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// Runs the threads of a compute work group on the calling thread. Each thread of the group (a lane) gets its own
+// stack and is switched to cooperatively: a lane runs until it reaches a group barrier or returns, and leaves a
+// barrier once all the lanes still running have reached it. The groupshared memory of the passes is thread_local,
+// so it is shared by the lanes of a group and private to the work groups running on other threads.
+
+#include <cstdint>
+
+namespace arm
+{
+
+#define FFXM_CPU_WORK_GROUP_MAX_LANE_COUNT  (256)
+#define FFXM_CPU_WORK_GROUP_LANE_STACK_SIZE (64 * 1024)
+
+typedef void (*CpuLaneFunc)(void* userData, uint32_t laneIndex);
+
+// Runs laneCount lanes of a work group and returns once they all have returned.
+void ffxmCpuRunWorkGroup(uint32_t laneCount, CpuLaneFunc laneFunc, void* userData);
+
+// Group barrier, called by a lane of the running work group.
+void ffxmCpuWorkGroupBarrier();
+
+// Index of the running lane in its work group.
+uint32_t ffxmCpuWorkGroupLaneIndex();
+
+} // namespace arm
@@ -0,0 +1,186 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// The hooks of ffxm_core_cpu.h and the loops running a pass, included by the pass sources after the GPU headers,
+// in the same unnamed namespace. Each thread of the pool binds the resources of the pass to its own copy of the
+// thread_local resources declared by ffxm_fsr2_callbacks_cpu.h before running its rows.
+
+thread_local const CpuFsr2PassDescription* s_PassDescription = nullptr;
+thread_local FfxmCpuTextureView            s_RenderTargets[8]   = {};
+
+// Lane index when the lanes of a work group run one after the other, without fibers.
+thread_local FfxUInt32 s_LocalThreadIndex = 0;
+thread_local FfxBoolean s_WorkGroupFibers = false;
+
+FfxmCpuTextureView ffxmCpuBindTexture(const wchar_t* name)
+{
+    FfxmCpuTextureView view = {};
+    view.texture            = ffxmCpuFindPassTexture(s_PassDescription, name, &view.baseMip);
+    return view;
+}
+
+void ffxmCpuBindConstants(const wchar_t* name, void* data, FfxUInt32 size)
+{
+    FfxUInt32       count     = 0;
+    const uint32_t* constants = ffxmCpuFindPassConstants(s_PassDescription, name, &count);
+    const FfxUInt32 copied    = constants ? FfxUInt32(min(size, count * FfxUInt32(sizeof(uint32_t)))) : 0;
+    if (copied)
+        memcpy(data, constants, copied);
+    memset(static_cast<uint8_t*>(data) + copied, 0, size - copied);
+}
+
+FfxInt32x2 ffxmCpuTextureSize(const FfxmCpuTextureView& view, FfxUInt32 mip)
+{
+    FfxInt32x2 size;
+    ffxmCpuGetTextureSize(static_cast<const CpuTexture*>(view.texture), view.baseMip + mip, &size[0]);
+    return size;
+}
+
+FfxFloat32x4 ffxmCpuTextureLoad(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip)
+{
+    FfxFloat32x4 value;
+    if (view.texture)
+        ffxmCpuLoadTexel(static_cast<const CpuTexture*>(view.texture), position.x, position.y, view.baseMip + mip, &value[0]);
+    return value;
+}
+
+FfxUInt32x4 ffxmCpuTextureLoadUint(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip)
+{
+    // the 32bit integer textures are also updated atomically by other threads
+    if (FfxUInt32* texel = ffxmCpuGetTexelUint(static_cast<CpuTexture*>(view.texture), position.x, position.y, view.baseMip + mip))
+        return FfxUInt32x4(std::atomic_ref<FfxUInt32>(*texel).load(std::memory_order_relaxed), 0u, 0u, 0u);
+    return FfxUInt32x4(ffxmCpuTextureLoad(view, position, mip));
+}
+
+void ffxmCpuTextureStore(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip, FfxFloat32x4 value)
+{
+    if (view.texture)
+        ffxmCpuStoreTexel(static_cast<CpuTexture*>(view.texture), position.x, position.y, view.baseMip + mip, &value[0]);
+}
+
+void ffxmCpuTextureStoreUint(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip, FfxUInt32x4 value)
+{
+    if (FfxUInt32* texel = ffxmCpuGetTexelUint(static_cast<CpuTexture*>(view.texture), position.x, position.y, view.baseMip + mip))
+        std::atomic_ref<FfxUInt32>(*texel).store(value.x, std::memory_order_relaxed);
+    else
+        ffxmCpuTextureStore(view, position, mip, FfxFloat32x4(value));
+}
+
+FfxUInt32* ffxmCpuTextureAtomic(const FfxmCpuTextureView& view, FfxInt32x2 position, FfxUInt32 mip)
+{
+    return ffxmCpuGetTexelUint(static_cast<CpuTexture*>(view.texture), position.x, position.y, view.baseMip + mip);
+}
+
+void ffxmCpuGroupMemoryBarrier()
+{
+    if (s_WorkGroupFibers)
+        ffxmCpuWorkGroupBarrier();
+}
+
+FfxUInt32 ffxmCpuLocalThreadIndex()
+{
+    return s_WorkGroupFibers ? ffxmCpuWorkGroupLaneIndex() : s_LocalThreadIndex;
+}
+
+// Binds the resources of the pass for the calling thread.
+void ffxmCpuBeginPass(const CpuFsr2PassDescription* passDescription)
+{
+    s_PassDescription = passDescription;
+    BindCpuResources();
+    for (FfxUInt32 target = 0; target < 8; ++target)
+    {
+        s_RenderTargets[target]         = {};
+        s_RenderTargets[target].texture = ffxmCpuGetPassRenderTarget(passDescription, target);
+    }
+}
+
+// Writes an output of a fragment pass to the render target bound to its SV_TARGET index.
+template <typename T>
+void ffxmCpuStoreTarget(FfxUInt32 target, FfxInt32x2 position, const T& value)
+{
+    ffxmCpuTextureWrite<T>(s_RenderTargets[target], position, 0, value);
+}
+
+// Runs the main function of a fragment pass on each pixel of its area, the outputs are written by storeOutputs.
+template <typename Outputs>
+void ffxmCpuRunFragmentPass(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor,
+                            Outputs (*shaderMain)(FfxFloat32x4), void (*storeOutputs)(FfxInt32x2, const Outputs&))
+{
+    uint32_t offset[2], dimensions[2];
+    ffxmCpuGetPassArea(passDescription, offset, dimensions);
+
+    parallelFor(dimensions[1], [&](uint32_t rowBegin, uint32_t rowEnd) {
+        ffxmCpuBeginPass(passDescription);
+        for (uint32_t y = rowBegin; y < rowEnd; ++y)
+        {
+            for (uint32_t x = 0; x < dimensions[0]; ++x)
+            {
+                const FfxInt32x2 position = FfxInt32x2(FfxInt32(offset[0] + x), FfxInt32(offset[1] + y));
+                storeOutputs(position, shaderMain(FfxFloat32x4(FfxFloat32x2(position) + 0.5f, 0.0f, 1.0f)));
+            }
+        }
+    });
+}
+
+typedef struct FfxmCpuWorkGroup
+{
+    void (*shaderMain)(FfxUInt32x2, FfxUInt32x2);
+    FfxUInt32x2 groupId;
+    FfxUInt32   width;
+} FfxmCpuWorkGroup;
+
+// Runs the work groups of a compute pass of width x height threads each. The lanes of a group run as fibers when the
+// pass has group barriers, and one after the other otherwise.
+template <FfxBoolean GroupBarriers>
+void ffxmCpuRunComputePass(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor,
+                           FfxUInt32 width, FfxUInt32 height, void (*shaderMain)(FfxUInt32x2, FfxUInt32x2))
+{
+    uint32_t offset[2], dimensions[2];
+    ffxmCpuGetPassArea(passDescription, offset, dimensions);
+
+    parallelFor(dimensions[1], [&](uint32_t rowBegin, uint32_t rowEnd) {
+        ffxmCpuBeginPass(passDescription);
+        s_WorkGroupFibers = GroupBarriers;
+
+        FfxmCpuWorkGroup group = {shaderMain, FfxUInt32x2(0u, 0u), width};
+        for (uint32_t y = rowBegin; y < rowEnd; ++y)
+        {
+            for (uint32_t x = 0; x < dimensions[0]; ++x)
+            {
+                group.groupId = FfxUInt32x2(offset[0] + x, offset[1] + y);
+                if constexpr (GroupBarriers)
+                {
+                    ffxmCpuRunWorkGroup(width * height, [](void* userData, uint32_t laneIndex) {
+                        const FfxmCpuWorkGroup& group = *static_cast<const FfxmCpuWorkGroup*>(userData);
+                        group.shaderMain(group.groupId, FfxUInt32x2(laneIndex % group.width, laneIndex / group.width));
+                    }, &group);
+                }
+                else
+                {
+                    for (s_LocalThreadIndex = 0; s_LocalThreadIndex < width * height; ++s_LocalThreadIndex)
+                        shaderMain(group.groupId, FfxUInt32x2(s_LocalThreadIndex % width, s_LocalThreadIndex / width));
+                }
+            }
+        }
+
+        s_WorkGroupFibers = false;
+    });
+}
@@ -0,0 +1,171 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#define FSR2_BIND_SRV_INPUT_EXPOSURE                         0
+#define FSR2_BIND_SRV_DILATED_REACTIVE_MASKS                 1
+#if FFXM_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS
+
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#define FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA 2
+#else
+#define FSR2_BIND_SRV_DILATED_MOTION_VECTORS                 2
+#endif
+
+#else
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                   2
+#endif
+#define FSR2_BIND_SRV_INTERNAL_UPSCALED                      3
+#define FSR2_BIND_SRV_LOCK_STATUS                            4
+
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#define FSR2_BIND_SRV_INPUT_COLOR                            5
+#else
+#define FSR2_BIND_SRV_PREPARED_INPUT_COLOR                   5
+#endif
+
+#define FSR2_BIND_SRV_LANCZOS_LUT                            6
+#define FSR2_BIND_SRV_UPSCALE_MAXIMUM_BIAS_LUT               7
+#define FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS                   8
+#define FSR2_BIND_SRV_AUTO_EXPOSURE                          9
+
+#if !FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#define FSR2_BIND_SRV_LUMA_HISTORY                           10
+#define FSR2_BIND_SRV_TEMPORAL_REACTIVE                      11
+#endif
+
+#define FSR2_BIND_UAV_NEW_LOCKS                              12
+
+// The half resolution depth clip of the performance preset leaves the input color to prepare, and is upsampled along the dilated depth
+#if FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE && !FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE && FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP
+#define FSR2_BIND_SRV_INPUT_COLOR                            13
+#define FSR2_BIND_SRV_DILATED_DEPTH                          14
+#endif
+
+#define FSR2_BIND_CB_FSR2                                    0
+
+// Global mandatory defines
+#if !defined(FFXM_HALF)
+#define FFXM_HALF 0
+#endif
+#if !defined(FFXM_GPU)
+#define FFXM_GPU 1
+#endif
+#if !defined(FFXM_CPU)
+#define FFXM_CPU 1
+#endif
+
+#include "ffxm_cpu_shader.h"
+#include "ffxm_cpu_workgroup.h"
+
+namespace arm
+{
+
+namespace
+{
+
+#include "fsr2/ffxm_fsr2_callbacks_cpu.h"
+#include "fsr2/ffxm_fsr2_common.h"
+#include "fsr2/ffxm_fsr2_sample.h"
+#include "fsr2/ffxm_fsr2_upsample.h"
+#include "fsr2/ffxm_fsr2_postprocess_lock_status.h"
+#include "fsr2/ffxm_fsr2_reproject.h"
+#include "fsr2/ffxm_fsr2_accumulate.h"
+#include "ffxm_cpu_shader_main.h"
+
+struct AccumulateOutputsFS
+{
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    FfxFloat32x3 fUpscaledColor;
+    FfxFloat32x2 fLockStatus;
+#if FFXM_FSR2_OPTION_APPLY_SHARPENING == 0
+    FfxFloat32x3 fColor;
+#endif
+#elif !FFXM_SHADER_QUALITY_BALANCED_OR_PERFORMANCE
+    FfxFloat32x4 fColorAndWeight;
+    FfxFloat32x2 fLockStatus;
+    FfxFloat32x4 fLumaHistory;
+#if FFXM_FSR2_OPTION_APPLY_SHARPENING == 0
+    FfxFloat32x3 fColor;
+#endif
+#else // FFXM_SHADER_QUALITY_BALANCED_OR_PERFORMANCE
+    FfxFloat32x3 fUpscaledColor;
+    FfxFloat32 fTemporalReactive;
+    FfxFloat32x2 fLockStatus;
+#if FFXM_FSR2_OPTION_APPLY_SHARPENING == 0
+    FfxFloat32x3 fColor;
+#endif
+#endif
+};
+
+AccumulateOutputsFS main(FfxFloat32x4 SvPosition)
+{
+    FfxUInt32x2 uPixelCoord = FfxUInt32x2(SvPosition.xy);
+    AccumulateOutputs result = Accumulate(uPixelCoord);
+    AccumulateOutputsFS output = {};
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    output.fUpscaledColor = result.fColorAndWeight.xyz;
+#elif !FFXM_SHADER_QUALITY_BALANCED_OR_PERFORMANCE
+    output.fColorAndWeight = result.fColorAndWeight;
+    output.fLumaHistory = result.fLumaHistory;
+#else
+    output.fUpscaledColor = result.fUpscaledColor;
+    output.fTemporalReactive = result.fTemporalReactive;
+#endif
+    output.fLockStatus = result.fLockStatus;
+#if FFXM_FSR2_OPTION_APPLY_SHARPENING == 0
+    output.fColor = result.fColor;
+#endif
+    return output;
+}
+
+void StoreOutputs(FfxInt32x2 iPxPos, const AccumulateOutputsFS& output)
+{
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    ffxmCpuStoreTarget(0, iPxPos, output.fUpscaledColor);
+    ffxmCpuStoreTarget(1, iPxPos, output.fLockStatus);
+#if FFXM_FSR2_OPTION_APPLY_SHARPENING == 0
+    ffxmCpuStoreTarget(2, iPxPos, output.fColor);
+#endif
+#elif !FFXM_SHADER_QUALITY_BALANCED_OR_PERFORMANCE
+    ffxmCpuStoreTarget(0, iPxPos, output.fColorAndWeight);
+    ffxmCpuStoreTarget(1, iPxPos, output.fLockStatus);
+    ffxmCpuStoreTarget(2, iPxPos, output.fLumaHistory);
+#if FFXM_FSR2_OPTION_APPLY_SHARPENING == 0
+    ffxmCpuStoreTarget(3, iPxPos, output.fColor);
+#endif
+#else
+    ffxmCpuStoreTarget(0, iPxPos, output.fUpscaledColor);
+    ffxmCpuStoreTarget(1, iPxPos, output.fTemporalReactive);
+    ffxmCpuStoreTarget(2, iPxPos, output.fLockStatus);
+#if FFXM_FSR2_OPTION_APPLY_SHARPENING == 0
+    ffxmCpuStoreTarget(3, iPxPos, output.fColor);
+#endif
+#endif
+}
+
+} // namespace
+
+void FFXM_CPU_SHADER_NAME(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor)
+{
+    ffxmCpuRunFragmentPass(passDescription, parallelFor, main, StoreOutputs);
+}
+
+} // namespace arm
@@ -0,0 +1,108 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                  0
+#define FSR2_BIND_SRV_INPUT_DEPTH                           1
+#define FSR2_BIND_SRV_INPUT_COLOR                           2
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#define FSR2_BIND_UAV_NEW_LOCKS                             3
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      4
+#define FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA 5
+#else
+#define FSR2_BIND_SRV_INPUT_EXPOSURE                        3
+#define FSR2_BIND_UAV_NEW_LOCKS                             4
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      5
+#define FSR2_BIND_UAV_DILATED_DEPTH                         6
+#define FSR2_BIND_UAV_DILATED_MOTION_VECTORS                7
+#endif
+#else
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#define FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA 0
+#else
+#define FSR2_BIND_SRV_LOCK_INPUT_LUMA                       0
+#endif
+#define FSR2_BIND_UAV_NEW_LOCKS                             1
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      2
+#endif
+
+#define FSR2_BIND_CB_FSR2                                   0
+
+// Global mandatory defines
+#if !defined(FFXM_HALF)
+#define FFXM_HALF 0
+#endif
+#if !defined(FFXM_GPU)
+#define FFXM_GPU 1
+#endif
+#if !defined(FFXM_CPU)
+#define FFXM_CPU 1
+#endif
+
+#include "ffxm_cpu_shader.h"
+#include "ffxm_cpu_workgroup.h"
+
+namespace arm
+{
+
+namespace
+{
+
+#ifndef FFXM_FSR2_THREAD_GROUP_WIDTH
+#define FFXM_FSR2_THREAD_GROUP_WIDTH 8
+#endif // #ifndef FFXM_FSR2_THREAD_GROUP_WIDTH
+#ifndef FFXM_FSR2_THREAD_GROUP_HEIGHT
+#define FFXM_FSR2_THREAD_GROUP_HEIGHT 8
+#endif // #ifndef FFXM_FSR2_THREAD_GROUP_HEIGHT
+
+#include "fsr2/ffxm_fsr2_callbacks_cpu.h"
+#include "fsr2/ffxm_fsr2_common.h"
+#include "fsr2/ffxm_fsr2_sample.h"
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+#include "fsr2/ffxm_fsr2_reconstruct_dilated_velocity_and_previous_depth.h"
+#endif
+#include "fsr2/ffxm_fsr2_lock.h"
+#include "ffxm_cpu_shader_main.h"
+
+void main(FfxUInt32x2 uGroupId, FfxUInt32x2 uGroupThreadId)
+{
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+    ReconstructAndLock(uGroupId * FfxUInt32x2(FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT), uGroupThreadId);
+#else
+    FfxUInt32x2 uDispatchThreadId = uGroupId * FfxUInt32x2(FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT) + uGroupThreadId;
+
+    ComputeLock(uDispatchThreadId);
+#endif
+}
+
+} // namespace
+
+void FFXM_CPU_SHADER_NAME(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor)
+{
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+    // the fused pass shares the tile of its work group between the reconstruction and the lock behind a group barrier
+    ffxmCpuRunComputePass<true>(passDescription, parallelFor, FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT, main);
+#else
+    ffxmCpuRunComputePass<false>(passDescription, parallelFor, FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT, main);
+#endif
+}
+
+} // namespace arm
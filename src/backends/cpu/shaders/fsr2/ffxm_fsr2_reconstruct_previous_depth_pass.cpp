@@ -0,0 +1,105 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                  0
+#define FSR2_BIND_SRV_INPUT_DEPTH                           1
+#define FSR2_BIND_SRV_INPUT_COLOR                           2
+
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      3
+#else
+#define FSR2_BIND_SRV_INPUT_EXPOSURE                        3
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      4
+#endif
+
+#define FSR2_BIND_CB_FSR2                                   0
+
+// Global mandatory defines
+#if !defined(FFXM_HALF)
+#define FFXM_HALF 0
+#endif
+#if !defined(FFXM_GPU)
+#define FFXM_GPU 1
+#endif
+#if !defined(FFXM_CPU)
+#define FFXM_CPU 1
+#endif
+
+#include "ffxm_cpu_shader.h"
+#include "ffxm_cpu_workgroup.h"
+
+namespace arm
+{
+
+namespace
+{
+
+#include "fsr2/ffxm_fsr2_callbacks_cpu.h"
+#include "fsr2/ffxm_fsr2_common.h"
+#include "fsr2/ffxm_fsr2_sample.h"
+#include "fsr2/ffxm_fsr2_reconstruct_dilated_velocity_and_previous_depth.h"
+#include "ffxm_cpu_shader_main.h"
+
+struct ReconstructPrevDepthOutputsFS
+{
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    FfxFloat32x4 fDepthMotionVectorLuma;
+#else
+    FfxFloat32   fDepth;
+    FfxFloat32x2 fMotionVector;
+    FfxFloat32   fLuma;
+#endif
+};
+
+ReconstructPrevDepthOutputsFS main(FfxFloat32x4 SvPosition)
+{
+    FfxUInt32x2 uPixelCoord = FfxUInt32x2(SvPosition.xy);
+    ReconstructPrevDepthOutputs result = ReconstructAndDilate(uPixelCoord);
+    ReconstructPrevDepthOutputsFS output = {};
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    output.fDepthMotionVectorLuma = FfxFloat32x4(result.fDepth, result.fMotionVector, result.fLuma);
+#else
+    output.fDepth = result.fDepth;
+    output.fMotionVector = result.fMotionVector;
+    output.fLuma = result.fLuma;
+#endif
+    return output;
+}
+
+void StoreOutputs(FfxInt32x2 iPxPos, const ReconstructPrevDepthOutputsFS& output)
+{
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+    ffxmCpuStoreTarget(0, iPxPos, output.fDepthMotionVectorLuma);
+#else
+    ffxmCpuStoreTarget(0, iPxPos, output.fDepth);
+    ffxmCpuStoreTarget(1, iPxPos, output.fMotionVector);
+    ffxmCpuStoreTarget(2, iPxPos, output.fLuma);
+#endif
+}
+
+} // namespace
+
+void FFXM_CPU_SHADER_NAME(const CpuFsr2PassDescription* passDescription, const CpuParallelForFunc& parallelFor)
+{
+    ffxmCpuRunFragmentPass(passDescription, parallelFor, main, StoreOutputs);
+}
+
+} // namespace arm
@@ -0,0 +1,686 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <host/ffxm_interface.h>
+#include <host/ffxm_util.h>
+#include <host/ffxm_assert.h>
+#include <host/backends/null/ffxm_null.h>
+#include <ffxm_shader_blobs.h>
+#include <codecvt>
+#include <string.h>
+#include <math.h>
+#include <locale>
+
+namespace arm
+{
+
+// prototypes for functions in the interface
+FfxmUInt32              GetSDKVersionNull(FfxmInterface* backendInterface);
+FfxmErrorCode           CreateBackendContextNull(FfxmInterface* backendInterface, FfxmUInt32* effectContextId);
+FfxmErrorCode           GetDeviceCapabilitiesNull(FfxmInterface* backendInterface, FfxmDeviceCapabilities* deviceCapabilities);
+FfxmErrorCode           DestroyBackendContextNull(FfxmInterface* backendInterface, FfxmUInt32 effectContextId);
+FfxmErrorCode           CreateResourceNull(FfxmInterface* backendInterface, const FfxmCreateResourceDescription* desc, FfxmUInt32 effectContextId, FfxmResourceInternal* outTexture);
+FfxmErrorCode           CreateAliasedResourcesNull(FfxmInterface* backendInterface, const FfxmCreateResourceDescription* descs, const FfxmUInt32* aliasSlots, FfxmUInt32 resourceCount, FfxmUInt32 effectContextId, FfxmResourceInternal* outTextures, size_t* outSavedMemorySize);
+FfxmErrorCode           DestroyResourceNull(FfxmInterface* backendInterface, FfxmResourceInternal resource);
+FfxmErrorCode           RegisterResourceNull(FfxmInterface* backendInterface, const FfxmResource* inResource, FfxmUInt32 effectContextId, FfxmResourceInternal* outResourceInternal);
+FfxmResource            GetResourceNull(FfxmInterface* backendInterface, FfxmResourceInternal resource);
+FfxmErrorCode           UnregisterResourcesNull(FfxmInterface* backendInterface, FfxmCommandList commandList, FfxmUInt32 effectContextId);
+FfxmResourceDescription GetResourceDescriptionNull(FfxmInterface* backendInterface, FfxmResourceInternal resource);
+FfxmErrorCode           CreateComputePipelineNull(FfxmInterface* backendInterface, FfxmEffect effect, FfxmPass passId, FfxmShaderQuality qualityPreset, FfxmUInt32 permutationOptions, const FfxmPipelineDescription* desc, FfxmUInt32 effectContextId, FfxmPipelineState* outPass);
+FfxmErrorCode           CreateGraphicsPipelineNull(FfxmInterface* backendInterface, FfxmEffect effect, FfxmPass passId, FfxmShaderQuality qualityPreset, FfxmUInt32 permutationOptions, const FfxmPipelineDescription* desc, FfxmUInt32 effectContextId, FfxmPipelineState* outPass);
+FfxmErrorCode           DestroyPipelineNull(FfxmInterface* backendInterface, FfxmPipelineState* pipeline, FfxmUInt32 effectContextId);
+FfxmErrorCode           ScheduleGpuJobNull(FfxmInterface* backendInterface, const FfxmGpuJobDescription* job);
+FfxmErrorCode           ExecuteGpuJobsNull(FfxmInterface* backendInterface, FfxmCommandList commandList);
+
+static FfxmUInt32 s_BackendRefCount = 0;
+static FfxmUInt32 s_MaxEffectContexts = 0;
+
+typedef struct BackendContext_Null {
+
+    // store for resources, only their description is kept
+    typedef struct Resource
+    {
+        const void*             handle;                 // application handle of registered resources
+        FfxmResourceDescription  resourceDescription;
+        FfxmResourceStates       initialState;
+        bool                    dynamic;
+    } Resource;
+
+    typedef struct PipelineLayout {
+
+        FfxmEffect              effect;
+        FfxmPass                pass;
+        FfxmUInt32              permutationOptions;
+        FfxmUInt32              effectContextId;
+    } PipelineLayout;
+
+    FfxmUInt32              gpuJobCount;
+
+    PipelineLayout*         pPipelineLayouts;
+
+    typedef struct alignas(32) EffectContext {
+
+        // Resource allocation
+        FfxmUInt32              nextStaticResource;
+        FfxmUInt32              nextDynamicResource;
+
+        // Pipeline layout
+        FfxmUInt32              nextPipelineLayout;
+
+        // Usage
+        bool                    active;
+    } EffectContext;
+
+    Resource*               pResources;
+    EffectContext*          pEffectContexts;
+
+} BackendContext_Null;
+
+FFXM_API size_t ffxmGetScratchMemorySizeNull(size_t maxContexts)
+{
+    FfxmUInt32 pipelineArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_PASS_COUNT * sizeof(BackendContext_Null::PipelineLayout), sizeof(FfxmUInt32));
+    FfxmUInt32 resourceArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_RESOURCE_COUNT * sizeof(BackendContext_Null::Resource), sizeof(FfxmUInt32));
+    FfxmUInt32 contextArraySize = FFXM_ALIGN_UP(maxContexts * sizeof(BackendContext_Null::EffectContext), sizeof(FfxmUInt32));
+
+    return FFXM_ALIGN_UP(sizeof(BackendContext_Null) + pipelineArraySize + resourceArraySize + contextArraySize, sizeof(uint64_t));
+}
+
+// Create a FfxmDevice from a NullDeviceContext
+FfxmDevice ffxmGetDeviceNull(NullDeviceContext* nullDeviceContext)
+{
+    return reinterpret_cast<FfxmDevice>(nullDeviceContext);
+}
+
+FfxmErrorCode ffxmGetInterfaceNull(
+    FfxmInterface* backendInterface,
+    FfxmDevice device,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    size_t maxContexts)
+{
+    FFXM_RETURN_ON_ERROR(
+        !s_BackendRefCount,
+        FFXM_ERROR_BACKEND_API_ERROR);
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        device,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        scratchBuffer,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        scratchBufferSize >= ffxmGetScratchMemorySizeNull(maxContexts),
+        FFXM_ERROR_INSUFFICIENT_MEMORY);
+
+    backendInterface->fpGetSDKVersion = GetSDKVersionNull;
+    backendInterface->fpCreateBackendContext = CreateBackendContextNull;
+    backendInterface->fpGetDeviceCapabilities = GetDeviceCapabilitiesNull;
+    backendInterface->fpDestroyBackendContext = DestroyBackendContextNull;
+    backendInterface->fpCreateResource = CreateResourceNull;
+    backendInterface->fpCreateAliasedResources = CreateAliasedResourcesNull;
+    backendInterface->fpDestroyResource = DestroyResourceNull;
+    backendInterface->fpRegisterResource = RegisterResourceNull;
+    backendInterface->fpGetResource = GetResourceNull;
+    backendInterface->fpUnregisterResources = UnregisterResourcesNull;
+    backendInterface->fpGetResourceDescription = GetResourceDescriptionNull;
+    backendInterface->fpCreateComputePipeline = CreateComputePipelineNull;
+    backendInterface->fpCreateGraphicsPipeline = CreateGraphicsPipelineNull;
+    backendInterface->fpPrewarmGraphicsPipeline = nullptr;
+    backendInterface->fpDestroyPipeline = DestroyPipelineNull;
+    backendInterface->fpScheduleGpuJob = ScheduleGpuJobNull;
+    backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsNull;
+    backendInterface->fpExecuteGpuJobsAsync = nullptr;
+    backendInterface->fpEnableGpuTimings = nullptr;
+    backendInterface->fpGetGpuTimings = nullptr;
+    backendInterface->fpReadResource = nullptr;
+
+    // Memory assignments
+    backendInterface->scratchBuffer = scratchBuffer;
+    backendInterface->scratchBufferSize = scratchBufferSize;
+
+    // Map the device
+    backendInterface->device = device;
+
+    // Assign the max number of contexts we'll be using
+    s_MaxEffectContexts = static_cast<FfxmUInt32>(maxContexts);
+
+    return FFXM_OK;
+}
+
+FfxmCommandList ffxmGetCommandListNull(void* cmdList)
+{
+    return reinterpret_cast<FfxmCommandList>(cmdList);
+}
+
+FfxmResource ffxmGetResourceNull(void* handle,
+    FfxmResourceDescription          ffxmResDescription,
+    [[maybe_unused]] wchar_t* ffxmResName,
+    FfxmResourceStates               state /*=FFXM_RESOURCE_STATE_COMPUTE_READ*/)
+{
+    FfxmResource resource = {};
+    resource.resource = handle;
+    resource.state = state;
+    resource.description = ffxmResDescription;
+
+#ifdef _DEBUG
+    if (ffxmResName) {
+        wcscpy(resource.name, ffxmResName);
+    }
+#endif
+
+    return resource;
+}
+
+void ffxmResetTraceNull(NullDeviceContext* nullDeviceContext)
+{
+    FFXM_ASSERT(NULL != nullDeviceContext);
+
+    nullDeviceContext->traceCount = 0;
+    memset(nullDeviceContext->callCounts, 0, sizeof(nullDeviceContext->callCounts));
+}
+
+// append a call to the trace of the device
+static void recordCall(FfxmInterface* backendInterface, FfxmNullTraceCall call, FfxmUInt32 effectContextId,
+    FfxmUInt32 argument0 = 0, FfxmUInt32 argument1 = 0, FfxmUInt32 argument2 = 0)
+{
+    NullDeviceContext* nullDeviceContext = reinterpret_cast<NullDeviceContext*>(backendInterface->device);
+
+    if (nullDeviceContext->traceEntries && nullDeviceContext->traceCapacity)
+    {
+        FfxmNullTraceEntry& entry = nullDeviceContext->traceEntries[nullDeviceContext->traceCount % nullDeviceContext->traceCapacity];
+        entry.call = uint16_t(call);
+        entry.effectContextId = uint16_t(effectContextId);
+        entry.arguments[0] = argument0;
+        entry.arguments[1] = argument1;
+        entry.arguments[2] = argument2;
+    }
+
+    ++nullDeviceContext->traceCount;
+    ++nullDeviceContext->callCounts[call];
+}
+
+static FfxmUInt32 getDynamicResourcesStartIndex(FfxmUInt32 effectContextId)
+{
+    // dynamic resources are tracked from the max index
+    return (effectContextId * FFXM_MAX_RESOURCE_COUNT) + FFXM_MAX_RESOURCE_COUNT - 1;
+}
+
+static FfxmUInt32 getStaticResourcesStartIndex(FfxmUInt32 effectContextId)
+{
+    // index 0 is reserved for the NULL resource
+    return (effectContextId * FFXM_MAX_RESOURCE_COUNT) + 1;
+}
+
+FfxmUInt32 GetSDKVersionNull([[maybe_unused]] FfxmInterface* backendInterface)
+{
+    return FFXM_SDK_MAKE_VERSION(FFXM_SDK_VERSION_MAJOR, FFXM_SDK_VERSION_MINOR, FFXM_SDK_VERSION_PATCH);
+}
+
+FfxmErrorCode CreateBackendContextNull(FfxmInterface* backendInterface, FfxmUInt32* effectContextId)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != backendInterface->device);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    // Set things up if this is the first invocation
+    if (!s_BackendRefCount) {
+
+        // clear out mem prior to initializing
+        memset(backendContext, 0, sizeof(BackendContext_Null));
+
+        // Map all of our pointers
+        FfxmUInt32 pipelineArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_PASS_COUNT * sizeof(BackendContext_Null::PipelineLayout), sizeof(FfxmUInt32));
+        FfxmUInt32 resourceArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * sizeof(BackendContext_Null::Resource), sizeof(FfxmUInt32));
+        FfxmUInt32 contextArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * sizeof(BackendContext_Null::EffectContext), sizeof(FfxmUInt32));
+        uint8_t* pMem = (uint8_t*)((BackendContext_Null*)(backendContext + 1));
+
+        // Map the pipeline layouts
+        backendContext->pPipelineLayouts = (BackendContext_Null::PipelineLayout*)(pMem);
+        memset(backendContext->pPipelineLayouts, 0, pipelineArraySize);
+        pMem += pipelineArraySize;
+
+        // Map the resources
+        backendContext->pResources = (BackendContext_Null::Resource*)(pMem);
+        memset(backendContext->pResources, 0, resourceArraySize);
+        pMem += resourceArraySize;
+
+        // Map the effect contexts
+        backendContext->pEffectContexts = reinterpret_cast<BackendContext_Null::EffectContext*>(pMem);
+        memset(backendContext->pEffectContexts, 0, contextArraySize);
+    }
+
+    // Increment the ref count
+    ++s_BackendRefCount;
+
+    // Get an available context id
+    for (FfxmUInt32 i = 0; i < s_MaxEffectContexts; ++i)
+    {
+        if (!backendContext->pEffectContexts[i].active)
+        {
+            *effectContextId = i;
+
+            // Reset everything accordingly
+            BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[i];
+            effectContext.active = true;
+            effectContext.nextStaticResource = getStaticResourcesStartIndex(i);
+            effectContext.nextDynamicResource = getDynamicResourcesStartIndex(i);
+            effectContext.nextPipelineLayout = (i * FFXM_MAX_PASS_COUNT);
+            break;
+        }
+    }
+
+    recordCall(backendInterface, FFXM_NULL_TRACE_CREATE_BACKEND_CONTEXT, *effectContextId);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode GetDeviceCapabilitiesNull([[maybe_unused]] FfxmInterface* backendInterface, FfxmDeviceCapabilities* deviceCapabilities)
+{
+    // Report the same baseline as the other backends so that the same permutations get selected
+    deviceCapabilities->minimumSupportedShaderModel = FFXM_SHADER_MODEL_5_1;
+    deviceCapabilities->waveLaneCountMin = 32;
+    deviceCapabilities->waveLaneCountMax = 32;
+    deviceCapabilities->fp16Supported = false;
+    deviceCapabilities->raytracingSupported = false;
+    deviceCapabilities->sourcePermutationsSupported = ffxmHasSourcePermutations(FFXM_EFFECT_FSR2);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode DestroyBackendContextNull(FfxmInterface* backendInterface, FfxmUInt32 effectContextId)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    // Free up for use by another context
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    effectContext.nextStaticResource = 0;
+    effectContext.active = false;
+
+    // Decrement ref count
+    --s_BackendRefCount;
+
+    recordCall(backendInterface, FFXM_NULL_TRACE_DESTROY_BACKEND_CONTEXT, effectContextId);
+
+    return FFXM_OK;
+}
+
+// assign a static resource slot and keep the description of the resource
+static FfxmErrorCode createResource(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescription,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResource)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != createResourceDescription);
+    FFXM_ASSERT(NULL != outResource);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    FfxmResourceDescription resourceDesc = createResourceDescription->resourceDescription;
+    if (resourceDesc.type == FFXM_RESOURCE_TYPE_TEXTURE1D) {
+        resourceDesc.height = 1;
+    }
+
+    if (resourceDesc.mipCount == 0) {
+        resourceDesc.mipCount = (FfxmUInt32)(1 + floor(log2(FFXM_MAXIMUM(resourceDesc.width, resourceDesc.height))));
+    }
+
+    FFXM_ASSERT(effectContext.nextStaticResource + 1 < effectContext.nextDynamicResource);
+    outResource->internalIndex = effectContext.nextStaticResource++;
+    BackendContext_Null::Resource* backendResource = &backendContext->pResources[outResource->internalIndex];
+    backendResource->handle = nullptr;
+    backendResource->resourceDescription = resourceDesc;
+    backendResource->initialState = createResourceDescription->initalState;
+    backendResource->dynamic = false;
+
+    return FFXM_OK;
+}
+
+// create a internal resource that will stay alive until effect gets shut down
+FfxmErrorCode CreateResourceNull(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescription,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResource)
+{
+    FfxmErrorCode errorCode = createResource(backendInterface, createResourceDescription, effectContextId, outResource);
+    FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+
+    const FfxmResourceDescription& resourceDesc = createResourceDescription->resourceDescription;
+    recordCall(backendInterface, FFXM_NULL_TRACE_CREATE_RESOURCE, effectContextId, outResource->internalIndex, resourceDesc.width, resourceDesc.height);
+
+    return FFXM_OK;
+}
+
+// create transient resources, the null backend has no memory to share so only the slots are assigned
+FfxmErrorCode CreateAliasedResourcesNull(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescriptions,
+    const FfxmUInt32* aliasSlots,
+    FfxmUInt32 resourceCount,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResources,
+    size_t* outSavedMemorySize)
+{
+    FFXM_ASSERT(NULL != createResourceDescriptions);
+    FFXM_ASSERT(NULL != aliasSlots);
+    FFXM_ASSERT(NULL != outResources);
+
+    for (FfxmUInt32 resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex)
+    {
+        FFXM_RETURN_ON_ERROR(
+            aliasSlots[resourceIndex] < FFXM_MAX_ALIAS_HEAPS,
+            FFXM_ERROR_INVALID_ARGUMENT);
+
+        FfxmErrorCode errorCode = createResource(backendInterface, &createResourceDescriptions[resourceIndex], effectContextId, &outResources[resourceIndex]);
+        FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+    }
+
+    if (outSavedMemorySize)
+        *outSavedMemorySize = 0;
+
+    recordCall(backendInterface, FFXM_NULL_TRACE_CREATE_ALIASED_RESOURCES, effectContextId, resourceCount, resourceCount ? outResources[0].internalIndex : 0);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode DestroyResourceNull(FfxmInterface* backendInterface, FfxmResourceInternal resource)
+{
+    FFXM_ASSERT(backendInterface != nullptr);
+
+    if (resource.internalIndex > 0)
+        recordCall(backendInterface, FFXM_NULL_TRACE_DESTROY_RESOURCE, resource.internalIndex / FFXM_MAX_RESOURCE_COUNT, resource.internalIndex);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode RegisterResourceNull(
+    FfxmInterface* backendInterface,
+    const FfxmResource* inFfxmResource,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outFfxmResourceInternal
+)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)(backendInterface->scratchBuffer);
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    if (inFfxmResource->resource == nullptr) {
+
+        outFfxmResourceInternal->internalIndex = 0; // Always maps to FFXM_<feature>_RESOURCE_IDENTIFIER_NULL;
+        return FFXM_OK;
+    }
+
+    FFXM_ASSERT(effectContext.nextDynamicResource > effectContext.nextStaticResource);
+    outFfxmResourceInternal->internalIndex = effectContext.nextDynamicResource--;
+
+    BackendContext_Null::Resource* backendResource = &backendContext->pResources[outFfxmResourceInternal->internalIndex];
+    backendResource->handle = inFfxmResource->resource;
+    backendResource->resourceDescription = inFfxmResource->description;
+    backendResource->initialState = inFfxmResource->state;
+    backendResource->dynamic = true;
+
+    recordCall(backendInterface, FFXM_NULL_TRACE_REGISTER_RESOURCE, effectContextId, outFfxmResourceInternal->internalIndex,
+        inFfxmResource->description.width, inFfxmResource->description.height);
+
+    return FFXM_OK;
+}
+
+FfxmResource GetResourceNull(FfxmInterface* backendInterface, FfxmResourceInternal inResource)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    BackendContext_Null::Resource& backendResource = backendContext->pResources[inResource.internalIndex];
+
+    FfxmResource resource = {};
+    resource.resource = const_cast<void*>(backendResource.handle);
+    resource.state = backendResource.initialState;
+    resource.description = backendResource.resourceDescription;
+
+    return resource;
+}
+
+FfxmErrorCode UnregisterResourcesNull(FfxmInterface* backendInterface, [[maybe_unused]] FfxmCommandList commandList, FfxmUInt32 effectContextId)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)(backendInterface->scratchBuffer);
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    // Walk back all the resources that don't belong to us
+    const FfxmUInt32 dynamicResourceIndexStart = getDynamicResourcesStartIndex(effectContextId);
+    const FfxmUInt32 unregisteredCount = dynamicResourceIndexStart - effectContext.nextDynamicResource;
+    for (FfxmUInt32 resourceIndex = effectContext.nextDynamicResource + 1; resourceIndex <= dynamicResourceIndexStart; ++resourceIndex)
+    {
+        backendContext->pResources[resourceIndex].handle = nullptr;
+    }
+
+    effectContext.nextDynamicResource = dynamicResourceIndexStart;
+
+    recordCall(backendInterface, FFXM_NULL_TRACE_UNREGISTER_RESOURCES, effectContextId, unregisteredCount);
+
+    return FFXM_OK;
+}
+
+FfxmResourceDescription GetResourceDescriptionNull(FfxmInterface* backendInterface, FfxmResourceInternal resource)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    return backendContext->pResources[resource.internalIndex].resourceDescription;
+}
+
+// fill the pipeline reflection from the shader blob, the effect needs it to patch its resource bindings
+static FfxmErrorCode createPipeline(FfxmInterface* backendInterface,
+    FfxmEffect effect,
+    FfxmPass pass,
+    FfxmUInt32 permutationOptions,
+    FfxmUInt32 effectContextId,
+    bool graphics,
+    FfxmPipelineState* outPipeline)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != outPipeline);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    FfxmShaderBlob shaderBlob = { };
+    FFXM_VALIDATE(ffxmGetPermutationBlobByIndex(effect, pass, permutationOptions, &shaderBlob));
+    FFXM_ASSERT(shaderBlob.data && shaderBlob.size);
+
+    //////////////////////////////////////////////////////////////////////////
+    // One pipeline layout per pipeline
+    FFXM_ASSERT_MESSAGE(effectContext.nextPipelineLayout < (effectContextId * FFXM_MAX_PASS_COUNT) + FFXM_MAX_PASS_COUNT, "ffxmInterface: Null: Ran out of pipeline layouts. Please increase FFXM_MAX_PASS_COUNT");
+    BackendContext_Null::PipelineLayout* pPipelineLayout = &backendContext->pPipelineLayouts[effectContext.nextPipelineLayout++];
+    pPipelineLayout->effect = effect;
+    pPipelineLayout->pass = pass;
+    pPipelineLayout->permutationOptions = permutationOptions;
+    pPipelineLayout->effectContextId = effectContextId;
+
+    outPipeline->rootSignature = reinterpret_cast<FfxmRootSignature>(pPipelineLayout);
+    outPipeline->pipeline = reinterpret_cast<FfxmPipeline>(pPipelineLayout);
+    outPipeline->cmdSignature = nullptr;
+
+    // populate the pipeline information for this pass
+    outPipeline->srvTextureCount = shaderBlob.srvTextureCount;
+    outPipeline->srvBufferCount  = shaderBlob.srvBufferCount;
+    outPipeline->uavTextureCount = shaderBlob.uavTextureCount;
+    outPipeline->uavBufferCount = shaderBlob.uavBufferCount;
+    outPipeline->constCount = shaderBlob.cbvCount;
+    outPipeline->rtCount = shaderBlob.rtTextureCount;
+    outPipeline->descriptorSetCount = 0;
+
+    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+    for (FfxmUInt32 srvIndex = 0; srvIndex < outPipeline->srvTextureCount; ++srvIndex)
+    {
+        outPipeline->srvTextureBindings[srvIndex].slotIndex = shaderBlob.boundSRVTextures[srvIndex];
+        outPipeline->srvTextureBindings[srvIndex].bindCount = shaderBlob.boundSRVTextureCounts[srvIndex];
+        outPipeline->srvTextureBindings[srvIndex].bindSet = shaderBlob.boundSRVTextureSets[srvIndex];
+        wcscpy(outPipeline->srvTextureBindings[srvIndex].name, converter.from_bytes(shaderBlob.boundSRVTextureNames[srvIndex]).c_str());
+    }
+    for (FfxmUInt32 srvIndex = 0; srvIndex < outPipeline->srvBufferCount; ++srvIndex)
+    {
+        outPipeline->srvBufferBindings[srvIndex].slotIndex = shaderBlob.boundSRVBuffers[srvIndex];
+        outPipeline->srvBufferBindings[srvIndex].bindCount = shaderBlob.boundSRVBufferCounts[srvIndex];
+        outPipeline->srvBufferBindings[srvIndex].bindSet = shaderBlob.boundSRVBufferSets[srvIndex];
+        wcscpy(outPipeline->srvBufferBindings[srvIndex].name, converter.from_bytes(shaderBlob.boundSRVBufferNames[srvIndex]).c_str());
+    }
+    for (FfxmUInt32 uavIndex = 0; uavIndex < outPipeline->uavTextureCount; ++uavIndex)
+    {
+        outPipeline->uavTextureBindings[uavIndex].slotIndex = shaderBlob.boundUAVTextures[uavIndex];
+        outPipeline->uavTextureBindings[uavIndex].bindCount = shaderBlob.boundUAVTextureCounts[uavIndex];
+        outPipeline->uavTextureBindings[uavIndex].bindSet = shaderBlob.boundUAVTextureSets[uavIndex];
+        wcscpy(outPipeline->uavTextureBindings[uavIndex].name, converter.from_bytes(shaderBlob.boundUAVTextureNames[uavIndex]).c_str());
+    }
+    for (FfxmUInt32 uavIndex = 0; uavIndex < outPipeline->uavBufferCount; ++uavIndex)
+    {
+        outPipeline->uavBufferBindings[uavIndex].slotIndex = shaderBlob.boundUAVBuffers[uavIndex];
+        outPipeline->uavBufferBindings[uavIndex].bindCount = shaderBlob.boundUAVBufferCounts[uavIndex];
+        outPipeline->uavBufferBindings[uavIndex].bindSet = shaderBlob.boundUAVBufferSets[uavIndex];
+        wcscpy(outPipeline->uavBufferBindings[uavIndex].name, converter.from_bytes(shaderBlob.boundUAVBufferNames[uavIndex]).c_str());
+    }
+    for (FfxmUInt32 rtIndex = 0; rtIndex < outPipeline->rtCount; ++rtIndex)
+    {
+        outPipeline->rtBindings[rtIndex].slotIndex = shaderBlob.boundRTTextures[rtIndex];
+        wcscpy(outPipeline->rtBindings[rtIndex].name, converter.from_bytes(shaderBlob.boundRTTextureNames[rtIndex]).c_str());
+    }
+    for (FfxmUInt32 cbIndex = 0; cbIndex < outPipeline->constCount; ++cbIndex)
+    {
+        outPipeline->constantBufferBindings[cbIndex].slotIndex = shaderBlob.boundConstantBuffers[cbIndex];
+        outPipeline->constantBufferBindings[cbIndex].bindCount = shaderBlob.boundConstantBufferCounts[cbIndex];
+        outPipeline->constantBufferBindings[cbIndex].bindSet = shaderBlob.boundConstantBufferSets[cbIndex];
+        wcscpy(outPipeline->constantBufferBindings[cbIndex].name, converter.from_bytes(shaderBlob.boundConstantBufferNames[cbIndex]).c_str());
+    }
+
+    recordCall(backendInterface, FFXM_NULL_TRACE_CREATE_PIPELINE, effectContextId, pass, permutationOptions, graphics ? 1 : 0);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode CreateComputePipelineNull(FfxmInterface* backendInterface,
+    FfxmEffect effect,
+    FfxmPass pass,
+    [[maybe_unused]] FfxmShaderQuality qualityPreset,
+    FfxmUInt32 permutationOptions,
+    [[maybe_unused]] const FfxmPipelineDescription* pipelineDescription,
+    FfxmUInt32 effectContextId,
+    FfxmPipelineState* outPipeline)
+{
+    return createPipeline(backendInterface, effect, pass, permutationOptions, effectContextId, false, outPipeline);
+}
+
+FfxmErrorCode CreateGraphicsPipelineNull(FfxmInterface* backendInterface,
+    FfxmEffect effect,
+    FfxmPass pass,
+    [[maybe_unused]] FfxmShaderQuality qualityPreset,
+    FfxmUInt32 permutationOptions,
+    [[maybe_unused]] const FfxmPipelineDescription* pipelineDescription,
+    FfxmUInt32 effectContextId,
+    FfxmPipelineState* outPipeline)
+{
+    return createPipeline(backendInterface, effect, pass, permutationOptions, effectContextId, true, outPipeline);
+}
+
+FfxmErrorCode DestroyPipelineNull(FfxmInterface* backendInterface, FfxmPipelineState* pipeline, FfxmUInt32 effectContextId)
+{
+    FFXM_ASSERT(backendInterface != nullptr);
+    if (!pipeline)
+        return FFXM_OK;
+
+    // Pipeline layouts are recycled with the effect context, just drop the references
+    BackendContext_Null::PipelineLayout* pPipelineLayout = reinterpret_cast<BackendContext_Null::PipelineLayout*>(pipeline->pipeline);
+    if (pPipelineLayout) {
+        recordCall(backendInterface, FFXM_NULL_TRACE_DESTROY_PIPELINE, effectContextId, pPipelineLayout->pass);
+        memset(pPipelineLayout, 0, sizeof(BackendContext_Null::PipelineLayout));
+    }
+
+    pipeline->pipeline = nullptr;
+    pipeline->rootSignature = nullptr;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ScheduleGpuJobNull(FfxmInterface* backendInterface, const FfxmGpuJobDescription* job)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != job);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    FFXM_ASSERT(backendContext->gpuJobCount < FFXM_MAX_GPU_JOBS);
+
+    switch (job->jobType)
+    {
+    case FFXM_GPU_JOB_CLEAR_FLOAT:
+    {
+        const FfxmResourceInternal& target = job->clearJobDescriptor.target;
+        recordCall(backendInterface, FFXM_NULL_TRACE_SCHEDULE_CLEAR_JOB, target.internalIndex / FFXM_MAX_RESOURCE_COUNT, target.internalIndex);
+        break;
+    }
+    case FFXM_GPU_JOB_COPY:
+    {
+        const FfxmResourceInternal& dst = job->copyJobDescriptor.dst;
+        recordCall(backendInterface, FFXM_NULL_TRACE_SCHEDULE_COPY_JOB, dst.internalIndex / FFXM_MAX_RESOURCE_COUNT, job->copyJobDescriptor.src.internalIndex, dst.internalIndex);
+        break;
+    }
+    case FFXM_GPU_JOB_COMPUTE:
+    {
+        const FfxmComputeJobDescription& computeJob = job->computeJobDescriptor;
+        const BackendContext_Null::PipelineLayout* pPipelineLayout = reinterpret_cast<const BackendContext_Null::PipelineLayout*>(computeJob.pipeline->pipeline);
+        recordCall(backendInterface, FFXM_NULL_TRACE_SCHEDULE_COMPUTE_JOB, pPipelineLayout->effectContextId, pPipelineLayout->pass, computeJob.dimensions[0], computeJob.dimensions[1]);
+        break;
+    }
+    case FFXM_GPU_JOB_FRAGMENT:
+    {
+        const FfxmFragmentJobDescription& fragmentJob = job->fragmentJobDescription;
+        const BackendContext_Null::PipelineLayout* pPipelineLayout = reinterpret_cast<const BackendContext_Null::PipelineLayout*>(fragmentJob.pipeline->pipeline);
+        recordCall(backendInterface, FFXM_NULL_TRACE_SCHEDULE_FRAGMENT_JOB, pPipelineLayout->effectContextId, pPipelineLayout->pass, fragmentJob.viewport[0], fragmentJob.viewport[1]);
+        break;
+    }
+    default:
+        FFXM_ASSERT_MESSAGE(false, "ffxmInterface: Null: Unknown job type");
+        return FFXM_ERROR_INVALID_ARGUMENT;
+    }
+
+    backendContext->gpuJobCount++;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ExecuteGpuJobsNull(FfxmInterface* backendInterface, [[maybe_unused]] FfxmCommandList commandList)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    // nothing to execute, jobs were recorded when they got scheduled
+    recordCall(backendInterface, FFXM_NULL_TRACE_EXECUTE_GPU_JOBS, 0, backendContext->gpuJobCount);
+    backendContext->gpuJobCount = 0;
+
+    return FFXM_OK;
+}
+
+} // namespace arm
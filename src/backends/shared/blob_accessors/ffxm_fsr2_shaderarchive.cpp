@@ -0,0 +1,316 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <host/ffxm_util.h>
+#include <host/ffxm_shader_archive.h>
+#include "ffxm_fsr2_shaderblobs.h"
+#include "ffxm_shader_archive_codec.h"
+#include "fsr2/ffxm_fsr2_private.h"
+
+#include <mutex>
+#include <vector>
+#include <string.h> // for memset
+
+namespace arm
+{
+
+// A permutation decompressed from the archive. Its names point in the archive, and the encoded stream is
+// only kept for the permutations the others of their pass are compressed against.
+struct CachedShaderBlob
+{
+    bool                    decoded = false;
+    std::vector<uint8_t>    encoded;
+    std::vector<uint32_t>   code;
+    std::vector<const char*> names;
+};
+
+static std::mutex                       s_archiveMutex;
+static const uint8_t*                   s_archiveData = nullptr;
+static const FfxmShaderArchiveHeader*   s_archiveHeader = nullptr;
+static std::vector<CachedShaderBlob>    s_archiveCache;
+
+static const FfxmShaderArchiveBlob* getArchiveBlob(uint32_t blobIndex)
+{
+    return reinterpret_cast<const FfxmShaderArchiveBlob*>(s_archiveData + s_archiveHeader->blobOffset) + blobIndex;
+}
+
+static bool isSectionInRange(uint32_t offset, uint64_t size, uint32_t archiveSize)
+{
+    return (offset % sizeof(uint32_t)) == 0 && offset <= archiveSize && size <= archiveSize - offset;
+}
+
+static FfxmErrorCode validateShaderArchive(const uint8_t* data, size_t dataSize)
+{
+    FFXM_RETURN_ON_ERROR(dataSize >= sizeof(FfxmShaderArchiveHeader), FFXM_ERROR_MALFORMED_DATA);
+
+    const FfxmShaderArchiveHeader* header = reinterpret_cast<const FfxmShaderArchiveHeader*>(data);
+    FFXM_RETURN_ON_ERROR(header->magic == FFXM_SHADER_ARCHIVE_MAGIC, FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(header->version == FFXM_SHADER_ARCHIVE_VERSION, FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(header->size <= dataSize, FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(header->lookupCount == FFXM_FSR2_PASS_COUNT + 1, FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(header->blobCount < FFXM_SHADER_ARCHIVE_NO_BLOB, FFXM_ERROR_MALFORMED_DATA);
+
+    const uint32_t size = header->size;
+    FFXM_RETURN_ON_ERROR(isSectionInRange(header->lookupOffset, uint64_t(header->lookupCount) * FFXM_SHADER_ARCHIVE_KEY_COUNT * sizeof(uint16_t), size),
+                         FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(isSectionInRange(header->blobOffset, uint64_t(header->blobCount) * sizeof(FfxmShaderArchiveBlob), size), FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(isSectionInRange(header->reflectionOffset, 0, size), FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(isSectionInRange(header->stringOffset, 0, size), FFXM_ERROR_MALFORMED_DATA);
+    FFXM_RETURN_ON_ERROR(isSectionInRange(header->dataOffset, 0, size), FFXM_ERROR_MALFORMED_DATA);
+
+    const uint16_t* lookup = reinterpret_cast<const uint16_t*>(data + header->lookupOffset);
+    for (uint32_t entry = 0; entry < header->lookupCount * FFXM_SHADER_ARCHIVE_KEY_COUNT; ++entry)
+    {
+        FFXM_RETURN_ON_ERROR(lookup[entry] < header->blobCount || lookup[entry] == FFXM_SHADER_ARCHIVE_NO_BLOB, FFXM_ERROR_MALFORMED_DATA);
+    }
+
+    const FfxmShaderArchiveBlob* blobs = reinterpret_cast<const FfxmShaderArchiveBlob*>(data + header->blobOffset);
+    for (uint32_t blobIndex = 0; blobIndex < header->blobCount; ++blobIndex)
+    {
+        const FfxmShaderArchiveBlob& blob = blobs[blobIndex];
+        FFXM_RETURN_ON_ERROR(blob.codeSize > 0 && (blob.codeSize % sizeof(uint32_t)) == 0, FFXM_ERROR_MALFORMED_DATA);
+        FFXM_RETURN_ON_ERROR(blob.dataOffset <= size - header->dataOffset && blob.dataSize <= size - header->dataOffset - blob.dataOffset,
+                             FFXM_ERROR_MALFORMED_DATA);
+        FFXM_RETURN_ON_ERROR(isSectionInRange(blob.reflectionOffset, 0, size - header->reflectionOffset), FFXM_ERROR_MALFORMED_DATA);
+
+        // dictionaries are never compressed against another dictionary
+        if (blob.baseBlob != FFXM_SHADER_ARCHIVE_NO_BASE)
+        {
+            FFXM_RETURN_ON_ERROR(blob.baseBlob < header->blobCount && blobs[blob.baseBlob].baseBlob == FFXM_SHADER_ARCHIVE_NO_BASE,
+                                 FFXM_ERROR_MALFORMED_DATA);
+            FFXM_RETURN_ON_ERROR(uint64_t(blobs[blob.baseBlob].encodedSize) + blob.encodedSize <= UINT32_MAX, FFXM_ERROR_MALFORMED_DATA);
+        }
+    }
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmSetShaderArchive(const void* pData, size_t dataSize)
+{
+    FFXM_RETURN_ON_ERROR((reinterpret_cast<uintptr_t>(pData) % sizeof(uint32_t)) == 0, FFXM_ERROR_INVALID_ALIGNMENT);
+
+    const uint8_t* data = static_cast<const uint8_t*>(pData);
+    if (data)
+    {
+        FFXM_VALIDATE(validateShaderArchive(data, dataSize));
+    }
+
+    std::lock_guard<std::mutex> lock(s_archiveMutex);
+
+    s_archiveCache.clear();
+    s_archiveData = data;
+    s_archiveHeader = reinterpret_cast<const FfxmShaderArchiveHeader*>(data);
+    if (data)
+    {
+        s_archiveCache.resize(s_archiveHeader->blobCount);
+    }
+
+    return FFXM_OK;
+}
+
+static FfxmErrorCode decompressEncodedStream(uint32_t blobIndex, std::vector<uint8_t>& stream, uint32_t& prefixSize)
+{
+    const FfxmShaderArchiveBlob* blob = getArchiveBlob(blobIndex);
+
+    prefixSize = 0;
+    if (blob->baseBlob != FFXM_SHADER_ARCHIVE_NO_BASE)
+    {
+        CachedShaderBlob& base = s_archiveCache[blob->baseBlob];
+        if (base.encoded.empty())
+        {
+            uint32_t basePrefixSize;
+            FFXM_VALIDATE(decompressEncodedStream(blob->baseBlob, base.encoded, basePrefixSize));
+        }
+        prefixSize = uint32_t(base.encoded.size());
+        stream = base.encoded;
+    }
+
+    stream.resize(size_t(prefixSize) + blob->encodedSize);
+    const uint8_t* compressed = s_archiveData + s_archiveHeader->dataOffset + blob->dataOffset;
+    FFXM_RETURN_ON_ERROR(ffxmShaderArchiveDecompress(compressed, blob->dataSize, stream.data(), prefixSize, uint32_t(stream.size())),
+                         FFXM_ERROR_MALFORMED_DATA);
+    return FFXM_OK;
+}
+
+static FfxmErrorCode decodeArchiveBlob(uint32_t blobIndex, CachedShaderBlob& cached)
+{
+    const FfxmShaderArchiveBlob* blob = getArchiveBlob(blobIndex);
+
+    std::vector<uint8_t> stream;
+    uint32_t prefixSize;
+    if (blob->baseBlob == FFXM_SHADER_ARCHIVE_NO_BASE && !cached.encoded.empty())
+    {
+        stream = cached.encoded;
+        prefixSize = 0;
+    }
+    else
+    {
+        FFXM_VALIDATE(decompressEncodedStream(blobIndex, stream, prefixSize));
+    }
+
+    cached.code.resize(blob->codeSize / sizeof(uint32_t));
+    FFXM_RETURN_ON_ERROR(ffxmShaderArchiveDecodeSpirv(stream.data() + prefixSize, blob->encodedSize, cached.code.data(), blob->codeSize),
+                         FFXM_ERROR_MALFORMED_DATA);
+
+    if (blob->baseBlob == FFXM_SHADER_ARCHIVE_NO_BASE)
+    {
+        cached.encoded = std::move(stream);
+    }
+
+    // resolve the resource names of every binding kind, the other reflection arrays are used in place
+    const uint32_t  reflectionSize = s_archiveHeader->size - s_archiveHeader->reflectionOffset - blob->reflectionOffset;
+    const uint32_t* reflection = reinterpret_cast<const uint32_t*>(s_archiveData + s_archiveHeader->reflectionOffset + blob->reflectionOffset);
+    const uint32_t  reflectionWordCount = reflectionSize / sizeof(uint32_t);
+
+    const char*    strings = reinterpret_cast<const char*>(s_archiveData + s_archiveHeader->stringOffset);
+    const uint32_t stringSize = s_archiveHeader->size - s_archiveHeader->stringOffset;
+
+    cached.names.clear();
+    uint32_t word = 0;
+    for (uint32_t kind = 0; kind < FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT; ++kind)
+    {
+        FFXM_RETURN_ON_ERROR(word < reflectionWordCount, FFXM_ERROR_MALFORMED_DATA);
+        const uint32_t count = reflection[word++];
+        FFXM_RETURN_ON_ERROR(count <= (reflectionWordCount - word) / 4, FFXM_ERROR_MALFORMED_DATA);
+
+        for (uint32_t resource = 0; resource < count; ++resource)
+        {
+            const uint32_t nameOffset = reflection[word + resource];
+            FFXM_RETURN_ON_ERROR(nameOffset < stringSize && memchr(strings + nameOffset, 0, stringSize - nameOffset), FFXM_ERROR_MALFORMED_DATA);
+            cached.names.push_back(strings + nameOffset);
+        }
+        word += count * 4;
+    }
+
+    cached.decoded = true;
+    return FFXM_OK;
+}
+
+static FfxmErrorCode getArchiveBlobByKey(uint32_t lookupIndex, uint32_t key, FfxmShaderBlob* outBlob)
+{
+    FFXM_RETURN_ON_ERROR(s_archiveData, FFXM_ERROR_INCOMPLETE_INTERFACE);
+
+    const uint16_t* lookup = reinterpret_cast<const uint16_t*>(s_archiveData + s_archiveHeader->lookupOffset);
+    const uint32_t  blobIndex = lookup[lookupIndex * FFXM_SHADER_ARCHIVE_KEY_COUNT + key];
+    FFXM_RETURN_ON_ERROR(blobIndex != FFXM_SHADER_ARCHIVE_NO_BLOB, FFXM_ERROR_INVALID_ARGUMENT);
+
+    CachedShaderBlob& cached = s_archiveCache[blobIndex];
+    if (!cached.decoded)
+    {
+        FFXM_VALIDATE(decodeArchiveBlob(blobIndex, cached));
+    }
+
+    const FfxmShaderArchiveBlob* blob = getArchiveBlob(blobIndex);
+    const uint32_t* reflection = reinterpret_cast<const uint32_t*>(s_archiveData + s_archiveHeader->reflectionOffset + blob->reflectionOffset);
+
+    uint32_t        counts[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT];
+    const char**    names[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT];
+    const uint32_t* bindings[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT];
+    const uint32_t* bindingCounts[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT];
+    const uint32_t* sets[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT];
+
+    uint32_t nameIndex = 0;
+    for (uint32_t kind = 0; kind < FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT; ++kind)
+    {
+        const uint32_t count = *reflection++;
+        counts[kind] = count;
+        names[kind] = count ? cached.names.data() + nameIndex : nullptr;
+        bindings[kind] = count ? reflection + count : nullptr;
+        bindingCounts[kind] = count ? reflection + count * 2 : nullptr;
+        sets[kind] = count ? reflection + count * 3 : nullptr;
+        reflection += count * 4;
+        nameIndex += count;
+    }
+
+    FfxmShaderBlob result = {
+        reinterpret_cast<const uint8_t*>(cached.code.data()), blob->codeSize,
+        counts[0], counts[1], counts[2], counts[3], counts[4], counts[5], counts[6], counts[7],
+        names[0], bindings[0], bindingCounts[0], sets[0],
+        names[1], bindings[1], bindingCounts[1], sets[1],
+        names[2], bindings[2], bindingCounts[2], sets[2],
+        names[3], bindings[3], bindingCounts[3], sets[3],
+        names[4], bindings[4], bindingCounts[4], sets[4],
+        names[5], bindings[5], bindingCounts[5], sets[5],
+        names[6], bindings[6], bindingCounts[6], sets[6],
+        names[7], bindings[7], bindingCounts[7], sets[7],
+    };
+    memcpy(outBlob, &result, sizeof(FfxmShaderBlob));
+    return FFXM_OK;
+}
+
+// Same bit order as the permutation keys of the prebuilt shaders
+static uint32_t getPermutationKey(uint32_t permutationOptions)
+{
+    uint32_t key = 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT) ? (1u << 0) : 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS) ? (1u << 1) : 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS) ? (1u << 2) : 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_DEPTH_INVERTED) ? (1u << 3) : 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING) ? (1u << 4) : 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_APPLY_BALANCED_OPT) ? (1u << 5) : 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_APPLY_PERFORMANCE_OPT) ? (1u << 6) : 0;
+    key |= FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_APPLY_ULTRA_PERFORMANCE_OPT) ? (1u << 7) : 0;
+    return key;
+}
+
+FfxmErrorCode fsr2GetPermutationBlobByIndex(
+    FfxmFsr2Pass passId,
+    uint32_t permutationOptions,
+    FfxmShaderBlob* outBlob,
+    FfxmShaderBlob* outVertBlob) {
+
+    // return an empty blob on failure
+    memset(outBlob, 0, sizeof(FfxmShaderBlob));
+    if (outVertBlob)
+    {
+        memset(outVertBlob, 0, sizeof(FfxmShaderBlob));
+    }
+    FFXM_RETURN_ON_ERROR(uint32_t(passId) < FFXM_FSR2_PASS_COUNT, FFXM_ERROR_INVALID_ENUM);
+    // Archives are packed from the prebuilt permutations, which don't include the options compiled from source only
+    FFXM_RETURN_ON_ERROR(!(permutationOptions & FSR2_SHADER_PERMUTATION_SOURCE_ONLY), FFXM_ERROR_INVALID_ARGUMENT);
+
+    const uint32_t key = getPermutationKey(permutationOptions);
+
+    std::lock_guard<std::mutex> lock(s_archiveMutex);
+
+    // Currently all passes share the same vertex shader, stored after the passes
+    if (outVertBlob)
+    {
+        FFXM_VALIDATE(getArchiveBlobByKey(FFXM_FSR2_PASS_COUNT, key, outVertBlob));
+    }
+
+    return getArchiveBlobByKey(passId, key, outBlob);
+}
+
+FfxmErrorCode fsr2IsWave64(uint32_t permutationOptions, bool& isWave64)
+{
+    isWave64 = FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_FORCE_WAVE64);
+    return FFXM_OK;
+}
+
+bool fsr2HasSourcePermutations()
+{
+    // Archives are packed from the prebuilt permutations
+    return false;
+}
+
+} // namespace arm
@@ -32,6 +32,28 @@
 #include <ffxm_fsr2_rcas_pass_fs_16bit_permutations.h>
 #include <ffxm_fsr2_vs_16bit_permutations.h>
 
+// Optional shader variants generated when the backend is built with FFXM_BUILD_FP32_SHADER_PERMUTATIONS or
+// FFXM_BUILD_WAVE64_SHADER_PERMUTATIONS, the 16-bit Wave32 permutations are used for the variants not built
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+#include <ffxm_fsr2_autogen_reactive_pass_fs_permutations.h>
+#include <ffxm_fsr2_accumulate_pass_fs_permutations.h>
+#include <ffxm_fsr2_compute_luminance_pyramid_pass_permutations.h>
+#include <ffxm_fsr2_depth_clip_pass_fs_permutations.h>
+#include <ffxm_fsr2_lock_pass_permutations.h>
+#include <ffxm_fsr2_reconstruct_previous_depth_pass_fs_permutations.h>
+#include <ffxm_fsr2_rcas_pass_fs_permutations.h>
+#include <ffxm_fsr2_vs_permutations.h>
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
+#if defined(FFXM_FSR2_WAVE64_PERMUTATIONS)
+#include <ffxm_fsr2_compute_luminance_pyramid_pass_wave64_16bit_permutations.h>
+#include <ffxm_fsr2_lock_pass_wave64_16bit_permutations.h>
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+#include <ffxm_fsr2_compute_luminance_pyramid_pass_wave64_permutations.h>
+#include <ffxm_fsr2_lock_pass_wave64_permutations.h>
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+#endif // #if defined(FFXM_FSR2_WAVE64_PERMUTATIONS)
+
 #include <string.h> // for memset
 
 namespace arm
@@ -40,7 +62,7 @@ namespace arm
 #if defined(POPULATE_PERMUTATION_KEY)
 #undef POPULATE_PERMUTATION_KEY
 #endif // #if defined(POPULATE_PERMUTATION_KEY)
-#define POPULATE_PERMUTATION_KEY(options, key)                                                                \
+#define POPULATE_PERMUTATION_KEY(options, key, populatePassKey)                                               \
 key.index = 0;                                                                                                \
 key.FFXM_FSR2_OPTION_HDR_COLOR_INPUT = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT);                 \
 key.FFXM_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS);   \
@@ -49,14 +71,51 @@ key.FFXM_FSR2_OPTION_INVERTED_DEPTH = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PE
 key.FFXM_FSR2_OPTION_APPLY_SHARPENING = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING); \
 key.FFXM_FSR2_OPTION_SHADER_OPT_BALANCED = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_APPLY_BALANCED_OPT); \
 key.FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_APPLY_PERFORMANCE_OPT); \
-key.FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_APPLY_ULTRA_PERFORMANCE_OPT);
+key.FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_APPLY_ULTRA_PERFORMANCE_OPT); \
+populatePassKey(options, key)
+
+// The half resolution depth clip, the fused reconstruction and lock, the subgroup luminance pyramid and the Lanczos
+// weight table are only compiled from source (FFXM_FSR2_SOURCE_PERMUTATIONS), into the shaders of the passes reading
+// them, see CMakeShadersFSR2.txt. The prebuilt permutations don't include them.
+#if defined(FFXM_FSR2_SOURCE_PERMUTATIONS)
+#define POPULATE_DEPTH_CLIP_PERMUTATION_KEY(options, key) \
+key.FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_HALF_RES_DEPTH_CLIP);
+#define POPULATE_ACCUMULATE_PERMUTATION_KEY(options, key) \
+key.FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_HALF_RES_DEPTH_CLIP); \
+key.FFXM_FSR2_OPTION_LANCZOS_WEIGHT_TABLE = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_LANCZOS_WEIGHT_TABLE);
+#define POPULATE_LOCK_PERMUTATION_KEY(options, key) \
+key.FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_FUSED_RECONSTRUCT_AND_LOCK);
+#define POPULATE_LUMINANCE_PYRAMID_PERMUTATION_KEY(options, key) \
+key.FFXM_FSR2_OPTION_SUBGROUP_LUMINANCE_PYRAMID = FFXM_CONTAINS_FLAG(options, FSR2_SHADER_PERMUTATION_SUBGROUP_LUMINANCE_PYRAMID);
+#else
+#define POPULATE_DEPTH_CLIP_PERMUTATION_KEY(options, key)
+#define POPULATE_ACCUMULATE_PERMUTATION_KEY(options, key)
+#define POPULATE_LOCK_PERMUTATION_KEY(options, key)
+#define POPULATE_LUMINANCE_PYRAMID_PERMUTATION_KEY(options, key)
+#endif // #if defined(FFXM_FSR2_SOURCE_PERMUTATIONS)
+
+// For the passes with no options of their own
+#define POPULATE_NO_PASS_PERMUTATION_KEY(options, key)
+
+// Returns the blob of the permutation from the tables generated for the shader variant name
+#define RETURN_PERMUTATION_BLOB(name, options, populatePassKey)                                               \
+{                                                                                                             \
+    name##_PermutationKey variantKey;                                                                         \
+    POPULATE_PERMUTATION_KEY(options, variantKey, populatePassKey);                                           \
+    return POPULATE_SHADER_BLOB_FFX(g_##name##_PermutationInfo, g_##name##_IndirectionTable[variantKey.index]); \
+}
 
 static FfxmShaderBlob fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_depth_clip_pass_fs, permutationOptions, POPULATE_DEPTH_CLIP_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_depth_clip_pass_fs_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_DEPTH_CLIP_PERMUTATION_KEY);
 
     const int32_t tableIndex = g_ffxm_fsr2_depth_clip_pass_fs_16bit_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB_FFX(g_ffxm_fsr2_depth_clip_pass_fs_16bit_PermutationInfo, tableIndex);
@@ -65,9 +124,14 @@ static FfxmShaderBlob fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t permut
 static FfxmShaderBlob fsr2GetReconstructPreviousDepthPassPermutationBlobByIndex(uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_reconstruct_previous_depth_pass_fs, permutationOptions, POPULATE_NO_PASS_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_reconstruct_previous_depth_pass_fs_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_NO_PASS_PERMUTATION_KEY);
 
     const int32_t tableIndex = g_ffxm_fsr2_reconstruct_previous_depth_pass_fs_16bit_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB_FFX(g_ffxm_fsr2_reconstruct_previous_depth_pass_fs_16bit_PermutationInfo, tableIndex);
@@ -76,9 +140,25 @@ static FfxmShaderBlob fsr2GetReconstructPreviousDepthPassPermutationBlobByIndex(
 static FfxmShaderBlob fsr2GetLockPassPermutationBlobByIndex(uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_WAVE64_PERMUTATIONS)
+    if (isWave64)
+    {
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+        if (!is16bit)
+            RETURN_PERMUTATION_BLOB(ffxm_fsr2_lock_pass_wave64, permutationOptions, POPULATE_LOCK_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_lock_pass_wave64_16bit, permutationOptions, POPULATE_LOCK_PERMUTATION_KEY);
+    }
+#endif // #if defined(FFXM_FSR2_WAVE64_PERMUTATIONS)
+
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_lock_pass, permutationOptions, POPULATE_LOCK_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_lock_pass_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_LOCK_PERMUTATION_KEY);
 
     const int32_t tableIndex = g_ffxm_fsr2_lock_pass_16bit_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB_FFX(g_ffxm_fsr2_lock_pass_16bit_PermutationInfo, tableIndex);
@@ -87,9 +167,14 @@ static FfxmShaderBlob fsr2GetLockPassPermutationBlobByIndex(uint32_t permutation
 static FfxmShaderBlob fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_accumulate_pass_fs, permutationOptions, POPULATE_ACCUMULATE_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_accumulate_pass_fs_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_ACCUMULATE_PERMUTATION_KEY);
 
     const int32_t tableIndex = g_ffxm_fsr2_accumulate_pass_fs_16bit_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB_FFX(g_ffxm_fsr2_accumulate_pass_fs_16bit_PermutationInfo, tableIndex);
@@ -98,9 +183,14 @@ static FfxmShaderBlob fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t permu
 static FfxmShaderBlob fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_rcas_pass_fs, permutationOptions, POPULATE_NO_PASS_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_rcas_pass_fs_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_NO_PASS_PERMUTATION_KEY);
 
     const int32_t tableIndex = g_ffxm_fsr2_rcas_pass_fs_16bit_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB_FFX(g_ffxm_fsr2_rcas_pass_fs_16bit_PermutationInfo, tableIndex);
@@ -109,9 +199,25 @@ static FfxmShaderBlob fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutation
 static FfxmShaderBlob fsr2GetComputeLuminancePyramidPassPermutationBlobByIndex(uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_WAVE64_PERMUTATIONS)
+    if (isWave64)
+    {
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+        if (!is16bit)
+            RETURN_PERMUTATION_BLOB(ffxm_fsr2_compute_luminance_pyramid_pass_wave64, permutationOptions, POPULATE_LUMINANCE_PYRAMID_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_compute_luminance_pyramid_pass_wave64_16bit, permutationOptions, POPULATE_LUMINANCE_PYRAMID_PERMUTATION_KEY);
+    }
+#endif // #if defined(FFXM_FSR2_WAVE64_PERMUTATIONS)
+
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_compute_luminance_pyramid_pass, permutationOptions, POPULATE_LUMINANCE_PYRAMID_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_compute_luminance_pyramid_pass_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_LUMINANCE_PYRAMID_PERMUTATION_KEY);
 
     const int32_t tableIndex = g_ffxm_fsr2_compute_luminance_pyramid_pass_16bit_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB_FFX(g_ffxm_fsr2_compute_luminance_pyramid_pass_16bit_PermutationInfo, tableIndex);
@@ -121,9 +227,14 @@ static FfxmShaderBlob fsr2GetAutogenReactivePassPermutationBlobByIndex(
     uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_autogen_reactive_pass_fs, permutationOptions, POPULATE_NO_PASS_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_autogen_reactive_pass_fs_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_NO_PASS_PERMUTATION_KEY);
 
     const int32_t tableIndex = g_ffxm_fsr2_autogen_reactive_pass_fs_16bit_IndirectionTable[key.index];
     return POPULATE_SHADER_BLOB_FFX(g_ffxm_fsr2_autogen_reactive_pass_fs_16bit_PermutationInfo, tableIndex);
@@ -133,9 +244,14 @@ static FfxmShaderBlob fsr2GetGeneralVertexPermutationBlobByIndex(
     uint32_t permutationOptions, [[maybe_unused]] bool isWave64, [[maybe_unused]] bool is16bit)
 {
 
+#if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+    if (!is16bit)
+        RETURN_PERMUTATION_BLOB(ffxm_fsr2_vs, permutationOptions, POPULATE_NO_PASS_PERMUTATION_KEY);
+#endif // #if defined(FFXM_FSR2_FP32_PERMUTATIONS)
+
     ffxm_fsr2_vs_16bit_PermutationKey key;
 
-    POPULATE_PERMUTATION_KEY(permutationOptions, key);
+    POPULATE_PERMUTATION_KEY(permutationOptions, key, POPULATE_NO_PASS_PERMUTATION_KEY);
 
 
     const int32_t tableIndex = g_ffxm_fsr2_vs_16bit_IndirectionTable[key.index];
@@ -148,6 +264,19 @@ FfxmErrorCode fsr2GetPermutationBlobByIndex(
     FfxmShaderBlob* outBlob,
     FfxmShaderBlob* outVertBlob) {
 
+#if !defined(FFXM_FSR2_SOURCE_PERMUTATIONS)
+    // Rather than returning the blob of another permutation, fail the pipeline creation
+    if (permutationOptions & FSR2_SHADER_PERMUTATION_SOURCE_ONLY)
+    {
+        memset(outBlob, 0, sizeof(FfxmShaderBlob));
+        if (outVertBlob)
+        {
+            memset(outVertBlob, 0, sizeof(FfxmShaderBlob));
+        }
+        return FFXM_ERROR_INVALID_ARGUMENT;
+    }
+#endif // #if !defined(FFXM_FSR2_SOURCE_PERMUTATIONS)
+
     bool isWave64 = FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_FORCE_WAVE64);
     bool is16bit = FFXM_CONTAINS_FLAG(permutationOptions, FSR2_SHADER_PERMUTATION_ALLOW_FP16);
 
@@ -226,4 +355,13 @@ FfxmErrorCode fsr2IsWave64(uint32_t permutationOptions, bool& isWave64)
     return FFXM_OK;
 }
 
+bool fsr2HasSourcePermutations()
+{
+#if defined(FFXM_FSR2_SOURCE_PERMUTATIONS)
+    return true;
+#else
+    return false;
+#endif // #if defined(FFXM_FSR2_SOURCE_PERMUTATIONS)
+}
+
 } // namespace arm
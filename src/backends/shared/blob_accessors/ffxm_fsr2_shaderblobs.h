@@ -42,6 +42,9 @@ FfxmErrorCode fsr2GetPermutationBlobByIndex(
 // Check is Wave64 is requested on this permutation
 FfxmErrorCode fsr2IsWave64(uint32_t permutationOptions, bool& isWave64);
 
+// Check if the permutations only compiled from source can be returned
+bool fsr2HasSourcePermutations();
+
 #if defined(__cplusplus)
 }
 #endif // #if defined(__cplusplus)
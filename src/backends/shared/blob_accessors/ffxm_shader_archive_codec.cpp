@@ -0,0 +1,151 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "ffxm_shader_archive_codec.h"
+
+#include <string.h>
+#include <unordered_map>
+
+namespace arm
+{
+
+static bool readLength(const uint8_t*& src, const uint8_t* srcEnd, uint32_t& length)
+{
+    uint8_t byte;
+    do
+    {
+        if (src == srcEnd)
+            return false;
+        byte = *src++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+bool ffxmShaderArchiveDecompress(const uint8_t* src, uint32_t srcSize, uint8_t* dst, uint32_t prefixSize, uint32_t dstSize)
+{
+    const uint8_t* srcEnd = src + srcSize;
+    uint8_t*       out = dst + prefixSize;
+    uint8_t*       outEnd = dst + dstSize;
+
+    // each sequence is a token with the literal and match lengths, the literals, then the match offset,
+    // the last sequence stops after its literals
+    while (src < srcEnd)
+    {
+        const uint8_t token = *src++;
+
+        uint32_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(src, srcEnd, literalLength))
+            return false;
+        if (literalLength > uint32_t(srcEnd - src) || literalLength > uint32_t(outEnd - out))
+            return false;
+        memcpy(out, src, literalLength);
+        src += literalLength;
+        out += literalLength;
+
+        if (src == srcEnd)
+            break;
+
+        if (srcEnd - src < 2)
+            return false;
+        const uint32_t offset = uint32_t(src[0]) | (uint32_t(src[1]) << 8);
+        src += 2;
+
+        uint32_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(src, srcEnd, matchLength))
+            return false;
+        matchLength += 4;
+
+        if (offset == 0 || offset > uint32_t(out - dst) || matchLength > uint32_t(outEnd - out))
+            return false;
+
+        // matches can overlap the bytes they produce, copy forward one byte at a time
+        const uint8_t* match = out - offset;
+        for (uint32_t i = 0; i < matchLength; ++i)
+            out[i] = match[i];
+        out += matchLength;
+    }
+
+    return out == outEnd;
+}
+
+static bool readVarint(const uint8_t*& src, const uint8_t* srcEnd, uint32_t& value)
+{
+    value = 0;
+    for (uint32_t shift = 0; shift < 35; shift += 7)
+    {
+        if (src == srcEnd)
+            return false;
+        const uint8_t byte = *src++;
+        value |= uint32_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+bool ffxmShaderArchiveDecodeSpirv(const uint8_t* encoded, uint32_t encodedSize, uint32_t* code, uint32_t codeSize)
+{
+    const uint8_t* src = encoded;
+    const uint8_t* srcEnd = encoded + encodedSize;
+    const uint32_t wordCount = codeSize / sizeof(uint32_t);
+
+    const uint32_t headerWordCount = 5;
+    if (wordCount < headerWordCount)
+        return false;
+    for (uint32_t i = 0; i < headerWordCount; ++i)
+    {
+        if (!readVarint(src, srcEnd, code[i]))
+            return false;
+    }
+
+    // previous operand at each position of each opcode, positions past 255 share the last slot
+    std::unordered_map<uint32_t, uint32_t> previousOperands;
+
+    uint32_t word = headerWordCount;
+    while (word < wordCount)
+    {
+        uint32_t opcode, instructionWordCount;
+        if (!readVarint(src, srcEnd, opcode) || !readVarint(src, srcEnd, instructionWordCount))
+            return false;
+        if (opcode > 0xffff || instructionWordCount == 0 || instructionWordCount > wordCount - word)
+            return false;
+
+        code[word] = (instructionWordCount << 16) | opcode;
+        for (uint32_t operand = 1; operand < instructionWordCount; ++operand)
+        {
+            uint32_t zigzag;
+            if (!readVarint(src, srcEnd, zigzag))
+                return false;
+            const uint32_t delta = (zigzag >> 1) ^ (0u - (zigzag & 1));
+
+            uint32_t& previous = previousOperands[(opcode << 8) | (operand < 255 ? operand : 255)];
+            previous += delta;
+            code[word + operand] = previous;
+        }
+        word += instructionWordCount;
+    }
+
+    return src == srcEnd;
+}
+
+} // namespace arm
@@ -0,0 +1,80 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <stdint.h>
+
+namespace arm
+{
+
+// Layout of the shader archives written by the Arm_ASR_shader_pack tool. All values are little endian and
+// all the sections are 4 byte aligned, the reflection data is used in place.
+//
+// Each SPIR-V module is stored as an encoded instruction stream: the five header words, then for every
+// instruction its opcode and word count, followed by each operand as the difference to the operand at the
+// same position of the previous instruction with the same opcode. All the values are zigzag varints. The
+// result ids of the flattened FSR2 shaders grow steadily, so the differences are small and repeat between
+// the permutations of a pass even where the absolute ids do not.
+//
+// The encoded stream is then compressed with an LZ77 block format similar to LZ4. The permutations of a
+// pass are compressed against the encoded stream of the first permutation of that pass, used as a preset
+// dictionary, so the code they have in common is only stored once.
+
+#define FFXM_SHADER_ARCHIVE_MAGIC        0x41535846  // "FXSA"
+#define FFXM_SHADER_ARCHIVE_VERSION      1
+#define FFXM_SHADER_ARCHIVE_KEY_COUNT    256         // permutation keys have 8 option bits
+#define FFXM_SHADER_ARCHIVE_NO_BLOB      0xffff
+#define FFXM_SHADER_ARCHIVE_NO_BASE      0xffffffff
+#define FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT 8     // in the order of FfxmShaderBlob
+
+typedef struct FfxmShaderArchiveHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t lookupCount;       // FFXM_FSR2_PASS_COUNT lookup tables, followed by the one of the vertex shader
+    uint32_t blobCount;
+    uint32_t lookupOffset;      // uint16_t blob indices, FFXM_SHADER_ARCHIVE_KEY_COUNT per lookup table
+    uint32_t blobOffset;        // FfxmShaderArchiveBlob array
+    uint32_t reflectionOffset;  // for each binding kind: count, then count name offsets, bindings, counts and sets
+    uint32_t stringOffset;      // null terminated resource names
+    uint32_t dataOffset;        // compressed instruction streams
+    uint32_t size;              // total size of the archive
+} FfxmShaderArchiveHeader;
+
+typedef struct FfxmShaderArchiveBlob
+{
+    uint32_t codeSize;          // size of the SPIR-V module in bytes
+    uint32_t encodedSize;       // size of the encoded instruction stream
+    uint32_t dataOffset;        // offset of the compressed stream from the data section
+    uint32_t dataSize;          // size of the compressed stream
+    uint32_t baseBlob;          // blob whose encoded stream is the dictionary, or FFXM_SHADER_ARCHIVE_NO_BASE
+    uint32_t reflectionOffset;  // offset of the reflection data from the reflection section
+} FfxmShaderArchiveBlob;
+
+// Decompress src into dst, after the prefixSize bytes of dictionary already at the start of dst.
+bool ffxmShaderArchiveDecompress(const uint8_t* src, uint32_t srcSize, uint8_t* dst, uint32_t prefixSize, uint32_t dstSize);
+
+// Decode an encoded instruction stream back into a SPIR-V module of codeSize bytes.
+bool ffxmShaderArchiveDecodeSpirv(const uint8_t* encoded, uint32_t encodedSize, uint32_t* code, uint32_t codeSize);
+
+} // namespace arm
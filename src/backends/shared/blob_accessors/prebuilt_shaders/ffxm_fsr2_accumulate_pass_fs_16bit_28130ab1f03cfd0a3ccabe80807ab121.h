@@ -21,7 +21,7 @@ static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccab
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccabe80807ab121_SamplerResourceCounts[] = {  1, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccabe80807ab121_SamplerResourceSpaces[] = {  0, };
 
-static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccabe80807ab121_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_luma_history", };
+static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccabe80807ab121_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_upscaled_output", };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccabe80807ab121_TextureRTResourceBindings[] = {  0, 1, 2, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccabe80807ab121_TextureRTResourceCounts[] = {  0, 0, 0, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_28130ab1f03cfd0a3ccabe80807ab121_TextureRTResourceSpaces[] = {  0, 0, 0, };
@@ -21,7 +21,7 @@ static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c8737fa5590b_SamplerResourceCounts[] = {  1, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c8737fa5590b_SamplerResourceSpaces[] = {  0, };
 
-static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c8737fa5590b_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_luma_history", };
+static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c8737fa5590b_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_upscaled_output", };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c8737fa5590b_TextureRTResourceBindings[] = {  0, 1, 2, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c8737fa5590b_TextureRTResourceCounts[] = {  0, 0, 0, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_4f7973bcd38dd7a40235c8737fa5590b_TextureRTResourceSpaces[] = {  0, 0, 0, };
@@ -21,7 +21,7 @@ static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8d
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8db3b17bce024_SamplerResourceCounts[] = {  1, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8db3b17bce024_SamplerResourceSpaces[] = {  0, };
 
-static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8db3b17bce024_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_luma_history", };
+static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8db3b17bce024_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_upscaled_output", };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8db3b17bce024_TextureRTResourceBindings[] = {  0, 1, 2, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8db3b17bce024_TextureRTResourceCounts[] = {  0, 0, 0, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_539904acc997c5460ba8db3b17bce024_TextureRTResourceSpaces[] = {  0, 0, 0, };
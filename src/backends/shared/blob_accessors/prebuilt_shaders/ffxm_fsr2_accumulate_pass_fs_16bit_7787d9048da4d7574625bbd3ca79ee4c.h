@@ -21,7 +21,7 @@ static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625b
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625bbd3ca79ee4c_SamplerResourceCounts[] = {  1, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625bbd3ca79ee4c_SamplerResourceSpaces[] = {  0, };
 
-static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625bbd3ca79ee4c_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_luma_history", };
+static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625bbd3ca79ee4c_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_upscaled_output", };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625bbd3ca79ee4c_TextureRTResourceBindings[] = {  0, 1, 2, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625bbd3ca79ee4c_TextureRTResourceCounts[] = {  0, 0, 0, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_7787d9048da4d7574625bbd3ca79ee4c_TextureRTResourceSpaces[] = {  0, 0, 0, };
@@ -21,7 +21,7 @@ static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e9a2e889b5e8_SamplerResourceCounts[] = {  1, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e9a2e889b5e8_SamplerResourceSpaces[] = {  0, };
 
-static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e9a2e889b5e8_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_luma_history", };
+static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e9a2e889b5e8_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_upscaled_output", };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e9a2e889b5e8_TextureRTResourceBindings[] = {  0, 1, 2, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e9a2e889b5e8_TextureRTResourceCounts[] = {  0, 0, 0, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_c7814fa66f965d83a864e9a2e889b5e8_TextureRTResourceSpaces[] = {  0, 0, 0, };
@@ -21,7 +21,7 @@ static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f9db14efba14_SamplerResourceCounts[] = {  1, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f9db14efba14_SamplerResourceSpaces[] = {  0, };
 
-static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f9db14efba14_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_luma_history", };
+static const char* g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f9db14efba14_TextureRTResourceNames[] = {  "rw_internal_upscaled_color", "rw_lock_status", "rw_upscaled_output", };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f9db14efba14_TextureRTResourceBindings[] = {  0, 1, 2, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f9db14efba14_TextureRTResourceCounts[] = {  0, 0, 0, };
 static const uint32_t g_ffxm_fsr2_accumulate_pass_fs_16bit_d13ef401d10a81f601d9f9db14efba14_TextureRTResourceSpaces[] = {  0, 0, 0, };
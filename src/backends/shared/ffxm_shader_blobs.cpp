@@ -73,4 +73,21 @@ switch (effectId)
     return FFXM_ERROR_BACKEND_API_ERROR;
 }
 
+bool ffxmHasSourcePermutations(FfxmEffect effectId)
+{
+    switch (effectId)
+    {
+#if defined(FFXM_FSR) || defined(FFXM_ALL)
+    case FFXM_EFFECT_FSR2:
+        return fsr2HasSourcePermutations();
+#endif // #if defined(FFXM_FSR) || defined(FFXM_ALL)
+
+    default:
+        FFXM_ASSERT_MESSAGE(false, "Not implemented");
+        break;
+    }
+
+    return false;
+}
+
 } // namespace arm
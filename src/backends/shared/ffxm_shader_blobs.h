@@ -43,6 +43,9 @@ FfxmErrorCode ffxmGetPermutationBlobByIndex(FfxmEffect effectId,
 // Check is Wave64 is requested on this permutation
 FfxmErrorCode ffxmIsWave64(FfxmEffect effectId, uint32_t permutationOptions, bool& isWave64);
 
+// Check if the permutations of the effect only compiled from source can be returned
+bool ffxmHasSourcePermutations(FfxmEffect effectId);
+
 #if defined(__cplusplus)
 }
 #endif // #if defined(__cplusplus)
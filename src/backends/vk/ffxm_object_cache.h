@@ -0,0 +1,192 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+
+namespace arm {
+
+/// @addtogroup util_other
+/// @{
+
+/// Usage counters of the caches of one object class.
+typedef struct ObjectCacheCounters {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint32_t count;             ///< Number of objects currently alive in the caches.
+} ObjectCacheCounters;
+
+/// A fixed capacity cache of objects keyed by a 64-bit hash of their creation parameters.
+///
+/// Lookups go through an open-addressing table with linear probing, the least
+/// recently used object is evicted once the cache is full. The cache owns no
+/// memory and is valid when zero-initialized, which lets it live in the scratch
+/// buffer of a backend.
+/// @tparam T The object handle type.
+/// @tparam CAPACITY The maximum number of objects alive in the cache.
+template<typename T, uint32_t CAPACITY>
+struct ObjectCache
+{
+    static_assert(CAPACITY > 0 && CAPACITY < 256, "Entry links are stored on 8 bits");
+
+    /// The number of slots of the table, a power of two keeping the load factor at or below one half.
+    static constexpr uint32_t SLOT_COUNT = []() { uint32_t count = 1; while (count < CAPACITY * 2) count <<= 1; return count; }();
+
+    /// Links and slots store entry indices biased by one, zero stands for none.
+    struct Entry {
+        uint64_t hash;
+        T        handle;
+        uint8_t  prev;          ///< More recently used entry.
+        uint8_t  next;          ///< Less recently used entry.
+    };
+
+    Entry   entries[CAPACITY];
+    uint8_t slots[SLOT_COUNT];
+    uint8_t count;
+    uint8_t head;               ///< Most recently used entry.
+    uint8_t tail;               ///< Least recently used entry.
+
+    /// Looks an object up and marks it as the most recently used one.
+    /// @param hash The hash of the object.
+    /// @param counters The counters to update.
+    /// @return A pointer to the handle of the object, or nullptr if it is not in the cache.
+    const T* find(uint64_t hash, ObjectCacheCounters& counters)
+    {
+        for (uint32_t slot = hash & (SLOT_COUNT - 1); slots[slot]; slot = (slot + 1) & (SLOT_COUNT - 1))
+        {
+            Entry& entry = entries[slots[slot] - 1];
+            if (entry.hash == hash)
+            {
+                unlink(slots[slot]);
+                pushFront(slots[slot]);
+                counters.hits++;
+                return &entry.handle;
+            }
+        }
+
+        counters.misses++;
+        return nullptr;
+    }
+
+    /// Adds an object which is not in the cache yet as the most recently used one.
+    /// @param hash The hash of the object.
+    /// @param handle The handle of the object.
+    /// @param evicted Receives the handle of the least recently used object when the cache was full.
+    /// @param counters The counters to update.
+    /// @return true if an object was evicted, it is up to the caller to destroy it.
+    bool insert(uint64_t hash, T handle, T& evicted, ObjectCacheCounters& counters)
+    {
+        uint8_t link;
+        bool    evict = count == CAPACITY;
+        if (evict)
+        {
+            link = tail;
+            evicted = entries[link - 1].handle;
+            unlink(link);
+            removeSlot(link);
+            counters.evictions++;
+        }
+        else
+        {
+            link = ++count;
+            counters.count++;
+        }
+
+        entries[link - 1].hash = hash;
+        entries[link - 1].handle = handle;
+        pushFront(link);
+
+        uint32_t slot = hash & (SLOT_COUNT - 1);
+        while (slots[slot])
+            slot = (slot + 1) & (SLOT_COUNT - 1);
+        slots[slot] = link;
+
+        return evict;
+    }
+
+    /// Checks whether a handle is owned by the cache.
+    bool contains(T handle) const
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            if (entries[i].handle == handle)
+                return true;
+        return false;
+    }
+
+    /// Hands every object to the destroy function and empties the cache.
+    template<typename DestroyFunc>
+    void clear(DestroyFunc destroy, ObjectCacheCounters& counters)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            destroy(entries[i].handle);
+
+        counters.count -= count;
+        *this = {};
+    }
+
+private:
+    void unlink(uint8_t link)
+    {
+        Entry& entry = entries[link - 1];
+        (entry.prev ? entries[entry.prev - 1].next : head) = entry.next;
+        (entry.next ? entries[entry.next - 1].prev : tail) = entry.prev;
+        entry.prev = entry.next = 0;
+    }
+
+    void pushFront(uint8_t link)
+    {
+        Entry& entry = entries[link - 1];
+        entry.next = head;
+        if (head)
+            entries[head - 1].prev = link;
+        head = link;
+        if (!tail)
+            tail = link;
+    }
+
+    // Backward shift deletion, keeps every probe sequence free of holes without tombstones
+    void removeSlot(uint8_t link)
+    {
+        const uint32_t mask = SLOT_COUNT - 1;
+        uint32_t hole = entries[link - 1].hash & mask;
+        while (slots[hole] != link)
+            hole = (hole + 1) & mask;
+        slots[hole] = 0;
+
+        for (uint32_t slot = (hole + 1) & mask; slots[slot]; slot = (slot + 1) & mask)
+        {
+            // an entry may only move back if its home slot does not lie in (hole, slot]
+            const uint32_t home = entries[slots[slot] - 1].hash & mask;
+            if (((slot - home) & mask) >= ((slot - hole) & mask))
+            {
+                slots[hole] = slots[slot];
+                slots[slot] = 0;
+                hole = slot;
+            }
+        }
+    }
+};
+
+/// @}
+
+} // end namespace arm
@@ -29,6 +29,7 @@
 #include <math.h>
 #include <array>
 #include <ffxm_hash.h>
+#include <ffxm_object_cache.h>
 #include <locale>
 
 namespace arm
@@ -40,6 +41,7 @@ FfxmErrorCode           CreateBackendContextVK(FfxmInterface* backendInterface,
 FfxmErrorCode           GetDeviceCapabilitiesVK(FfxmInterface* backendInterface, FfxmDeviceCapabilities* deviceCapabilities);
 FfxmErrorCode           DestroyBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32 effectContextId);
 FfxmErrorCode           CreateResourceVK(FfxmInterface* backendInterface, const FfxmCreateResourceDescription* desc, FfxmUInt32 effectContextId, FfxmResourceInternal* outTexture);
+FfxmErrorCode           CreateAliasedResourcesVK(FfxmInterface* backendInterface, const FfxmCreateResourceDescription* descs, const FfxmUInt32* aliasSlots, FfxmUInt32 resourceCount, FfxmUInt32 effectContextId, FfxmResourceInternal* outTextures, size_t* outSavedMemorySize);
 FfxmErrorCode           DestroyResourceVK(FfxmInterface* backendInterface, FfxmResourceInternal resource);
 FfxmErrorCode           RegisterResourceVK(FfxmInterface* backendInterface, const FfxmResource* inResource, FfxmUInt32 effectContextId, FfxmResourceInternal* outResourceInternal);
 FfxmResource            GetResourceVK(FfxmInterface* backendInterface, FfxmResourceInternal resource);
@@ -47,18 +49,43 @@ FfxmErrorCode           UnregisterResourcesVK(FfxmInterface* backendInterface, F
 FfxmResourceDescription GetResourceDescriptionVK(FfxmInterface* backendInterface, FfxmResourceInternal resource);
 FfxmErrorCode		   CreateComputePipelineVK(FfxmInterface* backendInterface, FfxmEffect effect, FfxmPass passId, FfxmShaderQuality qualityPreset, FfxmUInt32 permutationOptions, const FfxmPipelineDescription* desc, FfxmUInt32 effectContextId, FfxmPipelineState* outPass);
 FfxmErrorCode		   CreateGraphicsPipelineVK(FfxmInterface* backendInterface, FfxmEffect effect, FfxmPass passId, FfxmShaderQuality qualityPreset, FfxmUInt32 permutationOptions, const FfxmPipelineDescription* desc, FfxmUInt32 effectContextId, FfxmPipelineState* outPass);
+FfxmErrorCode           PrewarmGraphicsPipelineVK(FfxmInterface* backendInterface, FfxmPipelineState* pipeline, const FfxmResourceDescription* rtDescriptions, FfxmUInt32 rtCount);
 FfxmErrorCode           DestroyPipelineVK(FfxmInterface* backendInterface, FfxmPipelineState* pipeline, FfxmUInt32 effectContextId);
 FfxmErrorCode           ScheduleGpuJobVK(FfxmInterface* backendInterface, const FfxmGpuJobDescription* job);
 FfxmErrorCode           ExecuteGpuJobsVK(FfxmInterface* backendInterface, FfxmCommandList commandList);
+FfxmErrorCode           ExecuteGpuJobsAsyncVK(FfxmInterface* backendInterface, FfxmCommandList commandList, FfxmCommandList asyncComputeCommandList);
+FfxmErrorCode           EnableGpuTimingsVK(FfxmInterface* backendInterface, FfxmUInt32 effectContextId);
+FfxmErrorCode           GetGpuTimingsVK(FfxmInterface* backendInterface, FfxmUInt32 effectContextId, FfxmUInt64* passTimings, FfxmUInt32 passCount);
 
 static VkDeviceContext sVkDeviceContext = { VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE };
 
 #define MAX_DESCRIPTOR_SET_LAYOUTS      (32)
 #define MAX_DESCRIPTOR_SETS             (2)
+#define MAX_DESCRIPTOR_SET_RING         (FFXM_MAX_QUEUED_FRAMES * FFXM_MAX_VIEW_COUNT)  // a pipeline is used once per view in a frame
+// Capacity of the per pass object caches, can be overridden at build time
+#ifndef MAX_RENDER_PASS_COUNT
 #define MAX_RENDER_PASS_COUNT           (FFXM_MAX_QUEUED_FRAMES)
-#define MAX_IMAGE_VIEW_COUNT            (FFXM_MAX_QUEUED_FRAMES*4)
-#define MAX_FRAME_BUFFER_COUNT          (FFXM_MAX_QUEUED_FRAMES)
+#endif
+#ifndef MAX_IMAGE_VIEW_COUNT
+#define MAX_IMAGE_VIEW_COUNT            (FFXM_MAX_QUEUED_FRAMES*4*FFXM_MAX_VIEW_COUNT)
+#endif
+#ifndef MAX_FRAME_BUFFER_COUNT
+#define MAX_FRAME_BUFFER_COUNT          (FFXM_MAX_QUEUED_FRAMES*FFXM_MAX_VIEW_COUNT)
+#endif
+#ifndef MAX_GRAPHICS_PIPELINE_COUNT
 #define MAX_GRAPHICS_PIPELINE_COUNT     (FFXM_MAX_QUEUED_FRAMES)
+#endif
+#define MAX_MERGED_SUBPASSES            (4)         // fragment jobs recorded as the subpasses of one render pass
+#define MAX_SUBPASS_GROUP_RESOURCES     (MAX_MERGED_SUBPASSES * (FFXM_MAX_NUM_SRVS + FFXM_MAX_NUM_UAVS + FFXM_MAX_NUM_RTS))
+#define MAX_RESOURCE_VIEWS_PER_CONTEXT  (FFXM_MAX_QUEUED_FRAMES * FFXM_MAX_RESOURCE_COUNT * 2)
+#define MAX_DYNAMIC_VIEW_ENTRIES        (FFXM_MAX_RESOURCE_COUNT / 2)
+#define MAX_VIEWS_PER_DYNAMIC_ENTRY     (8)         // the srv and the uavs of up to 7 mips of a registered resource
+#define UNIFORM_BUFFER_RANGE            (FFXM_MAX_CONST_SIZE * sizeof(FfxmUInt32))     // the range of the constant buffer descriptors
+#define MAX_TIMED_JOBS                  (FFXM_MAX_GPU_JOBS)                             // per frame and effect context
+#define TIMESTAMP_FRAME_COUNT           (FFXM_MAX_QUEUED_FRAMES + 1)                    // the frames in flight and the last completed one
+#define MEMORY_BLOCK_SIZE               (32 * 1024 * 1024)
+#define MAX_MEMORY_BLOCKS               (32)
+#define MAX_MEMORY_BLOCK_RANGES         (FFXM_MAX_RESOURCE_COUNT)
 
 // Redefine offsets for compilation purposes
 #define BINDING_SHIFT(name, shift)                       \
@@ -75,29 +102,32 @@ constexpr wchar_t* name##_BINDING_SHIFT_STR = L#shift;
 static FfxmUInt32 s_BackendRefCount = 0;
 static FfxmUInt32 s_MaxEffectContexts = 0;
 
-typedef struct ObjectBase_VK {
-    uint64_t hash;
-	FfxmUInt32 visitedFlag;
-} ObjectBase_VK;
+// Application provided pipeline cache data, consumed when the pipeline cache gets created
+static const void* s_PipelineCacheInitialData = nullptr;
+static size_t s_PipelineCacheInitialDataSize = 0;
 
-typedef struct GraphicPipeline_VK : ObjectBase_VK {
-    VkPipeline handle;
-} GraphicPipeline_VK;
+// Application provided device memory allocator, replaces the block sub-allocator when set
+static FfxmAllocatorCallbacksVK s_AllocatorCallbacks = {};
 
-typedef struct FrameBuffer_VK : ObjectBase_VK {
-    VkFramebuffer handle;
-} FrameBuffer_VK;
-
-typedef struct ImageView_VK : ObjectBase_VK {
-    VkImageView handle;
-} ImageView_VK;
-
-typedef struct RenderPass_VK : ObjectBase_VK {
-    VkRenderPass handle;
-} RenderPass_VK;
+typedef ObjectCache<VkPipeline, MAX_GRAPHICS_PIPELINE_COUNT> GraphicPipelineCache_VK;
+typedef ObjectCache<VkFramebuffer, MAX_FRAME_BUFFER_COUNT> FrameBufferCache_VK;
+typedef ObjectCache<VkImageView, MAX_IMAGE_VIEW_COUNT> ImageViewCache_VK;
+typedef ObjectCache<VkRenderPass, MAX_RENDER_PASS_COUNT> RenderPassCache_VK;
 
 typedef struct BackendContext_VK {
 
+    // a range of device memory, sub-allocated from a memory block or provided by the application allocator
+    typedef struct MemoryAllocation
+    {
+        VkDeviceMemory          deviceMemory;
+        VkDeviceSize            offset;
+        VkDeviceSize            size;
+        VkMemoryPropertyFlags   memoryProperties;
+        void*                   pMappedData;
+        FfxmInt32               memoryBlockIndex;       // -1 if allocated by the application allocator
+        void*                   pUserAllocation;
+    } MemoryAllocation;
+
     // store for resources and resourceViews
     typedef struct Resource
     {
@@ -116,46 +146,53 @@ typedef struct BackendContext_VK {
         int32_t                 uavViewIndex;
         FfxmUInt32                uavViewCount;
 
-        VkDeviceMemory          deviceMemory;
-        VkMemoryPropertyFlags   memoryProperties;
+        MemoryAllocation        memory;
+        FfxmInt32               aliasHeapIndex;         // -1 if the resource owns its memory
 
         bool                    undefined;
         bool                    dynamic;
 
     } Resource;
 
-    typedef struct UniformBuffer
-    {
-        VkBuffer bufferResource;
-        uint8_t* pData;
-    } UniformBuffer;
-
     typedef struct PipelineLayout {
 
         VkSampler               samplers[FFXM_MAX_SAMPLERS];
         VkDescriptorSetLayout   descriptorSetLayout[MAX_DESCRIPTOR_SETS];
-        VkDescriptorSet         descriptorSets[FFXM_MAX_QUEUED_FRAMES][MAX_DESCRIPTOR_SETS];
+        VkDescriptorSet         descriptorSets[MAX_DESCRIPTOR_SET_RING][MAX_DESCRIPTOR_SETS];
         FfxmUInt32                descriptorSetIndex;
         VkPipelineLayout        pipelineLayout;
 
+        // The constant buffers bound with dynamic offsets, in set and binding order as vkCmdBindDescriptorSets expects them
+        FfxmUInt32              dynamicOffsetOrder[FFXM_MAX_NUM_CONST_BUFFERS];
+        FfxmUInt32              dynamicOffsetCounts[MAX_DESCRIPTOR_SETS];
+
+        // Templates reading the descriptor data of a job, null for the sets holding only immutable samplers
+        VkDescriptorUpdateTemplate  descriptorUpdateTemplates[MAX_DESCRIPTOR_SETS];
+        bool                    useDescriptorUpdateTemplates;
+        FfxmInt32               pushDescriptorSet;      // the set written with push descriptors, -1 if none
+
         // Only used by graphics pipeline
         VkShaderModule          fragShaderModule;
         VkShaderModule          vertShaderModule;
 
-        RenderPass_VK           renderPass[MAX_RENDER_PASS_COUNT];
-        FfxmUInt32                renderPassIndex;
+        // Objects depending on the bound render targets, the current ones are those of the last fragment job
+        RenderPassCache_VK      renderPasses;
+        VkRenderPass            currentRenderPass;
 
-        ImageView_VK            imageView[MAX_IMAGE_VIEW_COUNT];
-        FfxmUInt32                imageViewIndex;
+        ImageViewCache_VK       imageViews;
 
-        FrameBuffer_VK          frameBuffer[MAX_FRAME_BUFFER_COUNT];
-        FfxmUInt32                frameBufferIndex;
+        FrameBufferCache_VK     frameBuffers;
+        VkFramebuffer           currentFrameBuffer;
 
-        GraphicPipeline_VK      graphicsPipeline[MAX_GRAPHICS_PIPELINE_COUNT];
-        FfxmUInt32                graphicsPipelineIndex;
+        GraphicPipelineCache_VK graphicsPipelines;
+        VkPipeline              currentGraphicsPipeline;
 
         wchar_t                 name[64];
         FfxmUInt32               effectContextId;
+        FfxmUInt32              pass;                   // the pass of the effect the GPU time of the jobs is accumulated to
+
+        // Resolved from the name at creation, only used by graphics pipeline
+        bool                    isEndOfUpscaler;
     } PipelineLayout;
 
     typedef struct VKFunctionTable
@@ -172,6 +209,10 @@ typedef struct BackendContext_VK {
         PFN_vkCreatePipelineLayout          vkCreatePipelineLayout = 0;
         PFN_vkCreateComputePipelines        vkCreateComputePipelines = 0;
         PFN_vkCreateGraphicsPipelines       vkCreateGraphicsPipelines = 0;
+        PFN_vkCreatePipelineCache           vkCreatePipelineCache = 0;
+        PFN_vkDestroyPipelineCache          vkDestroyPipelineCache = 0;
+        PFN_vkGetPipelineCacheData          vkGetPipelineCacheData = 0;
+        PFN_vkMergePipelineCaches           vkMergePipelineCaches = 0;
         PFN_vkCreateRenderPass              vkCreateRenderPass = 0;
         PFN_vkCreateFramebuffer             vkCreateFramebuffer = 0;
         PFN_vkDestroyPipelineLayout         vkDestroyPipelineLayout = 0;
@@ -195,12 +236,17 @@ typedef struct BackendContext_VK {
         PFN_vkBindBufferMemory              vkBindBufferMemory = 0;
         PFN_vkBindImageMemory               vkBindImageMemory = 0;
         PFN_vkUpdateDescriptorSets          vkUpdateDescriptorSets = 0;
+        PFN_vkCreateDescriptorUpdateTemplate    vkCreateDescriptorUpdateTemplate = 0;
+        PFN_vkDestroyDescriptorUpdateTemplate   vkDestroyDescriptorUpdateTemplate = 0;
+        PFN_vkUpdateDescriptorSetWithTemplate   vkUpdateDescriptorSetWithTemplate = 0;
+        PFN_vkCmdPushDescriptorSetWithTemplateKHR   vkCmdPushDescriptorSetWithTemplateKHR = 0;
         PFN_vkFlushMappedMemoryRanges       vkFlushMappedMemoryRanges = 0;
         PFN_vkCmdPipelineBarrier            vkCmdPipelineBarrier = 0;
         PFN_vkCmdBindPipeline               vkCmdBindPipeline = 0;
         PFN_vkCmdBindDescriptorSets         vkCmdBindDescriptorSets = 0;
         PFN_vkCmdDispatch                   vkCmdDispatch = 0;
         PFN_vkCmdDispatchIndirect           vkCmdDispatchIndirect = 0;
+        PFN_vkCmdDispatchBase               vkCmdDispatchBase = 0;             // Vulkan 1.1, null on older devices
         PFN_vkCmdCopyBuffer                 vkCmdCopyBuffer = 0;
         PFN_vkCmdCopyImage                  vkCmdCopyImage = 0;
         PFN_vkCmdCopyBufferToImage          vkCmdCopyBufferToImage = 0;
@@ -208,14 +254,29 @@ typedef struct BackendContext_VK {
         PFN_vkCmdFillBuffer                 vkCmdFillBuffer = 0;
         PFN_vkCmdBeginRenderPass            vkCmdBeginRenderPass = 0;
         PFN_vkCmdEndRenderPass              vkCmdEndRenderPass = 0;
+        PFN_vkCmdNextSubpass                vkCmdNextSubpass = 0;
+        PFN_vkCreateSemaphore               vkCreateSemaphore = 0;
+        PFN_vkDestroySemaphore              vkDestroySemaphore = 0;
         PFN_vkCmdDraw                       vkCmdDraw = 0;
+        PFN_vkCreateQueryPool               vkCreateQueryPool = 0;
+        PFN_vkDestroyQueryPool              vkDestroyQueryPool = 0;
+        PFN_vkCmdResetQueryPool             vkCmdResetQueryPool = 0;
+        PFN_vkCmdWriteTimestamp             vkCmdWriteTimestamp = 0;
+        PFN_vkGetQueryPoolResults           vkGetQueryPoolResults = 0;
     } VkFunctionTable;
 
     VkDevice                device = nullptr;
     VkPhysicalDevice        physicalDevice = nullptr;
     VkFunctionTable         vkFunctionTable = {};
 
-    FfxmGpuJobDescription*   pGpuJobs;
+    typedef struct GpuJob {
+        FfxmGpuJobDescription   description;
+
+        // Offsets in the uniform ring buffer of the constant buffers of compute and fragment jobs, filled when the job is scheduled
+        FfxmUInt32              constantBufferOffsets[FFXM_MAX_NUM_CONST_BUFFERS];
+    } GpuJob;
+
+    GpuJob*                 pGpuJobs;
     FfxmUInt32                gpuJobCount = 0;
 
     typedef struct VkResourceView {
@@ -223,14 +284,48 @@ typedef struct BackendContext_VK {
     } VkResourceView;
     VkResourceView*         pResourceViews;
 
+    // Persistently mapped uniform buffer holding the constant buffers of the scheduled jobs. It is sub-allocated linearly and
+    // wraps around, so its descriptors never change and the jobs select their data with dynamic offsets
+    VkBuffer                ringBuffer = VK_NULL_HANDLE;
     VkDeviceMemory          ringBufferMemory = nullptr;
     VkMemoryPropertyFlags   ringBufferMemoryProperties = 0;
-    UniformBuffer*          pRingBuffer;
-    FfxmUInt32                ringBufferBase = 0;
+    VkDeviceSize            ringBufferSize = 0;
+    uint8_t*                pRingBufferData = nullptr;
+    VkDeviceSize            ringBufferOffset = 0;           // where the next constant buffer goes
+    VkDeviceSize            ringBufferFlushOffset = 0;      // start of the data not flushed yet, only used on non-coherent memory
+    VkDeviceSize            uniformBufferOffsetAlignment = 0;
+    VkDeviceSize            nonCoherentAtomSize = 0;
+    float                   timestampPeriod = 0.0f;     // nanoseconds per timestamp tick
 
     PipelineLayout*         pPipelineLayouts;
 
+    // usage of the object caches of all pipeline layouts, per object class
+    ObjectCacheCounters     renderPassCounters = {};
+    ObjectCacheCounters     imageViewCounters = {};
+    ObjectCacheCounters     frameBufferCounters = {};
+    ObjectCacheCounters     graphicsPipelineCounters = {};
+
     VkDescriptorPool        descriptorPool;
+    VkPipelineCache         pipelineCache = VK_NULL_HANDLE;
+
+    // device memory shared by the resources of all effect contexts
+    typedef struct MemoryBlock {
+        typedef struct FreeRange {
+            VkDeviceSize        offset;
+            VkDeviceSize        size;
+        } FreeRange;
+
+        VkDeviceMemory          deviceMemory;
+        VkDeviceSize            size;
+        FfxmUInt32              memoryTypeIndex;
+        VkMemoryPropertyFlags   memoryProperties;
+        void*                   pMappedData;
+        bool                    linear;                 // buffers are kept apart from optimal images to honor bufferImageGranularity
+        FfxmUInt32              allocationCount;
+        FreeRange               freeRanges[MAX_MEMORY_BLOCK_RANGES];    // sorted by offset
+        FfxmUInt32              freeRangeCount;
+    } MemoryBlock;
+    MemoryBlock             memoryBlocks[MAX_MEMORY_BLOCKS] = {};
 
     VkImageMemoryBarrier    imageMemoryBarriers[FFXM_MAX_BARRIERS] = {};
     VkBufferMemoryBarrier   bufferMemoryBarriers[FFXM_MAX_BARRIERS] = {};
@@ -239,6 +334,15 @@ typedef struct BackendContext_VK {
     VkPipelineStageFlags    srcStageMask = 0;
     VkPipelineStageFlags    dstStageMask = 0;
 
+    // set while the jobs of the asynchronous compute command list are recorded
+    bool                    recordingAsyncCompute = false;
+
+    // signalled by the asynchronous compute command list of the last execution, VK_NULL_HANDLE if it got no job
+    VkSemaphore             asyncComputeSemaphore = VK_NULL_HANDLE;
+
+    // queue families of the graphics and asynchronous compute command lists, the resources are shared concurrently when they differ
+    uint32_t                queueFamilyIndices[2] = { VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED };
+
     typedef struct alignas(32) EffectContext {
 
         // Resource allocation
@@ -247,13 +351,38 @@ typedef struct BackendContext_VK {
 
         // UAV offsets
         FfxmUInt32              nextStaticResourceView;
-        FfxmUInt32              nextDynamicResourceView[FFXM_MAX_QUEUED_FRAMES];
+
+        // Views of the resources registered by the application, kept across frames. Each entry owns
+        // MAX_VIEWS_PER_DYNAMIC_ENTRY resource views starting from getDynamicResourceViewsStartIndex
+        typedef struct DynamicView {
+            uint64_t            hash;                   // of the image and the view parameters, 0 if the entry is free
+            VkImage             image;
+            FfxmUInt64          lastUsedFrame;
+        } DynamicView;
+        DynamicView             dynamicViews[MAX_DYNAMIC_VIEW_ENTRIES];
 
         // Pipeline layout
 		FfxmUInt32			   nextPipelineLayout;
 
-        // the frame index for the context
-        FfxmUInt32              frameIndex;
+        // the number of frames completed by the context
+        FfxmUInt64              frameCount;
+
+        // Memory shared by aliased resources
+        typedef struct AliasHeap {
+            MemoryAllocation    memory;
+            FfxmInt32           activeResource;         // the resource the memory currently holds, -1 if none
+        } AliasHeap;
+        AliasHeap               aliasHeaps[FFXM_MAX_ALIAS_HEAPS];
+
+        // Timestamps around the jobs of the context, a range of queries per frame in flight and one for the last completed frame
+        VkQueryPool             timestampQueryPool;
+        FfxmUInt64              timestampFrames[TIMESTAMP_FRAME_COUNT];     // one past the frame written to each range, 0 if none
+        FfxmUInt32              timedJobCounts[TIMESTAMP_FRAME_COUNT];
+        FfxmUInt32              timedJobPasses[TIMESTAMP_FRAME_COUNT][MAX_TIMED_JOBS];
+
+        // Order the asynchronous compute command lists before the graphics ones, created on first use
+        VkSemaphore             asyncComputeSemaphores[FFXM_MAX_QUEUED_FRAMES];
+        FfxmUInt32              asyncComputeSemaphoreIndex;
 
         // Usage
         bool                  active;
@@ -267,6 +396,10 @@ typedef struct BackendContext_VK {
     FfxmUInt32               numDeviceExtensions = 0;
     VkExtensionProperties*  extensionProperties = nullptr;
 
+    // descriptor update paths, resolved from the device at creation
+    bool                    descriptorUpdateTemplatesSupported = false;
+    FfxmUInt32              maxPushDescriptors = 0;     // 0 if push descriptors are not supported
+
 } BackendContext_VK;
 
 FFXM_API size_t ffxmGetScratchMemorySizeVK(VkPhysicalDevice physicalDevice, size_t maxContexts)
@@ -277,14 +410,13 @@ FFXM_API size_t ffxmGetScratchMemorySizeVK(VkPhysicalDevice physicalDevice, size
         vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &numExtensions, nullptr);
 
     FfxmUInt32 extensionPropArraySize = sizeof(VkExtensionProperties) * numExtensions;
-    FfxmUInt32 gpuJobDescArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_GPU_JOBS * sizeof(FfxmGpuJobDescription), sizeof(FfxmUInt32));
+    FfxmUInt32 gpuJobDescArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_GPU_JOBS * sizeof(BackendContext_VK::GpuJob), sizeof(FfxmUInt32));
     FfxmUInt32 resourceViewArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_QUEUED_FRAMES * FFXM_MAX_RESOURCE_COUNT * 2 * sizeof(BackendContext_VK::VkResourceView), sizeof(FfxmUInt32));
-    FfxmUInt32 ringBufferArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_RING_BUFFER_SIZE * sizeof(BackendContext_VK::UniformBuffer), sizeof(FfxmUInt32));
     FfxmUInt32 pipelineArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_PASS_COUNT * sizeof(BackendContext_VK::PipelineLayout), sizeof(FfxmUInt32));
     FfxmUInt32 resourceArraySize = FFXM_ALIGN_UP(maxContexts * FFXM_MAX_RESOURCE_COUNT * sizeof(BackendContext_VK::Resource), sizeof(FfxmUInt32));
     FfxmUInt32 contextArraySize = FFXM_ALIGN_UP(maxContexts * sizeof(BackendContext_VK::EffectContext), sizeof(FfxmUInt32));
 
-    return FFXM_ALIGN_UP(sizeof(BackendContext_VK) + extensionPropArraySize + gpuJobDescArraySize + resourceArraySize + ringBufferArraySize +
+    return FFXM_ALIGN_UP(sizeof(BackendContext_VK) + extensionPropArraySize + gpuJobDescArraySize + resourceArraySize +
         pipelineArraySize + resourceArraySize + contextArraySize, sizeof(uint64_t));
 }
 
@@ -300,7 +432,8 @@ FfxmErrorCode ffxmGetInterfaceVK(
     FfxmDevice device,
     void* scratchBuffer,
     size_t scratchBufferSize,
-    size_t maxContexts)
+    size_t maxContexts,
+    const FfxmAllocatorCallbacksVK* allocatorCallbacks)
 {
     FFXM_RETURN_ON_ERROR(
         !s_BackendRefCount,
@@ -308,6 +441,9 @@ FfxmErrorCode ffxmGetInterfaceVK(
     FFXM_RETURN_ON_ERROR(
         backendInterface,
         FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        !allocatorCallbacks || (allocatorCallbacks->fpAllocateMemory && allocatorCallbacks->fpFreeMemory),
+        FFXM_ERROR_INVALID_ARGUMENT);
     FFXM_RETURN_ON_ERROR(
         scratchBuffer,
         FFXM_ERROR_INVALID_POINTER);
@@ -320,6 +456,7 @@ FfxmErrorCode ffxmGetInterfaceVK(
     backendInterface->fpGetDeviceCapabilities = GetDeviceCapabilitiesVK;
     backendInterface->fpDestroyBackendContext = DestroyBackendContextVK;
     backendInterface->fpCreateResource = CreateResourceVK;
+    backendInterface->fpCreateAliasedResources = CreateAliasedResourcesVK;
     backendInterface->fpDestroyResource = DestroyResourceVK;
     backendInterface->fpRegisterResource = RegisterResourceVK;
     backendInterface->fpGetResource = GetResourceVK;
@@ -327,9 +464,14 @@ FfxmErrorCode ffxmGetInterfaceVK(
     backendInterface->fpGetResourceDescription = GetResourceDescriptionVK;
     backendInterface->fpCreateComputePipeline = CreateComputePipelineVK;
     backendInterface->fpCreateGraphicsPipeline = CreateGraphicsPipelineVK;
+    backendInterface->fpPrewarmGraphicsPipeline = PrewarmGraphicsPipelineVK;
     backendInterface->fpDestroyPipeline = DestroyPipelineVK;
     backendInterface->fpScheduleGpuJob = ScheduleGpuJobVK;
     backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsVK;
+    backendInterface->fpExecuteGpuJobsAsync = ExecuteGpuJobsAsyncVK;
+    backendInterface->fpEnableGpuTimings = EnableGpuTimingsVK;
+    backendInterface->fpGetGpuTimings = GetGpuTimingsVK;
+    backendInterface->fpReadResource = nullptr;
 
     // Memory assignments
     backendInterface->scratchBuffer = scratchBuffer;
@@ -341,6 +483,14 @@ FfxmErrorCode ffxmGetInterfaceVK(
     // Assign the max number of contexts we'll be using
     s_MaxEffectContexts = static_cast<FfxmUInt32>(maxContexts);
 
+    // The queue families can be set between here and the creation of the first context
+    BackendContext_VK* backendContext = (BackendContext_VK*)scratchBuffer;
+    backendContext->queueFamilyIndices[0] = VK_QUEUE_FAMILY_IGNORED;
+    backendContext->queueFamilyIndices[1] = VK_QUEUE_FAMILY_IGNORED;
+
+    // No allocator callbacks means the backend sub-allocates its memory itself
+    s_AllocatorCallbacks = allocatorCallbacks ? *allocatorCallbacks : FfxmAllocatorCallbacksVK{};
+
     return FFXM_OK;
 }
 
@@ -624,6 +774,22 @@ VkFormat ffxmGetVKUAVFormatFromSurfaceFormat(FfxmSurfaceFormat fmt)
     }
 }
 
+// Resources used by both queues are concurrent rather than transferred between the queue families
+template<typename CreateInfo>
+static void setVKSharingMode(const BackendContext_VK* backendContext, CreateInfo& createInfo)
+{
+    if (backendContext->queueFamilyIndices[0] != backendContext->queueFamilyIndices[1])
+    {
+        createInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        createInfo.queueFamilyIndexCount = 2;
+        createInfo.pQueueFamilyIndices = backendContext->queueFamilyIndices;
+    }
+    else
+    {
+        createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    }
+}
+
 VkImageUsageFlags getVKImageUsageFlagsFromResourceUsage(FfxmResourceUsage flags)
 {
     VkImageUsageFlags ret = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
@@ -632,32 +798,225 @@ VkImageUsageFlags getVKImageUsageFlagsFromResourceUsage(FfxmResourceUsage flags)
     return ret;
 }
 
-FfxmErrorCode allocateDeviceMemory(BackendContext_VK* backendContext, VkMemoryRequirements memRequirements, VkMemoryPropertyFlags requiredMemoryProperties, BackendContext_VK::Resource* backendResource)
+// carve a range out of the free ranges of a memory block
+bool subAllocateFromMemoryBlock(BackendContext_VK::MemoryBlock& memoryBlock, const VkMemoryRequirements& memRequirements, VkDeviceSize& outOffset)
+{
+    // free ranges are separated by allocations, so the range array can't overflow while allocations are capped
+    if (memoryBlock.allocationCount + 1 >= MAX_MEMORY_BLOCK_RANGES)
+        return false;
+
+    for (FfxmUInt32 rangeIndex = 0; rangeIndex < memoryBlock.freeRangeCount; ++rangeIndex)
+    {
+        const BackendContext_VK::MemoryBlock::FreeRange range = memoryBlock.freeRanges[rangeIndex];
+        const VkDeviceSize offset = FFXM_ALIGN_UP(range.offset, memRequirements.alignment);
+        if (offset + memRequirements.size > range.offset + range.size)
+            continue;
+
+        // the alignment padding and the remainder stay free
+        const BackendContext_VK::MemoryBlock::FreeRange padding = { range.offset, offset - range.offset };
+        const BackendContext_VK::MemoryBlock::FreeRange remainder = { offset + memRequirements.size, range.offset + range.size - offset - memRequirements.size };
+        if (padding.size && remainder.size)
+        {
+            memmove(&memoryBlock.freeRanges[rangeIndex + 2], &memoryBlock.freeRanges[rangeIndex + 1], (memoryBlock.freeRangeCount - rangeIndex - 1) * sizeof(BackendContext_VK::MemoryBlock::FreeRange));
+            memoryBlock.freeRanges[rangeIndex] = padding;
+            memoryBlock.freeRanges[rangeIndex + 1] = remainder;
+            ++memoryBlock.freeRangeCount;
+        }
+        else if (padding.size || remainder.size)
+        {
+            memoryBlock.freeRanges[rangeIndex] = padding.size ? padding : remainder;
+        }
+        else
+        {
+            memmove(&memoryBlock.freeRanges[rangeIndex], &memoryBlock.freeRanges[rangeIndex + 1], (memoryBlock.freeRangeCount - rangeIndex - 1) * sizeof(BackendContext_VK::MemoryBlock::FreeRange));
+            --memoryBlock.freeRangeCount;
+        }
+
+        ++memoryBlock.allocationCount;
+        outOffset = offset;
+        return true;
+    }
+
+    return false;
+}
+
+// return a range to a memory block, merging it with its free neighbors
+void releaseToMemoryBlock(BackendContext_VK::MemoryBlock& memoryBlock, VkDeviceSize offset, VkDeviceSize size)
+{
+    FfxmUInt32 rangeIndex = 0;
+    while (rangeIndex < memoryBlock.freeRangeCount && memoryBlock.freeRanges[rangeIndex].offset < offset)
+        ++rangeIndex;
+
+    BackendContext_VK::MemoryBlock::FreeRange* previous = rangeIndex > 0 ? &memoryBlock.freeRanges[rangeIndex - 1] : nullptr;
+    BackendContext_VK::MemoryBlock::FreeRange* next = rangeIndex < memoryBlock.freeRangeCount ? &memoryBlock.freeRanges[rangeIndex] : nullptr;
+    const bool mergePrevious = previous && previous->offset + previous->size == offset;
+    const bool mergeNext = next && offset + size == next->offset;
+
+    if (mergePrevious && mergeNext)
+    {
+        previous->size += size + next->size;
+        memmove(&memoryBlock.freeRanges[rangeIndex], &memoryBlock.freeRanges[rangeIndex + 1], (memoryBlock.freeRangeCount - rangeIndex - 1) * sizeof(BackendContext_VK::MemoryBlock::FreeRange));
+        --memoryBlock.freeRangeCount;
+    }
+    else if (mergePrevious)
+    {
+        previous->size += size;
+    }
+    else if (mergeNext)
+    {
+        next->offset = offset;
+        next->size += size;
+    }
+    else
+    {
+        FFXM_ASSERT(memoryBlock.freeRangeCount < MAX_MEMORY_BLOCK_RANGES);
+        memmove(&memoryBlock.freeRanges[rangeIndex + 1], &memoryBlock.freeRanges[rangeIndex], (memoryBlock.freeRangeCount - rangeIndex) * sizeof(BackendContext_VK::MemoryBlock::FreeRange));
+        memoryBlock.freeRanges[rangeIndex] = { offset, size };
+        ++memoryBlock.freeRangeCount;
+    }
+
+    --memoryBlock.allocationCount;
+}
+
+FfxmErrorCode allocateDeviceMemory(BackendContext_VK* backendContext, VkMemoryRequirements memRequirements, VkMemoryPropertyFlags requiredMemoryProperties, bool linear, BackendContext_VK::MemoryAllocation* outAllocation)
 {
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = findMemoryTypeIndex(backendContext->physicalDevice, memRequirements, requiredMemoryProperties, backendResource->memoryProperties);
+    *outAllocation = {};
+    outAllocation->size = memRequirements.size;
+    outAllocation->memoryBlockIndex = -1;
+
+    // hand the allocation over to the application if it provided an allocator
+    if (s_AllocatorCallbacks.fpAllocateMemory)
+    {
+        FfxmAllocationVK allocation = {};
+        FfxmErrorCode errorCode = s_AllocatorCallbacks.fpAllocateMemory(s_AllocatorCallbacks.pUserData, &memRequirements, requiredMemoryProperties, &allocation);
+        FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+        FFXM_RETURN_ON_ERROR(
+            allocation.deviceMemory != VK_NULL_HANDLE && (allocation.pMappedData || !(requiredMemoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)),
+            FFXM_ERROR_BACKEND_API_ERROR);
+
+        outAllocation->deviceMemory = allocation.deviceMemory;
+        outAllocation->offset = allocation.offset;
+        outAllocation->memoryProperties = allocation.memoryProperties;
+        outAllocation->pMappedData = allocation.pMappedData;
+        outAllocation->pUserAllocation = allocation.pUserAllocation;
+        return FFXM_OK;
+    }
+
+    VkMemoryPropertyFlags memoryProperties = 0;
+    const FfxmUInt32 memoryTypeIndex = findMemoryTypeIndex(backendContext->physicalDevice, memRequirements, requiredMemoryProperties, memoryProperties);
 
-    if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+    if (memoryTypeIndex == UINT32_MAX) {
         return FFXM_ERROR_BACKEND_API_ERROR;
     }
 
-    VkResult result = backendContext->vkFunctionTable.vkAllocateMemory(backendContext->device, &allocInfo, nullptr, &backendResource->deviceMemory);
+    // look for room in the blocks of the memory type first
+    FfxmInt32 memoryBlockIndex = -1;
+    FfxmInt32 unusedMemoryBlockIndex = -1;
+    VkDeviceSize offset = 0;
+    for (FfxmInt32 blockIndex = 0; blockIndex < MAX_MEMORY_BLOCKS && memoryBlockIndex < 0; ++blockIndex)
+    {
+        BackendContext_VK::MemoryBlock& memoryBlock = backendContext->memoryBlocks[blockIndex];
+        if (memoryBlock.deviceMemory == VK_NULL_HANDLE)
+        {
+            if (unusedMemoryBlockIndex < 0)
+                unusedMemoryBlockIndex = blockIndex;
+        }
+        else if (memoryBlock.memoryTypeIndex == memoryTypeIndex && memoryBlock.linear == linear && subAllocateFromMemoryBlock(memoryBlock, memRequirements, offset))
+        {
+            memoryBlockIndex = blockIndex;
+        }
+    }
 
-    if (result != VK_SUCCESS) {
-        switch (result) {
-        case(VK_ERROR_OUT_OF_HOST_MEMORY):
-        case(VK_ERROR_OUT_OF_DEVICE_MEMORY):
-            return FFXM_ERROR_OUT_OF_MEMORY;
-        default:
+    // otherwise start a new block, resources larger than a block get a block of their own
+    if (memoryBlockIndex < 0)
+    {
+        FFXM_RETURN_ON_ERROR(unusedMemoryBlockIndex >= 0, FFXM_ERROR_OUT_OF_MEMORY);
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = FFXM_MAXIMUM(VkDeviceSize(MEMORY_BLOCK_SIZE), memRequirements.size);
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+        BackendContext_VK::MemoryBlock& memoryBlock = backendContext->memoryBlocks[unusedMemoryBlockIndex];
+        VkResult result = backendContext->vkFunctionTable.vkAllocateMemory(backendContext->device, &allocInfo, nullptr, &memoryBlock.deviceMemory);
+
+        if (result != VK_SUCCESS) {
+            memoryBlock.deviceMemory = VK_NULL_HANDLE;
+            switch (result) {
+            case(VK_ERROR_OUT_OF_HOST_MEMORY):
+            case(VK_ERROR_OUT_OF_DEVICE_MEMORY):
+                return FFXM_ERROR_OUT_OF_MEMORY;
+            default:
+                return FFXM_ERROR_BACKEND_API_ERROR;
+            }
+        }
+
+        memoryBlock.size = allocInfo.allocationSize;
+        memoryBlock.memoryTypeIndex = memoryTypeIndex;
+        memoryBlock.memoryProperties = memoryProperties;
+        memoryBlock.pMappedData = nullptr;
+        memoryBlock.linear = linear;
+        memoryBlock.allocationCount = 0;
+        memoryBlock.freeRanges[0] = { 0, memoryBlock.size };
+        memoryBlock.freeRangeCount = 1;
+
+        const bool allocated = subAllocateFromMemoryBlock(memoryBlock, memRequirements, offset);
+        FFXM_ASSERT(allocated);
+        (void)allocated;
+        memoryBlockIndex = unusedMemoryBlockIndex;
+    }
+
+    // host visible blocks get mapped once, on the first allocation which needs it
+    BackendContext_VK::MemoryBlock& memoryBlock = backendContext->memoryBlocks[memoryBlockIndex];
+    outAllocation->deviceMemory = memoryBlock.deviceMemory;
+    outAllocation->offset = offset;
+    outAllocation->memoryProperties = memoryBlock.memoryProperties;
+    outAllocation->memoryBlockIndex = memoryBlockIndex;
+
+    if (requiredMemoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+        if (!memoryBlock.pMappedData && backendContext->vkFunctionTable.vkMapMemory(backendContext->device, memoryBlock.deviceMemory, 0, VK_WHOLE_SIZE, 0, &memoryBlock.pMappedData) != VK_SUCCESS) {
+            memoryBlock.pMappedData = nullptr;
             return FFXM_ERROR_BACKEND_API_ERROR;
         }
+
+        outAllocation->pMappedData = static_cast<uint8_t*>(memoryBlock.pMappedData) + offset;
     }
 
     return FFXM_OK;
 }
 
+void freeDeviceMemory(BackendContext_VK* backendContext, BackendContext_VK::MemoryAllocation* allocation)
+{
+    if (allocation->deviceMemory == VK_NULL_HANDLE)
+        return;
+
+    if (allocation->memoryBlockIndex < 0)
+    {
+        FfxmAllocationVK userAllocation = { allocation->deviceMemory, allocation->offset, allocation->memoryProperties, allocation->pMappedData, allocation->pUserAllocation };
+        s_AllocatorCallbacks.fpFreeMemory(s_AllocatorCallbacks.pUserData, &userAllocation);
+    }
+    else
+    {
+        // blocks are released as soon as they become empty
+        BackendContext_VK::MemoryBlock& memoryBlock = backendContext->memoryBlocks[allocation->memoryBlockIndex];
+        releaseToMemoryBlock(memoryBlock, allocation->offset, allocation->size);
+
+        if (!memoryBlock.allocationCount)
+        {
+            if (memoryBlock.pMappedData)
+                backendContext->vkFunctionTable.vkUnmapMemory(backendContext->device, memoryBlock.deviceMemory);
+            backendContext->vkFunctionTable.vkFreeMemory(backendContext->device, memoryBlock.deviceMemory, nullptr);
+            memoryBlock.deviceMemory = VK_NULL_HANDLE;
+            memoryBlock.pMappedData = nullptr;
+            memoryBlock.freeRangeCount = 0;
+        }
+    }
+
+    *allocation = {};
+    allocation->memoryBlockIndex = -1;
+}
+
 void setVKObjectName(BackendContext_VK::VKFunctionTable& vkFunctionTable, VkDevice device, VkObjectType objectType, uint64_t object, char* name)
 {
     VkDebugUtilsObjectNameInfoEXT s{ VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr, objectType, object, name };
@@ -671,25 +1030,75 @@ FfxmUInt32 getDynamicResourcesStartIndex(FfxmUInt32 effectContextId)
     // dynamic resources are tracked from the max index
     return (effectContextId * FFXM_MAX_RESOURCE_COUNT) + FFXM_MAX_RESOURCE_COUNT - 1;
 }
-FfxmUInt32 getDynamicResourceViewsStartIndex(FfxmUInt32 effectContextId, FfxmUInt32 frameIndex)
+FfxmUInt32 getDynamicResourceViewsStartIndex(FfxmUInt32 effectContextId, FfxmUInt32 dynamicViewIndex)
+{
+    // dynamic resource views occupy the top of the view range of the context, static ones grow from the bottom
+    return (effectContextId * MAX_RESOURCE_VIEWS_PER_CONTEXT) + MAX_RESOURCE_VIEWS_PER_CONTEXT
+        - (MAX_DYNAMIC_VIEW_ENTRIES - dynamicViewIndex) * MAX_VIEWS_PER_DYNAMIC_ENTRY;
+}
+
+void destroyDynamicViews(BackendContext_VK* backendContext, FfxmUInt32 effectContextId, FfxmUInt32 dynamicViewIndex)
 {
-    // dynamic resource views are tracked from the max index
-    return (effectContextId * FFXM_MAX_QUEUED_FRAMES * FFXM_MAX_RESOURCE_COUNT * 2) + (frameIndex * FFXM_MAX_RESOURCE_COUNT * 2) + (FFXM_MAX_RESOURCE_COUNT * 2) - 1;
+    BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    // Release image views of the entry
+    const FfxmUInt32 resourceViewIndexStart = getDynamicResourceViewsStartIndex(effectContextId, dynamicViewIndex);
+    for (FfxmUInt32 resourceViewIndex = resourceViewIndexStart; resourceViewIndex < resourceViewIndexStart + MAX_VIEWS_PER_DYNAMIC_ENTRY; ++resourceViewIndex)
+    {
+        if (backendContext->pResourceViews[resourceViewIndex].imageView != VK_NULL_HANDLE) {
+            backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, backendContext->pResourceViews[resourceViewIndex].imageView, VK_NULL_HANDLE);
+            backendContext->pResourceViews[resourceViewIndex].imageView = VK_NULL_HANDLE;
+        }
+    }
+    effectContext.dynamicViews[dynamicViewIndex] = {};
 }
 
-void destroyDynamicViews(BackendContext_VK* backendContext, FfxmUInt32 effectContextId, FfxmUInt32 frameIndex)
+// Finds the entry holding the views of a registered resource. On a miss, a free entry or the least recently used
+// one which is no longer in flight is recycled, and outCached tells the caller to create the views.
+FfxmErrorCode acquireDynamicViews(BackendContext_VK* backendContext, FfxmUInt32 effectContextId, uint64_t hash, VkImage image, FfxmUInt32* outDynamicViewIndex, bool* outCached)
 {
     BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
 
-    // Release image views for dynamic resources
-    const FfxmUInt32 dynamicResourceViewIndexStart = getDynamicResourceViewsStartIndex(effectContextId, frameIndex);
-    for (FfxmUInt32 dynamicViewIndex = effectContext.nextDynamicResourceView[frameIndex] + 1; dynamicViewIndex <= dynamicResourceViewIndexStart;
-         ++dynamicViewIndex)
+    FfxmInt32 freeIndex = -1;
+    FfxmInt32 lruIndex = -1;
+    for (FfxmUInt32 dynamicViewIndex = 0; dynamicViewIndex < MAX_DYNAMIC_VIEW_ENTRIES; ++dynamicViewIndex)
     {
-        backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, backendContext->pResourceViews[dynamicViewIndex].imageView, VK_NULL_HANDLE);
-        backendContext->pResourceViews[dynamicViewIndex].imageView = VK_NULL_HANDLE;
+        BackendContext_VK::EffectContext::DynamicView& dynamicView = effectContext.dynamicViews[dynamicViewIndex];
+        if (dynamicView.hash == hash)
+        {
+            dynamicView.lastUsedFrame = effectContext.frameCount;
+            *outDynamicViewIndex = dynamicViewIndex;
+            *outCached = true;
+            return FFXM_OK;
+        }
+
+        if (!dynamicView.hash)
+        {
+            if (freeIndex < 0)
+                freeIndex = dynamicViewIndex;
+        }
+        else if (effectContext.frameCount - dynamicView.lastUsedFrame >= FFXM_MAX_QUEUED_FRAMES &&
+                 (lruIndex < 0 || dynamicView.lastUsedFrame < effectContext.dynamicViews[lruIndex].lastUsedFrame))
+        {
+            lruIndex = dynamicViewIndex;
+        }
     }
-    effectContext.nextDynamicResourceView[frameIndex] = dynamicResourceViewIndexStart;
+
+    const FfxmInt32 dynamicViewIndex = (freeIndex >= 0) ? freeIndex : lruIndex;
+    FFXM_ASSERT_MESSAGE(dynamicViewIndex >= 0, "ffxmInterface: Vulkan: All registered resource views are in flight. Please increase MAX_DYNAMIC_VIEW_ENTRIES.");
+    FFXM_RETURN_ON_ERROR(
+        dynamicViewIndex >= 0,
+        FFXM_ERROR_OUT_OF_MEMORY);
+
+    if (effectContext.dynamicViews[dynamicViewIndex].hash)
+        destroyDynamicViews(backendContext, effectContextId, dynamicViewIndex);
+
+    effectContext.dynamicViews[dynamicViewIndex].hash = hash;
+    effectContext.dynamicViews[dynamicViewIndex].image = image;
+    effectContext.dynamicViews[dynamicViewIndex].lastUsedFrame = effectContext.frameCount;
+    *outDynamicViewIndex = dynamicViewIndex;
+    *outCached = false;
+    return FFXM_OK;
 }
 
 VkAccessFlags getVKAccessFlagsFromResourceState(FfxmResourceStates state)
@@ -786,6 +1195,7 @@ void copyResourceState(BackendContext_VK::Resource* backendResource, const FfxmR
     backendResource->currentState = state;
     backendResource->undefined    = false;
     backendResource->dynamic      = true;
+    backendResource->aliasHeapIndex = -1;
 
     // If the internal resource state is undefined, that means we are importing a resource that
     // has not yet been initialized, so tag the resource as undefined so we can transition it accordingly.
@@ -803,6 +1213,22 @@ void addBarrier(BackendContext_VK* backendContext, FfxmResourceInternal* resourc
 
     BackendContext_VK::Resource& ffxmResource = backendContext->pResources[resource->internalIndex];
 
+    // When an aliased resource takes over its memory, wait for the last user of the memory and discard the content
+    FfxmResourceStates srcState = ffxmResource.currentState;
+    if (ffxmResource.aliasHeapIndex >= 0)
+    {
+        BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[resource->internalIndex / FFXM_MAX_RESOURCE_COUNT];
+        BackendContext_VK::EffectContext::AliasHeap& aliasHeap = effectContext.aliasHeaps[ffxmResource.aliasHeapIndex];
+        if (aliasHeap.activeResource != resource->internalIndex)
+        {
+            if (aliasHeap.activeResource >= 0)
+                srcState = backendContext->pResources[aliasHeap.activeResource].currentState;
+
+            aliasHeap.activeResource = resource->internalIndex;
+            ffxmResource.undefined = true;
+        }
+    }
+
     if(ffxmResource.currentState == newState && !ffxmResource.undefined)
     {
         return;
@@ -817,7 +1243,7 @@ void addBarrier(BackendContext_VK* backendContext, FfxmResourceInternal* resourc
 
         barrier->sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
         barrier->pNext = nullptr;
-        barrier->srcAccessMask = getVKAccessFlagsFromResourceState(curState);
+        barrier->srcAccessMask = getVKAccessFlagsFromResourceState(srcState);
         barrier->dstAccessMask = getVKAccessFlagsFromResourceState(newState);
         barrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
@@ -825,7 +1251,7 @@ void addBarrier(BackendContext_VK* backendContext, FfxmResourceInternal* resourc
         barrier->offset = 0;
         barrier->size = VK_WHOLE_SIZE;
 
-        backendContext->srcStageMask |= getVKPipelineStageFlagsFromResourceState(curState);
+        backendContext->srcStageMask |= getVKPipelineStageFlagsFromResourceState(srcState);
         backendContext->dstStageMask |= getVKPipelineStageFlagsFromResourceState(newState);
 
         curState = newState;
@@ -848,7 +1274,7 @@ void addBarrier(BackendContext_VK* backendContext, FfxmResourceInternal* resourc
 
         barrier->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
         barrier->pNext = nullptr;
-        barrier->srcAccessMask = getVKAccessFlagsFromResourceState(curState);
+        barrier->srcAccessMask = getVKAccessFlagsFromResourceState(srcState);
         barrier->dstAccessMask = getVKAccessFlagsFromResourceState(newState);
         barrier->oldLayout = ffxmResource.undefined ? VK_IMAGE_LAYOUT_UNDEFINED : ffxmResource.resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : getVKImageLayoutFromResourceState(curState);
         barrier->newLayout = ffxmResource.resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : getVKImageLayoutFromResourceState(newState);
@@ -857,7 +1283,7 @@ void addBarrier(BackendContext_VK* backendContext, FfxmResourceInternal* resourc
         barrier->image = vkResource;
         barrier->subresourceRange = range;
 
-        backendContext->srcStageMask |= getVKPipelineStageFlagsFromResourceState(curState);
+        backendContext->srcStageMask |= getVKPipelineStageFlagsFromResourceState(srcState);
         backendContext->dstStageMask |= getVKPipelineStageFlagsFromResourceState(newState);
 
         curState = newState;
@@ -876,7 +1302,14 @@ void flushBarriers(BackendContext_VK* backendContext, VkCommandBuffer vkCommandB
 
     if (backendContext->scheduledImageBarrierCount > 0 || backendContext->scheduledBufferBarrierCount > 0)
     {
-        backendContext->vkFunctionTable.vkCmdPipelineBarrier(vkCommandBuffer, backendContext->srcStageMask, backendContext->dstStageMask, VK_DEPENDENCY_BY_REGION_BIT, 0, nullptr, backendContext->scheduledBufferBarrierCount, backendContext->bufferMemoryBarriers, backendContext->scheduledImageBarrierCount, backendContext->imageMemoryBarriers);
+        // A compute queue has no graphics stages, the last graphics use of the resources is then
+        // covered by all the commands the semaphore wait of the command list chains with
+        VkPipelineStageFlags srcStageMask = backendContext->srcStageMask;
+        const VkPipelineStageFlags computeStages = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+        if (backendContext->recordingAsyncCompute && (srcStageMask & ~computeStages) != 0)
+            srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        backendContext->vkFunctionTable.vkCmdPipelineBarrier(vkCommandBuffer, srcStageMask, backendContext->dstStageMask, VK_DEPENDENCY_BY_REGION_BIT, 0, nullptr, backendContext->scheduledBufferBarrierCount, backendContext->bufferMemoryBarriers, backendContext->scheduledImageBarrierCount, backendContext->imageMemoryBarriers);
         backendContext->scheduledImageBarrierCount = 0;
         backendContext->scheduledBufferBarrierCount = 0;
         backendContext->srcStageMask = 0;
@@ -907,20 +1340,22 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
     // Set things up if this is the first invocation
     if (!s_BackendRefCount) {
 
-        // clear out mem prior to initializing
+        // clear out mem prior to initializing, but the queue families set on the interface
+        uint32_t queueFamilyIndices[2];
+        memcpy(queueFamilyIndices, backendContext->queueFamilyIndices, sizeof(queueFamilyIndices));
         memset(backendContext, 0, sizeof(BackendContext_VK));
+        memcpy(backendContext->queueFamilyIndices, queueFamilyIndices, sizeof(queueFamilyIndices));
 
         // Map all of our pointers
-        FfxmUInt32 gpuJobDescArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_GPU_JOBS * sizeof(FfxmGpuJobDescription), sizeof(FfxmUInt32));
+        FfxmUInt32 gpuJobDescArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_GPU_JOBS * sizeof(BackendContext_VK::GpuJob), sizeof(FfxmUInt32));
         FfxmUInt32 resourceViewArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_QUEUED_FRAMES * FFXM_MAX_RESOURCE_COUNT * 2 * sizeof(BackendContext_VK::VkResourceView), sizeof(FfxmUInt32));
-        FfxmUInt32 ringBufferArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_RING_BUFFER_SIZE * sizeof(BackendContext_VK::UniformBuffer), sizeof(FfxmUInt32));
         FfxmUInt32 pipelineArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_PASS_COUNT * sizeof(BackendContext_VK::PipelineLayout), sizeof(FfxmUInt32));
         FfxmUInt32 resourceArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * sizeof(BackendContext_VK::Resource), sizeof(FfxmUInt32));
         FfxmUInt32 contextArraySize = FFXM_ALIGN_UP(s_MaxEffectContexts * sizeof(BackendContext_VK::EffectContext), sizeof(FfxmUInt32));
         uint8_t* pMem = (uint8_t*)((BackendContext_VK*)(backendContext + 1));
 
         // Map gpu job array
-        backendContext->pGpuJobs = (FfxmGpuJobDescription*)pMem;
+        backendContext->pGpuJobs = (BackendContext_VK::GpuJob*)pMem;
         memset(backendContext->pGpuJobs, 0, gpuJobDescArraySize);
         pMem += gpuJobDescArraySize;
 
@@ -929,11 +1364,6 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         memset(backendContext->pResourceViews, 0, resourceViewArraySize);
         pMem += resourceViewArraySize;
 
-        // Map the ring buffer array
-        backendContext->pRingBuffer = (BackendContext_VK::UniformBuffer*)pMem;
-        memset(backendContext->pRingBuffer, 0, ringBufferArraySize);
-        pMem += ringBufferArraySize;
-
         // Map pipeline array
         backendContext->pPipelineLayouts = (BackendContext_VK::PipelineLayout*)pMem;
         memset(backendContext->pPipelineLayouts, 0, pipelineArraySize);
@@ -983,6 +1413,10 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         backendContext->vkFunctionTable.vkCreatePipelineLayout = vkCreatePipelineLayout;
         backendContext->vkFunctionTable.vkCreateComputePipelines = vkCreateComputePipelines;
         backendContext->vkFunctionTable.vkCreateGraphicsPipelines = vkCreateGraphicsPipelines;
+        backendContext->vkFunctionTable.vkCreatePipelineCache = vkCreatePipelineCache;
+        backendContext->vkFunctionTable.vkDestroyPipelineCache = vkDestroyPipelineCache;
+        backendContext->vkFunctionTable.vkGetPipelineCacheData = vkGetPipelineCacheData;
+        backendContext->vkFunctionTable.vkMergePipelineCaches = vkMergePipelineCaches;
         backendContext->vkFunctionTable.vkCreateRenderPass = vkCreateRenderPass;
         backendContext->vkFunctionTable.vkCreateFramebuffer = vkCreateFramebuffer;
         backendContext->vkFunctionTable.vkDestroyPipelineLayout = vkDestroyPipelineLayout;
@@ -1006,11 +1440,16 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         backendContext->vkFunctionTable.vkBindBufferMemory = vkBindBufferMemory;
         backendContext->vkFunctionTable.vkBindImageMemory = vkBindImageMemory;
         backendContext->vkFunctionTable.vkUpdateDescriptorSets = vkUpdateDescriptorSets;
+        backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate = vkCreateDescriptorUpdateTemplate;
+        backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate = vkDestroyDescriptorUpdateTemplate;
+        backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate = vkUpdateDescriptorSetWithTemplate;
+        backendContext->vkFunctionTable.vkCmdPushDescriptorSetWithTemplateKHR = vkCmdPushDescriptorSetWithTemplateKHR;
         backendContext->vkFunctionTable.vkCmdPipelineBarrier = vkCmdPipelineBarrier;
         backendContext->vkFunctionTable.vkCmdBindPipeline = vkCmdBindPipeline;
         backendContext->vkFunctionTable.vkCmdBindDescriptorSets = vkCmdBindDescriptorSets;
         backendContext->vkFunctionTable.vkCmdDispatch = vkCmdDispatch;
         backendContext->vkFunctionTable.vkCmdDispatchIndirect = vkCmdDispatchIndirect;
+        backendContext->vkFunctionTable.vkCmdDispatchBase = vkCmdDispatchBase;
         backendContext->vkFunctionTable.vkCmdCopyBuffer = vkCmdCopyBuffer;
         backendContext->vkFunctionTable.vkCmdCopyImage = vkCmdCopyImage;
         backendContext->vkFunctionTable.vkCmdCopyBufferToImage = vkCmdCopyBufferToImage;
@@ -1018,7 +1457,15 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         backendContext->vkFunctionTable.vkCmdFillBuffer = vkCmdFillBuffer;
         backendContext->vkFunctionTable.vkCmdBeginRenderPass = vkCmdBeginRenderPass;
         backendContext->vkFunctionTable.vkCmdEndRenderPass = vkCmdEndRenderPass;
+        backendContext->vkFunctionTable.vkCmdNextSubpass = vkCmdNextSubpass;
+        backendContext->vkFunctionTable.vkCreateSemaphore = vkCreateSemaphore;
+        backendContext->vkFunctionTable.vkDestroySemaphore = vkDestroySemaphore;
         backendContext->vkFunctionTable.vkCmdDraw = vkCmdDraw;
+        backendContext->vkFunctionTable.vkCreateQueryPool = vkCreateQueryPool;
+        backendContext->vkFunctionTable.vkDestroyQueryPool = vkDestroyQueryPool;
+        backendContext->vkFunctionTable.vkCmdResetQueryPool = vkCmdResetQueryPool;
+        backendContext->vkFunctionTable.vkCmdWriteTimestamp = vkCmdWriteTimestamp;
+        backendContext->vkFunctionTable.vkGetQueryPoolResults = vkGetQueryPoolResults;
 #else
         // load vulkan functions
         backendContext->vkFunctionTable.vkSetDebugUtilsObjectNameEXT = (PFN_vkSetDebugUtilsObjectNameEXT)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkSetDebugUtilsObjectNameEXT");
@@ -1033,6 +1480,10 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         backendContext->vkFunctionTable.vkCreatePipelineLayout = (PFN_vkCreatePipelineLayout)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreatePipelineLayout");
         backendContext->vkFunctionTable.vkCreateComputePipelines = (PFN_vkCreateComputePipelines)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateComputePipelines");
         backendContext->vkFunctionTable.vkCreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateGraphicsPipelines");
+        backendContext->vkFunctionTable.vkCreatePipelineCache = (PFN_vkCreatePipelineCache)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreatePipelineCache");
+        backendContext->vkFunctionTable.vkDestroyPipelineCache = (PFN_vkDestroyPipelineCache)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyPipelineCache");
+        backendContext->vkFunctionTable.vkGetPipelineCacheData = (PFN_vkGetPipelineCacheData)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkGetPipelineCacheData");
+        backendContext->vkFunctionTable.vkMergePipelineCaches = (PFN_vkMergePipelineCaches)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkMergePipelineCaches");
         backendContext->vkFunctionTable.vkCreateRenderPass = (PFN_vkCreateRenderPass)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateRenderPass");
         backendContext->vkFunctionTable.vkCreateFramebuffer = (PFN_vkCreateFramebuffer)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateFramebuffer");
         backendContext->vkFunctionTable.vkDestroyPipelineLayout = (PFN_vkDestroyPipelineLayout)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyPipelineLayout");
@@ -1056,11 +1507,16 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         backendContext->vkFunctionTable.vkBindBufferMemory = (PFN_vkBindBufferMemory)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkBindBufferMemory");
         backendContext->vkFunctionTable.vkBindImageMemory = (PFN_vkBindImageMemory)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkBindImageMemory");
         backendContext->vkFunctionTable.vkUpdateDescriptorSets = (PFN_vkUpdateDescriptorSets)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkUpdateDescriptorSets");
+        backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateDescriptorUpdateTemplate");
+        backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyDescriptorUpdateTemplate");
+        backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkUpdateDescriptorSetWithTemplate");
+        backendContext->vkFunctionTable.vkCmdPushDescriptorSetWithTemplateKHR = (PFN_vkCmdPushDescriptorSetWithTemplateKHR)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdPushDescriptorSetWithTemplateKHR");
         backendContext->vkFunctionTable.vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdPipelineBarrier");
         backendContext->vkFunctionTable.vkCmdBindPipeline = (PFN_vkCmdBindPipeline)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdBindPipeline");
         backendContext->vkFunctionTable.vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdBindDescriptorSets");
         backendContext->vkFunctionTable.vkCmdDispatch = (PFN_vkCmdDispatch)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdDispatch");
         backendContext->vkFunctionTable.vkCmdDispatchIndirect = (PFN_vkCmdDispatchIndirect)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdDispatchIndirect");
+        backendContext->vkFunctionTable.vkCmdDispatchBase = (PFN_vkCmdDispatchBase)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdDispatchBase");
         backendContext->vkFunctionTable.vkCmdCopyBuffer = (PFN_vkCmdCopyBuffer)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdCopyBuffer");
         backendContext->vkFunctionTable.vkCmdCopyImage = (PFN_vkCmdCopyImage)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdCopyImage");
         backendContext->vkFunctionTable.vkCmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdCopyBufferToImage");
@@ -1068,7 +1524,15 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         backendContext->vkFunctionTable.vkCmdFillBuffer = (PFN_vkCmdFillBuffer)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdFillBuffer");
         backendContext->vkFunctionTable.vkCmdBeginRenderPass = (PFN_vkCmdBeginRenderPass)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdBeginRenderPass");
         backendContext->vkFunctionTable.vkCmdEndRenderPass = (PFN_vkCmdEndRenderPass)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdEndRenderPass");
+        backendContext->vkFunctionTable.vkCmdNextSubpass = (PFN_vkCmdNextSubpass)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdNextSubpass");
+        backendContext->vkFunctionTable.vkCreateSemaphore = (PFN_vkCreateSemaphore)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateSemaphore");
+        backendContext->vkFunctionTable.vkDestroySemaphore = (PFN_vkDestroySemaphore)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroySemaphore");
         backendContext->vkFunctionTable.vkCmdDraw = (PFN_vkCmdDraw)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdDraw");
+        backendContext->vkFunctionTable.vkCreateQueryPool = (PFN_vkCreateQueryPool)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateQueryPool");
+        backendContext->vkFunctionTable.vkDestroyQueryPool = (PFN_vkDestroyQueryPool)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyQueryPool");
+        backendContext->vkFunctionTable.vkCmdResetQueryPool = (PFN_vkCmdResetQueryPool)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdResetQueryPool");
+        backendContext->vkFunctionTable.vkCmdWriteTimestamp = (PFN_vkCmdWriteTimestamp)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdWriteTimestamp");
+        backendContext->vkFunctionTable.vkGetQueryPoolResults = (PFN_vkGetQueryPoolResults)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkGetQueryPoolResults");
 #endif // FFXM_VKLOADER_VOLK
 
         // enumerate all the device extensions
@@ -1076,14 +1540,39 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         vkEnumerateDeviceExtensionProperties(backendContext->physicalDevice, nullptr, &backendContext->numDeviceExtensions, nullptr);
         vkEnumerateDeviceExtensionProperties(backendContext->physicalDevice, nullptr, &backendContext->numDeviceExtensions, backendContext->extensionProperties);
 
+        // descriptor update templates are core in Vulkan 1.1, push descriptors need the extension to be enabled on the device
+        backendContext->descriptorUpdateTemplatesSupported = backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate != nullptr &&
+            backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate != nullptr &&
+            backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate != nullptr;
+        backendContext->maxPushDescriptors = 0;
+        if (backendContext->descriptorUpdateTemplatesSupported && backendContext->vkFunctionTable.vkCmdPushDescriptorSetWithTemplateKHR != nullptr)
+        {
+            for (FfxmUInt32 i = 0; i < backendContext->numDeviceExtensions; i++)
+            {
+                if (strcmp(backendContext->extensionProperties[i].extensionName, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) == 0)
+                {
+                    VkPhysicalDevicePushDescriptorPropertiesKHR pushDescriptorProperties = {};
+                    pushDescriptorProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+
+                    VkPhysicalDeviceProperties2 deviceProperties2 = {};
+                    deviceProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+                    deviceProperties2.pNext = &pushDescriptorProperties;
+                    vkGetPhysicalDeviceProperties2(backendContext->physicalDevice, &deviceProperties2);
+
+                    backendContext->maxPushDescriptors = pushDescriptorProperties.maxPushDescriptors;
+                    break;
+                }
+            }
+        }
+
         // create a global descriptor pool to hold all descriptors we'll need
         VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
         VkDescriptorPoolSize poolSizes[] = {
-            { VK_DESCRIPTOR_TYPE_SAMPLER, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * FFXM_MAX_QUEUED_FRAMES },
-            { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * FFXM_MAX_QUEUED_FRAMES },
-            { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * FFXM_MAX_QUEUED_FRAMES },
-            { VK_DESCRIPTOR_TYPE_SAMPLER, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * FFXM_MAX_QUEUED_FRAMES  },
-            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * FFXM_MAX_QUEUED_FRAMES },
+            { VK_DESCRIPTOR_TYPE_SAMPLER, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * MAX_DESCRIPTOR_SET_RING },
+            { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * MAX_DESCRIPTOR_SET_RING },
+            { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * MAX_DESCRIPTOR_SET_RING },
+            { VK_DESCRIPTOR_TYPE_SAMPLER, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * MAX_DESCRIPTOR_SET_RING  },
+            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, s_MaxEffectContexts * FFXM_MAX_RESOURCE_COUNT * FFXM_MAX_PASS_COUNT * MAX_DESCRIPTOR_SET_RING },
         };
 
         descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
@@ -1091,37 +1580,61 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
         descriptorPoolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
         descriptorPoolCreateInfo.poolSizeCount = 5;
         descriptorPoolCreateInfo.pPoolSizes = poolSizes;
-        descriptorPoolCreateInfo.maxSets = s_MaxEffectContexts * FFXM_MAX_PASS_COUNT * FFXM_MAX_QUEUED_FRAMES;
+        descriptorPoolCreateInfo.maxSets = s_MaxEffectContexts * FFXM_MAX_PASS_COUNT * MAX_DESCRIPTOR_SET_RING;
 
         if (backendContext->vkFunctionTable.vkCreateDescriptorPool(backendContext->device, &descriptorPoolCreateInfo, nullptr, &backendContext->descriptorPool) != VK_SUCCESS) {
             return FFXM_ERROR_BACKEND_API_ERROR;
         }
 
-        // allocate ring buffer of uniform buffers
+        // create the pipeline cache shared by all effect contexts, seeded with the application data if any
+        VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+        pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        pipelineCacheCreateInfo.initialDataSize = s_PipelineCacheInitialDataSize;
+        pipelineCacheCreateInfo.pInitialData = s_PipelineCacheInitialData;
+
+        if (backendContext->vkFunctionTable.vkCreatePipelineCache(backendContext->device, &pipelineCacheCreateInfo, nullptr, &backendContext->pipelineCache) != VK_SUCCESS) {
+
+            // data from another driver or device may be refused, start from an empty cache instead
+            pipelineCacheCreateInfo.initialDataSize = 0;
+            pipelineCacheCreateInfo.pInitialData = nullptr;
+            if (backendContext->vkFunctionTable.vkCreatePipelineCache(backendContext->device, &pipelineCacheCreateInfo, nullptr, &backendContext->pipelineCache) != VK_SUCCESS) {
+                return FFXM_ERROR_BACKEND_API_ERROR;
+            }
+        }
+
+        // the data has been copied by the driver
+        s_PipelineCacheInitialData = nullptr;
+        s_PipelineCacheInitialDataSize = 0;
+
+        // allocate the uniform ring buffer
         {
-            for (FfxmUInt32 i = 0; i < FFXM_RING_BUFFER_SIZE * s_MaxEffectContexts; i++)
-            {
-                BackendContext_VK::UniformBuffer& uBuffer = backendContext->pRingBuffer[i];
-                VkBufferCreateInfo bufferInfo = {};
-                bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-                bufferInfo.size = FFXM_BUFFER_SIZE;
-                bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-                bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-                if (backendContext->vkFunctionTable.vkCreateBuffer(backendContext->device, &bufferInfo, NULL, &uBuffer.bufferResource) != VK_SUCCESS) {
-                    return FFXM_ERROR_BACKEND_API_ERROR;
-                }
+            VkPhysicalDeviceProperties deviceProperties = {};
+            vkGetPhysicalDeviceProperties(backendContext->physicalDevice, &deviceProperties);
+            backendContext->uniformBufferOffsetAlignment = deviceProperties.limits.minUniformBufferOffsetAlignment;
+            backendContext->nonCoherentAtomSize = deviceProperties.limits.nonCoherentAtomSize;
+            backendContext->timestampPeriod = deviceProperties.limits.timestampPeriod;
+
+            VkBufferCreateInfo bufferInfo = {};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size = s_MaxEffectContexts * FFXM_RING_BUFFER_MEM_BLOCK_SIZE;
+            bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            setVKSharingMode(backendContext, bufferInfo);
+
+            if (backendContext->vkFunctionTable.vkCreateBuffer(backendContext->device, &bufferInfo, NULL, &backendContext->ringBuffer) != VK_SUCCESS) {
+                return FFXM_ERROR_BACKEND_API_ERROR;
             }
+            backendContext->ringBufferSize = bufferInfo.size;
+            backendContext->ringBufferOffset = 0;
+            backendContext->ringBufferFlushOffset = 0;
 
-            // allocate memory block for all uniform buffers
             VkMemoryRequirements memRequirements = {};
-            backendContext->vkFunctionTable.vkGetBufferMemoryRequirements(backendContext->device, backendContext->pRingBuffer[0].bufferResource, &memRequirements);
+            backendContext->vkFunctionTable.vkGetBufferMemoryRequirements(backendContext->device, backendContext->ringBuffer, &memRequirements);
 
             VkMemoryPropertyFlags requiredMemoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
             VkMemoryAllocateInfo allocInfo{};
             allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-            allocInfo.allocationSize = s_MaxEffectContexts * FFXM_RING_BUFFER_MEM_BLOCK_SIZE;
+            allocInfo.allocationSize = memRequirements.size;
             allocInfo.memoryTypeIndex = findMemoryTypeIndex(backendContext->physicalDevice, memRequirements, requiredMemoryProperties, backendContext->ringBufferMemoryProperties);
 
             if (allocInfo.memoryTypeIndex == UINT32_MAX) {
@@ -1145,27 +1658,13 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
                 }
             }
 
-            // map the memory block
-            uint8_t* pData = nullptr;
-
-            if (backendContext->vkFunctionTable.vkMapMemory(backendContext->device, backendContext->ringBufferMemory, 0, s_MaxEffectContexts * FFXM_RING_BUFFER_MEM_BLOCK_SIZE, 0, reinterpret_cast<void**>(&pData)) != VK_SUCCESS) {
+            // the memory stays mapped for the lifetime of the backend
+            if (backendContext->vkFunctionTable.vkMapMemory(backendContext->device, backendContext->ringBufferMemory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void**>(&backendContext->pRingBufferData)) != VK_SUCCESS) {
                 return FFXM_ERROR_BACKEND_API_ERROR;
             }
 
-            // bind each FFXM_BUFFER_SIZE-byte block to the ubos
-            for (FfxmUInt32 i = 0; i < s_MaxEffectContexts * FFXM_RING_BUFFER_SIZE; i++)
-            {
-                BackendContext_VK::UniformBuffer& uBuffer = backendContext->pRingBuffer[i];
-
-                // get the buffer memory requirements for each buffer object to silence validation errors
-                VkMemoryRequirements memRequirements = {};
-                backendContext->vkFunctionTable.vkGetBufferMemoryRequirements(backendContext->device, uBuffer.bufferResource, &memRequirements);
-
-                uBuffer.pData = pData + FFXM_BUFFER_SIZE * i;
-
-                if (backendContext->vkFunctionTable.vkBindBufferMemory(backendContext->device, uBuffer.bufferResource, backendContext->ringBufferMemory, FFXM_BUFFER_SIZE * i) != VK_SUCCESS) {
-                    return FFXM_ERROR_BACKEND_API_ERROR;
-                }
+            if (backendContext->vkFunctionTable.vkBindBufferMemory(backendContext->device, backendContext->ringBuffer, backendContext->ringBufferMemory, 0) != VK_SUCCESS) {
+                return FFXM_ERROR_BACKEND_API_ERROR;
             }
         }
     }
@@ -1185,13 +1684,10 @@ FfxmErrorCode CreateBackendContextVK(FfxmInterface* backendInterface, FfxmUInt32
             effectContext.active = true;
             effectContext.nextStaticResource = (i * FFXM_MAX_RESOURCE_COUNT);
             effectContext.nextDynamicResource = getDynamicResourcesStartIndex(i);
-            effectContext.nextStaticResourceView = (i * FFXM_MAX_QUEUED_FRAMES * FFXM_MAX_RESOURCE_COUNT * 2);
-            for (FfxmUInt32 frameIndex = 0; frameIndex < FFXM_MAX_QUEUED_FRAMES; ++frameIndex)
-            {
-                effectContext.nextDynamicResourceView[frameIndex] = getDynamicResourceViewsStartIndex(i, frameIndex);
-            }
+            effectContext.nextStaticResourceView = (i * MAX_RESOURCE_VIEWS_PER_CONTEXT);
+            memset(effectContext.dynamicViews, 0, sizeof(effectContext.dynamicViews));
             effectContext.nextPipelineLayout = (i * FFXM_MAX_PASS_COUNT);
-            effectContext.frameIndex = 0;
+            effectContext.frameCount = 0;
             break;
         }
     }
@@ -1209,6 +1705,7 @@ FfxmErrorCode GetDeviceCapabilitiesVK(FfxmInterface* backendInterface, FfxmDevic
     deviceCapabilities->waveLaneCountMax = 32;
     deviceCapabilities->fp16Supported = false;
     deviceCapabilities->raytracingSupported = false;
+    deviceCapabilities->sourcePermutationsSupported = ffxmHasSourcePermutations(FFXM_EFFECT_FSR2);
 
     BackendContext_VK* context = (BackendContext_VK*)backendInterface->scratchBuffer;
 
@@ -1260,6 +1757,21 @@ FfxmErrorCode GetDeviceCapabilitiesVK(FfxmInterface* backendInterface, FfxmDevic
         }
     }
 
+    // report the wave operations of shader model 6.0 when compute shaders have the subgroup arithmetic
+    VkPhysicalDeviceSubgroupProperties subgroupProperties = {};
+    subgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 deviceProperties2 = {};
+    deviceProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    deviceProperties2.pNext = &subgroupProperties;
+    vkGetPhysicalDeviceProperties2(context->physicalDevice, &deviceProperties2);
+
+    if ((subgroupProperties.supportedStages & VK_SHADER_STAGE_COMPUTE_BIT) && (subgroupProperties.supportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT)
+        && subgroupProperties.subgroupSize >= 4)
+    {
+        deviceCapabilities->minimumSupportedShaderModel = FFXM_SHADER_MODEL_6_0;
+    }
+
     return FFXM_OK;
 }
 
@@ -1280,8 +1792,29 @@ FfxmErrorCode DestroyBackendContextVK(FfxmInterface* backendInterface, FfxmUInt3
         }
     }
 
-    for (FfxmUInt32 frameIndex = 0; frameIndex < FFXM_MAX_QUEUED_FRAMES; ++frameIndex)
-        destroyDynamicViews(backendContext, effectContextId, frameIndex);
+    for (FfxmUInt32 dynamicViewIndex = 0; dynamicViewIndex < MAX_DYNAMIC_VIEW_ENTRIES; ++dynamicViewIndex)
+        destroyDynamicViews(backendContext, effectContextId, dynamicViewIndex);
+
+    // Release the memory shared by aliased resources
+    for (FfxmUInt32 heapIndex = 0; heapIndex < FFXM_MAX_ALIAS_HEAPS; ++heapIndex)
+    {
+        BackendContext_VK::EffectContext::AliasHeap& aliasHeap = effectContext.aliasHeaps[heapIndex];
+        freeDeviceMemory(backendContext, &aliasHeap.memory);
+        aliasHeap.activeResource = -1;
+    }
+
+    for (FfxmUInt32 semaphoreIndex = 0; semaphoreIndex < FFXM_MAX_QUEUED_FRAMES; ++semaphoreIndex)
+    {
+        if (effectContext.asyncComputeSemaphores[semaphoreIndex] == backendContext->asyncComputeSemaphore)
+            backendContext->asyncComputeSemaphore = VK_NULL_HANDLE;
+
+        backendContext->vkFunctionTable.vkDestroySemaphore(backendContext->device, effectContext.asyncComputeSemaphores[semaphoreIndex], nullptr);
+        effectContext.asyncComputeSemaphores[semaphoreIndex] = VK_NULL_HANDLE;
+    }
+    effectContext.asyncComputeSemaphoreIndex = 0;
+
+    backendContext->vkFunctionTable.vkDestroyQueryPool(backendContext->device, effectContext.timestampQueryPool, nullptr);
+    effectContext.timestampQueryPool = VK_NULL_HANDLE;
 
     // Free up for use by another context
     effectContext.nextStaticResource = 0;
@@ -1298,17 +1831,18 @@ FfxmErrorCode DestroyBackendContextVK(FfxmInterface* backendInterface, FfxmUInt3
         backendContext->vkFunctionTable.vkDestroyDescriptorPool(backendContext->device, backendContext->descriptorPool, VK_NULL_HANDLE);
         backendContext->descriptorPool = VK_NULL_HANDLE;
 
+        // clean up pipeline cache
+        backendContext->vkFunctionTable.vkDestroyPipelineCache(backendContext->device, backendContext->pipelineCache, VK_NULL_HANDLE);
+        backendContext->pipelineCache = VK_NULL_HANDLE;
+
         // clean up ring buffer & memory
-        for (FfxmUInt32 i = 0; i < s_MaxEffectContexts * FFXM_RING_BUFFER_SIZE; i++) {
-            BackendContext_VK::UniformBuffer& uBuffer = backendContext->pRingBuffer[i];
-            backendContext->vkFunctionTable.vkDestroyBuffer(backendContext->device, uBuffer.bufferResource, VK_NULL_HANDLE);
-            uBuffer.bufferResource = VK_NULL_HANDLE;
-            uBuffer.pData = VK_NULL_HANDLE;
-        }
+        backendContext->vkFunctionTable.vkDestroyBuffer(backendContext->device, backendContext->ringBuffer, VK_NULL_HANDLE);
+        backendContext->ringBuffer = VK_NULL_HANDLE;
 
         backendContext->vkFunctionTable.vkUnmapMemory(backendContext->device, backendContext->ringBufferMemory);
         backendContext->vkFunctionTable.vkFreeMemory(backendContext->device, backendContext->ringBufferMemory, VK_NULL_HANDLE);
         backendContext->ringBufferMemory = VK_NULL_HANDLE;
+        backendContext->pRingBufferData = nullptr;
 
         if (backendContext->device != VK_NULL_HANDLE)
             backendContext->device = VK_NULL_HANDLE;
@@ -1317,12 +1851,54 @@ FfxmErrorCode DestroyBackendContextVK(FfxmInterface* backendInterface, FfxmUInt3
     return FFXM_OK;
 }
 
-// create a internal resource that will stay alive until effect gets shut down
-FfxmErrorCode CreateResourceVK(
+VkImageCreateInfo getVKImageCreateInfo(const BackendContext_VK* backendContext, const FfxmCreateResourceDescription* createResourceDescription, const FfxmResourceDescription& resourceDesc)
+{
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = ffxmGetVKImageTypeFromResourceType(createResourceDescription->resourceDescription.type);
+    imageInfo.extent.width = createResourceDescription->resourceDescription.width;
+    imageInfo.extent.height = createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE1D ? 1 : createResourceDescription->resourceDescription.height;
+    imageInfo.extent.depth = ( createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE3D || createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE_CUBE ) ?
+        createResourceDescription->resourceDescription.depth : 1;
+    imageInfo.mipLevels = resourceDesc.mipCount;
+    imageInfo.arrayLayers = (createResourceDescription->resourceDescription.type ==
+                            FFXM_RESOURCE_TYPE_TEXTURE1D || createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE2D)
+        ? createResourceDescription->resourceDescription.depth : 1;
+    imageInfo.format = ((resourceDesc.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET) != 0) ? VK_FORMAT_D32_SFLOAT : ffxmGetVKSurfaceFormatFromSurfaceFormat(createResourceDescription->resourceDescription.format);
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = getVKImageUsageFlagsFromResourceUsage(resourceDesc.usage);
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    setVKSharingMode(backendContext, imageInfo);
+
+    if ((resourceDesc.usage & FFXM_RESOURCE_USAGE_UAV) != 0 && ffxmIsSurfaceFormatSRGB(createResourceDescription->resourceDescription.format))
+    {
+        imageInfo.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+        imageInfo.format = ffxmGetVKSurfaceFormatFromSurfaceFormat(ffxmGetSurfaceFormatFromGamma(createResourceDescription->resourceDescription.format));
+    }
+
+    return imageInfo;
+}
+
+FfxmResourceDescription getCreatedResourceDescription(const FfxmCreateResourceDescription* createResourceDescription)
+{
+    FfxmResourceDescription resourceDesc = createResourceDescription->resourceDescription;
+
+    if (resourceDesc.mipCount == 0) {
+        resourceDesc.mipCount = (FfxmUInt32)(1 + floor(log2(FFXM_MAXIMUM(FFXM_MAXIMUM(createResourceDescription->resourceDescription.width,
+            createResourceDescription->resourceDescription.height), createResourceDescription->resourceDescription.depth))));
+    }
+
+    return resourceDesc;
+}
+
+// create a resource, either in its own memory or placed at the start of an alias heap
+FfxmErrorCode createResourceVK(
     FfxmInterface* backendInterface,
     const FfxmCreateResourceDescription* createResourceDescription,
     FfxmUInt32 effectContextId,
-    FfxmResourceInternal* outResource)
+    FfxmResourceInternal* outResource,
+    FfxmInt32 aliasHeapIndex)
 {
     FFXM_ASSERT(NULL != backendInterface);
     FFXM_ASSERT(NULL != createResourceDescription);
@@ -1341,18 +1917,16 @@ FfxmErrorCode CreateResourceVK(
         requiredMemoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
     // Setup the resource description
-    FfxmResourceDescription resourceDesc = createResourceDescription->resourceDescription;
-
-    if (resourceDesc.mipCount == 0) {
-        resourceDesc.mipCount = (FfxmUInt32)(1 + floor(log2(FFXM_MAXIMUM(FFXM_MAXIMUM(createResourceDescription->resourceDescription.width,
-            createResourceDescription->resourceDescription.height), createResourceDescription->resourceDescription.depth))));
-    }
+    const FfxmResourceDescription resourceDesc = getCreatedResourceDescription(createResourceDescription);
 
     FFXM_ASSERT(effectContext.nextStaticResource + 1 < effectContext.nextDynamicResource);
     outResource->internalIndex = effectContext.nextStaticResource++;
     BackendContext_VK::Resource* backendResource = &backendContext->pResources[outResource->internalIndex];
     backendResource->undefined = true;  // A flag to make sure the first barrier for this image resource always uses an src layout of undefined
     backendResource->dynamic = false;   // Not a dynamic resource (need to track them separately for image views)
+    backendResource->aliasHeapIndex = aliasHeapIndex;
+    backendResource->memory = {};
+    backendResource->memory.memoryBlockIndex = -1;
     backendResource->resourceDescription = resourceDesc;
 
     const FfxmResourceStates resourceState = (createResourceDescription->initData && (createResourceDescription->heapType != FFXM_HEAP_TYPE_UPLOAD)) ? FFXM_RESOURCE_STATE_COPY_DEST : createResourceDescription->initalState;
@@ -1375,7 +1949,7 @@ FfxmErrorCode CreateResourceVK(
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         bufferInfo.size = createResourceDescription->resourceDescription.width;
         bufferInfo.usage = ffxmGetVKBufferUsageFlagsFromResourceUsage(resourceDesc.usage);
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        setVKSharingMode(backendContext, bufferInfo);
 
         if (createResourceDescription->initData)
             bufferInfo.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
@@ -1391,11 +1965,11 @@ FfxmErrorCode CreateResourceVK(
         backendContext->vkFunctionTable.vkGetBufferMemoryRequirements(backendContext->device, backendResource->bufferResource, &memRequirements);
 
         // allocate the memory
-        FfxmErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, backendResource);
+        FfxmErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, true, &backendResource->memory);
         if (FFXM_OK != errorCode)
             return errorCode;
 
-        if (backendContext->vkFunctionTable.vkBindBufferMemory(backendContext->device, backendResource->bufferResource, backendResource->deviceMemory, 0) != VK_SUCCESS) {
+        if (backendContext->vkFunctionTable.vkBindBufferMemory(backendContext->device, backendResource->bufferResource, backendResource->memory.deviceMemory, backendResource->memory.offset) != VK_SUCCESS) {
             return FFXM_ERROR_BACKEND_API_ERROR;
         }
 
@@ -1403,26 +1977,23 @@ FfxmErrorCode CreateResourceVK(
         if (createResourceDescription->heapType == FFXM_HEAP_TYPE_UPLOAD)
         {
             // only allow copies directly into mapped memory for buffer resources since all texture resources are in optimal tiling
-            void* data = NULL;
-
-            if (backendContext->vkFunctionTable.vkMapMemory(backendContext->device, backendResource->deviceMemory, 0, createResourceDescription->initDataSize, 0, &data) != VK_SUCCESS) {
-                return FFXM_ERROR_BACKEND_API_ERROR;
-            }
-
-            memcpy(data, createResourceDescription->initData, createResourceDescription->initDataSize);
+            memcpy(backendResource->memory.pMappedData, createResourceDescription->initData, createResourceDescription->initDataSize);
 
-            // flush mapped range if memory type is not coherant
-            if ((backendResource->memoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
+            // flush mapped range if memory type is not coherant, the range must start on a multiple of nonCoherentAtomSize
+            if ((backendResource->memory.memoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
             {
+                VkPhysicalDeviceProperties deviceProperties = {};
+                vkGetPhysicalDeviceProperties(backendContext->physicalDevice, &deviceProperties);
+
                 VkMappedMemoryRange memoryRange = {};
                 memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-                memoryRange.memory = backendResource->deviceMemory;
-                memoryRange.size = createResourceDescription->initDataSize;
+                memoryRange.memory = backendResource->memory.deviceMemory;
+                memoryRange.offset = backendResource->memory.offset - backendResource->memory.offset % deviceProperties.limits.nonCoherentAtomSize;
+                memoryRange.size = VK_WHOLE_SIZE;
 
                 backendContext->vkFunctionTable.vkFlushMappedMemoryRanges(backendContext->device, 1, &memoryRange);
             }
 
-            backendContext->vkFunctionTable.vkUnmapMemory(backendContext->device, backendResource->deviceMemory);
             return FFXM_OK;
         }
 
@@ -1433,30 +2004,7 @@ FfxmErrorCode CreateResourceVK(
     case FFXM_RESOURCE_TYPE_TEXTURE_CUBE:
     case FFXM_RESOURCE_TYPE_TEXTURE3D:
     {
-        VkImageCreateInfo imageInfo = {};
-        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        imageInfo.imageType = ffxmGetVKImageTypeFromResourceType(createResourceDescription->resourceDescription.type);
-        imageInfo.extent.width = createResourceDescription->resourceDescription.width;
-        imageInfo.extent.height = createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE1D ? 1 : createResourceDescription->resourceDescription.height;
-        imageInfo.extent.depth = ( createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE3D || createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE_CUBE ) ?
-            createResourceDescription->resourceDescription.depth : 1;
-        imageInfo.mipLevels = backendResource->resourceDescription.mipCount;
-        imageInfo.arrayLayers = (createResourceDescription->resourceDescription.type ==
-                                FFXM_RESOURCE_TYPE_TEXTURE1D || createResourceDescription->resourceDescription.type == FFXM_RESOURCE_TYPE_TEXTURE2D)
-            ? createResourceDescription->resourceDescription.depth : 1;
-        imageInfo.format = ((resourceDesc.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET) != 0) ? VK_FORMAT_D32_SFLOAT : ffxmGetVKSurfaceFormatFromSurfaceFormat(createResourceDescription->resourceDescription.format);
-        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        imageInfo.usage = getVKImageUsageFlagsFromResourceUsage(resourceDesc.usage);
-        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        if ((resourceDesc.usage & FFXM_RESOURCE_USAGE_UAV) != 0 && ffxmIsSurfaceFormatSRGB(createResourceDescription->resourceDescription.format))
-        {
-            imageInfo.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
-            imageInfo.format = ffxmGetVKSurfaceFormatFromSurfaceFormat(ffxmGetSurfaceFormatFromGamma(createResourceDescription->resourceDescription.format));
-        }
-
+        const VkImageCreateInfo imageInfo = getVKImageCreateInfo(backendContext, createResourceDescription, resourceDesc);
         if (backendContext->vkFunctionTable.vkCreateImage(backendContext->device, &imageInfo, nullptr, &backendResource->imageResource) != VK_SUCCESS) {
             return FFXM_ERROR_BACKEND_API_ERROR;
         }
@@ -1465,14 +2013,25 @@ FfxmErrorCode CreateResourceVK(
         setVKObjectName(backendContext->vkFunctionTable, backendContext->device, VK_OBJECT_TYPE_IMAGE, (uint64_t)backendResource->imageResource, backendResource->resourceName);
 #endif
 
-        backendContext->vkFunctionTable.vkGetImageMemoryRequirements(backendContext->device, backendResource->imageResource, &memRequirements);
+        // aliased resources are bound to the start of their heap, which is sized for the largest of them
+        const BackendContext_VK::MemoryAllocation* imageMemory = nullptr;
+        if (aliasHeapIndex >= 0)
+        {
+            imageMemory = &effectContext.aliasHeaps[aliasHeapIndex].memory;
+        }
+        else
+        {
+            backendContext->vkFunctionTable.vkGetImageMemoryRequirements(backendContext->device, backendResource->imageResource, &memRequirements);
+
+            // allocate the memory
+            FfxmErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, false, &backendResource->memory);
+            if (FFXM_OK != errorCode)
+                return errorCode;
 
-        // allocate the memory
-        FfxmErrorCode errorCode = allocateDeviceMemory(backendContext, memRequirements, requiredMemoryProperties, backendResource);
-        if (FFXM_OK != errorCode)
-            return errorCode;
+            imageMemory = &backendResource->memory;
+        }
 
-        if (backendContext->vkFunctionTable.vkBindImageMemory(backendContext->device, backendResource->imageResource, backendResource->deviceMemory, 0) != VK_SUCCESS) {
+        if (backendContext->vkFunctionTable.vkBindImageMemory(backendContext->device, backendResource->imageResource, imageMemory->deviceMemory, imageMemory->offset) != VK_SUCCESS) {
             return FFXM_ERROR_BACKEND_API_ERROR;
         }
 
@@ -1493,7 +2052,7 @@ FfxmErrorCode CreateResourceVK(
     case FFXM_RESOURCE_TYPE_TEXTURE_CUBE:
     case FFXM_RESOURCE_TYPE_TEXTURE3D:
     {
-        FFXM_ASSERT_MESSAGE(effectContext.nextStaticResourceView + 1 < effectContext.nextDynamicResourceView[0],
+        FFXM_ASSERT_MESSAGE(effectContext.nextStaticResourceView < getDynamicResourceViewsStartIndex(effectContextId, 0),
             "ffxmInterface: Vulkan: We've run out of resource views. Please increase the size.");
         backendResource->srvViewIndex = effectContext.nextStaticResourceView++;
 
@@ -1549,7 +2108,7 @@ FfxmErrorCode CreateResourceVK(
         if (backendResource->resourceDescription.usage & FFXM_RESOURCE_USAGE_UAV)
         {
             const int32_t uavResourceViewCount = backendResource->resourceDescription.mipCount;
-            FFXM_ASSERT(effectContext.nextStaticResourceView + uavResourceViewCount < effectContext.nextDynamicResourceView[0]);
+            FFXM_ASSERT(effectContext.nextStaticResourceView + uavResourceViewCount <= getDynamicResourceViewsStartIndex(effectContextId, 0));
 
             backendResource->uavViewIndex = effectContext.nextStaticResourceView;
             backendResource->uavViewCount = uavResourceViewCount;
@@ -1607,25 +2166,124 @@ FfxmErrorCode CreateResourceVK(
     return FFXM_OK;
 }
 
-FfxmErrorCode DestroyResourceVK(FfxmInterface* backendInterface, FfxmResourceInternal resource)
+// create a internal resource that will stay alive until effect gets shut down
+FfxmErrorCode CreateResourceVK(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescription,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResource)
 {
-    FFXM_ASSERT(backendInterface != nullptr);
+    return createResourceVK(backendInterface, createResourceDescription, effectContextId, outResource, -1);
+}
+
+// create transient resources, those sharing an alias slot are placed in the same device memory
+FfxmErrorCode CreateAliasedResourcesVK(
+    FfxmInterface* backendInterface,
+    const FfxmCreateResourceDescription* createResourceDescriptions,
+    const FfxmUInt32* aliasSlots,
+    FfxmUInt32 resourceCount,
+    FfxmUInt32 effectContextId,
+    FfxmResourceInternal* outResources,
+    size_t* outSavedMemorySize)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != createResourceDescriptions);
+    FFXM_ASSERT(NULL != aliasSlots);
+    FFXM_ASSERT(NULL != outResources);
+    FFXM_RETURN_ON_ERROR(
+        resourceCount <= FFXM_MAX_RESOURCE_COUNT,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
     BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
 
-     if (resource.internalIndex != -1)
-     {
-         BackendContext_VK::Resource& backgroundResource = backendContext->pResources[resource.internalIndex];
+    // Images created with the same parameters have the same requirements, query them on throwaway images
+    VkMemoryRequirements heapRequirements[FFXM_MAX_ALIAS_HEAPS] = {};
+    FfxmInt32 aliasHeapIndices[FFXM_MAX_RESOURCE_COUNT];
+    VkDeviceSize dedicatedSize = 0;
+    VkDeviceSize aliasedSize = 0;
+    for (FfxmUInt32 resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex)
+    {
+        const FfxmCreateResourceDescription* createResourceDescription = &createResourceDescriptions[resourceIndex];
+        const FfxmUInt32 aliasSlot = aliasSlots[resourceIndex];
+        FFXM_RETURN_ON_ERROR(
+            aliasSlot < FFXM_MAX_ALIAS_HEAPS && !createResourceDescription->initData && createResourceDescription->resourceDescription.type != FFXM_RESOURCE_TYPE_BUFFER,
+            FFXM_ERROR_INVALID_ARGUMENT);
+        FFXM_RETURN_ON_ERROR(
+            effectContext.aliasHeaps[aliasSlot].memory.deviceMemory == VK_NULL_HANDLE,
+            FFXM_ERROR_INVALID_ARGUMENT);
+
+        const VkImageCreateInfo imageInfo = getVKImageCreateInfo(backendContext, createResourceDescription, getCreatedResourceDescription(createResourceDescription));
+        VkImage image = VK_NULL_HANDLE;
+        if (backendContext->vkFunctionTable.vkCreateImage(backendContext->device, &imageInfo, nullptr, &image) != VK_SUCCESS) {
+            return FFXM_ERROR_BACKEND_API_ERROR;
+        }
 
-         if (backgroundResource.resourceDescription.type == FFXM_RESOURCE_TYPE_BUFFER)
-         {
-             // Destroy the resource
-             if (backgroundResource.bufferResource != VK_NULL_HANDLE)
-             {
-                 backendContext->vkFunctionTable.vkDestroyBuffer(backendContext->device, backgroundResource.bufferResource, nullptr);
-                 backgroundResource.bufferResource = VK_NULL_HANDLE;
-             }
-         }
-         else
+        VkMemoryRequirements memRequirements = {};
+        backendContext->vkFunctionTable.vkGetImageMemoryRequirements(backendContext->device, image, &memRequirements);
+        backendContext->vkFunctionTable.vkDestroyImage(backendContext->device, image, nullptr);
+        dedicatedSize += memRequirements.size;
+
+        // A resource which can't live in the same memory type as the rest of its slot gets its own allocation
+        VkMemoryRequirements& heapRequirement = heapRequirements[aliasSlot];
+        const FfxmUInt32 memoryTypeBits = heapRequirement.size ? (heapRequirement.memoryTypeBits & memRequirements.memoryTypeBits) : memRequirements.memoryTypeBits;
+        if (!memoryTypeBits)
+        {
+            aliasHeapIndices[resourceIndex] = -1;
+            aliasedSize += memRequirements.size;
+            continue;
+        }
+
+        heapRequirement.size = FFXM_MAXIMUM(heapRequirement.size, memRequirements.size);
+        heapRequirement.alignment = FFXM_MAXIMUM(heapRequirement.alignment, memRequirements.alignment);
+        heapRequirement.memoryTypeBits = memoryTypeBits;
+        aliasHeapIndices[resourceIndex] = FfxmInt32(aliasSlot);
+    }
+
+    // Allocate the heaps
+    for (FfxmUInt32 heapIndex = 0; heapIndex < FFXM_MAX_ALIAS_HEAPS; ++heapIndex)
+    {
+        if (!heapRequirements[heapIndex].size)
+            continue;
+
+        FfxmErrorCode errorCode = allocateDeviceMemory(backendContext, heapRequirements[heapIndex], VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false, &effectContext.aliasHeaps[heapIndex].memory);
+        FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+
+        effectContext.aliasHeaps[heapIndex].activeResource = -1;
+        aliasedSize += heapRequirements[heapIndex].size;
+    }
+
+    for (FfxmUInt32 resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex)
+    {
+        FfxmErrorCode errorCode = createResourceVK(backendInterface, &createResourceDescriptions[resourceIndex], effectContextId, &outResources[resourceIndex], aliasHeapIndices[resourceIndex]);
+        FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+    }
+
+    if (outSavedMemorySize)
+        *outSavedMemorySize = size_t(dedicatedSize - aliasedSize);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode DestroyResourceVK(FfxmInterface* backendInterface, FfxmResourceInternal resource)
+{
+    FFXM_ASSERT(backendInterface != nullptr);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+
+     if (resource.internalIndex != -1)
+     {
+         BackendContext_VK::Resource& backgroundResource = backendContext->pResources[resource.internalIndex];
+
+         if (backgroundResource.resourceDescription.type == FFXM_RESOURCE_TYPE_BUFFER)
+         {
+             // Destroy the resource
+             if (backgroundResource.bufferResource != VK_NULL_HANDLE)
+             {
+                 backendContext->vkFunctionTable.vkDestroyBuffer(backendContext->device, backgroundResource.bufferResource, nullptr);
+                 backgroundResource.bufferResource = VK_NULL_HANDLE;
+             }
+         }
+         else
          {
              // Destroy SRV
              backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, backendContext->pResourceViews[backgroundResource.srvViewIndex].imageView, nullptr);
@@ -1657,11 +2315,7 @@ FfxmErrorCode DestroyResourceVK(FfxmInterface* backendInterface, FfxmResourceInt
              }
          }
 
-         if (backgroundResource.deviceMemory)
-         {
-             backendContext->vkFunctionTable.vkFreeMemory(backendContext->device, backgroundResource.deviceMemory, nullptr);
-             backgroundResource.deviceMemory = VK_NULL_HANDLE;
-         }
+         freeDeviceMemory(backendContext, &backgroundResource.memory);
      }
 
     return FFXM_OK;
@@ -1685,56 +2339,14 @@ FfxmErrorCode RegisterResourceVK(
     }
 
     // In vulkan we need to treat dynamic resources a little differently due to needing views to live as long as the GPU needs them.
-    // We will treat them more like static resources and use the nextDynamicResource as a "hint" for where it should be.
-    // Failure to find the pre-existing resource at the expected location will force a search until the resource is found.
-    // If it is not found, a new entry will be created
+    // The resource slot is only valid for the frame, while the views are looked up in a cache keyed by the image and view parameters
+    // so that steady state frames reuse them.
     FFXM_ASSERT(effectContext.nextDynamicResource > effectContext.nextStaticResource);
     outFfxmResourceInternal->internalIndex = effectContext.nextDynamicResource--;
 
-    //bool setupDynamicResource = false;
     BackendContext_VK::Resource* backendResource = &backendContext->pResources[outFfxmResourceInternal->internalIndex];
 
-    // Start by seeing if this entry is empty, as that triggers an automatic setup of a new dynamic resource
-    /*if (backendResource->uavViewIndex < 0 && backendResource->srvViewIndex < 0)
-    {
-        setupDynamicResource = true;
-    }
-
-    // If not a new resource, does it match what's current slotted for this dynamic resource
-    if (!setupDynamicResource)
-    {
-        // If this is us, just return as everything is setup as needed
-        if ((backendResource->resourceDescription.type == FFXM_RESOURCE_TYPE_BUFFER && backendResource->bufferResource == (VkBuffer)inFfxmResource->resource) ||
-            (backendResource->resourceDescription.type != FFXM_RESOURCE_TYPE_BUFFER && backendResource->imageResource == (VkImage)inFfxmResource->resource))
-            return FFXM_OK;
-
-        // If this isn't us, search until we either find our entry or an empty resource
-        outFfxmResourceInternal->internalIndex = (effectContextId * FFXM_MAX_RESOURCE_COUNT) + FFXM_MAX_RESOURCE_COUNT - 1;
-        while (!setupDynamicResource)
-        {
-            FFXM_ASSERT(outFfxmResourceInternal->internalIndex > effectContext.nextStaticResource); // Safety check while iterating
-            backendResource = &backendContext->pResources[outFfxmResourceInternal->internalIndex];
-
-            // Is this us?
-            if ((backendResource->resourceDescription.type == FFXM_RESOURCE_TYPE_BUFFER && backendResource->bufferResource == (VkBuffer)inFfxmResource->resource) ||
-                (backendResource->resourceDescription.type != FFXM_RESOURCE_TYPE_BUFFER && backendResource->imageResource == (VkImage)inFfxmResource->resource))
-            {
-                 copyResourceState(backendResource, inFfxmResource);
-                 return FFXM_OK;
-            }
-
-            // Empty?
-            if (backendResource->uavViewIndex == -1 && backendResource->srvViewIndex == -1)
-            {
-                setupDynamicResource = true;
-                break;
-            }
-
-            --outFfxmResourceInternal->internalIndex;
-        }
-    }*/
-
-    // If we got here, we are setting up a new dynamic entry
+    // Set up the dynamic entry
     backendResource->resourceDescription = inFfxmResource->description;
     if (inFfxmResource->description.type == FFXM_RESOURCE_TYPE_BUFFER)
         backendResource->bufferResource = reinterpret_cast<VkBuffer>(inFfxmResource->resource);
@@ -1749,11 +2361,8 @@ FfxmErrorCode RegisterResourceVK(
     if (retval >= 64) backendResource->resourceName[63] = '\0';
 #endif
 
-    // the first call of RegisterResource can be identified because
-
-
     //////////////////////////////////////////////////////////////////////////
-    // Create SRVs and UAVs
+    // Find or create SRVs and UAVs
     switch (backendResource->resourceDescription.type)
     {
     case FFXM_RESOURCE_TYPE_BUFFER:
@@ -1799,14 +2408,36 @@ FfxmErrorCode RegisterResourceVK(
         imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
         imageViewCreateInfo.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
 
-        // create an image view containing all mip levels for use as an srv
-        FFXM_ASSERT(effectContext.nextDynamicResourceView[effectContext.frameIndex] > ((effectContext.frameIndex == 0) ? effectContext.nextStaticResourceView : getDynamicResourceViewsStartIndex(effectContextId, effectContext.frameIndex - 1)));
-        backendResource->srvViewIndex = effectContext.nextDynamicResourceView[effectContext.frameIndex]--;
+        // the views only depend on the image, the view parameters and the usage of the resource
+        uint64_t viewHash = computeHash(&imageViewCreateInfo, sizeof(imageViewCreateInfo));
+        viewHash = appendHash(&backendResource->resourceDescription.usage, sizeof(backendResource->resourceDescription.usage), viewHash);
+        viewHash = viewHash ? viewHash : 1;
+
+        const bool createUAVs = backendResource->resourceDescription.usage & FFXM_RESOURCE_USAGE_UAV;
+        FFXM_ASSERT_MESSAGE(!createUAVs || backendResource->resourceDescription.mipCount < MAX_VIEWS_PER_DYNAMIC_ENTRY,
+            "ffxmInterface: Vulkan: Registered UAV resource has too many mips. Please increase MAX_VIEWS_PER_DYNAMIC_ENTRY.");
+
+        FfxmUInt32 dynamicViewIndex;
+        bool cached;
+        FFXM_VALIDATE(acquireDynamicViews(backendContext, effectContextId, viewHash, backendResource->imageResource, &dynamicViewIndex, &cached));
+
+        // the srv comes first, followed by the uav of each mip
+        backendResource->srvViewIndex = getDynamicResourceViewsStartIndex(effectContextId, dynamicViewIndex);
+        if (createUAVs)
+        {
+            backendResource->uavViewIndex = backendResource->srvViewIndex + 1;
+            backendResource->uavViewCount = backendResource->resourceDescription.mipCount;
+        }
+
+        if (cached)
+            break;
 
+        // create an image view containing all mip levels for use as an srv
         VkImageViewUsageCreateInfo imageViewUsageCreateInfo = {};
         addMutableViewForSRV(imageViewCreateInfo, imageViewUsageCreateInfo, backendResource->resourceDescription);
 
         if (backendContext->vkFunctionTable.vkCreateImageView(backendContext->device, &imageViewCreateInfo, NULL, &backendContext->pResourceViews[backendResource->srvViewIndex].imageView) != VK_SUCCESS) {
+            destroyDynamicViews(backendContext, effectContextId, dynamicViewIndex);
             return FFXM_ERROR_BACKEND_API_ERROR;
         }
 #ifdef _DEBUG
@@ -1814,13 +2445,8 @@ FfxmErrorCode RegisterResourceVK(
 #endif
 
         // create image views of individual mip levels for use as a uav
-        if (backendResource->resourceDescription.usage & FFXM_RESOURCE_USAGE_UAV)
+        if (createUAVs)
         {
-            const int32_t uavResourceViewCount = backendResource->resourceDescription.mipCount;
-            FFXM_ASSERT(effectContext.nextDynamicResourceView[effectContext.frameIndex] - uavResourceViewCount + 1 > ((effectContext.frameIndex == 0) ? effectContext.nextStaticResourceView : getDynamicResourceViewsStartIndex(effectContextId, effectContext.frameIndex - 1)));
-            backendResource->uavViewIndex = effectContext.nextDynamicResourceView[effectContext.frameIndex] - uavResourceViewCount + 1;
-            backendResource->uavViewCount = uavResourceViewCount;
-
             imageViewCreateInfo.format = (backendResource->resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET) ? VK_FORMAT_D32_SFLOAT : ffxmGetVKUAVFormatFromSurfaceFormat(backendResource->resourceDescription.format);
             imageViewCreateInfo.pNext  = nullptr;
 
@@ -1830,13 +2456,13 @@ FfxmErrorCode RegisterResourceVK(
                 imageViewCreateInfo.subresourceRange.baseMipLevel = mip;
 
                 if (backendContext->vkFunctionTable.vkCreateImageView(backendContext->device, &imageViewCreateInfo, NULL, &backendContext->pResourceViews[backendResource->uavViewIndex + mip].imageView) != VK_SUCCESS) {
+                    destroyDynamicViews(backendContext, effectContextId, dynamicViewIndex);
                     return FFXM_ERROR_BACKEND_API_ERROR;
                 }
 #ifdef _DEBUG
                 setVKObjectName(backendContext->vkFunctionTable, backendContext->device, VK_OBJECT_TYPE_IMAGE_VIEW, (uint64_t)backendContext->pResourceViews[backendResource->uavViewIndex + mip].imageView, backendResource->resourceName);
 #endif
             }
-            effectContext.nextDynamicResourceView[effectContext.frameIndex] -= uavResourceViewCount;
         }
         break;
     }
@@ -1895,7 +2521,7 @@ FfxmErrorCode UnregisterResourcesVK(FfxmInterface* backendInterface, FfxmCommand
 
         BackendContext_VK::Resource* backendResource = &backendContext->pResources[resourceIndex];
 
-        // Also clear out their srv/uav indices so they are regenerated each frame
+        // Also clear out their srv/uav indices, the views stay in the cache of the context
         backendResource->uavViewIndex = -1;
         backendResource->srvViewIndex = -1;
 
@@ -1909,14 +2535,12 @@ FfxmErrorCode UnregisterResourcesVK(FfxmInterface* backendInterface, FfxmCommand
     flushBarriers(backendContext, pCmdList);
 
     // Just reset the dynamic resource index, but leave the images views.
-    // They will be deleted in the first pipeline destroy call as they need to live until then
+    // They get recycled once unused for FFXM_MAX_QUEUED_FRAMES frames, or when the context is destroyed
     effectContext.nextDynamicResource = dynamicResourceIndexStart;
 
-    // destroy the views of the next frame
     if (effectContext.isEndOfUpscaler)
     {
-        effectContext.frameIndex = (effectContext.frameIndex + 1) % FFXM_MAX_QUEUED_FRAMES;
-        destroyDynamicViews(backendContext, effectContextId, effectContext.frameIndex);
+        ++effectContext.frameCount;
     }
 
     return FFXM_OK;
@@ -1952,6 +2576,199 @@ VkSamplerAddressMode FfxmGetAddressModeVK(const FfxmAddressMode& addressMode)
     }
 }
 
+// A descriptor of a job, as read by the descriptor update templates of its pipeline
+typedef union DescriptorData
+{
+    VkDescriptorImageInfo   image;
+    VkDescriptorBufferInfo  buffer;
+} DescriptorData;
+
+// Creates the descriptor set layouts of a pipeline and allocates its descriptor sets.
+// When push descriptors are supported, the set holding the most descriptors updated per job is pushed
+// instead, so it is not allocated. Sets holding only immutable samplers and constant buffers never get updated,
+// the latter can't be pushed as they use dynamic offsets.
+static FfxmErrorCode createDescriptorSets(BackendContext_VK* backendContext, BackendContext_VK::PipelineLayout* pPipelineLayout,
+    const VkDescriptorSetLayoutBinding layoutBindings[MAX_DESCRIPTOR_SETS][MAX_DESCRIPTOR_SET_LAYOUTS], const FfxmUInt32* numLayoutBindings, FfxmUInt32& numDescriptorSets)
+{
+    pPipelineLayout->pushDescriptorSet = -1;
+    FfxmUInt32 pushDescriptorCount = 0;
+    for (FfxmUInt32 setIndex = 0; setIndex < MAX_DESCRIPTOR_SETS; ++setIndex)
+    {
+        FfxmUInt32 descriptorCount = 0;
+        FfxmUInt32 updatedDescriptorCount = 0;
+        bool dynamicDescriptors = false;
+        for (FfxmUInt32 bindingIndex = 0; bindingIndex < numLayoutBindings[setIndex]; ++bindingIndex)
+        {
+            const VkDescriptorType descriptorType = layoutBindings[setIndex][bindingIndex].descriptorType;
+            descriptorCount += layoutBindings[setIndex][bindingIndex].descriptorCount;
+            dynamicDescriptors |= descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            if (descriptorType != VK_DESCRIPTOR_TYPE_SAMPLER && descriptorType != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+                updatedDescriptorCount += layoutBindings[setIndex][bindingIndex].descriptorCount;
+        }
+
+        if (!dynamicDescriptors && updatedDescriptorCount > pushDescriptorCount && descriptorCount <= backendContext->maxPushDescriptors)
+        {
+            pPipelineLayout->pushDescriptorSet = setIndex;
+            pushDescriptorCount = updatedDescriptorCount;
+        }
+    }
+
+    numDescriptorSets = 0;
+    VkDescriptorSetLayout allocatedSetLayouts[MAX_DESCRIPTOR_SETS];
+    FfxmUInt32 allocatedSetIndices[MAX_DESCRIPTOR_SETS];
+    FfxmUInt32 allocatedSetCount = 0;
+
+    for (FfxmUInt32 setIndex = 0; setIndex < MAX_DESCRIPTOR_SETS; ++setIndex)
+    {
+        if (numLayoutBindings[setIndex] != 0)
+        {
+            VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+            layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+            layoutInfo.flags = (pPipelineLayout->pushDescriptorSet == FfxmInt32(setIndex)) ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+            layoutInfo.bindingCount = numLayoutBindings[setIndex];
+            layoutInfo.pBindings = layoutBindings[setIndex];
+
+            if (backendContext->vkFunctionTable.vkCreateDescriptorSetLayout(backendContext->device, &layoutInfo, nullptr, &pPipelineLayout->descriptorSetLayout[setIndex]) != VK_SUCCESS) {
+                return FFXM_ERROR_BACKEND_API_ERROR;
+            }
+            numDescriptorSets++;
+
+            if (pPipelineLayout->pushDescriptorSet != FfxmInt32(setIndex))
+            {
+                allocatedSetLayouts[allocatedSetCount] = pPipelineLayout->descriptorSetLayout[setIndex];
+                allocatedSetIndices[allocatedSetCount++] = setIndex;
+            }
+        }
+    }
+
+    // allocate descriptor sets
+    pPipelineLayout->descriptorSetIndex = 0;
+    for (FfxmUInt32 i = 0; i < MAX_DESCRIPTOR_SET_RING && allocatedSetCount; i++)
+    {
+        VkDescriptorSetAllocateInfo allocateInfo = {};
+        allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocateInfo.descriptorPool = backendContext->descriptorPool;
+        allocateInfo.descriptorSetCount = allocatedSetCount;
+        allocateInfo.pSetLayouts = allocatedSetLayouts;
+
+        VkDescriptorSet allocatedSets[MAX_DESCRIPTOR_SETS];
+        if (backendContext->vkFunctionTable.vkAllocateDescriptorSets(backendContext->device, &allocateInfo, allocatedSets) != VK_SUCCESS) {
+            return FFXM_ERROR_BACKEND_API_ERROR;
+        }
+
+        for (FfxmUInt32 allocatedSetIndex = 0; allocatedSetIndex < allocatedSetCount; ++allocatedSetIndex)
+            pPipelineLayout->descriptorSets[i][allocatedSetIndices[allocatedSetIndex]] = allocatedSets[allocatedSetIndex];
+    }
+
+    return FFXM_OK;
+}
+
+// Creates one descriptor update template per descriptor set of a pipeline. The entries follow the order in which
+// executeGpuJobCompute and executeGpuJobFragment gather the descriptors of a job, one DescriptorData per descriptor.
+// Fragment jobs don't bind buffers. Constant buffers are written once by initConstantBufferDescriptors.
+static FfxmErrorCode createDescriptorUpdateTemplates(BackendContext_VK* backendContext, BackendContext_VK::PipelineLayout* pPipelineLayout,
+    const FfxmPipelineState* pipeline, VkPipelineBindPoint bindPoint)
+{
+    pPipelineLayout->useDescriptorUpdateTemplates = false;
+    if (!backendContext->descriptorUpdateTemplatesSupported)
+        return FFXM_OK;
+
+    VkDescriptorUpdateTemplateEntry entries[MAX_DESCRIPTOR_SETS][FFXM_MAX_RESOURCE_COUNT];
+    FfxmUInt32 entryCounts[MAX_DESCRIPTOR_SETS] = { 0 };
+    FfxmUInt32 descriptorIndex = 0;
+
+    auto addEntry = [&](const FfxmResourceBinding& binding, FfxmUInt32 arrayElement, FfxmUInt32 descriptorCount, VkDescriptorType descriptorType) {
+        FFXM_ASSERT(binding.bindSet < MAX_DESCRIPTOR_SETS && descriptorIndex + descriptorCount <= FFXM_MAX_RESOURCE_COUNT);
+        entries[binding.bindSet][entryCounts[binding.bindSet]++] = { binding.slotIndex, arrayElement, descriptorCount, descriptorType,
+            descriptorIndex * sizeof(DescriptorData), sizeof(DescriptorData) };
+        descriptorIndex += descriptorCount;
+    };
+
+    const bool bindBuffers = bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE;
+    for (FfxmUInt32 uavIndex = 0; uavIndex < pipeline->uavTextureCount; ++uavIndex)
+        for (FfxmUInt32 uavEntry = 0; uavEntry < pipeline->uavTextureBindings[uavIndex].bindCount; ++uavEntry)
+            addEntry(pipeline->uavTextureBindings[uavIndex], uavEntry, 1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
+    for (FfxmUInt32 uavIndex = 0; bindBuffers && uavIndex < pipeline->uavBufferCount; ++uavIndex)
+        addEntry(pipeline->uavBufferBindings[uavIndex], 0, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    for (FfxmUInt32 srvIndex = 0; srvIndex < pipeline->srvTextureCount; ++srvIndex)
+        addEntry(pipeline->srvTextureBindings[srvIndex], 0, pipeline->srvTextureBindings[srvIndex].bindCount, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE);
+    for (FfxmUInt32 srvIndex = 0; bindBuffers && srvIndex < pipeline->srvBufferCount; ++srvIndex)
+        addEntry(pipeline->srvBufferBindings[srvIndex], 0, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    for (FfxmUInt32 setIndex = 0; setIndex < pipeline->descriptorSetCount; ++setIndex)
+    {
+        if (entryCounts[setIndex] == 0)
+            continue;
+
+        const bool pushDescriptors = pPipelineLayout->pushDescriptorSet == FfxmInt32(setIndex);
+
+        VkDescriptorUpdateTemplateCreateInfo templateCreateInfo = {};
+        templateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateCreateInfo.descriptorUpdateEntryCount = entryCounts[setIndex];
+        templateCreateInfo.pDescriptorUpdateEntries = entries[setIndex];
+        templateCreateInfo.templateType = pushDescriptors ? VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR : VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateCreateInfo.descriptorSetLayout = pPipelineLayout->descriptorSetLayout[setIndex];
+        templateCreateInfo.pipelineBindPoint = bindPoint;
+        templateCreateInfo.pipelineLayout = pPipelineLayout->pipelineLayout;
+        templateCreateInfo.set = setIndex;
+
+        if (backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate(backendContext->device, &templateCreateInfo, nullptr, &pPipelineLayout->descriptorUpdateTemplates[setIndex]) != VK_SUCCESS) {
+            return FFXM_ERROR_BACKEND_API_ERROR;
+        }
+    }
+
+    pPipelineLayout->useDescriptorUpdateTemplates = true;
+    return FFXM_OK;
+}
+
+// Writes the constant buffer descriptors of a pipeline, they all point to the uniform ring buffer and the jobs
+// select their data with dynamic offsets, so they are written once for all the descriptor sets
+static void initConstantBufferDescriptors(BackendContext_VK* backendContext, BackendContext_VK::PipelineLayout* pPipelineLayout, const FfxmPipelineState* pipeline)
+{
+    // dynamic offsets are consumed in set then binding order
+    for (FfxmUInt32 setIndex = 0; setIndex < MAX_DESCRIPTOR_SETS; ++setIndex)
+        pPipelineLayout->dynamicOffsetCounts[setIndex] = 0;
+    for (FfxmUInt32 cbIndex = 0; cbIndex < pipeline->constCount; ++cbIndex)
+    {
+        const FfxmResourceBinding& binding = pipeline->constantBufferBindings[cbIndex];
+        FFXM_ASSERT_MESSAGE(binding.bindCount == 1, "ffxmInterface: Vulkan: Constant buffer arrays are not supported");
+
+        FfxmUInt32 orderIndex = cbIndex;
+        for (; orderIndex > 0; --orderIndex)
+        {
+            const FfxmResourceBinding& previous = pipeline->constantBufferBindings[pPipelineLayout->dynamicOffsetOrder[orderIndex - 1]];
+            if (previous.bindSet < binding.bindSet || (previous.bindSet == binding.bindSet && previous.slotIndex < binding.slotIndex))
+                break;
+            pPipelineLayout->dynamicOffsetOrder[orderIndex] = pPipelineLayout->dynamicOffsetOrder[orderIndex - 1];
+        }
+        pPipelineLayout->dynamicOffsetOrder[orderIndex] = cbIndex;
+        ++pPipelineLayout->dynamicOffsetCounts[binding.bindSet];
+    }
+
+    const VkDescriptorBufferInfo bufferInfo = { backendContext->ringBuffer, 0, UNIFORM_BUFFER_RANGE };
+    VkWriteDescriptorSet writeDescriptorSets[MAX_DESCRIPTOR_SET_RING * FFXM_MAX_NUM_CONST_BUFFERS];
+    FfxmUInt32 descriptorWriteIndex = 0;
+    for (FfxmUInt32 i = 0; i < MAX_DESCRIPTOR_SET_RING; i++)
+    {
+        for (FfxmUInt32 cbIndex = 0; cbIndex < pipeline->constCount; ++cbIndex, ++descriptorWriteIndex)
+        {
+            FFXM_ASSERT(pPipelineLayout->pushDescriptorSet != FfxmInt32(pipeline->constantBufferBindings[cbIndex].bindSet));
+
+            writeDescriptorSets[descriptorWriteIndex] = {};
+            writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDescriptorSets[descriptorWriteIndex].dstSet = pPipelineLayout->descriptorSets[i][pipeline->constantBufferBindings[cbIndex].bindSet];
+            writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
+            writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            writeDescriptorSets[descriptorWriteIndex].pBufferInfo = &bufferInfo;
+            writeDescriptorSets[descriptorWriteIndex].dstBinding = pipeline->constantBufferBindings[cbIndex].slotIndex;
+            writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+        }
+    }
+
+    if (descriptorWriteIndex)
+        backendContext->vkFunctionTable.vkUpdateDescriptorSets(backendContext->device, descriptorWriteIndex, writeDescriptorSets, 0, nullptr);
+}
+
 FfxmErrorCode CreateComputePipelineVK(FfxmInterface* backendInterface,
     FfxmEffect effect,
     FfxmPass pass,
@@ -1969,7 +2786,7 @@ FfxmErrorCode CreateComputePipelineVK(FfxmInterface* backendInterface,
 
     // start by fetching the shader blob
     FfxmShaderBlob shaderBlob = { };
-    ffxmGetPermutationBlobByIndex(effect, pass, permutationOptions, &shaderBlob);
+    FFXM_VALIDATE(ffxmGetPermutationBlobByIndex(effect, pass, permutationOptions, &shaderBlob));
     FFXM_ASSERT(shaderBlob.data && shaderBlob.size);
 
     //////////////////////////////////////////////////////////////////////////
@@ -2087,42 +2904,13 @@ FfxmErrorCode CreateComputePipelineVK(FfxmInterface* backendInterface,
     for (FfxmUInt32 cbIndex = 0; cbIndex < shaderBlob.cbvCount; ++cbIndex)
     {
         FfxmUInt32 set = shaderBlob.boundConstantBufferSets[cbIndex];
-        layoutBindings[set][numLayoutBindings[set]++] = { shaderBlob.boundConstantBuffers[cbIndex], VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+        layoutBindings[set][numLayoutBindings[set]++] = { shaderBlob.boundConstantBuffers[cbIndex], VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
             shaderBlob.boundConstantBufferCounts[cbIndex], shaderStageFlags, nullptr };
     }
 
-    // Create the descriptor layout
-
+    // Create the descriptor layouts and sets
     FfxmUInt32 numDescriptorSets = 0;
-
-    for (FfxmUInt32 setIndex = 0; setIndex < MAX_DESCRIPTOR_SETS; ++setIndex)
-    {
-        if (numLayoutBindings[setIndex] != 0)
-        {
-            VkDescriptorSetLayoutCreateInfo layoutInfo = {};
-            layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-            layoutInfo.bindingCount = numLayoutBindings[setIndex];
-            layoutInfo.pBindings = layoutBindings[setIndex];
-
-            if (backendContext->vkFunctionTable.vkCreateDescriptorSetLayout(backendContext->device, &layoutInfo, nullptr, &pPipelineLayout->descriptorSetLayout[setIndex]) != VK_SUCCESS) {
-                return FFXM_ERROR_BACKEND_API_ERROR;
-            }
-            numDescriptorSets++;
-        }
-    }
-
-    // allocate descriptor sets
-    pPipelineLayout->descriptorSetIndex = 0;
-    for (FfxmUInt32 i = 0; i < FFXM_MAX_QUEUED_FRAMES; i++)
-    {
-        VkDescriptorSetAllocateInfo allocateInfo = {};
-        allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocateInfo.descriptorPool = backendContext->descriptorPool;
-        allocateInfo.descriptorSetCount = numDescriptorSets;
-        allocateInfo.pSetLayouts = pPipelineLayout->descriptorSetLayout;
-
-        backendContext->vkFunctionTable.vkAllocateDescriptorSets(backendContext->device, &allocateInfo, pPipelineLayout->descriptorSets[i]);
-    }
+    FFXM_RETURN_ON_ERROR(createDescriptorSets(backendContext, pPipelineLayout, layoutBindings, numLayoutBindings, numDescriptorSets) == FFXM_OK, FFXM_ERROR_BACKEND_API_ERROR);
 
     // create the pipeline layout
     VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
@@ -2138,6 +2926,7 @@ FfxmErrorCode CreateComputePipelineVK(FfxmInterface* backendInterface,
 
     wcscpy(pPipelineLayout->name, pipelineDescription->name);
     pPipelineLayout->effectContextId = effectContextId;
+    pPipelineLayout->pass = FfxmUInt32(pass);
 
     // set the root signature to pipeline
     outPipeline->rootSignature = reinterpret_cast<FfxmRootSignature>(pPipelineLayout);
@@ -2204,6 +2993,10 @@ FfxmErrorCode CreateComputePipelineVK(FfxmInterface* backendInterface,
         wcscpy(outPipeline->constantBufferBindings[cbIndex].name, converter.from_bytes(shaderBlob.boundConstantBufferNames[cbIndex]).c_str());
     }
 
+    // the constant buffers are bound with dynamic offsets, the other descriptors of the jobs are written through update templates when available
+    initConstantBufferDescriptors(backendContext, pPipelineLayout, outPipeline);
+    FFXM_RETURN_ON_ERROR(createDescriptorUpdateTemplates(backendContext, pPipelineLayout, outPipeline, VK_PIPELINE_BIND_POINT_COMPUTE) == FFXM_OK, FFXM_ERROR_BACKEND_API_ERROR);
+
     //////////////////////////////////////////////////////////////////////////
     // pipeline creation
     FfxmDeviceCapabilities capabilities;
@@ -2244,8 +3037,12 @@ FfxmErrorCode CreateComputePipelineVK(FfxmInterface* backendInterface,
     pipelineCreateInfo.stage = shaderStageCreateInfo;
     pipelineCreateInfo.layout = pPipelineLayout->pipelineLayout;
 
+    // the thread group rectangles of the compute jobs are dispatched with a base group
+    if (backendContext->vkFunctionTable.vkCmdDispatchBase)
+        pipelineCreateInfo.flags = VK_PIPELINE_CREATE_DISPATCH_BASE_BIT;
+
     VkPipeline computePipeline = VK_NULL_HANDLE;
-    if (backendContext->vkFunctionTable.vkCreateComputePipelines(backendContext->device, nullptr, 1, &pipelineCreateInfo, nullptr, &computePipeline) != VK_SUCCESS) {
+    if (backendContext->vkFunctionTable.vkCreateComputePipelines(backendContext->device, backendContext->pipelineCache, 1, &pipelineCreateInfo, nullptr, &computePipeline) != VK_SUCCESS) {
         return FFXM_ERROR_BACKEND_API_ERROR;
     }
 
@@ -2275,7 +3072,7 @@ FfxmErrorCode CreateGraphicsPipelineVK(FfxmInterface* backendInterface,
 
     // start by fetching the shader blob
     FfxmShaderBlob shaderBlob = { }, vertShaderBlob = { };
-    ffxmGetPermutationBlobByIndex(effect, pass, permutationOptions, &shaderBlob, &vertShaderBlob);
+    FFXM_VALIDATE(ffxmGetPermutationBlobByIndex(effect, pass, permutationOptions, &shaderBlob, &vertShaderBlob));
     FFXM_ASSERT(shaderBlob.data && shaderBlob.size);
     FFXM_ASSERT(vertShaderBlob.data && vertShaderBlob.size);
 
@@ -2395,42 +3192,13 @@ FfxmErrorCode CreateGraphicsPipelineVK(FfxmInterface* backendInterface,
     for (FfxmUInt32 cbIndex = 0; cbIndex < shaderBlob.cbvCount; ++cbIndex)
     {
         FfxmUInt32 set = shaderBlob.boundConstantBufferSets[cbIndex];
-        layoutBindings[set][numLayoutBindings[set]++] = { shaderBlob.boundConstantBuffers[cbIndex], VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+        layoutBindings[set][numLayoutBindings[set]++] = { shaderBlob.boundConstantBuffers[cbIndex], VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
             shaderBlob.boundConstantBufferCounts[cbIndex], shaderStageFlags, nullptr };
     }
 
-    // Create the descriptor layout
-
+    // Create the descriptor layouts and sets
     FfxmUInt32 numDescriptorSets = 0;
-
-    for (FfxmUInt32 setIndex = 0; setIndex < MAX_DESCRIPTOR_SETS; ++setIndex)
-    {
-        if (numLayoutBindings[setIndex] != 0)
-        {
-            VkDescriptorSetLayoutCreateInfo layoutInfo = {};
-            layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-            layoutInfo.bindingCount = numLayoutBindings[setIndex];
-            layoutInfo.pBindings = layoutBindings[setIndex];
-
-            if (backendContext->vkFunctionTable.vkCreateDescriptorSetLayout(backendContext->device, &layoutInfo, nullptr, &pPipelineLayout->descriptorSetLayout[setIndex]) != VK_SUCCESS) {
-                return FFXM_ERROR_BACKEND_API_ERROR;
-            }
-            numDescriptorSets++;
-        }
-    }
-
-    // allocate descriptor sets
-    pPipelineLayout->descriptorSetIndex = 0;
-    for (FfxmUInt32 i = 0; i < FFXM_MAX_QUEUED_FRAMES; i++)
-    {
-        VkDescriptorSetAllocateInfo allocateInfo = {};
-        allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocateInfo.descriptorPool = backendContext->descriptorPool;
-        allocateInfo.descriptorSetCount = numDescriptorSets;
-        allocateInfo.pSetLayouts = pPipelineLayout->descriptorSetLayout;
-
-        backendContext->vkFunctionTable.vkAllocateDescriptorSets(backendContext->device, &allocateInfo, pPipelineLayout->descriptorSets[i]);
-    }
+    FFXM_RETURN_ON_ERROR(createDescriptorSets(backendContext, pPipelineLayout, layoutBindings, numLayoutBindings, numDescriptorSets) == FFXM_OK, FFXM_ERROR_BACKEND_API_ERROR);
 
     // create the pipeline layout
     VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
@@ -2445,7 +3213,9 @@ FfxmErrorCode CreateGraphicsPipelineVK(FfxmInterface* backendInterface,
     }
 
     wcscpy(pPipelineLayout->name, pipelineDescription->name);
+    pPipelineLayout->isEndOfUpscaler = !!wcscmp(pipelineDescription->name, L"FSR2-GEN_REACTIVE");
     pPipelineLayout->effectContextId = effectContextId;
+    pPipelineLayout->pass = FfxmUInt32(pass);
 
     // set the root signature to pipeline
     outPipeline->rootSignature = reinterpret_cast<FfxmRootSignature>(pPipelineLayout);
@@ -2518,6 +3288,10 @@ FfxmErrorCode CreateGraphicsPipelineVK(FfxmInterface* backendInterface,
         wcscpy(outPipeline->constantBufferBindings[cbIndex].name, converter.from_bytes(shaderBlob.boundConstantBufferNames[cbIndex]).c_str());
     }
 
+    // the constant buffers are bound with dynamic offsets, the other descriptors of the jobs are written through update templates when available
+    initConstantBufferDescriptors(backendContext, pPipelineLayout, outPipeline);
+    FFXM_RETURN_ON_ERROR(createDescriptorUpdateTemplates(backendContext, pPipelineLayout, outPipeline, VK_PIPELINE_BIND_POINT_GRAPHICS) == FFXM_OK, FFXM_ERROR_BACKEND_API_ERROR);
+
     //////////////////////////////////////////////////////////////////////////
     // pipeline creation
     FfxmDeviceCapabilities capabilities;
@@ -2546,41 +3320,78 @@ FfxmErrorCode CreateGraphicsPipelineVK(FfxmInterface* backendInterface,
     return FFXM_OK;
 }
 
-template<size_t SIZE, typename T> int8_t findObject(T (&objs)[SIZE], uint64_t hash)
+// returns the cached object matching the hash, or creates it and caches it, destroying the least recently used object if the cache is full
+template<typename T, uint32_t CAPACITY, typename CreateFunc, typename DestroyFunc>
+FfxmErrorCode getOrCreateObject(ObjectCache<T, CAPACITY>& cache, ObjectCacheCounters& counters, uint64_t hash, T& handle, CreateFunc create, DestroyFunc destroy)
 {
-    int8_t idx = -1;
+    if (const T* cachedHandle = cache.find(hash, counters))
+    {
+        handle = *cachedHandle;
+        return FFXM_OK;
+    }
 
-    for (int8_t i = 0; i < SIZE; i++)
+    if (create(&handle) != VK_SUCCESS)
     {
-        objs[i].visitedFlag++;
+        return FFXM_ERROR_BACKEND_API_ERROR;
+    }
 
-        if (objs[i].hash == hash)
-        {
-            objs[i].visitedFlag = 0;
-            idx = i;
-        }
+    T evictedHandle;
+    if (cache.insert(hash, handle, evictedHandle, counters))
+    {
+        destroy(evictedHandle);
     }
 
-    return idx;
+    return FFXM_OK;
 }
 
-template<size_t SIZE, typename T> uint8_t getLRUIndex(T (&objs)[SIZE])
+// returns the view of a render target, cached in the pipeline layout
+static FfxmErrorCode getOrCreateAttachmentView(BackendContext_VK* backendContext, BackendContext_VK::PipelineLayout* pipelineLayout, FfxmUInt32 resourceIndex, VkImageView& imageView)
 {
-    FfxmUInt32 max = 0;
-    uint8_t idx = 0;
+    VkImageViewCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    createInfo.image = backendContext->pResources[resourceIndex].imageResource;
+    createInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    createInfo.format = (backendContext->pResources[resourceIndex].resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET)
+                        ? VK_FORMAT_D32_SFLOAT : ffxmGetVKSurfaceFormatFromSurfaceFormat(backendContext->pResources[resourceIndex].resourceDescription.format);
+    createInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
+    createInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
+    createInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
+    createInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+    createInfo.subresourceRange.aspectMask = (backendContext->pResources[resourceIndex].resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET)
+                                             ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+    createInfo.subresourceRange.baseMipLevel = 0;
+    createInfo.subresourceRange.levelCount = 1;
+    createInfo.subresourceRange.baseArrayLayer = 0;
+    createInfo.subresourceRange.layerCount = 1;
+
+    uint64_t hash = computeHash(&createInfo, sizeof(createInfo));
+
+    return getOrCreateObject(pipelineLayout->imageViews, backendContext->imageViewCounters, hash, imageView,
+        [&](VkImageView* imageView) { return backendContext->vkFunctionTable.vkCreateImageView(backendContext->device, &createInfo, nullptr, imageView); },
+        [&](VkImageView imageView) { backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, imageView, nullptr); });
+}
 
-    for (uint8_t i = 0; i < SIZE; i++)
-    {
-        if (objs[i].visitedFlag > max)
-        {
-            max = objs[i].visitedFlag;
-            idx = i;
-        }
-    }
+// returns the framebuffer of the attachments for the current render pass of the pipeline layout
+static FfxmErrorCode getOrCreateFrameBuffer(BackendContext_VK* backendContext, BackendContext_VK::PipelineLayout* pipelineLayout, const VkImageView* attachments, FfxmUInt32 attachmentCount,
+    FfxmUInt32 width, FfxmUInt32 height)
+{
+    uint64_t hash = computeHash(attachments, attachmentCount*sizeof(attachments[0]));
+
+    VkFramebufferCreateInfo fbufCreateInfo = { } ;
+    fbufCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    fbufCreateInfo.renderPass = pipelineLayout->currentRenderPass;
+    fbufCreateInfo.attachmentCount = attachmentCount;
+    fbufCreateInfo.width = width;
+    fbufCreateInfo.height = height;
+    fbufCreateInfo.layers = 1;
+
+    hash = appendHash(&fbufCreateInfo, sizeof(fbufCreateInfo), hash);
 
-    objs[idx].visitedFlag = 0;
+    fbufCreateInfo.pAttachments = attachments;
 
-    return idx;
+    return getOrCreateObject(pipelineLayout->frameBuffers, backendContext->frameBufferCounters, hash, pipelineLayout->currentFrameBuffer,
+        [&](VkFramebuffer* frameBuffer) { return backendContext->vkFunctionTable.vkCreateFramebuffer(backendContext->device, &fbufCreateInfo, nullptr, frameBuffer); },
+        [&](VkFramebuffer frameBuffer) { backendContext->vkFunctionTable.vkDestroyFramebuffer(backendContext->device, frameBuffer, nullptr); });
 }
 
 FfxmErrorCode getOrCreateFrameBuffer(BackendContext_VK* backendContext, FfxmGpuJobDescription* job)
@@ -2592,113 +3403,28 @@ FfxmErrorCode getOrCreateFrameBuffer(BackendContext_VK* backendContext, FfxmGpuJ
     std::array<VkImageView, FFXM_MAX_NUM_RTS> attachments;
     for(FfxmUInt32 rtIndex = 0; rtIndex < pipeline->rtCount; ++rtIndex)
     {
-        const FfxmUInt32 resourceIndex = job->fragmentJobDescription.rtTextures[rtIndex].internalIndex;
-        VkImageViewCreateInfo createInfo = {};
-        createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-        createInfo.image = backendContext->pResources[resourceIndex].imageResource;
-        createInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        createInfo.format = (backendContext->pResources[resourceIndex].resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET)
-                            ? VK_FORMAT_D32_SFLOAT : ffxmGetVKSurfaceFormatFromSurfaceFormat(backendContext->pResources[resourceIndex].resourceDescription.format);
-        createInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
-        createInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
-        createInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
-        createInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
-        createInfo.subresourceRange.aspectMask = (backendContext->pResources[resourceIndex].resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET)
-                                                 ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
-        createInfo.subresourceRange.baseMipLevel = 0;
-        createInfo.subresourceRange.levelCount = 1;
-        createInfo.subresourceRange.baseArrayLayer = 0;
-        createInfo.subresourceRange.layerCount = 1;
-
-        uint64_t hash = computeHash(&createInfo, sizeof(createInfo));
-
-        int8_t idx = findObject(pipelineLayout->imageView, hash);
-
-        // find image view
-        if (idx != -1)
-        {
-            pipelineLayout->imageViewIndex = idx;
-        }
-        else
-        {
-            // not find, get lru index in the array
-            pipelineLayout->imageViewIndex = getLRUIndex(pipelineLayout->imageView);
-
-            if (pipelineLayout->imageView[pipelineLayout->imageViewIndex].handle != VK_NULL_HANDLE)
-            {
-                backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, pipelineLayout->imageView[pipelineLayout->imageViewIndex].handle, VK_NULL_HANDLE);
-            }
-
-            if (backendContext->vkFunctionTable.vkCreateImageView(backendContext->device, &createInfo, nullptr, &pipelineLayout->imageView[pipelineLayout->imageViewIndex].handle) != VK_SUCCESS)
-            {
-                return FFXM_ERROR_BACKEND_API_ERROR;
-            }
-
-            pipelineLayout->imageView[pipelineLayout->imageViewIndex].hash = hash;
-        }
-
-        attachments[rtIndex] = pipelineLayout->imageView[pipelineLayout->imageViewIndex].handle;
+        FFXM_VALIDATE(getOrCreateAttachmentView(backendContext, pipelineLayout, job->fragmentJobDescription.rtTextures[rtIndex].internalIndex, attachments[rtIndex]));
     }
 
-    uint64_t hash = computeHash(attachments.data(), pipeline->rtCount*sizeof(attachments[0]));
-
-    VkFramebufferCreateInfo fbufCreateInfo = { } ;
-    fbufCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-    fbufCreateInfo.renderPass = pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle;
-    fbufCreateInfo.attachmentCount = pipeline->rtCount;
-    fbufCreateInfo.width = job->fragmentJobDescription.viewport[0];
-    fbufCreateInfo.height = job->fragmentJobDescription.viewport[1];
-    fbufCreateInfo.layers = 1;
-
-    hash = appendHash(&fbufCreateInfo, sizeof(fbufCreateInfo), hash);
+    return getOrCreateFrameBuffer(backendContext, pipelineLayout, attachments.data(), pipeline->rtCount, job->fragmentJobDescription.viewport[0], job->fragmentJobDescription.viewport[1]);
+}
 
-    fbufCreateInfo.pAttachments = attachments.data();
+// render passes only depend on the render target descriptions, which allows building them ahead of the first dispatch
+FfxmErrorCode getOrCreateRenderPass(BackendContext_VK* backendContext, BackendContext_VK::PipelineLayout* pipelineLayout, FfxmPipelineState* pipeline, const FfxmResourceDescription* rtDescriptions,
+    VkAttachmentLoadOp loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE)
+{
+    FFXM_ASSERT(NULL != backendContext);
 
-    int8_t idx = findObject(pipelineLayout->frameBuffer, hash);
+    std::array<VkAttachmentDescription, FFXM_MAX_NUM_RTS> attachmentDescriptions;
+    std::array<VkAttachmentReference, FFXM_MAX_NUM_RTS> colorAttachmentReferences;
 
-    // find frame buffer
-    if (idx != -1)
-    {
-        pipelineLayout->frameBufferIndex = idx;
-    }
-    else
+    for(FfxmUInt32 rtIndex = 0; rtIndex < pipeline->rtCount; ++rtIndex)
     {
-        // not find, get lru index in the array
-        pipelineLayout->frameBufferIndex = getLRUIndex(pipelineLayout->frameBuffer);
-
-        if (pipelineLayout->frameBuffer[pipelineLayout->frameBufferIndex].handle != VK_NULL_HANDLE)
-        {
-            backendContext->vkFunctionTable.vkDestroyFramebuffer(backendContext->device, pipelineLayout->frameBuffer[pipelineLayout->frameBufferIndex].handle, VK_NULL_HANDLE);
-        }
-
-        if (backendContext->vkFunctionTable.vkCreateFramebuffer(backendContext->device, &fbufCreateInfo, nullptr, &pipelineLayout->frameBuffer[pipelineLayout->frameBufferIndex].handle) != VK_SUCCESS)
-        {
-            return FFXM_ERROR_BACKEND_API_ERROR;
-        }
-
-        pipelineLayout->frameBuffer[pipelineLayout->frameBufferIndex].hash = hash;
-    }
-
-    return FFXM_OK;
-}
-
-FfxmErrorCode getOrCreateRenderPass(BackendContext_VK* backendContext, FfxmGpuJobDescription* job)
-{
-    FFXM_ASSERT(NULL != backendContext);
-    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->fragmentJobDescription.pipeline->rootSignature);
-    FfxmPipelineState* pipeline = job->fragmentJobDescription.pipeline;
-
-    std::array<VkAttachmentDescription, FFXM_MAX_NUM_RTS> attachmentDescriptions;
-    std::array<VkAttachmentReference, FFXM_MAX_NUM_RTS> colorAttachmentReferences;
-
-    for(FfxmUInt32 rtIndex = 0; rtIndex < pipeline->rtCount; ++rtIndex)
-    {
-        const FfxmUInt32 resourceIndex = job->fragmentJobDescription.rtTextures[rtIndex].internalIndex;
         VkAttachmentDescription attachmentDescription = { };
-        attachmentDescription.format = (backendContext->pResources[resourceIndex].resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET)
-                                        ? VK_FORMAT_D32_SFLOAT : ffxmGetVKSurfaceFormatFromSurfaceFormat(backendContext->pResources[resourceIndex].resourceDescription.format);
+        attachmentDescription.format = (rtDescriptions[rtIndex].usage & FFXM_RESOURCE_USAGE_DEPTHTARGET)
+                                        ? VK_FORMAT_D32_SFLOAT : ffxmGetVKSurfaceFormatFromSurfaceFormat(rtDescriptions[rtIndex].format);
         attachmentDescription.samples = VK_SAMPLE_COUNT_1_BIT;
-        attachmentDescription.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachmentDescription.loadOp = loadOp;
         attachmentDescription.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
         attachmentDescription.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         attachmentDescription.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
@@ -2732,52 +3458,297 @@ FfxmErrorCode getOrCreateRenderPass(BackendContext_VK* backendContext, FfxmGpuJo
     renderPassCreateInfo.subpassCount = 1;
     renderPassCreateInfo.pSubpasses = &subPassDescription;
 
-    int8_t idx = findObject(pipelineLayout->renderPass, hash);
+    return getOrCreateObject(pipelineLayout->renderPasses, backendContext->renderPassCounters, hash, pipelineLayout->currentRenderPass,
+        [&](VkRenderPass* renderPass) { return backendContext->vkFunctionTable.vkCreateRenderPass(backendContext->device, &renderPassCreateInfo, nullptr, renderPass); },
+        [&](VkRenderPass renderPass) { backendContext->vkFunctionTable.vkDestroyRenderPass(backendContext->device, renderPass, nullptr); });
+}
+
+FfxmErrorCode getOrCreateRenderPass(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, VkAttachmentLoadOp loadOp)
+{
+    FFXM_ASSERT(NULL != backendContext);
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->fragmentJobDescription.pipeline->rootSignature);
+    FfxmPipelineState* pipeline = job->fragmentJobDescription.pipeline;
 
-    // find render pass
-    if (idx != -1)
+    std::array<FfxmResourceDescription, FFXM_MAX_NUM_RTS> rtDescriptions;
+    for(FfxmUInt32 rtIndex = 0; rtIndex < pipeline->rtCount; ++rtIndex)
     {
-        pipelineLayout->renderPassIndex = idx;
+        const FfxmUInt32 resourceIndex = job->fragmentJobDescription.rtTextures[rtIndex].internalIndex;
+        rtDescriptions[rtIndex] = backendContext->pResources[resourceIndex].resourceDescription;
     }
-    else
-    {
-        // not find, get lru index in the array
-        pipelineLayout->renderPassIndex = getLRUIndex(pipelineLayout->renderPass);
 
-        if (pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle != VK_NULL_HANDLE)
+    return getOrCreateRenderPass(backendContext, pipelineLayout, pipeline, rtDescriptions.data(), loadOp);
+}
+
+// The fragment jobs recorded as the subpasses of one render pass, with every resource they use
+typedef struct SubpassGroup_VK {
+    BackendContext_VK::GpuJob*  jobs;
+    FfxmUInt32                  jobCount;
+
+    FfxmUInt32                  resourceCount;
+    FfxmUInt32                  resources[MAX_SUBPASS_GROUP_RESOURCES];
+    FfxmUInt32                  accessMasks[MAX_SUBPASS_GROUP_RESOURCES];   // a bit per subpass using the resource
+    FfxmUInt32                  writeMasks[MAX_SUBPASS_GROUP_RESOURCES];    // a bit per subpass writing the resource
+} SubpassGroup_VK;
+
+template<typename Visitor>
+static void forEachFragmentJobResource(const FfxmFragmentJobDescription& job, Visitor visit)
+{
+    for (FfxmUInt32 srvIndex = 0; srvIndex < job.pipeline->srvTextureCount; ++srvIndex)
+        visit(job.srvTextures[srvIndex].internalIndex, false);
+    for (FfxmUInt32 uavIndex = 0; uavIndex < job.pipeline->uavTextureCount; ++uavIndex)
+        visit(job.uavTextures[uavIndex].internalIndex, true);
+    for (FfxmUInt32 rtIndex = 0; rtIndex < job.pipeline->rtCount; ++rtIndex)
+        visit(job.rtTextures[rtIndex].internalIndex, true);
+}
+
+static void addSubpassGroupJob(SubpassGroup_VK& group)
+{
+    const FfxmUInt32 subpass = group.jobCount++;
+
+    forEachFragmentJobResource(group.jobs[subpass].description.fragmentJobDescription, [&](FfxmUInt32 resourceIndex, bool written) {
+        FfxmUInt32 entry = 0;
+        while (entry < group.resourceCount && group.resources[entry] != resourceIndex)
+            ++entry;
+
+        if (entry == group.resourceCount)
         {
-            backendContext->vkFunctionTable.vkDestroyRenderPass(backendContext->device, pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle, VK_NULL_HANDLE);
+            FFXM_ASSERT(group.resourceCount < MAX_SUBPASS_GROUP_RESOURCES);
+            group.resources[entry] = resourceIndex;
+            group.accessMasks[entry] = 0;
+            group.writeMasks[entry] = 0;
+            ++group.resourceCount;
         }
 
-        if (backendContext->vkFunctionTable.vkCreateRenderPass(backendContext->device, &renderPassCreateInfo, nullptr, &pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle) != VK_SUCCESS)
+        group.accessMasks[entry] |= 1 << subpass;
+        if (written)
+            group.writeMasks[entry] |= 1 << subpass;
+    });
+}
+
+// Only the general layout is valid for all the uses of a resource written in one subpass and used in another one
+static bool isGeneralResource(const SubpassGroup_VK& group, FfxmUInt32 resourceIndex)
+{
+    for (FfxmUInt32 entry = 0; entry < group.resourceCount; ++entry)
+    {
+        if (group.resources[entry] == resourceIndex)
+            return group.writeMasks[entry] != 0 && (group.accessMasks[entry] & (group.accessMasks[entry] - 1)) != 0;
+    }
+    return false;
+}
+
+static FfxmResourceStates getSubpassGroupResourceState(const SubpassGroup_VK* group, FfxmUInt32 resourceIndex, FfxmResourceStates state)
+{
+    // the unordered access state is the one kept in the general layout
+    return (group && isGeneralResource(*group, resourceIndex)) ? FFXM_RESOURCE_STATE_UNORDERED_ACCESS : state;
+}
+
+static bool canAddSubpassGroupJob(const BackendContext_VK* backendContext, const SubpassGroup_VK& group, const FfxmFragmentJobDescription& job)
+{
+    // the descriptor sets of all the jobs are written before the render pass, each job needs its own pipeline layout
+    for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+    {
+        if (group.jobs[subpass].description.fragmentJobDescription.pipeline->rootSignature == job.pipeline->rootSignature)
+            return false;
+    }
+
+    // the resources are transitioned before the render pass, none can take over the memory of another one in use by the group
+    bool aliased = false;
+    forEachFragmentJobResource(job, [&](FfxmUInt32 resourceIndex, bool) {
+        const FfxmInt32 aliasHeapIndex = backendContext->pResources[resourceIndex].aliasHeapIndex;
+        if (aliasHeapIndex < 0)
+            return;
+
+        for (FfxmUInt32 entry = 0; entry < group.resourceCount; ++entry)
         {
-            return FFXM_ERROR_BACKEND_API_ERROR;
+            const FfxmUInt32 groupResourceIndex = group.resources[entry];
+            if (groupResourceIndex != resourceIndex && backendContext->pResources[groupResourceIndex].aliasHeapIndex == aliasHeapIndex
+                && groupResourceIndex / FFXM_MAX_RESOURCE_COUNT == resourceIndex / FFXM_MAX_RESOURCE_COUNT)
+                aliased = true;
         }
+    });
+
+    return !aliased;
+}
+
+// Gathers the consecutive fragment jobs the effect allows to merge, starting at the given job. Returns the number of jobs in the group.
+static FfxmUInt32 getSubpassGroup(BackendContext_VK* backendContext, FfxmUInt32 firstJobIndex, SubpassGroup_VK& group)
+{
+    group.jobs = &backendContext->pGpuJobs[firstJobIndex];
+    group.jobCount = 0;
+    group.resourceCount = 0;
+    addSubpassGroupJob(group);
 
-        pipelineLayout->renderPass[pipelineLayout->renderPassIndex].hash = hash;
+    while (group.jobCount < MAX_MERGED_SUBPASSES && firstJobIndex + group.jobCount < backendContext->gpuJobCount)
+    {
+        const FfxmFragmentJobDescription& previousJob = group.jobs[group.jobCount - 1].description.fragmentJobDescription;
+        const FfxmGpuJobDescription&      nextJob = group.jobs[group.jobCount].description;
+
+        if (!previousJob.mergeWithNextJob || nextJob.jobType != FFXM_GPU_JOB_FRAGMENT
+            || nextJob.fragmentJobDescription.viewport[0] != previousJob.viewport[0] || nextJob.fragmentJobDescription.viewport[1] != previousJob.viewport[1]
+            || !canAddSubpassGroupJob(backendContext, group, nextJob.fragmentJobDescription))
+            break;
+
+        addSubpassGroupJob(group);
     }
 
-    return FFXM_OK;
+    return group.jobCount;
 }
 
-FfxmErrorCode getOrCreateGraphicsPipeline(BackendContext_VK* backendContext, FfxmGpuJobDescription* job)
+// the render targets of all the subpasses, in order of first use
+static FfxmUInt32 getSubpassGroupAttachments(const SubpassGroup_VK& group, FfxmUInt32* attachmentResources)
+{
+    FfxmUInt32 attachmentCount = 0;
+    for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+    {
+        const FfxmFragmentJobDescription& job = group.jobs[subpass].description.fragmentJobDescription;
+        for (FfxmUInt32 rtIndex = 0; rtIndex < job.pipeline->rtCount; ++rtIndex)
+        {
+            const FfxmUInt32 resourceIndex = job.rtTextures[rtIndex].internalIndex;
+
+            FfxmUInt32 attachment = 0;
+            while (attachment < attachmentCount && attachmentResources[attachment] != resourceIndex)
+                ++attachment;
+
+            if (attachment == attachmentCount)
+                attachmentResources[attachmentCount++] = resourceIndex;
+        }
+    }
+    return attachmentCount;
+}
+
+// The render pass of a subpass group is cached with the pipeline layout of its first job
+FfxmErrorCode getOrCreateRenderPass(BackendContext_VK* backendContext, const SubpassGroup_VK& group, const FfxmUInt32* attachmentResources, FfxmUInt32 attachmentCount,
+    VkAttachmentLoadOp loadOp)
 {
     FFXM_ASSERT(NULL != backendContext);
-    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->fragmentJobDescription.pipeline->rootSignature);
-    FfxmPipelineState* pipeline = job->fragmentJobDescription.pipeline;
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(group.jobs[0].description.fragmentJobDescription.pipeline->rootSignature);
+
+    // zero initialized as they are hashed as a whole
+    VkAttachmentDescription attachmentDescriptions[MAX_MERGED_SUBPASSES * FFXM_MAX_NUM_RTS] = {};
+    VkAttachmentReference   colorAttachmentReferences[MAX_MERGED_SUBPASSES][FFXM_MAX_NUM_RTS] = {};
+    FfxmUInt32              preserveAttachments[MAX_MERGED_SUBPASSES][MAX_MERGED_SUBPASSES * FFXM_MAX_NUM_RTS] = {};
+    FfxmUInt32              preserveAttachmentCounts[MAX_MERGED_SUBPASSES] = {};
+    VkSubpassDependency     dependencies[MAX_MERGED_SUBPASSES * MAX_MERGED_SUBPASSES] = {};
+    FfxmUInt32              dependencyCount = 0;
+    FfxmUInt32              attachmentUseMasks[MAX_MERGED_SUBPASSES * FFXM_MAX_NUM_RTS] = {};
+
+    for (FfxmUInt32 attachment = 0; attachment < attachmentCount; ++attachment)
+    {
+        const FfxmResourceDescription& rtDescription = backendContext->pResources[attachmentResources[attachment]].resourceDescription;
+        const VkImageLayout layout = isGeneralResource(group, attachmentResources[attachment]) ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentDescription& attachmentDescription = attachmentDescriptions[attachment];
+        attachmentDescription.format = (rtDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET)
+                                        ? VK_FORMAT_D32_SFLOAT : ffxmGetVKSurfaceFormatFromSurfaceFormat(rtDescription.format);
+        attachmentDescription.samples = VK_SAMPLE_COUNT_1_BIT;
+        attachmentDescription.loadOp = loadOp;
+        attachmentDescription.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachmentDescription.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachmentDescription.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachmentDescription.initialLayout = layout;
+        attachmentDescription.finalLayout = layout;
+    }
+
+    for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+    {
+        const FfxmFragmentJobDescription& job = group.jobs[subpass].description.fragmentJobDescription;
+        for (FfxmUInt32 rtIndex = 0; rtIndex < job.pipeline->rtCount; ++rtIndex)
+        {
+            const FfxmUInt32 resourceIndex = job.rtTextures[rtIndex].internalIndex;
+
+            FfxmUInt32 attachment = 0;
+            while (attachmentResources[attachment] != resourceIndex)
+                ++attachment;
 
-    // pipeline only depends on render pass, so compute hash first
-    uint64_t hash = computeHash(&pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle, sizeof(pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle));
+            colorAttachmentReferences[subpass][rtIndex].attachment = attachment;
+            colorAttachmentReferences[subpass][rtIndex].layout = attachmentDescriptions[attachment].initialLayout;
+            attachmentUseMasks[attachment] |= 1 << subpass;
+        }
+    }
+
+    // the content of an attachment must be preserved through the subpasses between its uses
+    for (FfxmUInt32 attachment = 0; attachment < attachmentCount; ++attachment)
+    {
+        for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+        {
+            const FfxmUInt32 subpassBit = 1 << subpass;
+            if ((attachmentUseMasks[attachment] & subpassBit) == 0 && (attachmentUseMasks[attachment] & (subpassBit - 1)) != 0 && (attachmentUseMasks[attachment] & ~((subpassBit << 1) - 1)) != 0)
+                preserveAttachments[subpass][preserveAttachmentCounts[subpass]++] = attachment;
+        }
+    }
+
+    // Order the subpasses touching a resource written by one of them. The shaders sample and store anywhere in the
+    // render targets of the previous passes, so the dependencies cannot be by region.
+    for (FfxmUInt32 dstSubpass = 1; dstSubpass < group.jobCount; ++dstSubpass)
+    {
+        for (FfxmUInt32 srcSubpass = 0; srcSubpass < dstSubpass; ++srcSubpass)
+        {
+            const FfxmUInt32 subpassMask = (1 << srcSubpass) | (1 << dstSubpass);
+
+            bool hazard = false;
+            for (FfxmUInt32 entry = 0; entry < group.resourceCount; ++entry)
+                hazard |= (group.accessMasks[entry] & subpassMask) == subpassMask && (group.writeMasks[entry] & subpassMask) != 0;
 
-    int8_t idx = findObject(pipelineLayout->graphicsPipeline, hash);
+            if (!hazard)
+                continue;
+
+            VkSubpassDependency& dependency = dependencies[dependencyCount++];
+            dependency.srcSubpass = srcSubpass;
+            dependency.dstSubpass = dstSubpass;
+            dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+            dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+            dependency.dependencyFlags = 0;
+        }
+    }
+
+    uint64_t hash = computeHash(attachmentDescriptions, attachmentCount*sizeof(attachmentDescriptions[0]));
+    hash = appendHash(colorAttachmentReferences, sizeof(colorAttachmentReferences), hash);
+    hash = appendHash(preserveAttachments, sizeof(preserveAttachments), hash);
+    hash = appendHash(preserveAttachmentCounts, sizeof(preserveAttachmentCounts), hash);
+    hash = appendHash(dependencies, dependencyCount*sizeof(dependencies[0]), hash);
+    hash = appendHash(&group.jobCount, sizeof(group.jobCount), hash);
+
+    std::array<VkSubpassDescription, MAX_MERGED_SUBPASSES> subPassDescriptions = {};
+    for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+    {
+        subPassDescriptions[subpass].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subPassDescriptions[subpass].colorAttachmentCount = group.jobs[subpass].description.fragmentJobDescription.pipeline->rtCount;
+        subPassDescriptions[subpass].pColorAttachments = colorAttachmentReferences[subpass];
+        subPassDescriptions[subpass].preserveAttachmentCount = preserveAttachmentCounts[subpass];
+        subPassDescriptions[subpass].pPreserveAttachments = preserveAttachments[subpass];
+    }
+
+    VkRenderPassCreateInfo renderPassCreateInfo = {};
+    renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassCreateInfo.attachmentCount = attachmentCount;
+    renderPassCreateInfo.pAttachments = attachmentDescriptions;
+    renderPassCreateInfo.subpassCount = group.jobCount;
+    renderPassCreateInfo.pSubpasses = subPassDescriptions.data();
+    renderPassCreateInfo.dependencyCount = dependencyCount;
+    renderPassCreateInfo.pDependencies = dependencies;
+
+    return getOrCreateObject(pipelineLayout->renderPasses, backendContext->renderPassCounters, hash, pipelineLayout->currentRenderPass,
+        [&](VkRenderPass* renderPass) { return backendContext->vkFunctionTable.vkCreateRenderPass(backendContext->device, &renderPassCreateInfo, nullptr, renderPass); },
+        [&](VkRenderPass renderPass) { backendContext->vkFunctionTable.vkDestroyRenderPass(backendContext->device, renderPass, nullptr); });
+}
+
+FfxmErrorCode getOrCreateGraphicsPipeline(BackendContext_VK* backendContext, BackendContext_VK::PipelineLayout* pipelineLayout, FfxmPipelineState* pipeline, FfxmUInt32 subpass = 0)
+{
+    FFXM_ASSERT(NULL != backendContext);
+
+    // pipeline only depends on render pass and subpass, so compute hash first
+    uint64_t hash = computeHash(&pipelineLayout->currentRenderPass, sizeof(pipelineLayout->currentRenderPass));
+    hash = appendHash(&subpass, sizeof(subpass), hash);
 
     // find graphics pipeline
-    if (idx != -1)
+    if (const VkPipeline* cachedPipeline = pipelineLayout->graphicsPipelines.find(hash, backendContext->graphicsPipelineCounters))
     {
-        pipelineLayout->graphicsPipelineIndex = idx;
+        pipelineLayout->currentGraphicsPipeline = *cachedPipeline;
 
         // set the pipeline
-        pipeline->pipeline = reinterpret_cast<FfxmPipeline>(pipelineLayout->graphicsPipeline[pipelineLayout->graphicsPipelineIndex].handle);
+        pipeline->pipeline = reinterpret_cast<FfxmPipeline>(pipelineLayout->currentGraphicsPipeline);
 
         return FFXM_OK;
     }
@@ -2883,28 +3854,194 @@ FfxmErrorCode getOrCreateGraphicsPipeline(BackendContext_VK* backendContext, Ffx
     pipelineCreateInfo.pColorBlendState = &colorBlendCreateInfo;
     pipelineCreateInfo.pDynamicState = &dynamicStateCreateInfo;
     pipelineCreateInfo.layout = pipelineLayout->pipelineLayout;
-    pipelineCreateInfo.renderPass = pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle;
-    pipelineCreateInfo.subpass = 0;
+    pipelineCreateInfo.renderPass = pipelineLayout->currentRenderPass;
+    pipelineCreateInfo.subpass = subpass;
     pipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
     pipelineCreateInfo.basePipelineIndex = -1;
 
-    // not find, get lru index in the array
-    pipelineLayout->graphicsPipelineIndex = getLRUIndex(pipelineLayout->graphicsPipeline);
-
-    if (pipelineLayout->graphicsPipeline[pipelineLayout->graphicsPipelineIndex].handle != VK_NULL_HANDLE)
+    if (backendContext->vkFunctionTable.vkCreateGraphicsPipelines(backendContext->device, backendContext->pipelineCache, 1, &pipelineCreateInfo, nullptr, &pipelineLayout->currentGraphicsPipeline) != VK_SUCCESS)
     {
-        backendContext->vkFunctionTable.vkDestroyPipeline(backendContext->device, pipelineLayout->graphicsPipeline[pipelineLayout->graphicsPipelineIndex].handle, VK_NULL_HANDLE);
+        return FFXM_ERROR_BACKEND_API_ERROR;
     }
 
-    if (backendContext->vkFunctionTable.vkCreateGraphicsPipelines(backendContext->device, VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pipelineLayout->graphicsPipeline[pipelineLayout->graphicsPipelineIndex].handle) != VK_SUCCESS)
+    // not found, the least recently used pipeline makes room if the cache is full
+    VkPipeline evictedPipeline;
+    if (pipelineLayout->graphicsPipelines.insert(hash, pipelineLayout->currentGraphicsPipeline, evictedPipeline, backendContext->graphicsPipelineCounters))
     {
+        backendContext->vkFunctionTable.vkDestroyPipeline(backendContext->device, evictedPipeline, VK_NULL_HANDLE);
+    }
+
+    // set the pipeline
+    pipeline->pipeline = reinterpret_cast<FfxmPipeline>(pipelineLayout->currentGraphicsPipeline);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode getOrCreateGraphicsPipeline(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, FfxmUInt32 subpass = 0)
+{
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->fragmentJobDescription.pipeline->rootSignature);
+    return getOrCreateGraphicsPipeline(backendContext, pipelineLayout, job->fragmentJobDescription.pipeline, subpass);
+}
+
+FfxmErrorCode PrewarmGraphicsPipelineVK(FfxmInterface* backendInterface, FfxmPipelineState* pipeline, const FfxmResourceDescription* rtDescriptions, FfxmUInt32 rtCount)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != pipeline);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(pipeline->rootSignature);
+
+    FFXM_RETURN_ON_ERROR(
+        rtCount == pipeline->rtCount,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    // the framebuffer depends on the actual image views so it is still created on first use
+    FFXM_VALIDATE(getOrCreateRenderPass(backendContext, pipelineLayout, pipeline, rtDescriptions));
+    FFXM_VALIDATE(getOrCreateGraphicsPipeline(backendContext, pipelineLayout, pipeline));
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmGetPipelineCacheDataVK(FfxmInterface* backendInterface, size_t* dataSize, void* data)
+{
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        dataSize,
+        FFXM_ERROR_INVALID_POINTER);
+
+    // the pipeline cache only lives while at least one effect context exists
+    FFXM_RETURN_ON_ERROR(
+        s_BackendRefCount,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    VkResult result = backendContext->vkFunctionTable.vkGetPipelineCacheData(backendContext->device, backendContext->pipelineCache, dataSize, data);
+
+    FFXM_RETURN_ON_ERROR(
+        result != VK_INCOMPLETE,
+        FFXM_ERROR_INSUFFICIENT_MEMORY);
+    FFXM_RETURN_ON_ERROR(
+        result == VK_SUCCESS,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmSetPipelineCacheDataVK(FfxmInterface* backendInterface, const void* data, size_t dataSize)
+{
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        data || !dataSize,
+        FFXM_ERROR_INVALID_POINTER);
+
+    // no effect context yet, the data seeds the pipeline cache when the first one gets created
+    if (!s_BackendRefCount) {
+        s_PipelineCacheInitialData = data;
+        s_PipelineCacheInitialDataSize = dataSize;
+        return FFXM_OK;
+    }
+
+    // otherwise merge it into the live cache
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.initialDataSize = dataSize;
+    pipelineCacheCreateInfo.pInitialData = data;
+
+    VkPipelineCache srcPipelineCache = VK_NULL_HANDLE;
+    if (backendContext->vkFunctionTable.vkCreatePipelineCache(backendContext->device, &pipelineCacheCreateInfo, nullptr, &srcPipelineCache) != VK_SUCCESS) {
         return FFXM_ERROR_BACKEND_API_ERROR;
     }
 
-    pipelineLayout->graphicsPipeline[pipelineLayout->graphicsPipelineIndex].hash = hash;
+    VkResult result = backendContext->vkFunctionTable.vkMergePipelineCaches(backendContext->device, backendContext->pipelineCache, 1, &srcPipelineCache);
+    backendContext->vkFunctionTable.vkDestroyPipelineCache(backendContext->device, srcPipelineCache, nullptr);
 
-    // set the pipeline
-    pipeline->pipeline = reinterpret_cast<FfxmPipeline>(pipelineLayout->graphicsPipeline[pipelineLayout->graphicsPipelineIndex].handle);
+    FFXM_RETURN_ON_ERROR(
+        result == VK_SUCCESS,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmInvalidateResourceVK(FfxmInterface* backendInterface, void* vkResource)
+{
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+
+    // nothing is cached while no effect context is alive
+    if (!s_BackendRefCount)
+        return FFXM_OK;
+
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    const VkImage image = reinterpret_cast<VkImage>(vkResource);
+
+    for (FfxmUInt32 effectContextId = 0; effectContextId < s_MaxEffectContexts; ++effectContextId)
+    {
+        BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+        if (!effectContext.active)
+            continue;
+
+        for (FfxmUInt32 dynamicViewIndex = 0; dynamicViewIndex < MAX_DYNAMIC_VIEW_ENTRIES; ++dynamicViewIndex)
+        {
+            if (effectContext.dynamicViews[dynamicViewIndex].hash && effectContext.dynamicViews[dynamicViewIndex].image == image)
+                destroyDynamicViews(backendContext, effectContextId, dynamicViewIndex);
+        }
+
+        // render target views only keep a hash of the image, flush them all along with the framebuffers using them
+        for (FfxmUInt32 pipelineLayoutIndex = effectContextId * FFXM_MAX_PASS_COUNT; pipelineLayoutIndex < effectContext.nextPipelineLayout; ++pipelineLayoutIndex)
+        {
+            BackendContext_VK::PipelineLayout& pipelineLayout = backendContext->pPipelineLayouts[pipelineLayoutIndex];
+
+            pipelineLayout.frameBuffers.clear([&](VkFramebuffer frameBuffer) {
+                backendContext->vkFunctionTable.vkDestroyFramebuffer(backendContext->device, frameBuffer, VK_NULL_HANDLE);
+            }, backendContext->frameBufferCounters);
+
+            pipelineLayout.imageViews.clear([&](VkImageView imageView) {
+                backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, imageView, VK_NULL_HANDLE);
+            }, backendContext->imageViewCounters);
+
+            pipelineLayout.currentFrameBuffer = VK_NULL_HANDLE;
+        }
+    }
+
+    return FFXM_OK;
+}
+
+static FfxmObjectCacheStatsVK getObjectCacheStats(const ObjectCacheCounters& counters, FfxmUInt32 capacity)
+{
+    FfxmObjectCacheStatsVK stats = {};
+    stats.hits = counters.hits;
+    stats.misses = counters.misses;
+    stats.evictions = counters.evictions;
+    stats.count = counters.count;
+    stats.capacity = capacity;
+    return stats;
+}
+
+FfxmErrorCode ffxmGetBackendStatsVK(FfxmInterface* backendInterface, FfxmBackendStatsVK* stats)
+{
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        stats,
+        FFXM_ERROR_INVALID_POINTER);
+
+    // the counters get reset when the first effect context is created
+    FFXM_RETURN_ON_ERROR(
+        s_BackendRefCount,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    const BackendContext_VK* backendContext = (const BackendContext_VK*)backendInterface->scratchBuffer;
+    stats->renderPasses = getObjectCacheStats(backendContext->renderPassCounters, MAX_RENDER_PASS_COUNT);
+    stats->imageViews = getObjectCacheStats(backendContext->imageViewCounters, MAX_IMAGE_VIEW_COUNT);
+    stats->frameBuffers = getObjectCacheStats(backendContext->frameBufferCounters, MAX_FRAME_BUFFER_COUNT);
+    stats->graphicsPipelines = getObjectCacheStats(backendContext->graphicsPipelineCounters, MAX_GRAPHICS_PIPELINE_COUNT);
 
     return FFXM_OK;
 }
@@ -2922,7 +4059,7 @@ FfxmErrorCode DestroyPipelineVK(FfxmInterface* backendInterface, FfxmPipelineSta
 
     BackendContext_VK::PipelineLayout* pPipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(pipeline->rootSignature);
 
-    if (vkPipeline != VK_NULL_HANDLE && vkPipeline != pPipelineLayout->graphicsPipeline[pPipelineLayout->graphicsPipelineIndex].handle) {
+    if (vkPipeline != VK_NULL_HANDLE && !pPipelineLayout->graphicsPipelines.contains(vkPipeline)) {
         backendContext->vkFunctionTable.vkDestroyPipeline(backendContext->device, vkPipeline, VK_NULL_HANDLE);
         pipeline->pipeline = VK_NULL_HANDLE;
     }
@@ -2940,10 +4077,21 @@ FfxmErrorCode DestroyPipelineVK(FfxmInterface* backendInterface, FfxmPipelineSta
         }
 
         // Descriptor sets
-        for (FfxmUInt32 i = 0; i < FFXM_MAX_QUEUED_FRAMES; i++)
+        for (FfxmUInt32 i = 0; i < MAX_DESCRIPTOR_SET_RING; i++)
             for (FfxmUInt32 j = 0; j < MAX_DESCRIPTOR_SETS; j++)
                 pPipelineLayout->descriptorSets[i][j] = VK_NULL_HANDLE;
 
+        // Descriptor update templates
+        for (FfxmUInt32 i = 0; i < MAX_DESCRIPTOR_SETS; i++)
+        {
+            if (pPipelineLayout->descriptorUpdateTemplates[i] != VK_NULL_HANDLE) {
+                backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate(backendContext->device, pPipelineLayout->descriptorUpdateTemplates[i], VK_NULL_HANDLE);
+                pPipelineLayout->descriptorUpdateTemplates[i] = VK_NULL_HANDLE;
+            }
+        }
+        pPipelineLayout->useDescriptorUpdateTemplates = false;
+        pPipelineLayout->pushDescriptorSet = -1;
+
         // Descriptor set layout
         for (FfxmUInt32 i = 0; i < MAX_DESCRIPTOR_SETS; i++)
         {
@@ -2962,33 +4110,26 @@ FfxmErrorCode DestroyPipelineVK(FfxmInterface* backendInterface, FfxmPipelineSta
             }
         }
 
-        for (FfxmUInt32 i = 0; i < MAX_IMAGE_VIEW_COUNT; i++)
-        {
-            if (pPipelineLayout->imageView[i].handle != VK_NULL_HANDLE) {
-                backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, pPipelineLayout->imageView[i].handle, VK_NULL_HANDLE);
-            }
-        }
+        // Cached objects of graphics pipelines
+        pPipelineLayout->imageViews.clear([&](VkImageView imageView) {
+            backendContext->vkFunctionTable.vkDestroyImageView(backendContext->device, imageView, VK_NULL_HANDLE);
+        }, backendContext->imageViewCounters);
 
-        for (FfxmUInt32 i = 0; i < MAX_FRAME_BUFFER_COUNT; i++)
-        {
-            if (pPipelineLayout->frameBuffer[i].handle != VK_NULL_HANDLE) {
-                backendContext->vkFunctionTable.vkDestroyFramebuffer(backendContext->device, pPipelineLayout->frameBuffer[i].handle, VK_NULL_HANDLE);
-            }
-        }
+        pPipelineLayout->frameBuffers.clear([&](VkFramebuffer frameBuffer) {
+            backendContext->vkFunctionTable.vkDestroyFramebuffer(backendContext->device, frameBuffer, VK_NULL_HANDLE);
+        }, backendContext->frameBufferCounters);
 
-        for (FfxmUInt32 i = 0; i < MAX_RENDER_PASS_COUNT; i++)
-        {
-            if (pPipelineLayout->renderPass[i].handle != VK_NULL_HANDLE) {
-                backendContext->vkFunctionTable.vkDestroyRenderPass(backendContext->device, pPipelineLayout->renderPass[i].handle, VK_NULL_HANDLE);
-            }
-        }
+        pPipelineLayout->renderPasses.clear([&](VkRenderPass renderPass) {
+            backendContext->vkFunctionTable.vkDestroyRenderPass(backendContext->device, renderPass, VK_NULL_HANDLE);
+        }, backendContext->renderPassCounters);
 
-        for (FfxmUInt32 i = 0; i < MAX_GRAPHICS_PIPELINE_COUNT; i++)
-        {
-            if (pPipelineLayout->graphicsPipeline[i].handle != VK_NULL_HANDLE) {
-                backendContext->vkFunctionTable.vkDestroyPipeline(backendContext->device, pPipelineLayout->graphicsPipeline[i].handle, VK_NULL_HANDLE);
-            }
-        }
+        pPipelineLayout->graphicsPipelines.clear([&](VkPipeline graphicsPipeline) {
+            backendContext->vkFunctionTable.vkDestroyPipeline(backendContext->device, graphicsPipeline, VK_NULL_HANDLE);
+        }, backendContext->graphicsPipelineCounters);
+
+        pPipelineLayout->currentRenderPass = VK_NULL_HANDLE;
+        pPipelineLayout->currentFrameBuffer = VK_NULL_HANDLE;
+        pPipelineLayout->currentGraphicsPipeline = VK_NULL_HANDLE;
 
         if (pPipelineLayout->fragShaderModule != VK_NULL_HANDLE) {
             backendContext->vkFunctionTable.vkDestroyShaderModule(backendContext->device, pPipelineLayout->fragShaderModule, nullptr);
@@ -3002,6 +4143,64 @@ FfxmErrorCode DestroyPipelineVK(FfxmInterface* backendInterface, FfxmPipelineSta
     return FFXM_OK;
 }
 
+static FfxmUInt32 uploadConstantBuffer(BackendContext_VK* backendContext, const FfxmConstantBufferReference& cb)
+{
+    // the constant buffers are sub-allocated linearly from the ring buffer, leaving room for the range of the descriptors reading them
+    const FfxmUInt32 dataSize = cb.num32BitEntries * sizeof(FfxmUInt32);
+    FFXM_ASSERT(dataSize <= UNIFORM_BUFFER_RANGE);
+
+    VkDeviceSize offset = backendContext->ringBufferOffset;
+    if (offset + UNIFORM_BUFFER_RANGE > backendContext->ringBufferSize)
+        offset = 0;
+
+    if (cb.data != nullptr)
+        memcpy(backendContext->pRingBufferData + offset, cb.data, dataSize);
+
+    // the data gets flushed by ExecuteGpuJobsVK if the memory is not coherent
+    backendContext->ringBufferOffset = offset + FFXM_ALIGN_UP(VkDeviceSize(dataSize), backendContext->uniformBufferOffsetAlignment);
+
+    return FfxmUInt32(offset);
+}
+
+// Flushes the constant buffers uploaded since the previous call, if the ring buffer memory is not coherent
+static void flushConstantBuffers(BackendContext_VK* backendContext)
+{
+    const VkDeviceSize begin = backendContext->ringBufferFlushOffset;
+    const VkDeviceSize end = backendContext->ringBufferOffset;
+    backendContext->ringBufferFlushOffset = end;
+
+    if ((backendContext->ringBufferMemoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0 || begin == end)
+        return;
+
+    // the ranges must be aligned on nonCoherentAtomSize or reach the end of the memory
+    const VkDeviceSize atomSize = backendContext->nonCoherentAtomSize;
+    auto getMappedRange = [&](VkDeviceSize rangeBegin, VkDeviceSize rangeEnd) {
+        VkMappedMemoryRange memoryRange = {};
+        memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        memoryRange.memory = backendContext->ringBufferMemory;
+        memoryRange.offset = rangeBegin - rangeBegin % atomSize;
+
+        const VkDeviceSize alignedEnd = rangeEnd + (atomSize - rangeEnd % atomSize) % atomSize;
+        memoryRange.size = alignedEnd >= backendContext->ringBufferSize ? VK_WHOLE_SIZE : alignedEnd - memoryRange.offset;
+        return memoryRange;
+    };
+
+    // the allocations wrapped around the end of the ring buffer since the previous flush
+    VkMappedMemoryRange memoryRanges[2];
+    FfxmUInt32 memoryRangeCount = 0;
+    if (begin < end)
+    {
+        memoryRanges[memoryRangeCount++] = getMappedRange(begin, end);
+    }
+    else
+    {
+        memoryRanges[memoryRangeCount++] = getMappedRange(begin, backendContext->ringBufferSize);
+        memoryRanges[memoryRangeCount++] = getMappedRange(0, end);
+    }
+
+    backendContext->vkFunctionTable.vkFlushMappedMemoryRanges(backendContext->device, memoryRangeCount, memoryRanges);
+}
+
 FfxmErrorCode ScheduleGpuJobVK(FfxmInterface* backendInterface, const FfxmGpuJobDescription* job)
 {
     FFXM_ASSERT(NULL != backendInterface);
@@ -3011,90 +4210,129 @@ FfxmErrorCode ScheduleGpuJobVK(FfxmInterface* backendInterface, const FfxmGpuJob
 
     FFXM_ASSERT(backendContext->gpuJobCount < FFXM_MAX_GPU_JOBS);
 
-    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+    BackendContext_VK::GpuJob& gpuJob = backendContext->pGpuJobs[backendContext->gpuJobCount];
+    gpuJob.description = *job;
+
+    // the constant buffer data only needs to be valid while scheduling, upload it to the ring buffer right away
+    const FfxmConstantBufferReference* cbs = nullptr;
+    FfxmUInt32                         constCount = 0;
+    if (job->jobType == FFXM_GPU_JOB_COMPUTE)
+    {
+        cbs = job->computeJobDescriptor.cbs;
+        constCount = job->computeJobDescriptor.pipeline->constCount;
+    }
+    else if (job->jobType == FFXM_GPU_JOB_FRAGMENT)
+    {
+        cbs = job->fragmentJobDescription.cbs;
+        constCount = job->fragmentJobDescription.pipeline->constCount;
+    }
+    for (FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < constCount; ++currentRootConstantIndex)
+        gpuJob.constantBufferOffsets[currentRootConstantIndex] = uploadConstantBuffer(backendContext, cbs[currentRootConstantIndex]);
+
+    backendContext->gpuJobCount++;
+
+    return FFXM_OK;
+}
 
-    if (job->jobType == FFXM_GPU_JOB_COMPUTE) {
+// Writes the descriptors gathered for a job into the descriptor sets of its pipeline, the push descriptor set is written when binding
+static void updateDescriptorSets(BackendContext_VK* backendContext, const BackendContext_VK::PipelineLayout* pipelineLayout, FfxmUInt32 descriptorSetCount,
+    const DescriptorData* descriptorData, const VkWriteDescriptorSet* writeDescriptorSets, FfxmUInt32 writeDescriptorSetCount)
+{
+    if (!pipelineLayout->useDescriptorUpdateTemplates)
+    {
+        backendContext->vkFunctionTable.vkUpdateDescriptorSets(backendContext->device, writeDescriptorSetCount, writeDescriptorSets, 0, nullptr);
+        return;
+    }
 
-        // needs to copy SRVs and UAVs in case they are on the stack only
-        FfxmComputeJobDescription* computeJob = &backendContext->pGpuJobs[backendContext->gpuJobCount].computeJobDescriptor;
-        const FfxmUInt32 numConstBuffers = job->computeJobDescriptor.pipeline.constCount;
-        for (FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < numConstBuffers; ++currentRootConstantIndex)
+    for (FfxmUInt32 setIndex = 0; setIndex < descriptorSetCount; ++setIndex)
+    {
+        if (pipelineLayout->descriptorUpdateTemplates[setIndex] != VK_NULL_HANDLE && pipelineLayout->pushDescriptorSet != FfxmInt32(setIndex))
         {
-            computeJob->cbs[currentRootConstantIndex].num32BitEntries = job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries;
-            memcpy(computeJob->cbs[currentRootConstantIndex].data, job->computeJobDescriptor.cbs[currentRootConstantIndex].data, computeJob->cbs[currentRootConstantIndex].num32BitEntries * sizeof(FfxmUInt32));
+            backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate(backendContext->device, pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][setIndex],
+                pipelineLayout->descriptorUpdateTemplates[setIndex], descriptorData);
         }
     }
+}
 
-	if(job->jobType == FFXM_GPU_JOB_FRAGMENT)
-	{
-
-		// needs to copy SRVs and UAVs in case they are on the stack only
-		FfxmFragmentJobDescription* fragmentJob = &backendContext->pGpuJobs[backendContext->gpuJobCount].fragmentJobDescription;
-		const FfxmUInt32 numConstBuffers = job->fragmentJobDescription.pipeline->constCount;
-		for(FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < numConstBuffers; ++currentRootConstantIndex)
-		{
-			fragmentJob->cbs[currentRootConstantIndex].num32BitEntries = job->fragmentJobDescription.cbs[currentRootConstantIndex].num32BitEntries;
-			memcpy(fragmentJob->cbs[currentRootConstantIndex].data, job->fragmentJobDescription.cbs[currentRootConstantIndex].data,
-				   fragmentJob->cbs[currentRootConstantIndex].num32BitEntries * sizeof(FfxmUInt32));
-		}
-	}
+static void bindDescriptorSets(BackendContext_VK* backendContext, const BackendContext_VK::PipelineLayout* pipelineLayout, const FfxmPipelineState* pipeline,
+    const DescriptorData* descriptorData, const FfxmUInt32* constantBufferOffsets, VkPipelineBindPoint bindPoint, VkCommandBuffer vkCommandBuffer)
+{
+    // the constant buffers of the job in the ring buffer
+    FfxmUInt32 dynamicOffsets[FFXM_MAX_NUM_CONST_BUFFERS];
+    for (FfxmUInt32 cbIndex = 0; cbIndex < pipeline->constCount; ++cbIndex)
+        dynamicOffsets[cbIndex] = constantBufferOffsets[pipelineLayout->dynamicOffsetOrder[cbIndex]];
 
-    backendContext->gpuJobCount++;
+    if (pipelineLayout->pushDescriptorSet < 0)
+    {
+        backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, bindPoint, pipelineLayout->pipelineLayout, 0, pipeline->descriptorSetCount, pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex],
+            pipeline->constCount, dynamicOffsets);
+        return;
+    }
 
-    return FFXM_OK;
+    FfxmUInt32 dynamicOffsetIndex = 0;
+    for (FfxmUInt32 setIndex = 0; setIndex < pipeline->descriptorSetCount; ++setIndex)
+    {
+        if (pipelineLayout->pushDescriptorSet == FfxmInt32(setIndex))
+        {
+            backendContext->vkFunctionTable.vkCmdPushDescriptorSetWithTemplateKHR(vkCommandBuffer, pipelineLayout->descriptorUpdateTemplates[setIndex], pipelineLayout->pipelineLayout, setIndex, descriptorData);
+        }
+        else
+        {
+            backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, bindPoint, pipelineLayout->pipelineLayout, setIndex, 1, &pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][setIndex],
+                pipelineLayout->dynamicOffsetCounts[setIndex], &dynamicOffsets[dynamicOffsetIndex]);
+            dynamicOffsetIndex += pipelineLayout->dynamicOffsetCounts[setIndex];
+        }
+    }
 }
 
-static FfxmErrorCode executeGpuJobCompute(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, VkCommandBuffer vkCommandBuffer)
+static FfxmErrorCode executeGpuJobCompute(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, const FfxmUInt32* constantBufferOffsets, VkCommandBuffer vkCommandBuffer)
 {
-    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->computeJobDescriptor.pipeline.rootSignature);
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->computeJobDescriptor.pipeline->rootSignature);
 
     // bind texture & buffer UAVs (note the binding order here MUST match the root signature mapping order from CreatePipeline!)
+    // the descriptors are gathered in that order, which is the layout read by the descriptor update templates of the pipeline
+    const bool             useDescriptorWrites = !pipelineLayout->useDescriptorUpdateTemplates;
     FfxmUInt32               descriptorWriteIndex = 0;
     VkWriteDescriptorSet   writeDescriptorSets[FFXM_MAX_RESOURCE_COUNT];
 
-    // These MUST be initialized
-    FfxmUInt32               imageDescriptorIndex = 0;
-    VkDescriptorImageInfo  imageDescriptorInfos[FFXM_MAX_RESOURCE_COUNT];
-    for (int i = 0; i < FFXM_MAX_RESOURCE_COUNT; ++i)
-        imageDescriptorInfos[i] = { VK_NULL_HANDLE, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
-
-    // These MUST be initialized
-    FfxmUInt32               bufferDescriptorIndex = 0;
-    VkDescriptorBufferInfo bufferDescriptorInfos[FFXM_MAX_RESOURCE_COUNT];
-    for (int i = 0; i < FFXM_MAX_RESOURCE_COUNT; ++i)
-        bufferDescriptorInfos[i] = { VK_NULL_HANDLE, 0, VK_WHOLE_SIZE };
+    FfxmUInt32               descriptorIndex = 0;
+    DescriptorData         descriptorData[FFXM_MAX_RESOURCE_COUNT];
 
     // bind texture UAVs
-    for (FfxmUInt32 currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavTextureCount; ++currentPipelineUavIndex)
+    for (FfxmUInt32 currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline->uavTextureCount; ++currentPipelineUavIndex)
     {
         addBarrier(backendContext, &job->computeJobDescriptor.uavTextures[currentPipelineUavIndex], FFXM_RESOURCE_STATE_UNORDERED_ACCESS);
 
         // where to bind it
-        const FfxmUInt32 currentUavResourceIndex = job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex].slotIndex;
+        const FfxmUInt32 currentUavResourceIndex = job->computeJobDescriptor.pipeline->uavTextureBindings[currentPipelineUavIndex].slotIndex;
 
-        for (FfxmUInt32 uavEntry = 0; uavEntry < job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex].bindCount; ++uavEntry, ++imageDescriptorIndex, ++descriptorWriteIndex)
+        for (FfxmUInt32 uavEntry = 0; uavEntry < job->computeJobDescriptor.pipeline->uavTextureBindings[currentPipelineUavIndex].bindCount; ++uavEntry, ++descriptorIndex)
         {
             // source: UAV of resource to bind
             const FfxmUInt32 resourceIndex = job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].internalIndex;
-            const FfxmUInt32 uavViewIndex = backendContext->pResources[resourceIndex].uavViewIndex + job->computeJobDescriptor.uavTextureMips[imageDescriptorIndex];
+            const FfxmUInt32 uavViewIndex = backendContext->pResources[resourceIndex].uavViewIndex + job->computeJobDescriptor.uavTextureMips[descriptorIndex];
 
-            writeDescriptorSets[descriptorWriteIndex] = {};
-            writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex].bindSet];
-            writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-            writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-            writeDescriptorSets[descriptorWriteIndex].pImageInfo = &imageDescriptorInfos[imageDescriptorIndex];
-            writeDescriptorSets[descriptorWriteIndex].dstBinding = currentUavResourceIndex;
-            writeDescriptorSets[descriptorWriteIndex].dstArrayElement = uavEntry;
+            if (useDescriptorWrites)
+            {
+                writeDescriptorSets[descriptorWriteIndex] = {};
+                writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline->uavTextureBindings[currentPipelineUavIndex].bindSet];
+                writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
+                writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+                writeDescriptorSets[descriptorWriteIndex].pImageInfo = &descriptorData[descriptorIndex].image;
+                writeDescriptorSets[descriptorWriteIndex].dstBinding = currentUavResourceIndex;
+                writeDescriptorSets[descriptorWriteIndex].dstArrayElement = uavEntry;
+                ++descriptorWriteIndex;
+            }
 
-            imageDescriptorInfos[imageDescriptorIndex] = {};
-            imageDescriptorInfos[imageDescriptorIndex].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-            imageDescriptorInfos[imageDescriptorIndex].imageView = backendContext->pResourceViews[uavViewIndex].imageView;
+            descriptorData[descriptorIndex].image = {};
+            descriptorData[descriptorIndex].image.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+            descriptorData[descriptorIndex].image.imageView = backendContext->pResourceViews[uavViewIndex].imageView;
         }
     }
 
     // bind buffer UAVs
-    for (FfxmUInt32 currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavBufferCount; ++currentPipelineUavIndex, ++bufferDescriptorIndex, ++descriptorWriteIndex) {
+    for (FfxmUInt32 currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline->uavBufferCount; ++currentPipelineUavIndex, ++descriptorIndex) {
 
         addBarrier(backendContext, &job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex], FFXM_RESOURCE_STATE_UNORDERED_ACCESS);
 
@@ -3102,56 +4340,63 @@ static FfxmErrorCode executeGpuJobCompute(BackendContext_VK* backendContext, Ffx
         const FfxmUInt32 resourceIndex = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].internalIndex;
 
         // where to bind it
-        const FfxmUInt32 currentUavResourceIndex = job->computeJobDescriptor.pipeline.uavBufferBindings[currentPipelineUavIndex].slotIndex;
+        const FfxmUInt32 currentUavResourceIndex = job->computeJobDescriptor.pipeline->uavBufferBindings[currentPipelineUavIndex].slotIndex;
 
-        writeDescriptorSets[descriptorWriteIndex] = {};
-        writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline.uavBufferBindings[currentPipelineUavIndex].bindSet];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        writeDescriptorSets[descriptorWriteIndex].pBufferInfo = &bufferDescriptorInfos[bufferDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding = currentUavResourceIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+        if (useDescriptorWrites)
+        {
+            writeDescriptorSets[descriptorWriteIndex] = {};
+            writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline->uavBufferBindings[currentPipelineUavIndex].bindSet];
+            writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
+            writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writeDescriptorSets[descriptorWriteIndex].pBufferInfo = &descriptorData[descriptorIndex].buffer;
+            writeDescriptorSets[descriptorWriteIndex].dstBinding = currentUavResourceIndex;
+            writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+            ++descriptorWriteIndex;
+        }
 
-        bufferDescriptorInfos[bufferDescriptorIndex] = {};
-        bufferDescriptorInfos[bufferDescriptorIndex].buffer = backendContext->pResources[resourceIndex].bufferResource;
-        bufferDescriptorInfos[bufferDescriptorIndex].offset = 0;
-        bufferDescriptorInfos[bufferDescriptorIndex].range = VK_WHOLE_SIZE;
+        descriptorData[descriptorIndex].buffer = {};
+        descriptorData[descriptorIndex].buffer.buffer = backendContext->pResources[resourceIndex].bufferResource;
+        descriptorData[descriptorIndex].buffer.offset = 0;
+        descriptorData[descriptorIndex].buffer.range = VK_WHOLE_SIZE;
     }
 
     // bind texture SRVs
-    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvTextureCount;
-         ++currentPipelineSrvIndex, ++descriptorWriteIndex)
+    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline->srvTextureCount; ++currentPipelineSrvIndex)
     {
 
         // where to bind it
-        const FfxmUInt32 currentSrvResourceIndex = job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex].slotIndex;
-
-        writeDescriptorSets[descriptorWriteIndex]                 = {};
-        writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex].bindSet];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex].bindCount;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-        writeDescriptorSets[descriptorWriteIndex].pImageInfo      = &imageDescriptorInfos[imageDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding      = currentSrvResourceIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
-
-        for(FfxmUInt32 i = 0; i < job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex].bindCount; ++i, ++imageDescriptorIndex)
+        const FfxmUInt32 currentSrvResourceIndex = job->computeJobDescriptor.pipeline->srvTextureBindings[currentPipelineSrvIndex].slotIndex;
+
+        if (useDescriptorWrites)
+        {
+            writeDescriptorSets[descriptorWriteIndex]                 = {};
+            writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindSet];
+            writeDescriptorSets[descriptorWriteIndex].descriptorCount = job->computeJobDescriptor.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindCount;
+            writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            writeDescriptorSets[descriptorWriteIndex].pImageInfo      = &descriptorData[descriptorIndex].image;
+            writeDescriptorSets[descriptorWriteIndex].dstBinding      = currentSrvResourceIndex;
+            writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+            ++descriptorWriteIndex;
+        }
+
+        for(FfxmUInt32 i = 0; i < job->computeJobDescriptor.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindCount; ++i, ++descriptorIndex)
         {
             addBarrier(backendContext, &job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex + i], FFXM_RESOURCE_STATE_COMPUTE_READ);
 
             const FfxmUInt32 resourceIndex = job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex + i].internalIndex;
             const FfxmUInt32 srvViewIndex  = backendContext->pResources[resourceIndex].srvViewIndex;
 
-            imageDescriptorInfos[imageDescriptorIndex]             = {};
-            imageDescriptorInfos[imageDescriptorIndex].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            imageDescriptorInfos[imageDescriptorIndex].imageView   = backendContext->pResourceViews[srvViewIndex].imageView;
+            descriptorData[descriptorIndex].image             = {};
+            descriptorData[descriptorIndex].image.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            descriptorData[descriptorIndex].image.imageView   = backendContext->pResourceViews[srvViewIndex].imageView;
         }
     }
 
     // bind buffer SRVs
-    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvBufferCount;
-         ++currentPipelineSrvIndex, ++bufferDescriptorIndex, ++descriptorWriteIndex)
+    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline->srvBufferCount;
+         ++currentPipelineSrvIndex, ++descriptorIndex)
     {
         addBarrier(backendContext, &job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex], FFXM_RESOURCE_STATE_COMPUTE_READ);
 
@@ -3159,72 +4404,29 @@ static FfxmErrorCode executeGpuJobCompute(BackendContext_VK* backendContext, Ffx
         const FfxmUInt32 resourceIndex = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].internalIndex;
 
         // where to bind it
-        const FfxmUInt32 currentSrvResourceIndex = job->computeJobDescriptor.pipeline.srvBufferBindings[currentPipelineSrvIndex].slotIndex;
-
-        writeDescriptorSets[descriptorWriteIndex]                 = {};
-        writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline.srvBufferBindings[currentPipelineSrvIndex].bindSet];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        writeDescriptorSets[descriptorWriteIndex].pBufferInfo     = &bufferDescriptorInfos[bufferDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding      = currentSrvResourceIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
-
-        bufferDescriptorInfos[bufferDescriptorIndex]        = {};
-        bufferDescriptorInfos[bufferDescriptorIndex].buffer = backendContext->pResources[resourceIndex].bufferResource;
-        bufferDescriptorInfos[bufferDescriptorIndex].offset = 0;
-        bufferDescriptorInfos[bufferDescriptorIndex].range  = VK_WHOLE_SIZE;
-    }
-
-    // update uniform buffers
-    for (FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < job->computeJobDescriptor.pipeline.constCount; ++currentRootConstantIndex, ++bufferDescriptorIndex, ++descriptorWriteIndex)
-    {
-        writeDescriptorSets[descriptorWriteIndex] = {};
-        writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline.constantBufferBindings[currentRootConstantIndex].bindSet];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        writeDescriptorSets[descriptorWriteIndex].pBufferInfo = &bufferDescriptorInfos[bufferDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding = job->computeJobDescriptor.pipeline.constantBufferBindings[currentRootConstantIndex].slotIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
-
-        // the ubo ring buffer is pre-populated with VkBuffer objects of FFXM_BUFFER_SIZE-bytes to prevent creating buffers at runtime
-        FfxmUInt32 dataSize = job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries * sizeof(FfxmUInt32);
-        FFXM_ASSERT(dataSize <= FFXM_MAX_CONST_SIZE * sizeof(FfxmUInt32));
-
-        BackendContext_VK::UniformBuffer& uBuffer = backendContext->pRingBuffer[backendContext->ringBufferBase];
-
-        bufferDescriptorInfos[bufferDescriptorIndex].buffer = uBuffer.bufferResource;
-        bufferDescriptorInfos[bufferDescriptorIndex].offset = 0;
-        bufferDescriptorInfos[bufferDescriptorIndex].range = dataSize;
-
-        if (job->computeJobDescriptor.cbs[currentRootConstantIndex].data != nullptr)
-        {
-            memcpy(uBuffer.pData, job->computeJobDescriptor.cbs[currentRootConstantIndex].data, dataSize);
-
-            // flush mapped range if memory type is not coherent
-            if ((backendContext->ringBufferMemoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
-            {
-                VkMappedMemoryRange memoryRange;
-                memset(&memoryRange, 0, sizeof(memoryRange));
-
-                memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-                memoryRange.memory = backendContext->ringBufferMemory;
-                memoryRange.offset = FFXM_BUFFER_SIZE * backendContext->ringBufferBase;
-                memoryRange.size = dataSize;
+        const FfxmUInt32 currentSrvResourceIndex = job->computeJobDescriptor.pipeline->srvBufferBindings[currentPipelineSrvIndex].slotIndex;
 
-                backendContext->vkFunctionTable.vkFlushMappedMemoryRanges(backendContext->device, 1, &memoryRange);
-            }
+        if (useDescriptorWrites)
+        {
+            writeDescriptorSets[descriptorWriteIndex]                 = {};
+            writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->computeJobDescriptor.pipeline->srvBufferBindings[currentPipelineSrvIndex].bindSet];
+            writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
+            writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writeDescriptorSets[descriptorWriteIndex].pBufferInfo     = &descriptorData[descriptorIndex].buffer;
+            writeDescriptorSets[descriptorWriteIndex].dstBinding      = currentSrvResourceIndex;
+            writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+            ++descriptorWriteIndex;
         }
 
-        // Increment the base pointer in the ring buffer
-        ++backendContext->ringBufferBase;
-        if (backendContext->ringBufferBase >= FFXM_RING_BUFFER_SIZE * s_MaxEffectContexts)
-            backendContext->ringBufferBase = 0;
+        descriptorData[descriptorIndex].buffer        = {};
+        descriptorData[descriptorIndex].buffer.buffer = backendContext->pResources[resourceIndex].bufferResource;
+        descriptorData[descriptorIndex].buffer.offset = 0;
+        descriptorData[descriptorIndex].buffer.range  = VK_WHOLE_SIZE;
     }
 
     // If we are dispatching indirectly, transition the argument resource to indirect argument
-    if (job->computeJobDescriptor.pipeline.cmdSignature)
+    if (job->computeJobDescriptor.pipeline->cmdSignature)
     {
         addBarrier(backendContext, &job->computeJobDescriptor.cmdArgument, FFXM_RESOURCE_STATE_INDIRECT_ARGUMENT);
     }
@@ -3233,53 +4435,56 @@ static FfxmErrorCode executeGpuJobCompute(BackendContext_VK* backendContext, Ffx
     flushBarriers(backendContext, vkCommandBuffer);
 
     // update all uavs and srvs
-    backendContext->vkFunctionTable.vkUpdateDescriptorSets(backendContext->device, descriptorWriteIndex, writeDescriptorSets, 0, nullptr);
+    updateDescriptorSets(backendContext, pipelineLayout, job->computeJobDescriptor.pipeline->descriptorSetCount, descriptorData, writeDescriptorSets, descriptorWriteIndex);
 
     // bind pipeline
-    backendContext->vkFunctionTable.vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, reinterpret_cast<VkPipeline>(job->computeJobDescriptor.pipeline.pipeline));
+    backendContext->vkFunctionTable.vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, reinterpret_cast<VkPipeline>(job->computeJobDescriptor.pipeline->pipeline));
 
     // bind descriptor sets
-    backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout->pipelineLayout, 0, job->computeJobDescriptor.pipeline.descriptorSetCount, pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex], 0, nullptr);
+    bindDescriptorSets(backendContext, pipelineLayout, job->computeJobDescriptor.pipeline, descriptorData, constantBufferOffsets, VK_PIPELINE_BIND_POINT_COMPUTE, vkCommandBuffer);
 
     // Dispatch (or dispatch indirect)
-    if (job->computeJobDescriptor.pipeline.cmdSignature)
+    if (job->computeJobDescriptor.pipeline->cmdSignature)
     {
         const FfxmUInt32 resourceIndex = job->computeJobDescriptor.cmdArgument.internalIndex;
         VkBuffer buffer = backendContext->pResources[resourceIndex].bufferResource;
         backendContext->vkFunctionTable.vkCmdDispatchIndirect(vkCommandBuffer, buffer, job->computeJobDescriptor.cmdArgumentOffset);
     }
+    else if (job->computeJobDescriptor.groupRectCount && backendContext->vkFunctionTable.vkCmdDispatchBase)
+    {
+        for (FfxmUInt32 rectIndex = 0; rectIndex < job->computeJobDescriptor.groupRectCount; ++rectIndex)
+        {
+            const FfxmRect2D& groupRect = job->computeJobDescriptor.groupRects[rectIndex];
+            backendContext->vkFunctionTable.vkCmdDispatchBase(vkCommandBuffer, groupRect.x, groupRect.y, 0, groupRect.width, groupRect.height, job->computeJobDescriptor.dimensions[2]);
+        }
+    }
     else
     {
+        // without dispatch base the thread group rectangles fall back to the whole dispatch
         backendContext->vkFunctionTable.vkCmdDispatch(vkCommandBuffer, job->computeJobDescriptor.dimensions[0], job->computeJobDescriptor.dimensions[1], job->computeJobDescriptor.dimensions[2]);
     }
 
     // move to another descriptor set for the next compute render job so that we don't overwrite descriptors in-use
     ++pipelineLayout->descriptorSetIndex;
-    if (pipelineLayout->descriptorSetIndex >= FFXM_MAX_QUEUED_FRAMES)
+    if (pipelineLayout->descriptorSetIndex >= MAX_DESCRIPTOR_SET_RING)
         pipelineLayout->descriptorSetIndex = 0;
 
     return FFXM_OK;
 }
 
-static FfxmErrorCode executeGpuJobFragment(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, VkCommandBuffer vkCommandBuffer)
+// Schedules the barriers of a fragment job and gathers its descriptors. Returns the number of descriptor writes.
+// Within a subpass group, the resources shared by several subpasses are kept in the general layout.
+static FfxmUInt32 gatherGpuJobFragment(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, const SubpassGroup_VK* group,
+    DescriptorData* descriptorData, VkWriteDescriptorSet* writeDescriptorSets)
 {
     BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->fragmentJobDescription.pipeline->rootSignature);
 
     // bind texture & buffer UAVs (note the binding order here MUST match the root signature mapping order from CreatePipeline!)
+    // the descriptors are gathered in that order, which is the layout read by the descriptor update templates of the pipeline
+    const bool             useDescriptorWrites = !pipelineLayout->useDescriptorUpdateTemplates;
     FfxmUInt32               descriptorWriteIndex = 0;
-    VkWriteDescriptorSet   writeDescriptorSets[FFXM_MAX_RESOURCE_COUNT];
-
-    // These MUST be initialized
-    FfxmUInt32               imageDescriptorIndex = 0;
-    VkDescriptorImageInfo  imageDescriptorInfos[FFXM_MAX_RESOURCE_COUNT];
-    for (int i = 0; i < FFXM_MAX_RESOURCE_COUNT; ++i)
-        imageDescriptorInfos[i] = { VK_NULL_HANDLE, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
 
-    // These MUST be initialized
-    FfxmUInt32               bufferDescriptorIndex = 0;
-    VkDescriptorBufferInfo bufferDescriptorInfos[FFXM_MAX_RESOURCE_COUNT];
-    for (int i = 0; i < FFXM_MAX_RESOURCE_COUNT; ++i)
-        bufferDescriptorInfos[i] = { VK_NULL_HANDLE, 0, VK_WHOLE_SIZE };
+    FfxmUInt32               descriptorIndex = 0;
 
     // bind texture UAVs
     for (FfxmUInt32 currentPipelineUavIndex = 0; currentPipelineUavIndex < job->fragmentJobDescription.pipeline->uavTextureCount; ++currentPipelineUavIndex)
@@ -3289,158 +4494,232 @@ static FfxmErrorCode executeGpuJobFragment(BackendContext_VK* backendContext, Ff
         // where to bind it
         const FfxmUInt32 currentUavResourceIndex = job->fragmentJobDescription.pipeline->uavTextureBindings[currentPipelineUavIndex].slotIndex;
 
-        for (FfxmUInt32 uavEntry = 0; uavEntry < job->fragmentJobDescription.pipeline->uavTextureBindings[currentPipelineUavIndex].bindCount; ++uavEntry, ++imageDescriptorIndex, ++descriptorWriteIndex)
+        for (FfxmUInt32 uavEntry = 0; uavEntry < job->fragmentJobDescription.pipeline->uavTextureBindings[currentPipelineUavIndex].bindCount; ++uavEntry, ++descriptorIndex)
         {
             // source: UAV of resource to bind
             const FfxmUInt32 resourceIndex = job->fragmentJobDescription.uavTextures[currentPipelineUavIndex].internalIndex;
-            const FfxmUInt32 uavViewIndex = backendContext->pResources[resourceIndex].uavViewIndex + job->fragmentJobDescription.uavTextureMips[imageDescriptorIndex];
+            const FfxmUInt32 uavViewIndex = backendContext->pResources[resourceIndex].uavViewIndex + job->fragmentJobDescription.uavTextureMips[descriptorIndex];
 
-            writeDescriptorSets[descriptorWriteIndex] = {};
-            writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->fragmentJobDescription.pipeline->uavTextureBindings[currentPipelineUavIndex].bindSet];
-            writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-            writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-            writeDescriptorSets[descriptorWriteIndex].pImageInfo = &imageDescriptorInfos[imageDescriptorIndex];
-            writeDescriptorSets[descriptorWriteIndex].dstBinding = currentUavResourceIndex;
-            writeDescriptorSets[descriptorWriteIndex].dstArrayElement = uavEntry;
+            if (useDescriptorWrites)
+            {
+                writeDescriptorSets[descriptorWriteIndex] = {};
+                writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->fragmentJobDescription.pipeline->uavTextureBindings[currentPipelineUavIndex].bindSet];
+                writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
+                writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+                writeDescriptorSets[descriptorWriteIndex].pImageInfo = &descriptorData[descriptorIndex].image;
+                writeDescriptorSets[descriptorWriteIndex].dstBinding = currentUavResourceIndex;
+                writeDescriptorSets[descriptorWriteIndex].dstArrayElement = uavEntry;
+                ++descriptorWriteIndex;
+            }
 
-            imageDescriptorInfos[imageDescriptorIndex] = {};
-            imageDescriptorInfos[imageDescriptorIndex].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-            imageDescriptorInfos[imageDescriptorIndex].imageView = backendContext->pResourceViews[uavViewIndex].imageView;
+            descriptorData[descriptorIndex].image = {};
+            descriptorData[descriptorIndex].image.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+            descriptorData[descriptorIndex].image.imageView = backendContext->pResourceViews[uavViewIndex].imageView;
         }
     }
 
     // bind texture SRVs
-    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->fragmentJobDescription.pipeline->srvTextureCount;
-         ++currentPipelineSrvIndex, ++descriptorWriteIndex)
+    for (FfxmUInt32 currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->fragmentJobDescription.pipeline->srvTextureCount; ++currentPipelineSrvIndex)
     {
 
         // where to bind it
         const FfxmUInt32 currentSrvResourceIndex = job->fragmentJobDescription.pipeline->srvTextureBindings[currentPipelineSrvIndex].slotIndex;
 
-        writeDescriptorSets[descriptorWriteIndex]                 = {};
-        writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->fragmentJobDescription.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindSet];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = job->fragmentJobDescription.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindCount;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-        writeDescriptorSets[descriptorWriteIndex].pImageInfo      = &imageDescriptorInfos[imageDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding      = currentSrvResourceIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+        if (useDescriptorWrites)
+        {
+            writeDescriptorSets[descriptorWriteIndex]                 = {};
+            writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->fragmentJobDescription.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindSet];
+            writeDescriptorSets[descriptorWriteIndex].descriptorCount = job->fragmentJobDescription.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindCount;
+            writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            writeDescriptorSets[descriptorWriteIndex].pImageInfo      = &descriptorData[descriptorIndex].image;
+            writeDescriptorSets[descriptorWriteIndex].dstBinding      = currentSrvResourceIndex;
+            writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+            ++descriptorWriteIndex;
+        }
 
-        for(FfxmUInt32 i = 0; i < job->fragmentJobDescription.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindCount; ++i, ++imageDescriptorIndex)
+        for(FfxmUInt32 i = 0; i < job->fragmentJobDescription.pipeline->srvTextureBindings[currentPipelineSrvIndex].bindCount; ++i, ++descriptorIndex)
         {
-            addBarrier(backendContext, &job->fragmentJobDescription.srvTextures[currentPipelineSrvIndex + i], FFXM_RESOURCE_STATE_PIXEL_READ);
+            FfxmResourceInternal* srvTexture = &job->fragmentJobDescription.srvTextures[currentPipelineSrvIndex + i];
+            addBarrier(backendContext, srvTexture, getSubpassGroupResourceState(group, srvTexture->internalIndex, FFXM_RESOURCE_STATE_PIXEL_READ));
 
             const FfxmUInt32 resourceIndex = job->fragmentJobDescription.srvTextures[currentPipelineSrvIndex + i].internalIndex;
             const FfxmUInt32 srvViewIndex  = backendContext->pResources[resourceIndex].srvViewIndex;
 
-            imageDescriptorInfos[imageDescriptorIndex]             = {};
-            imageDescriptorInfos[imageDescriptorIndex].imageLayout = backendContext->pResources[resourceIndex].resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : getVKImageLayoutFromResourceState(backendContext->pResources[resourceIndex].currentState);
-            imageDescriptorInfos[imageDescriptorIndex].imageView   = backendContext->pResourceViews[srvViewIndex].imageView;
+            descriptorData[descriptorIndex].image             = {};
+            descriptorData[descriptorIndex].image.imageLayout = backendContext->pResources[resourceIndex].resourceDescription.usage & FFXM_RESOURCE_USAGE_DEPTHTARGET ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : getVKImageLayoutFromResourceState(backendContext->pResources[resourceIndex].currentState);
+            descriptorData[descriptorIndex].image.imageView   = backendContext->pResourceViews[srvViewIndex].imageView;
         }
     }
 
-    // update uniform buffers
-    for (FfxmUInt32 currentRootConstantIndex = 0; currentRootConstantIndex < job->fragmentJobDescription.pipeline->constCount; ++currentRootConstantIndex, ++bufferDescriptorIndex, ++descriptorWriteIndex)
+	// Tansit RTs
+	for(FfxmUInt32 rt = 0; rt < job->fragmentJobDescription.pipeline->rtCount; ++rt)
+	{
+		FfxmResourceInternal* rtTexture = &job->fragmentJobDescription.rtTextures[rt];
+		addBarrier(backendContext, rtTexture, getSubpassGroupResourceState(group, rtTexture->internalIndex, FFXM_RESOURCE_STATE_PIXEL_WRITE));
+	}
+
+    return descriptorWriteIndex;
+}
+
+// The render area of a fragment job, the bounds of its scissor rectangles or its whole viewport without them
+static VkRect2D getFragmentRenderArea(const FfxmFragmentJobDescription& fragmentJob)
+{
+    if (!fragmentJob.scissorRectCount)
+        return { { 0, 0 }, { fragmentJob.viewport[0], fragmentJob.viewport[1] } };
+
+    FfxmUInt32 left = UINT32_MAX, top = UINT32_MAX, right = 0, bottom = 0;
+    for (FfxmUInt32 rectIndex = 0; rectIndex < fragmentJob.scissorRectCount; ++rectIndex)
     {
-        writeDescriptorSets[descriptorWriteIndex] = {};
-        writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex][job->fragmentJobDescription.pipeline->constantBufferBindings[currentRootConstantIndex].bindSet];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        writeDescriptorSets[descriptorWriteIndex].pBufferInfo = &bufferDescriptorInfos[bufferDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding = job->fragmentJobDescription.pipeline->constantBufferBindings[currentRootConstantIndex].slotIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
+        const FfxmRect2D& rect = fragmentJob.scissorRects[rectIndex];
+        left = FFXM_MINIMUM(left, rect.x);
+        top = FFXM_MINIMUM(top, rect.y);
+        right = FFXM_MAXIMUM(right, rect.x + rect.width);
+        bottom = FFXM_MAXIMUM(bottom, rect.y + rect.height);
+    }
+    return { { int32_t(left), int32_t(top) }, { right - left, bottom - top } };
+}
 
-        // the ubo ring buffer is pre-populated with VkBuffer objects of FFXM_BUFFER_SIZE-bytes to prevent creating buffers at runtime
-        FfxmUInt32 dataSize = job->fragmentJobDescription.cbs[currentRootConstantIndex].num32BitEntries * sizeof(FfxmUInt32);
-        FFXM_ASSERT(dataSize <= FFXM_MAX_CONST_SIZE * sizeof(FfxmUInt32));
+// Records the draw of a fragment job in the current subpass
+static void drawGpuJobFragment(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, const FfxmUInt32* constantBufferOffsets,
+    const DescriptorData* descriptorData, const VkWriteDescriptorSet* writeDescriptorSets, FfxmUInt32 writeDescriptorSetCount, VkCommandBuffer vkCommandBuffer)
+{
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->fragmentJobDescription.pipeline->rootSignature);
 
-        BackendContext_VK::UniformBuffer& uBuffer = backendContext->pRingBuffer[backendContext->ringBufferBase];
+    // update all uavs and srvs
+    updateDescriptorSets(backendContext, pipelineLayout, job->fragmentJobDescription.pipeline->descriptorSetCount, descriptorData, writeDescriptorSets, writeDescriptorSetCount);
 
-        bufferDescriptorInfos[bufferDescriptorIndex].buffer = uBuffer.bufferResource;
-        bufferDescriptorInfos[bufferDescriptorIndex].offset = 0;
-        bufferDescriptorInfos[bufferDescriptorIndex].range = dataSize;
+    // bind pipeline
+    backendContext->vkFunctionTable.vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, reinterpret_cast<VkPipeline>(job->fragmentJobDescription.pipeline->pipeline));
 
-        if (job->fragmentJobDescription.cbs[currentRootConstantIndex].data)
-        {
-            memcpy(uBuffer.pData, job->fragmentJobDescription.cbs[currentRootConstantIndex].data, dataSize);
+    // bind descriptor sets
+    bindDescriptorSets(backendContext, pipelineLayout, job->fragmentJobDescription.pipeline, descriptorData, constantBufferOffsets, VK_PIPELINE_BIND_POINT_GRAPHICS, vkCommandBuffer);
 
-            // flush mapped range if memory type is not coherent
-            if ((backendContext->ringBufferMemoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
-            {
-                VkMappedMemoryRange memoryRange;
-                memset(&memoryRange, 0, sizeof(memoryRange));
+    VkViewport viewport = { 0.0f, 0.0f, (float)job->fragmentJobDescription.viewport[0], (float)job->fragmentJobDescription.viewport[1] };
+    vkCmdSetViewport(vkCommandBuffer, 0, 1, &viewport);
 
-                memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-                memoryRange.memory = backendContext->ringBufferMemory;
-                memoryRange.offset = FFXM_BUFFER_SIZE * backendContext->ringBufferBase;
-                memoryRange.size = dataSize;
+    // one draw per scissor rectangle, the full screen triangle is clipped to each of them
+    if (!job->fragmentJobDescription.scissorRectCount)
+    {
+        VkRect2D scissor = { { 0, 0 }, { job->fragmentJobDescription.viewport[0], job->fragmentJobDescription.viewport[1] } };
+        vkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
 
-                backendContext->vkFunctionTable.vkFlushMappedMemoryRanges(backendContext->device, 1, &memoryRange);
-            }
-        }
+        backendContext->vkFunctionTable.vkCmdDraw(vkCommandBuffer, 3, 1, 0, 0);
+    }
+    for (FfxmUInt32 rectIndex = 0; rectIndex < job->fragmentJobDescription.scissorRectCount; ++rectIndex)
+    {
+        const FfxmRect2D& rect = job->fragmentJobDescription.scissorRects[rectIndex];
+        VkRect2D scissor = { { int32_t(rect.x), int32_t(rect.y) }, { rect.width, rect.height } };
+        vkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
 
-        // Increment the base pointer in the ring buffer
-        ++backendContext->ringBufferBase;
-        if (backendContext->ringBufferBase >= FFXM_RING_BUFFER_SIZE * s_MaxEffectContexts)
-            backendContext->ringBufferBase = 0;
+        backendContext->vkFunctionTable.vkCmdDraw(vkCommandBuffer, 3, 1, 0, 0);
     }
 
-	// Tansit RTs
-	for(FfxmUInt32 rt = 0; rt < job->fragmentJobDescription.pipeline->rtCount; ++rt)
-	{
-		addBarrier(backendContext, &job->fragmentJobDescription.rtTextures[rt], FFXM_RESOURCE_STATE_PIXEL_WRITE);
-	}
+    // move to another descriptor set for the next compute render job so that we don't overwrite descriptors in-use
+    ++pipelineLayout->descriptorSetIndex;
+    if (pipelineLayout->descriptorSetIndex >= MAX_DESCRIPTOR_SET_RING)
+        pipelineLayout->descriptorSetIndex = 0;
+
+    // the pipelines are shared by the views of a component, the render target tells which effect context drew
+    const FfxmUInt32 effectContextId = FfxmUInt32(job->fragmentJobDescription.rtTextures[0].internalIndex) / FFXM_MAX_RESOURCE_COUNT;
+    backendContext->pEffectContexts[effectContextId].isEndOfUpscaler = pipelineLayout->isEndOfUpscaler;
+}
+
+static FfxmErrorCode executeGpuJobFragment(BackendContext_VK* backendContext, FfxmGpuJobDescription* job, const FfxmUInt32* constantBufferOffsets, VkCommandBuffer vkCommandBuffer)
+{
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->fragmentJobDescription.pipeline->rootSignature);
+
+    VkWriteDescriptorSet   writeDescriptorSets[FFXM_MAX_RESOURCE_COUNT];
+    DescriptorData         descriptorData[FFXM_MAX_RESOURCE_COUNT];
+    const FfxmUInt32       writeDescriptorSetCount = gatherGpuJobFragment(backendContext, job, nullptr, descriptorData, writeDescriptorSets);
 
     // insert all the barriers
     flushBarriers(backendContext, vkCommandBuffer);
 
-    // update all uavs and srvs
-    backendContext->vkFunctionTable.vkUpdateDescriptorSets(backendContext->device, descriptorWriteIndex, writeDescriptorSets, 0, nullptr);
-
-    getOrCreateRenderPass(backendContext, job);
+    // the attachments are only written in the scissor rectangles, their content is kept around them in the render area
+    getOrCreateRenderPass(backendContext, job, job->fragmentJobDescription.scissorRectCount > 1 ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_DONT_CARE);
 
     getOrCreateFrameBuffer(backendContext, job);
 
     getOrCreateGraphicsPipeline(backendContext, job);
 
     VkClearValue clearColor = { { 0.0f, 0.0f, 0.0f, 1.0f } };
-    VkExtent2D extent = { job->fragmentJobDescription.viewport[0], job->fragmentJobDescription.viewport[1] };
 
     VkRenderPassBeginInfo renderPassBeginInfo = {};
     renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassBeginInfo.renderPass = pipelineLayout->renderPass[pipelineLayout->renderPassIndex].handle;
-    renderPassBeginInfo.framebuffer = pipelineLayout->frameBuffer[pipelineLayout->frameBufferIndex].handle;
-    renderPassBeginInfo.renderArea.offset.x = 0;
-    renderPassBeginInfo.renderArea.offset.y = 0;
-    renderPassBeginInfo.renderArea.extent = extent;
+    renderPassBeginInfo.renderPass = pipelineLayout->currentRenderPass;
+    renderPassBeginInfo.framebuffer = pipelineLayout->currentFrameBuffer;
+    renderPassBeginInfo.renderArea = getFragmentRenderArea(job->fragmentJobDescription);
     renderPassBeginInfo.clearValueCount = 1;
     renderPassBeginInfo.pClearValues = &clearColor;
 
     backendContext->vkFunctionTable.vkCmdBeginRenderPass(vkCommandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-    // bind pipeline
-    backendContext->vkFunctionTable.vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, reinterpret_cast<VkPipeline>(job->fragmentJobDescription.pipeline->pipeline));
 
-    // bind descriptor sets
-    backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->pipelineLayout, 0, job->fragmentJobDescription.pipeline->descriptorSetCount, pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex], 0, nullptr);
+    drawGpuJobFragment(backendContext, job, constantBufferOffsets, descriptorData, writeDescriptorSets, writeDescriptorSetCount, vkCommandBuffer);
 
-    VkViewport viewport = { 0.0f, 0.0f, (float)job->fragmentJobDescription.viewport[0], (float)job->fragmentJobDescription.viewport[1] };
-    vkCmdSetViewport(vkCommandBuffer, 0, 1, &viewport);
+    backendContext->vkFunctionTable.vkCmdEndRenderPass(vkCommandBuffer);
 
-    VkRect2D scissor = { { 0, 0 }, { job->fragmentJobDescription.viewport[0], job->fragmentJobDescription.viewport[1] } };
-    vkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
+    return FFXM_OK;
+}
 
-    backendContext->vkFunctionTable.vkCmdDraw(vkCommandBuffer, 3, 1, 0, 0);
+// Records the jobs of a subpass group as the subpasses of one render pass
+static FfxmErrorCode executeGpuJobsFragmentMerged(BackendContext_VK* backendContext, const SubpassGroup_VK& group, VkCommandBuffer vkCommandBuffer)
+{
+    FfxmGpuJobDescription*             firstJob = &group.jobs[0].description;
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(firstJob->fragmentJobDescription.pipeline->rootSignature);
 
-    backendContext->vkFunctionTable.vkCmdEndRenderPass(vkCommandBuffer);
+    // no barrier can be recorded between the subpasses, transition the resources of all the jobs upfront
+    VkWriteDescriptorSet   writeDescriptorSets[MAX_MERGED_SUBPASSES][FFXM_MAX_RESOURCE_COUNT];
+    DescriptorData         descriptorData[MAX_MERGED_SUBPASSES][FFXM_MAX_RESOURCE_COUNT];
+    FfxmUInt32             writeDescriptorSetCounts[MAX_MERGED_SUBPASSES];
+    for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+        writeDescriptorSetCounts[subpass] = gatherGpuJobFragment(backendContext, &group.jobs[subpass].description, &group, descriptorData[subpass], writeDescriptorSets[subpass]);
 
-    // move to another descriptor set for the next compute render job so that we don't overwrite descriptors in-use
-    ++pipelineLayout->descriptorSetIndex;
-    if (pipelineLayout->descriptorSetIndex >= FFXM_MAX_QUEUED_FRAMES)
-        pipelineLayout->descriptorSetIndex = 0;
+    flushBarriers(backendContext, vkCommandBuffer);
+
+    FfxmUInt32 attachmentResources[MAX_MERGED_SUBPASSES * FFXM_MAX_NUM_RTS];
+    const FfxmUInt32 attachmentCount = getSubpassGroupAttachments(group, attachmentResources);
+
+    // the render area is the one of the first job, the other jobs may not write all of it
+    bool loadAttachments = firstJob->fragmentJobDescription.scissorRectCount > 1;
+    for (FfxmUInt32 subpass = 1; subpass < group.jobCount; ++subpass)
+        loadAttachments |= group.jobs[subpass].description.fragmentJobDescription.scissorRectCount > 0;
+    FFXM_VALIDATE(getOrCreateRenderPass(backendContext, group, attachmentResources, attachmentCount,
+        loadAttachments ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_DONT_CARE));
+
+    VkImageView attachments[MAX_MERGED_SUBPASSES * FFXM_MAX_NUM_RTS];
+    for (FfxmUInt32 attachment = 0; attachment < attachmentCount; ++attachment)
+        FFXM_VALIDATE(getOrCreateAttachmentView(backendContext, pipelineLayout, attachmentResources[attachment], attachments[attachment]));
+
+    FFXM_VALIDATE(getOrCreateFrameBuffer(backendContext, pipelineLayout, attachments, attachmentCount, firstJob->fragmentJobDescription.viewport[0], firstJob->fragmentJobDescription.viewport[1]));
+
+    // the pipelines of the other jobs are created for the render pass of the group and their subpass
+    for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+    {
+        BackendContext_VK::PipelineLayout* subpassPipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(group.jobs[subpass].description.fragmentJobDescription.pipeline->rootSignature);
+        subpassPipelineLayout->currentRenderPass = pipelineLayout->currentRenderPass;
+        FFXM_VALIDATE(getOrCreateGraphicsPipeline(backendContext, &group.jobs[subpass].description, subpass));
+    }
+
+    VkRenderPassBeginInfo renderPassBeginInfo = {};
+    renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassBeginInfo.renderPass = pipelineLayout->currentRenderPass;
+    renderPassBeginInfo.framebuffer = pipelineLayout->currentFrameBuffer;
+    renderPassBeginInfo.renderArea = getFragmentRenderArea(firstJob->fragmentJobDescription);
+
+    backendContext->vkFunctionTable.vkCmdBeginRenderPass(vkCommandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
 
-    backendContext->pEffectContexts[pipelineLayout->effectContextId].isEndOfUpscaler = !!wcscmp(pipelineLayout->name, L"FSR2-GEN_REACTIVE");
+    for (FfxmUInt32 subpass = 0; subpass < group.jobCount; ++subpass)
+    {
+        if (subpass > 0)
+            backendContext->vkFunctionTable.vkCmdNextSubpass(vkCommandBuffer, VK_SUBPASS_CONTENTS_INLINE);
+
+        drawGpuJobFragment(backendContext, &group.jobs[subpass].description, group.jobs[subpass].constantBufferOffsets,
+            descriptorData[subpass], writeDescriptorSets[subpass], writeDescriptorSetCounts[subpass], vkCommandBuffer);
+    }
+
+    backendContext->vkFunctionTable.vkCmdEndRenderPass(vkCommandBuffer);
 
     return FFXM_OK;
 }
@@ -3599,6 +4878,47 @@ static FfxmErrorCode executeGpuJobClearFloat(BackendContext_VK* backendContext,
     return FFXM_OK;
 }
 
+// Writes the timestamp starting a job when the effect context of its pipeline measures GPU timings, returns the first query of the job or -1.
+// The jobs of the asynchronous compute command list are not timed, they overlap the graphics work.
+static FfxmInt32 beginTimedJob(BackendContext_VK* backendContext, const FfxmPipelineState* pipeline, VkCommandBuffer vkCommandBuffer)
+{
+    const BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<const BackendContext_VK::PipelineLayout*>(pipeline->rootSignature);
+    BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[pipelineLayout->effectContextId];
+    if (effectContext.timestampQueryPool == VK_NULL_HANDLE || backendContext->recordingAsyncCompute)
+        return -1;
+
+    // the first job of a frame resets the range of the frame, the application waited for the frame using it before
+    const FfxmUInt32 frameIndex = FfxmUInt32(effectContext.frameCount % TIMESTAMP_FRAME_COUNT);
+    const FfxmUInt32 firstQuery = frameIndex * MAX_TIMED_JOBS * 2;
+    if (effectContext.timestampFrames[frameIndex] != effectContext.frameCount + 1)
+    {
+        backendContext->vkFunctionTable.vkCmdResetQueryPool(vkCommandBuffer, effectContext.timestampQueryPool, firstQuery, MAX_TIMED_JOBS * 2);
+        effectContext.timestampFrames[frameIndex] = effectContext.frameCount + 1;
+        effectContext.timedJobCounts[frameIndex] = 0;
+    }
+
+    FfxmUInt32& timedJobCount = effectContext.timedJobCounts[frameIndex];
+    if (timedJobCount >= MAX_TIMED_JOBS)
+        return -1;
+
+    effectContext.timedJobPasses[frameIndex][timedJobCount] = pipelineLayout->pass;
+    const FfxmUInt32 query = firstQuery + 2 * timedJobCount++;
+
+    // both timestamps wait for the previous commands, so that the passes do not overlap in the results
+    backendContext->vkFunctionTable.vkCmdWriteTimestamp(vkCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, effectContext.timestampQueryPool, query);
+    return FfxmInt32(query);
+}
+
+static void endTimedJob(BackendContext_VK* backendContext, const FfxmPipelineState* pipeline, FfxmInt32 query, VkCommandBuffer vkCommandBuffer)
+{
+    if (query < 0)
+        return;
+
+    const BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<const BackendContext_VK::PipelineLayout*>(pipeline->rootSignature);
+    const BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[pipelineLayout->effectContextId];
+    backendContext->vkFunctionTable.vkCmdWriteTimestamp(vkCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, effectContext.timestampQueryPool, FfxmUInt32(query) + 1);
+}
+
 FfxmErrorCode ExecuteGpuJobsVK(FfxmInterface* backendInterface, FfxmCommandList commandList)
 {
     FFXM_ASSERT(NULL != backendInterface);
@@ -3606,10 +4926,17 @@ FfxmErrorCode ExecuteGpuJobsVK(FfxmInterface* backendInterface, FfxmCommandList
 
     FfxmErrorCode errorCode = FFXM_OK;
 
+    // no asynchronous compute work to wait for unless ExecuteGpuJobsAsyncVK recorded some
+    backendContext->asyncComputeSemaphore = VK_NULL_HANDLE;
+
+    // make the constant buffers of all the jobs visible to the device at once
+    flushConstantBuffers(backendContext);
+
     // execute all renderjobs
     for (FfxmUInt32 i = 0; i < backendContext->gpuJobCount; ++i)
     {
-        FfxmGpuJobDescription* gpuJob = &backendContext->pGpuJobs[i];
+        FfxmGpuJobDescription* gpuJob = &backendContext->pGpuJobs[i].description;
+        const FfxmUInt32* constantBufferOffsets = backendContext->pGpuJobs[i].constantBufferOffsets;
         VkCommandBuffer vkCommandBuffer = reinterpret_cast<VkCommandBuffer>(commandList);
 
         switch (gpuJob->jobType)
@@ -3626,12 +4953,29 @@ FfxmErrorCode ExecuteGpuJobsVK(FfxmInterface* backendInterface, FfxmCommandList
         }
         case FFXM_GPU_JOB_COMPUTE:
         {
-            errorCode = executeGpuJobCompute(backendContext, gpuJob, vkCommandBuffer);
+            const FfxmInt32 timestampQuery = beginTimedJob(backendContext, gpuJob->computeJobDescriptor.pipeline, vkCommandBuffer);
+            errorCode = executeGpuJobCompute(backendContext, gpuJob, constantBufferOffsets, vkCommandBuffer);
+            endTimedJob(backendContext, gpuJob->computeJobDescriptor.pipeline, timestampQuery, vkCommandBuffer);
             break;
         }
         case FFXM_GPU_JOB_FRAGMENT:
         {
-            errorCode = executeGpuJobFragment(backendContext, gpuJob, vkCommandBuffer);
+            // the time of a subpass group goes to the pass of its first job
+            const FfxmPipelineState* pipeline = gpuJob->fragmentJobDescription.pipeline;
+            const FfxmInt32 timestampQuery = beginTimedJob(backendContext, pipeline, vkCommandBuffer);
+
+            SubpassGroup_VK subpassGroup;
+            if (gpuJob->fragmentJobDescription.mergeWithNextJob && getSubpassGroup(backendContext, i, subpassGroup) > 1)
+            {
+                errorCode = executeGpuJobsFragmentMerged(backendContext, subpassGroup, vkCommandBuffer);
+                i += subpassGroup.jobCount - 1;
+            }
+            else
+            {
+                errorCode = executeGpuJobFragment(backendContext, gpuJob, constantBufferOffsets, vkCommandBuffer);
+            }
+
+            endTimedJob(backendContext, pipeline, timestampQuery, vkCommandBuffer);
             break;
         }
         default:;
@@ -3648,4 +4992,232 @@ FfxmErrorCode ExecuteGpuJobsVK(FfxmInterface* backendInterface, FfxmCommandList
     return FFXM_OK;
 }
 
+template<typename Visitor>
+static void forEachGpuJobResource(const FfxmGpuJobDescription& job, Visitor visit)
+{
+    switch (job.jobType)
+    {
+    case FFXM_GPU_JOB_CLEAR_FLOAT:
+        visit(job.clearJobDescriptor.target.internalIndex);
+        break;
+    case FFXM_GPU_JOB_COPY:
+        visit(job.copyJobDescriptor.src.internalIndex);
+        visit(job.copyJobDescriptor.dst.internalIndex);
+        break;
+    case FFXM_GPU_JOB_COMPUTE:
+    {
+        const FfxmComputeJobDescription& computeJob = job.computeJobDescriptor;
+        for (FfxmUInt32 srvIndex = 0; srvIndex < computeJob.pipeline->srvTextureCount; ++srvIndex)
+            visit(computeJob.srvTextures[srvIndex].internalIndex);
+        for (FfxmUInt32 uavIndex = 0; uavIndex < computeJob.pipeline->uavTextureCount; ++uavIndex)
+            visit(computeJob.uavTextures[uavIndex].internalIndex);
+        for (FfxmUInt32 srvIndex = 0; srvIndex < computeJob.pipeline->srvBufferCount; ++srvIndex)
+            visit(computeJob.srvBuffers[srvIndex].internalIndex);
+        for (FfxmUInt32 uavIndex = 0; uavIndex < computeJob.pipeline->uavBufferCount; ++uavIndex)
+            visit(computeJob.uavBuffers[uavIndex].internalIndex);
+        break;
+    }
+    case FFXM_GPU_JOB_FRAGMENT:
+        forEachFragmentJobResource(job.fragmentJobDescription, [&](FfxmUInt32 resourceIndex, bool) { visit(FfxmInt32(resourceIndex)); });
+        break;
+    default:;
+    }
+}
+
+static bool gpuJobsShareResource(const FfxmGpuJobDescription& job, const FfxmGpuJobDescription& otherJob)
+{
+    bool shared = false;
+    forEachGpuJobResource(job, [&](FfxmInt32 resourceIndex) {
+        forEachGpuJobResource(otherJob, [&](FfxmInt32 otherResourceIndex) { shared |= resourceIndex == otherResourceIndex; });
+    });
+    return shared;
+}
+
+FfxmErrorCode ExecuteGpuJobsAsyncVK(FfxmInterface* backendInterface, FfxmCommandList commandList, FfxmCommandList asyncComputeCommandList)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+
+    if (!asyncComputeCommandList)
+        return ExecuteGpuJobsVK(backendInterface, commandList);
+
+    // a job goes to the compute queue when no earlier job staying on the graphics queue uses its resources,
+    // only the semaphore orders the two command lists
+    bool asyncJobs[FFXM_MAX_GPU_JOBS] = {};
+    FfxmUInt32 asyncJobCount = 0;
+    for (FfxmUInt32 i = 0; i < backendContext->gpuJobCount; ++i)
+    {
+        const FfxmGpuJobDescription& gpuJob = backendContext->pGpuJobs[i].description;
+        if (gpuJob.jobType != FFXM_GPU_JOB_COMPUTE || !gpuJob.computeJobDescriptor.asyncCompute)
+            continue;
+
+        asyncJobs[i] = true;
+        for (FfxmUInt32 j = 0; j < i && asyncJobs[i]; ++j)
+            asyncJobs[i] = asyncJobs[j] || !gpuJobsShareResource(gpuJob, backendContext->pGpuJobs[j].description);
+
+        asyncJobCount += asyncJobs[i] ? 1 : 0;
+    }
+
+    if (asyncJobCount == 0)
+        return ExecuteGpuJobsVK(backendInterface, commandList);
+
+    FfxmErrorCode errorCode = FFXM_OK;
+    VkCommandBuffer vkAsyncCommandBuffer = reinterpret_cast<VkCommandBuffer>(asyncComputeCommandList);
+    FfxmUInt32 effectContextId = 0;
+
+    backendContext->recordingAsyncCompute = true;
+    for (FfxmUInt32 i = 0; i < backendContext->gpuJobCount && errorCode == FFXM_OK; ++i)
+    {
+        if (!asyncJobs[i])
+            continue;
+
+        FfxmGpuJobDescription* gpuJob = &backendContext->pGpuJobs[i].description;
+        effectContextId = reinterpret_cast<BackendContext_VK::PipelineLayout*>(gpuJob->computeJobDescriptor.pipeline->rootSignature)->effectContextId;
+        errorCode = executeGpuJobCompute(backendContext, gpuJob, backendContext->pGpuJobs[i].constantBufferOffsets, vkAsyncCommandBuffer);
+    }
+    backendContext->recordingAsyncCompute = false;
+
+    FFXM_RETURN_ON_ERROR(
+        errorCode == FFXM_OK,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    // the semaphores cycle with the queued frames, so the one of a frame still in flight is never reused
+    BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    VkSemaphore& semaphore = effectContext.asyncComputeSemaphores[effectContext.asyncComputeSemaphoreIndex];
+    if (semaphore == VK_NULL_HANDLE)
+    {
+        VkSemaphoreCreateInfo semaphoreInfo = {};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+        FFXM_RETURN_ON_ERROR(
+            backendContext->vkFunctionTable.vkCreateSemaphore(backendContext->device, &semaphoreInfo, nullptr, &semaphore) == VK_SUCCESS,
+            FFXM_ERROR_BACKEND_API_ERROR);
+    }
+    effectContext.asyncComputeSemaphoreIndex = (effectContext.asyncComputeSemaphoreIndex + 1) % FFXM_MAX_QUEUED_FRAMES;
+
+    // the remaining jobs keep their order on the graphics command list
+    FfxmUInt32 graphicsJobCount = 0;
+    for (FfxmUInt32 i = 0; i < backendContext->gpuJobCount; ++i)
+    {
+        if (!asyncJobs[i])
+            backendContext->pGpuJobs[graphicsJobCount++] = backendContext->pGpuJobs[i];
+    }
+    backendContext->gpuJobCount = graphicsJobCount;
+
+    FFXM_RETURN_ON_ERROR(
+        ExecuteGpuJobsVK(backendInterface, commandList) == FFXM_OK,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    backendContext->asyncComputeSemaphore = semaphore;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode EnableGpuTimingsVK(FfxmInterface* backendInterface, FfxmUInt32 effectContextId)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    if (effectContext.timestampQueryPool != VK_NULL_HANDLE)
+        return FFXM_OK;
+
+    VkPhysicalDeviceProperties deviceProperties = {};
+    vkGetPhysicalDeviceProperties(backendContext->physicalDevice, &deviceProperties);
+    FFXM_RETURN_ON_ERROR(
+        deviceProperties.limits.timestampComputeAndGraphics,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    VkQueryPoolCreateInfo queryPoolInfo = {};
+    queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolInfo.queryCount = TIMESTAMP_FRAME_COUNT * MAX_TIMED_JOBS * 2;
+
+    FFXM_RETURN_ON_ERROR(
+        backendContext->vkFunctionTable.vkCreateQueryPool(backendContext->device, &queryPoolInfo, nullptr, &effectContext.timestampQueryPool) == VK_SUCCESS,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    memset(effectContext.timestampFrames, 0, sizeof(effectContext.timestampFrames));
+    memset(effectContext.timedJobCounts, 0, sizeof(effectContext.timedJobCounts));
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode GetGpuTimingsVK(FfxmInterface* backendInterface, FfxmUInt32 effectContextId, FfxmUInt64* passTimings, FfxmUInt32 passCount)
+{
+    FFXM_ASSERT(NULL != backendInterface);
+    FFXM_ASSERT(NULL != passTimings);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    const BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    FFXM_RETURN_ON_ERROR(
+        effectContext.timestampQueryPool != VK_NULL_HANDLE,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    memset(passTimings, 0, passCount * sizeof(FfxmUInt64));
+
+    // the application waited for this frame before recording the last one, its results are available
+    if (effectContext.frameCount <= FFXM_MAX_QUEUED_FRAMES)
+        return FFXM_OK;
+
+    const FfxmUInt64 frame = effectContext.frameCount - 1 - FFXM_MAX_QUEUED_FRAMES;
+    const FfxmUInt32 frameIndex = FfxmUInt32(frame % TIMESTAMP_FRAME_COUNT);
+    const FfxmUInt32 timedJobCount = effectContext.timedJobCounts[frameIndex];
+    if (effectContext.timestampFrames[frameIndex] != frame + 1 || timedJobCount == 0)
+        return FFXM_OK;
+
+    FfxmUInt64 timestamps[MAX_TIMED_JOBS * 2];
+    FFXM_RETURN_ON_ERROR(
+        backendContext->vkFunctionTable.vkGetQueryPoolResults(backendContext->device, effectContext.timestampQueryPool, frameIndex * MAX_TIMED_JOBS * 2, timedJobCount * 2,
+            sizeof(timestamps), timestamps, sizeof(FfxmUInt64), VK_QUERY_RESULT_64_BIT) == VK_SUCCESS,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    for (FfxmUInt32 jobIndex = 0; jobIndex < timedJobCount; ++jobIndex)
+    {
+        const FfxmUInt32 pass = effectContext.timedJobPasses[frameIndex][jobIndex];
+        if (pass < passCount)
+            passTimings[pass] += FfxmUInt64(double(timestamps[2 * jobIndex + 1] - timestamps[2 * jobIndex]) * backendContext->timestampPeriod);
+    }
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmSetAsyncComputeQueueFamiliesVK(FfxmInterface* backendInterface, uint32_t graphicsQueueFamilyIndex, uint32_t asyncComputeQueueFamilyIndex)
+{
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+
+    // the sharing mode of the resources is fixed at their creation
+    FFXM_RETURN_ON_ERROR(
+        !s_BackendRefCount,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    backendContext->queueFamilyIndices[0] = graphicsQueueFamilyIndex;
+    backendContext->queueFamilyIndices[1] = asyncComputeQueueFamilyIndex;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmGetAsyncComputeSemaphoreVK(FfxmInterface* backendInterface, VkSemaphore* semaphore, VkPipelineStageFlags* waitStageMask)
+{
+    FFXM_RETURN_ON_ERROR(
+        backendInterface,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        semaphore,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        s_BackendRefCount,
+        FFXM_ERROR_BACKEND_API_ERROR);
+
+    const BackendContext_VK* backendContext = (const BackendContext_VK*)backendInterface->scratchBuffer;
+    *semaphore = backendContext->asyncComputeSemaphore;
+    if (waitStageMask)
+        *waitStageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+
+    return FFXM_OK;
+}
+
 } // namespace arm
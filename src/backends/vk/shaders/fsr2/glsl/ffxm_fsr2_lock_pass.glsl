@@ -24,10 +24,22 @@
 #extension GL_GOOGLE_include_directive : require
 #extension GL_EXT_samplerless_texture_functions : require
 
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                  0
+#define FSR2_BIND_SRV_INPUT_DEPTH                           1
+#define FSR2_BIND_SRV_INPUT_COLOR                           2
+#define FSR2_BIND_SRV_INPUT_EXPOSURE                        3
+
+#define FSR2_BIND_UAV_NEW_LOCKS                             4
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      5
+#define FSR2_BIND_UAV_DILATED_DEPTH                         6
+#define FSR2_BIND_UAV_DILATED_MOTION_VECTORS                7
+#else
 #define FSR2_BIND_SRV_LOCK_INPUT_LUMA                       0
 
 #define FSR2_BIND_UAV_NEW_LOCKS                             1
 #define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      2
+#endif
 
 #define FSR2_BIND_CB_FSR2                                   0
 
@@ -42,11 +54,6 @@
 #define FFXM_GLSL 1
 #endif
 
-#include "fsr2/ffxm_fsr2_callbacks_glsl.h"
-#include "fsr2/ffxm_fsr2_common.h"
-#include "fsr2/ffxm_fsr2_sample.h"
-#include "fsr2/ffxm_fsr2_lock.h"
-
 #ifndef FFXM_FSR2_THREAD_GROUP_WIDTH
 #define FFXM_FSR2_THREAD_GROUP_WIDTH 8
 #endif // #ifndef FFXM_FSR2_THREAD_GROUP_WIDTH
@@ -60,10 +67,22 @@
 #define FFXM_FSR2_NUM_THREADS layout (local_size_x = FFXM_FSR2_THREAD_GROUP_WIDTH, local_size_y = FFXM_FSR2_THREAD_GROUP_HEIGHT, local_size_z = FFXM_FSR2_THREAD_GROUP_DEPTH) in;
 #endif // #ifndef FFXM_FSR2_NUM_THREADS
 
+#include "fsr2/ffxm_fsr2_callbacks_glsl.h"
+#include "fsr2/ffxm_fsr2_common.h"
+#include "fsr2/ffxm_fsr2_sample.h"
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+#include "fsr2/ffxm_fsr2_reconstruct_dilated_velocity_and_previous_depth.h"
+#endif
+#include "fsr2/ffxm_fsr2_lock.h"
+
 FFXM_FSR2_NUM_THREADS
 void main()
 {
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+    ReconstructAndLock(ivec2(gl_WorkGroupID.xy * uvec2(FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT)), ivec2(gl_LocalInvocationID.xy));
+#else
     uvec2 uDispatchThreadId = gl_WorkGroupID.xy * uvec2(FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT) + gl_LocalInvocationID.xy;
 
     ComputeLock(ivec2(uDispatchThreadId));
+#endif
 }
@@ -53,6 +53,12 @@
 
 #define FSR2_BIND_UAV_NEW_LOCKS                              12
 
+// The half resolution depth clip of the performance preset leaves the input color to prepare, and is upsampled along the dilated depth
+#if FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE && !FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE && FFXM_FSR2_OPTION_HALF_RES_DEPTH_CLIP
+#define FSR2_BIND_SRV_INPUT_COLOR                            13
+#define FSR2_BIND_SRV_DILATED_DEPTH                          14
+#endif
+
 #define FSR2_BIND_CB_FSR2                                    0
 
 // Global mandatory defines
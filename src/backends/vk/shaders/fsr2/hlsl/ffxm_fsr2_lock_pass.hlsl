@@ -19,6 +19,22 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS                  0
+#define FSR2_BIND_SRV_INPUT_DEPTH                           1
+#define FSR2_BIND_SRV_INPUT_COLOR                           2
+#if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
+#define FSR2_BIND_UAV_NEW_LOCKS                             3
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      4
+#define FSR2_BIND_UAV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA 5
+#else
+#define FSR2_BIND_SRV_INPUT_EXPOSURE                        3
+#define FSR2_BIND_UAV_NEW_LOCKS                             4
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      5
+#define FSR2_BIND_UAV_DILATED_DEPTH                         6
+#define FSR2_BIND_UAV_DILATED_MOTION_VECTORS                7
+#endif
+#else
 #if FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE
 #define FSR2_BIND_SRV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA 0
 #else
@@ -27,6 +43,7 @@
 
 #define FSR2_BIND_UAV_NEW_LOCKS                             1
 #define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH      2
+#endif
 
 #define FSR2_BIND_CB_FSR2                                   0
 
@@ -41,11 +58,6 @@
 #define FFXM_HLSL 1
 #endif
 
-#include "fsr2/ffxm_fsr2_callbacks_hlsl.h"
-#include "fsr2/ffxm_fsr2_common.h"
-#include "fsr2/ffxm_fsr2_sample.h"
-#include "fsr2/ffxm_fsr2_lock.h"
-
 #ifndef FFXM_FSR2_THREAD_GROUP_WIDTH
 #define FFXM_FSR2_THREAD_GROUP_WIDTH 8
 #endif // #ifndef FFXM_FSR2_THREAD_GROUP_WIDTH
@@ -59,12 +71,24 @@
 #define FFXM_FSR2_NUM_THREADS [numthreads(FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT, FFXM_FSR2_THREAD_GROUP_DEPTH)]
 #endif // #ifndef FFXM_FSR2_NUM_THREADS
 
+#include "fsr2/ffxm_fsr2_callbacks_hlsl.h"
+#include "fsr2/ffxm_fsr2_common.h"
+#include "fsr2/ffxm_fsr2_sample.h"
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+#include "fsr2/ffxm_fsr2_reconstruct_dilated_velocity_and_previous_depth.h"
+#endif
+#include "fsr2/ffxm_fsr2_lock.h"
+
 FFXM_PREFER_WAVE64
 FFXM_FSR2_NUM_THREADS
 FFXM_FSR2_EMBED_ROOTSIG_CONTENT
 void main(uint2 uGroupId : SV_GroupID, uint2 uGroupThreadId : SV_GroupThreadID)
 {
+#if FFXM_FSR2_OPTION_FUSED_RECONSTRUCT_AND_LOCK
+    ReconstructAndLock(uGroupId * uint2(FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT), uGroupThreadId);
+#else
     uint2 uDispatchThreadId = uGroupId * uint2(FFXM_FSR2_THREAD_GROUP_WIDTH, FFXM_FSR2_THREAD_GROUP_HEIGHT) + uGroupThreadId;
 
     ComputeLock(uDispatchThreadId);
+#endif
 }
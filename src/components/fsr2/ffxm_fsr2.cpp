@@ -22,8 +22,12 @@
 #include <algorithm>    // for max used inside SPD CPU code.
 #include <cmath>        // for fabs, abs, sinf, sqrt, etc.
 #include <string.h>     // for memset
+#include <stdlib.h>     // for malloc, free of the capture readback
 #include <cfloat>       // for FLT_EPSILON
+#include <cwchar>      // for wcscpy
+#include <vector>       // for the Lanczos weight table
 #include "ffxm_fsr2.h"
+#include "ffxm_fsr2_capture.h"
 #define FFXM_CPU
 #include "ffxm_core.h"
 #include "fsr1/ffxm_fsr1.h"
@@ -46,6 +50,10 @@ namespace arm
 // max queued frames for descriptor management
 static const uint32_t FSR2_MAX_QUEUED_FRAMES = 16;
 
+// context flags selecting permutations only compiled from source, see FSR2_SHADER_PERMUTATION_SOURCE_ONLY
+static const uint32_t FSR2_SOURCE_PERMUTATION_FLAGS = FFXM_FSR2_ENABLE_HALF_RES_DEPTH_CLIP | FFXM_FSR2_ENABLE_FUSED_RECONSTRUCT_AND_LOCK |
+                                                     FFXM_FSR2_ENABLE_SUBGROUP_LUMINANCE_PYRAMID | FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE;
+
 // lists to map shader resource bindpoint name to resource identifier
 typedef struct ResourceBinding
 {
@@ -190,6 +198,32 @@ static float halton(int32_t index, int32_t base)
     return result;
 }
 
+// The regions of a dispatch must be non empty rectangles of the output.
+static bool fsr2RegionsValid(const FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params)
+{
+    if (params->regionCount > FFXM_FSR2_MAX_DISPATCH_REGIONS || (params->regionCount && !params->regions))
+        return false;
+
+    const FfxmDimensions2D& displaySize = context->contextDescription.displaySize;
+    for (uint32_t regionIndex = 0; regionIndex < params->regionCount; ++regionIndex)
+    {
+        const FfxmRect2D& region = params->regions[regionIndex];
+        if (!region.width || !region.height || region.width > displaySize.width - FFXM_MINIMUM(region.x, displaySize.width) ||
+            region.height > displaySize.height - FFXM_MINIMUM(region.y, displaySize.height))
+            return false;
+    }
+
+    return true;
+}
+
+// The foveation of a dispatch has at most FFXM_FSR2_MAX_FOVEATION_CENTERS centers and no negative distances.
+static bool fsr2FoveationValid(const FfxmFsr2DispatchDescription* params)
+{
+    const FfxmFsr2FoveationDescription& foveation = params->foveation;
+    return foveation.centerCount <= FFXM_FSR2_MAX_FOVEATION_CENTERS &&
+           (!foveation.centerCount || (foveation.radius >= 0.0f && foveation.falloff >= 0.0f));
+}
+
 static void fsr2DebugCheckDispatch(FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params)
 {
     if (params->commandList == nullptr)
@@ -401,6 +435,25 @@ static uint32_t getPipelinePermutationFlags(FfxmFsr2ShaderQualityMode qualityMod
 	flags |= (qualityMode == FFXM_FSR2_SHADER_QUALITY_MODE_PERFORMANCE) ? (FSR2_SHADER_PERMUTATION_APPLY_BALANCED_OPT | FSR2_SHADER_PERMUTATION_APPLY_PERFORMANCE_OPT) : 0;
     flags |= (qualityMode == FFXM_FSR2_SHADER_QUALITY_MODE_ULTRA_PERFORMANCE) ? FSR2_SHADER_PERMUTATION_APPLY_ULTRA_PERFORMANCE_OPT : 0;
 
+    // The performance and ultra performance depth clip passes can run at half resolution, the accumulation passes
+    // upsample their output. With the performance preset they then prepare the input color themselves.
+    const bool halfResDepthClipPass = passId == FFXM_FSR2_PASS_DEPTH_CLIP || passId == FFXM_FSR2_PASS_ACCUMULATE || passId == FFXM_FSR2_PASS_ACCUMULATE_SHARPEN;
+    const bool halfResDepthClipMode = qualityMode == FFXM_FSR2_SHADER_QUALITY_MODE_PERFORMANCE || qualityMode == FFXM_FSR2_SHADER_QUALITY_MODE_ULTRA_PERFORMANCE;
+    const bool halfResDepthClip = (contextFlags & FFXM_FSR2_ENABLE_HALF_RES_DEPTH_CLIP) && halfResDepthClipMode && halfResDepthClipPass;
+    flags |= halfResDepthClip ? FSR2_SHADER_PERMUTATION_HALF_RES_DEPTH_CLIP : 0;
+
+    // The fused lock pass also dilates the inputs and reconstructs the previous depth
+    const bool fusedReconstructAndLock = (contextFlags & FFXM_FSR2_ENABLE_FUSED_RECONSTRUCT_AND_LOCK) && passId == FFXM_FSR2_PASS_LOCK;
+    flags |= fusedReconstructAndLock ? FSR2_SHADER_PERMUTATION_FUSED_RECONSTRUCT_AND_LOCK : 0;
+
+    // The subgroup pyramid only writes the shading change mip and the exposure
+    const bool subgroupLuminancePyramid = (contextFlags & FFXM_FSR2_ENABLE_SUBGROUP_LUMINANCE_PYRAMID) && passId == FFXM_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID;
+    flags |= subgroupLuminancePyramid ? FSR2_SHADER_PERMUTATION_SUBGROUP_LUMINANCE_PYRAMID : 0;
+
+    // Only the accumulation passes upsample with the Lanczos weights
+    const bool lanczosWeightTable = (contextFlags & FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE) && (passId == FFXM_FSR2_PASS_ACCUMULATE || passId == FFXM_FSR2_PASS_ACCUMULATE_SHARPEN);
+    flags |= lanczosWeightTable ? FSR2_SHADER_PERMUTATION_LANCZOS_WEIGHT_TABLE : 0;
+
 	// Indicate if running on GLES 3.2
 	flags |= (contextFlags & FFXM_FSR2_OPENGL_ES_3_2) ? FSR2_SHADER_PERMUTATION_PLATFORM_GLES_3_2 : 0;
 
@@ -468,10 +521,14 @@ static FfxmErrorCode createPipelineStates(FfxmFsr2Context_Private* context)
     FFXM_VALIDATE(context->contextDescription.backendInterface.fpCreateGraphicsPipeline(&context->contextDescription.backendInterface, FFXM_EFFECT_FSR2, FFXM_FSR2_PASS_DEPTH_CLIP,
 		context->contextDescription.qualityMode, getPipelinePermutationFlags(context->contextDescription.qualityMode, contextFlags, FFXM_FSR2_PASS_DEPTH_CLIP, supportedFP16, canForceWave64),
         &pipelineDescription, context->effectContextId, &context->pipelineDepthClip));
-    wcscpy(pipelineDescription.name, L"FSR2-RECON_PREV_DEPTH");
-    FFXM_VALIDATE(context->contextDescription.backendInterface.fpCreateGraphicsPipeline(&context->contextDescription.backendInterface, FFXM_EFFECT_FSR2, FFXM_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH,
-		context->contextDescription.qualityMode, getPipelinePermutationFlags(context->contextDescription.qualityMode, contextFlags, FFXM_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, supportedFP16, canForceWave64),
-        &pipelineDescription, context->effectContextId, &context->pipelineReconstructPreviousDepth));
+    // The fused lock pass replaces the reconstruction pass, which is left empty
+    if (!(contextFlags & FFXM_FSR2_ENABLE_FUSED_RECONSTRUCT_AND_LOCK))
+    {
+        wcscpy(pipelineDescription.name, L"FSR2-RECON_PREV_DEPTH");
+        FFXM_VALIDATE(context->contextDescription.backendInterface.fpCreateGraphicsPipeline(&context->contextDescription.backendInterface, FFXM_EFFECT_FSR2, FFXM_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH,
+            context->contextDescription.qualityMode, getPipelinePermutationFlags(context->contextDescription.qualityMode, contextFlags, FFXM_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, supportedFP16, canForceWave64),
+            &pipelineDescription, context->effectContextId, &context->pipelineReconstructPreviousDepth));
+    }
     wcscpy(pipelineDescription.name, L"FSR2-LOCK");
     FFXM_VALIDATE(context->contextDescription.backendInterface.fpCreateComputePipeline(&context->contextDescription.backendInterface, FFXM_EFFECT_FSR2, FFXM_FSR2_PASS_LOCK,
 		context->contextDescription.qualityMode, getPipelinePermutationFlags(context->contextDescription.qualityMode, contextFlags, FFXM_FSR2_PASS_LOCK, supportedFP16, canForceWave64),
@@ -498,13 +555,343 @@ static FfxmErrorCode createPipelineStates(FfxmFsr2Context_Private* context)
     return FFXM_OK;
 }
 
-static FfxmErrorCode createResourceFromDescription(FfxmFsr2Context_Private* context, const FfxmInternalResourceDescription* resDesc)
+// Resolve the description of a render target ahead of the first dispatch, ping-ponged
+// resources are resolved to their first instance since both share the same description.
+static bool getRenderTargetDescription(FfxmFsr2Context_Private* context, uint32_t resourceIdentifier, FfxmResourceDescription* outDescription)
+{
+    switch (resourceIdentifier)
+    {
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT:
+        *outDescription = {};
+        outDescription->type = FFXM_RESOURCE_TYPE_TEXTURE2D;
+        outDescription->format = context->contextDescription.outputFormat;
+        outDescription->width = context->contextDescription.displaySize.width;
+        outDescription->height = context->contextDescription.displaySize.height;
+        outDescription->depth = 1;
+        outDescription->mipCount = 1;
+        outDescription->usage = FFXM_RESOURCE_USAGE_RENDERTARGET;
+        return true;
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE:
+        // provided by the application with each call to ffxmFsr2ContextGenerateReactiveMask
+        return false;
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS:
+        resourceIdentifier = FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1;
+        break;
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR:
+        resourceIdentifier = FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_1;
+        break;
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE:
+        resourceIdentifier = FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE_1;
+        break;
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS:
+        resourceIdentifier = FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_1;
+        break;
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY:
+        resourceIdentifier = FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_1;
+        break;
+    case FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA:
+        resourceIdentifier = FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA_1;
+        break;
+    default:
+        break;
+    }
+
+    *outDescription = context->contextDescription.backendInterface.fpGetResourceDescription(&context->contextDescription.backendInterface, context->views[0].rtResources[resourceIdentifier]);
+    return true;
+}
+
+static FfxmErrorCode prewarmPipelineStates(FfxmFsr2Context_Private* context)
+{
+    FFXM_ASSERT(context);
+
+    // optional in the backend interface
+    if (!context->contextDescription.backendInterface.fpPrewarmGraphicsPipeline)
+        return FFXM_OK;
+
+    FfxmPipelineState* graphicsPipelines[] = { &context->pipelineDepthClip, &context->pipelineReconstructPreviousDepth, &context->pipelineAccumulate,
+                                              &context->pipelineAccumulateSharpen, &context->pipelineRCAS, &context->pipelineGenerateReactive };
+
+    for (FfxmPipelineState* pipeline : graphicsPipelines)
+    {
+        // pipelines of the passes this context doesn't run are not created
+        if (!pipeline->pipeline)
+            continue;
+
+        FfxmResourceDescription rtDescriptions[FFXM_MAX_NUM_RTS];
+        bool rtDescriptionsKnown = true;
+        for (uint32_t currentRtIndex = 0; currentRtIndex < pipeline->rtCount; ++currentRtIndex)
+        {
+            rtDescriptionsKnown &= getRenderTargetDescription(context, pipeline->rtBindings[currentRtIndex].resourceIdentifier, &rtDescriptions[currentRtIndex]);
+        }
+
+        if (rtDescriptionsKnown)
+        {
+            FFXM_VALIDATE(context->contextDescription.backendInterface.fpPrewarmGraphicsPipeline(&context->contextDescription.backendInterface, pipeline, rtDescriptions, pipeline->rtCount));
+        }
+    }
+
+    return FFXM_OK;
+}
+
+static FfxmCreateResourceDescription getCreateResourceDescription(const FfxmInternalResourceDescription* resDesc)
 {
 	const FfxmResourceType resourceType = resDesc->type;
     const FfxmResourceDescription resourceDescription = { resourceType, resDesc->format, resDesc->width, resDesc->height, 1, resDesc->mipCount, FFXM_RESOURCE_FLAGS_NONE, resDesc->usage };
     const FfxmResourceStates initialState = (resDesc->usage == FFXM_RESOURCE_USAGE_READ_ONLY) ? FFXM_RESOURCE_STATE_COMPUTE_READ : (resDesc->usage == FFXM_RESOURCE_USAGE_RENDERTARGET) ? FFXM_RESOURCE_STATE_PIXEL_WRITE : FFXM_RESOURCE_STATE_UNORDERED_ACCESS;
     const FfxmCreateResourceDescription createResourceDescription = { FFXM_HEAP_TYPE_DEFAULT, resourceDescription, initialState, resDesc->initDataSize, resDesc->initData, resDesc->name, resDesc->id };
-	return context->contextDescription.backendInterface.fpCreateResource(&context->contextDescription.backendInterface, &createResourceDescription, context->effectContextId, &context->srvResources[resDesc->id]);
+    return createResourceDescription;
+}
+
+static FfxmErrorCode createResourceFromDescription(FfxmFsr2Context_Private* context, Fsr2View* view, const FfxmInternalResourceDescription* resDesc)
+{
+    const FfxmCreateResourceDescription createResourceDescription = getCreateResourceDescription(resDesc);
+	return context->contextDescription.backendInterface.fpCreateResource(&context->contextDescription.backendInterface, &createResourceDescription, view->effectContextId, &view->srvResources[resDesc->id]);
+}
+
+// Position of each pass in the frame, in the order fsr2Dispatch schedules them.
+typedef enum Fsr2PassOrder {
+    FSR2_PASS_ORDER_COMPUTE_LUMINANCE_PYRAMID,
+    FSR2_PASS_ORDER_RECONSTRUCT_PREVIOUS_DEPTH,
+    FSR2_PASS_ORDER_DEPTH_CLIP,
+    FSR2_PASS_ORDER_LOCK,
+    FSR2_PASS_ORDER_ACCUMULATE,
+    FSR2_PASS_ORDER_RCAS,
+} Fsr2PassOrder;
+
+// The passes between which the content of a transient resource must be preserved.
+typedef struct Fsr2ResourceLifetime {
+    uint32_t                    id;
+    Fsr2PassOrder               firstPass;
+    Fsr2PassOrder               lastPass;
+} Fsr2ResourceLifetime;
+
+// Lifetimes of the resources which can share memory, sorted by first pass.
+// FSR2_ReconstructedPrevNearestDepth and FSR2_SpdAtomicCounter carry data to the next frame and are never aliased.
+// FSR2_NewLocks is reset by the accumulate pass for the next frame, when aliased it is cleared before the lock pass instead.
+// All of them but FSR2_NewLocks are live during the depth clip pass, so no placement can save more than its size.
+static const Fsr2ResourceLifetime transientResourceLifetimes[] = {
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE,            FSR2_PASS_ORDER_COMPUTE_LUMINANCE_PYRAMID,  FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH,              FSR2_PASS_ORDER_RECONSTRUCT_PREVIOUS_DEPTH, FSR2_PASS_ORDER_DEPTH_CLIP },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_INPUT_LUMA,            FSR2_PASS_ORDER_RECONSTRUCT_PREVIOUS_DEPTH, FSR2_PASS_ORDER_LOCK },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR,       FSR2_PASS_ORDER_DEPTH_CLIP,                 FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS,     FSR2_PASS_ORDER_DEPTH_CLIP,                 FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS,                  FSR2_PASS_ORDER_LOCK,                       FSR2_PASS_ORDER_ACCUMULATE },
+};
+
+// The fused lock pass runs in place of the reconstruction and writes the new locks ahead of the depth clip.
+// The lock input luma only lives in its groupshared memory.
+static const Fsr2ResourceLifetime transientResourceLifetimesFused[] = {
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE,            FSR2_PASS_ORDER_COMPUTE_LUMINANCE_PYRAMID,  FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH,              FSR2_PASS_ORDER_RECONSTRUCT_PREVIOUS_DEPTH, FSR2_PASS_ORDER_DEPTH_CLIP },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS,                  FSR2_PASS_ORDER_RECONSTRUCT_PREVIOUS_DEPTH, FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR,       FSR2_PASS_ORDER_DEPTH_CLIP,                 FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS,     FSR2_PASS_ORDER_DEPTH_CLIP,                 FSR2_PASS_ORDER_ACCUMULATE },
+};
+
+// Ultra performance skips the luminance pyramid, the scene luminance is only touched by the reset clear.
+static const Fsr2ResourceLifetime transientResourceLifetimesUltraPerformance[] = {
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE,            FSR2_PASS_ORDER_COMPUTE_LUMINANCE_PYRAMID,  FSR2_PASS_ORDER_COMPUTE_LUMINANCE_PYRAMID },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS,     FSR2_PASS_ORDER_DEPTH_CLIP,                 FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS,                  FSR2_PASS_ORDER_LOCK,                       FSR2_PASS_ORDER_ACCUMULATE },
+};
+
+static const Fsr2ResourceLifetime transientResourceLifetimesUltraPerformanceFused[] = {
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE,            FSR2_PASS_ORDER_COMPUTE_LUMINANCE_PYRAMID,  FSR2_PASS_ORDER_COMPUTE_LUMINANCE_PYRAMID },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS,                  FSR2_PASS_ORDER_RECONSTRUCT_PREVIOUS_DEPTH, FSR2_PASS_ORDER_ACCUMULATE },
+    { FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS,     FSR2_PASS_ORDER_DEPTH_CLIP,                 FSR2_PASS_ORDER_ACCUMULATE },
+};
+
+static const Fsr2ResourceLifetime* findResourceLifetime(const Fsr2ResourceLifetime* lifetimes, uint32_t lifetimeCount, uint32_t resourceId)
+{
+    for (uint32_t lifetimeIndex = 0; lifetimeIndex < lifetimeCount; ++lifetimeIndex)
+    {
+        if (lifetimes[lifetimeIndex].id == resourceId)
+            return &lifetimes[lifetimeIndex];
+    }
+
+    return nullptr;
+}
+
+// Assign an alias slot to each transient resource so that resources sharing a slot have disjoint lifetimes.
+// Resources are visited by first pass and placed in the first slot released by then (interval partitioning).
+static uint32_t planResourceAliasing(const Fsr2ResourceLifetime* const* lifetimes, uint32_t resourceCount, uint32_t* outAliasSlots)
+{
+    uint32_t slotLastPass[FFXM_MAX_ALIAS_HEAPS];
+    uint32_t slotCount = 0;
+
+    for (uint32_t resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex)
+    {
+        FFXM_ASSERT(resourceIndex == 0 || lifetimes[resourceIndex - 1]->firstPass <= lifetimes[resourceIndex]->firstPass);
+
+        uint32_t slot = 0;
+        while (slot < slotCount && slotLastPass[slot] >= uint32_t(lifetimes[resourceIndex]->firstPass))
+            ++slot;
+
+        FFXM_ASSERT(slot < FFXM_MAX_ALIAS_HEAPS);
+        if (slot == slotCount)
+            ++slotCount;
+
+        slotLastPass[slot] = lifetimes[resourceIndex]->lastPass;
+        outAliasSlots[resourceIndex] = slot;
+    }
+
+    return slotCount;
+}
+
+static FfxmErrorCode createAliasedResourcesFromDescriptions(FfxmFsr2Context_Private* context, Fsr2View* view, const FfxmInternalResourceDescription* resDescs, uint32_t resourceCount,
+                                                           const Fsr2ResourceLifetime* lifetimes, uint32_t lifetimeCount)
+{
+    const Fsr2ResourceLifetime* resourceLifetimes[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+    const FfxmInternalResourceDescription* plannedResourceDescs[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+    uint32_t aliasSlots[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+
+    // visit the resources in lifetime order
+    uint32_t plannedResourceCount = 0;
+    for (uint32_t lifetimeIndex = 0; lifetimeIndex < lifetimeCount; ++lifetimeIndex)
+    {
+        for (uint32_t resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex)
+        {
+            if (resDescs[resourceIndex].id == lifetimes[lifetimeIndex].id)
+            {
+                resourceLifetimes[plannedResourceCount] = &lifetimes[lifetimeIndex];
+                plannedResourceDescs[plannedResourceCount] = &resDescs[resourceIndex];
+                ++plannedResourceCount;
+            }
+        }
+    }
+    FFXM_ASSERT(plannedResourceCount == resourceCount);
+
+    planResourceAliasing(resourceLifetimes, plannedResourceCount, aliasSlots);
+
+    uint32_t slotResourceCounts[FFXM_MAX_ALIAS_HEAPS] = {};
+    for (uint32_t resourceIndex = 0; resourceIndex < plannedResourceCount; ++resourceIndex)
+    {
+        ++slotResourceCounts[aliasSlots[resourceIndex]];
+    }
+
+    // a resource alone in its slot saves nothing, it is created on its own rather than placed in a heap of its size
+    FfxmCreateResourceDescription createResourceDescriptions[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+    uint32_t sharedAliasSlots[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+    uint32_t sharedResourceCount = 0;
+    for (uint32_t resourceIndex = 0; resourceIndex < plannedResourceCount; ++resourceIndex)
+    {
+        if (slotResourceCounts[aliasSlots[resourceIndex]] < 2)
+        {
+            FFXM_VALIDATE(createResourceFromDescription(context, view, plannedResourceDescs[resourceIndex]));
+            continue;
+        }
+
+        createResourceDescriptions[sharedResourceCount] = getCreateResourceDescription(plannedResourceDescs[resourceIndex]);
+        sharedAliasSlots[sharedResourceCount] = aliasSlots[resourceIndex];
+        ++sharedResourceCount;
+
+        if (plannedResourceDescs[resourceIndex]->id == FFXM_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS)
+            context->newLocksAliased = true;
+    }
+
+    if (!sharedResourceCount)
+        return FFXM_OK;
+
+    FfxmResourceInternal resources[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+    size_t savedMemorySize = 0;
+    FfxmErrorCode errorCode = context->contextDescription.backendInterface.fpCreateAliasedResources(&context->contextDescription.backendInterface,
+        createResourceDescriptions, sharedAliasSlots, sharedResourceCount, view->effectContextId, resources, &savedMemorySize);
+    FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+    context->aliasedMemorySavings += savedMemorySize;
+
+    for (uint32_t resourceIndex = 0; resourceIndex < sharedResourceCount; ++resourceIndex)
+    {
+        view->srvResources[createResourceDescriptions[resourceIndex].id] = resources[resourceIndex];
+    }
+
+    return FFXM_OK;
+}
+
+// Builds the separable Lanczos weights of every jitter phase and output pixel phase at the maximum render size. The
+// source position of an axis repeats every displaySize / gcd(renderSize, displaySize) output pixels, the table is only
+// built when the periods of the whole jitter sequence fit in FFXM_FSR2_LANCZOS_TABLE_MAX_HEIGHT rows.
+static bool buildLanczosWeightTable(FfxmFsr2Context_Private* context, std::vector<uint16_t>& outTable)
+{
+    const int32_t renderSize[2] = { int32_t(context->contextDescription.maxRenderSize.width), int32_t(context->contextDescription.maxRenderSize.height) };
+    const int32_t displaySize[2] = { int32_t(context->contextDescription.displaySize.width), int32_t(context->contextDescription.displaySize.height) };
+    const int32_t phaseCount = ffxmFsr2GetJitterPhaseCount(renderSize[0], displaySize[0]);
+    if (renderSize[0] <= 0 || renderSize[1] <= 0 || displaySize[0] <= 0 || displaySize[1] <= 0 || phaseCount <= 0)
+        return false;
+
+    int32_t period[2];
+    int32_t sourceStep[2];
+    for (uint32_t axis = 0; axis < 2; ++axis) {
+
+        int32_t divisor = renderSize[axis];
+        for (int32_t remainder = displaySize[axis]; remainder != 0;) {
+            const int32_t next = divisor % remainder;
+            divisor = remainder;
+            remainder = next;
+        }
+        period[axis] = displaySize[axis] / divisor;
+        sourceStep[axis] = renderSize[axis] / divisor;
+    }
+
+    const int64_t rowsPerPhase = int64_t(period[0]) + period[1];
+    if (rowsPerPhase * phaseCount > FFXM_FSR2_LANCZOS_TABLE_MAX_HEIGHT)
+        return false;
+
+    // each texel holds the weights of the taps at -1, 0 and +1, then the floor of the source position in the period
+    outTable.assign(size_t(rowsPerPhase * phaseCount) * FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS * 4, 0);
+    for (int32_t jitterIndex = 0; jitterIndex < phaseCount; ++jitterIndex) {
+
+        float jitter[2];
+        ffxmFsr2GetJitterOffset(&jitter[0], &jitter[1], jitterIndex, phaseCount);
+
+        int32_t row = int32_t(jitterIndex * rowsPerPhase);
+        for (uint32_t axis = 0; axis < 2; ++axis) {
+            for (int32_t phase = 0; phase < period[axis]; ++phase, ++row) {
+
+                const int32_t sourceFloor = ((2 * phase + 1) * sourceStep[axis]) / (2 * period[axis]);
+                const double baseOffset = sourceFloor + 0.5 - jitter[axis] - (phase + 0.5) * sourceStep[axis] / double(period[axis]);
+
+                for (int32_t level = 0; level < FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS; ++level) {
+
+                    const float bias = FFXM_FSR2_LANCZOS_TABLE_BIAS_MIN +
+                        level * (FFXM_FSR2_LANCZOS_TABLE_BIAS_MAX - FFXM_FSR2_LANCZOS_TABLE_BIAS_MIN) / (FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS - 1);
+                    uint16_t* texel = &outTable[(size_t(row) * FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS + level) * 4];
+                    for (int32_t tap = 0; tap < 3; ++tap) {
+
+                        const float x = bias * float(baseOffset + tap - 1);
+                        texel[tap] = uint16_t(f32tof16(fabsf(x) < 2.0f ? lanczos2(x) : 0.0f));
+                    }
+                    texel[3] = uint16_t(f32tof16(float(sourceFloor)));
+                }
+            }
+        }
+    }
+
+    context->lanczosTableRenderSize[0] = renderSize[0];
+    context->lanczosTableRenderSize[1] = renderSize[1];
+    context->lanczosTablePeriod[0] = period[0];
+    context->lanczosTablePeriod[1] = period[1];
+    context->lanczosTableSourceStep[0] = sourceStep[0];
+    context->lanczosTableSourceStep[1] = sourceStep[1];
+    context->lanczosTablePhaseCount = phaseCount;
+    context->lanczosTableHeight = int32_t(rowsPerPhase * phaseCount);
+    return true;
+}
+
+// Returns the first table row of the jitter phase of the frame, or -1 when the table doesn't hold this frame's weights
+static int32_t getLanczosTableJitterRow(const FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params)
+{
+    if (!context->lanczosTableActive ||
+        int32_t(params->renderSize.width) != context->lanczosTableRenderSize[0] || int32_t(params->renderSize.height) != context->lanczosTableRenderSize[1])
+        return -1;
+
+    // the phase comes from the index of the sequence, the offset only confirms the application follows the sequence
+    const int32_t phase = int32_t(params->jitterIndex % uint32_t(context->lanczosTablePhaseCount));
+    float jitterX, jitterY;
+    ffxmFsr2GetJitterOffset(&jitterX, &jitterY, phase, context->lanczosTablePhaseCount);
+    if (jitterX != params->jitterOffset.x || jitterY != params->jitterOffset.y)
+        return -1;
+
+    return phase * (context->lanczosTablePeriod[0] + context->lanczosTablePeriod[1]);
 }
 
 static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2ContextDescription* contextDescription)
@@ -512,6 +899,10 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
     FFXM_ASSERT(context);
     FFXM_ASSERT(contextDescription);
 
+    // the graphics pipelines writing the output are built with its format when prewarming
+    FFXM_RETURN_ON_ERROR(!(contextDescription->flags & FFXM_FSR2_ENABLE_PIPELINE_PREWARM) || contextDescription->outputFormat != FFXM_SURFACE_FORMAT_UNKNOWN,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
     // Setup the data for implementation.
     memset(context, 0, sizeof(FfxmFsr2Context_Private));
     context->device = contextDescription->backendInterface.device;
@@ -533,12 +924,35 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
     errorCode = context->contextDescription.backendInterface.fpGetDeviceCapabilities(&context->contextDescription.backendInterface, &context->deviceCapabilities);
     FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
 
+    // the prebuilt shaders and the archives packed from them don't have the permutations only compiled from source,
+    // the features needing them fall back to the passes they replace
+    if (!context->deviceCapabilities.sourcePermutationsSupported)
+        context->contextDescription.flags &= ~FSR2_SOURCE_PERMUTATION_FLAGS;
+
+    // the subgroup luminance pyramid needs the wave operations of shader model 6.0, SPD runs without them
+    if (context->deviceCapabilities.minimumSupportedShaderModel < FFXM_SHADER_MODEL_6_0)
+        context->contextDescription.flags &= ~FFXM_FSR2_ENABLE_SUBGROUP_LUMINANCE_PYRAMID;
+
+    // the pipelines, thus the jobs of all the views, belong to the first effect context
+    context->gpuTimingsActive = (contextDescription->flags & FFXM_FSR2_ENABLE_GPU_TIMINGS)
+        && context->contextDescription.backendInterface.fpEnableGpuTimings && context->contextDescription.backendInterface.fpGetGpuTimings;
+    if (context->gpuTimingsActive)
+    {
+        errorCode = context->contextDescription.backendInterface.fpEnableGpuTimings(&context->contextDescription.backendInterface, context->effectContextId);
+        FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+    }
+
     // set defaults
-    context->firstExecution = true;
-    context->resourceFrameIndex = 0;
+    context->viewCount = contextDescription->viewCount ? contextDescription->viewCount : 1;
+    for (uint32_t viewIndex = 0; viewIndex < context->viewCount; ++viewIndex) {
 
-    context->constants.displaySize[0] = contextDescription->displaySize.width;
-    context->constants.displaySize[1] = contextDescription->displaySize.height;
+        Fsr2View* view = &context->views[viewIndex];
+        view->firstExecution = true;
+        view->resourceFrameIndex = 0;
+
+        view->constants.displaySize[0] = contextDescription->displaySize.width;
+        view->constants.displaySize[1] = contextDescription->displaySize.height;
+    }
 
     // generate the data for the LUT.
     const uint32_t lanczos2LutWidth = 128;
@@ -551,6 +965,20 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
         lanczos2Weights[currentLanczosWidthIndex] = int16_t(roundf(y * 32767.0f));
     }
 
+    // the weight table takes the place of the 1D LUT, the flag is dropped when the upscaling ratio doesn't allow one
+    std::vector<uint16_t> lanczosWeightTable;
+    if (context->contextDescription.flags & FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE) {
+
+        context->lanczosTableActive = buildLanczosWeightTable(context, lanczosWeightTable);
+        if (!context->lanczosTableActive)
+            context->contextDescription.flags &= ~FFXM_FSR2_ENABLE_LANCZOS_WEIGHT_TABLE;
+    }
+    const FfxmSurfaceFormat lanczosLutFormat = context->lanczosTableActive ? FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT : FFXM_SURFACE_FORMAT_R16_SNORM;
+    const uint32_t lanczosLutWidth = context->lanczosTableActive ? FFXM_FSR2_LANCZOS_TABLE_BIAS_LEVELS : lanczos2LutWidth;
+    const uint32_t lanczosLutHeight = context->lanczosTableActive ? uint32_t(context->lanczosTableHeight) : 1;
+    const uint32_t lanczosLutDataSize = context->lanczosTableActive ? uint32_t(lanczosWeightTable.size() * sizeof(uint16_t)) : sizeof(lanczos2Weights);
+    void* lanczosLutData = context->lanczosTableActive ? (void*)lanczosWeightTable.data() : (void*)lanczos2Weights;
+
     // upload path only supports R16_SNORM, let's go and convert
     int16_t maximumBias[FFXM_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH * FFXM_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT];
     for (uint32_t i = 0; i < FFXM_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH * FFXM_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT; ++i) {
@@ -572,6 +1000,10 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
 
 	const bool isOpenGLES = (contextDescription->flags & FFXM_FSR2_OPENGL_ES_3_2) != 0;
 
+    // The fused lock pass stores the dilated depth and motion vectors from a compute shader
+    const bool fusedReconstructAndLock = (context->contextDescription.flags & FFXM_FSR2_ENABLE_FUSED_RECONSTRUCT_AND_LOCK) != 0;
+    const FfxmResourceUsage dilationUsage = fusedReconstructAndLock ? FFXM_RESOURCE_USAGE_UAV : FFXM_RESOURCE_USAGE_RENDERTARGET;
+
 	// OpenGLES 3.2 specific: We need to workaround some GLES limitations for some resources.
 	const FfxmSurfaceFormat formatR8Workaround = isOpenGLES ? FFXM_SURFACE_FORMAT_R32_FLOAT : FFXM_SURFACE_FORMAT_R8_UNORM;
 	const FfxmSurfaceFormat formatR16FWorkaround = isOpenGLES ? FFXM_SURFACE_FORMAT_R32_FLOAT : FFXM_SURFACE_FORMAT_R16_FLOAT;
@@ -587,13 +1019,13 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
         {   FFXM_FSR2_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH, L"FSR2_ReconstructedPrevNearestDepth", FFXM_RESOURCE_TYPE_TEXTURE2D, FFXM_RESOURCE_USAGE_UAV,
             FFXM_SURFACE_FORMAT_R32_UINT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_ALIASABLE },
 
-        {   FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_1, L"FSR2_InternalDilatedVelocity1", FFXM_RESOURCE_TYPE_TEXTURE2D, (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET),
+        {   FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_1, L"FSR2_InternalDilatedVelocity1", FFXM_RESOURCE_TYPE_TEXTURE2D, dilationUsage,
             FFXM_SURFACE_FORMAT_R16G16_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_NONE },
 
-        {   FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_2, L"FSR2_InternalDilatedVelocity2", FFXM_RESOURCE_TYPE_TEXTURE2D, (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET),
+        {   FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DILATED_MOTION_VECTORS_2, L"FSR2_InternalDilatedVelocity2", FFXM_RESOURCE_TYPE_TEXTURE2D, dilationUsage,
             FFXM_SURFACE_FORMAT_R16G16_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_NONE },
 
-        {   FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH, L"FSR2_DilatedDepth", FFXM_RESOURCE_TYPE_TEXTURE2D, (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET),
+        {   FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH, L"FSR2_DilatedDepth", FFXM_RESOURCE_TYPE_TEXTURE2D, dilationUsage,
             FFXM_SURFACE_FORMAT_R32_FLOAT, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_ALIASABLE },
 
         {   FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1, L"FSR2_LockStatus1", FFXM_RESOURCE_TYPE_TEXTURE2D, (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET),
@@ -624,7 +1056,7 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
             FFXM_SURFACE_FORMAT_R8G8_UNORM, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_ALIASABLE },
 
         {   FFXM_FSR2_RESOURCE_IDENTIFIER_LANCZOS_LUT, L"FSR2_LanczosLutData", FFXM_RESOURCE_TYPE_TEXTURE2D, FFXM_RESOURCE_USAGE_READ_ONLY,
-            FFXM_SURFACE_FORMAT_R16_SNORM, lanczos2LutWidth, 1, 1, FFXM_RESOURCE_FLAGS_NONE, sizeof(lanczos2Weights), lanczos2Weights },
+            lanczosLutFormat, lanczosLutWidth, lanczosLutHeight, 1, FFXM_RESOURCE_FLAGS_NONE, lanczosLutDataSize, lanczosLutData },
 
         {   FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY, L"FSR2_DefaultReactiviyMask", FFXM_RESOURCE_TYPE_TEXTURE2D, FFXM_RESOURCE_USAGE_READ_ONLY,
             FFXM_SURFACE_FORMAT_R8_UNORM, 1, 1, 1, FFXM_RESOURCE_FLAGS_NONE, sizeof(defaultReactiveMaskData), &defaultReactiveMaskData },
@@ -650,11 +1082,11 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
 		 FFXM_RESOURCE_FLAGS_ALIASABLE},
 
 		{FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA_1, L"FSR2_DilatedDepthMotionVectorsInputLuma1", FFXM_RESOURCE_TYPE_TEXTURE2D,
-		 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT, contextDescription->maxRenderSize.width,
+		 dilationUsage, FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT, contextDescription->maxRenderSize.width,
 		 contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
 
 		{FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA_2, L"FSR2_DilatedDepthMotionVectorsInputLuma2", FFXM_RESOURCE_TYPE_TEXTURE2D,
-		 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT,contextDescription->maxRenderSize.width,
+		 dilationUsage, FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT,contextDescription->maxRenderSize.width,
 		 contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
 
 		{FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1, L"FSR2_LockStatus1", FFXM_RESOURCE_TYPE_TEXTURE2D,
@@ -688,7 +1120,7 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
 		 contextDescription->maxRenderSize.height, 1, FFXM_RESOURCE_FLAGS_ALIASABLE},
 
 		{FFXM_FSR2_RESOURCE_IDENTIFIER_LANCZOS_LUT, L"FSR2_LanczosLutData", FFXM_RESOURCE_TYPE_TEXTURE2D, FFXM_RESOURCE_USAGE_READ_ONLY,
-		 FFXM_SURFACE_FORMAT_R16_SNORM, lanczos2LutWidth, 1, 1, FFXM_RESOURCE_FLAGS_NONE, sizeof(lanczos2Weights), lanczos2Weights},
+		 lanczosLutFormat, lanczosLutWidth, lanczosLutHeight, 1, FFXM_RESOURCE_FLAGS_NONE, lanczosLutDataSize, lanczosLutData},
 
 		{FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY, L"FSR2_DefaultReactiviyMask", FFXM_RESOURCE_TYPE_TEXTURE2D,
 		 FFXM_RESOURCE_USAGE_READ_ONLY, FFXM_SURFACE_FORMAT_R8_UNORM, 1, 1, 1, FFXM_RESOURCE_FLAGS_NONE, sizeof(defaultReactiveMaskData),
@@ -711,71 +1143,119 @@ static FfxmErrorCode fsr2Create(FfxmFsr2Context_Private* context, const FfxmFsr2
 		 FFXM_RESOURCE_FLAGS_NONE},
 	};
 
-    // clear the SRV resources to NULL.
-    memset(context->srvResources, 0, sizeof(context->srvResources));
-
-	// Generally used resources by all presets
-    if (applyUltraPerformanceOptimizations)
+    for (uint32_t viewIndex = 0; viewIndex < context->viewCount; ++viewIndex)
     {
-        for(int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFXM_ARRAY_ELEMENTS(internalSurfaceDescUltraPerformance); ++currentSurfaceIndex)
-		{
-			FFXM_VALIDATE(createResourceFromDescription(context, &internalSurfaceDescUltraPerformance[currentSurfaceIndex]));
-		}
-    }
-    else
-    {
-        for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFXM_ARRAY_ELEMENTS(internalSurfaceDesc); ++currentSurfaceIndex)
+        Fsr2View* view = &context->views[viewIndex];
+
+        // the first view shares the effect context of the pipelines, the resources of the others need their own
+        if (viewIndex == 0) {
+            view->effectContextId = context->effectContextId;
+        } else {
+            errorCode = context->contextDescription.backendInterface.fpCreateBackendContext(&context->contextDescription.backendInterface, &view->effectContextId);
+            FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+        }
+
+        // clear the SRV resources to NULL.
+        memset(view->srvResources, 0, sizeof(view->srvResources));
+
+        // transient resources are put aside and created together once their memory has been planned
+        const bool aliasResources = (contextDescription->flags & FFXM_FSR2_ENABLE_RESOURCE_ALIASING) && contextDescription->backendInterface.fpCreateAliasedResources;
+        const Fsr2ResourceLifetime* lifetimes = applyUltraPerformanceOptimizations ? transientResourceLifetimesUltraPerformance : transientResourceLifetimes;
+        uint32_t lifetimeCount = applyUltraPerformanceOptimizations ? FFXM_ARRAY_ELEMENTS(transientResourceLifetimesUltraPerformance) : FFXM_ARRAY_ELEMENTS(transientResourceLifetimes);
+        if (fusedReconstructAndLock)
         {
-            FFXM_VALIDATE(createResourceFromDescription(context, &internalSurfaceDesc[currentSurfaceIndex]));
+            lifetimes = applyUltraPerformanceOptimizations ? transientResourceLifetimesUltraPerformanceFused : transientResourceLifetimesFused;
+            lifetimeCount = applyUltraPerformanceOptimizations ? FFXM_ARRAY_ELEMENTS(transientResourceLifetimesUltraPerformanceFused) : FFXM_ARRAY_ELEMENTS(transientResourceLifetimesFused);
         }
-    }
+        FfxmInternalResourceDescription transientSurfaceDesc[FFXM_ARRAY_ELEMENTS(transientResourceLifetimes)];
+        uint32_t transientSurfaceCount = 0;
 
-	// Additional textures used by either balanced or performance presets
-	if(isBalancedOrPerformance)
-	{
-		const FfxmInternalResourceDescription internalBalancedSurfaceDesc[] = {
-			{FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE_1, L"FSR2_InternalReactive1", FFXM_RESOURCE_TYPE_TEXTURE2D,
-			 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8_SNORM,
-			 contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
+		// Generally used resources by all presets
+        const FfxmInternalResourceDescription* surfaceDesc = applyUltraPerformanceOptimizations ? internalSurfaceDescUltraPerformance : internalSurfaceDesc;
+        const int32_t surfaceCount = applyUltraPerformanceOptimizations ? FFXM_ARRAY_ELEMENTS(internalSurfaceDescUltraPerformance) : FFXM_ARRAY_ELEMENTS(internalSurfaceDesc);
+        for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < surfaceCount; ++currentSurfaceIndex)
+        {
+            const FfxmInternalResourceDescription& currentSurfaceDesc = surfaceDesc[currentSurfaceIndex];
+
+            // the lock input luma of the fused lock pass stays in groupshared memory
+            if (fusedReconstructAndLock && currentSurfaceDesc.id == FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_INPUT_LUMA)
+                continue;
+
+            // read only resources hold the same data for all the views, they are created with the first one
+            if (viewIndex > 0 && currentSurfaceDesc.usage == FFXM_RESOURCE_USAGE_READ_ONLY)
+            {
+                view->srvResources[currentSurfaceDesc.id] = context->views[0].srvResources[currentSurfaceDesc.id];
+                continue;
+            }
+
+            if (aliasResources && (currentSurfaceDesc.flags & FFXM_RESOURCE_FLAGS_ALIASABLE) && !currentSurfaceDesc.initData &&
+                findResourceLifetime(lifetimes, lifetimeCount, currentSurfaceDesc.id))
+            {
+                transientSurfaceDesc[transientSurfaceCount++] = currentSurfaceDesc;
+                continue;
+            }
 
-			{FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE_2, L"FSR2_InternalReactive2", FFXM_RESOURCE_TYPE_TEXTURE2D,
-			 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8_SNORM,
-			 contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
-		};
+            FFXM_VALIDATE(createResourceFromDescription(context, view, &currentSurfaceDesc));
+        }
 
-		for(int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFXM_ARRAY_ELEMENTS(internalBalancedSurfaceDesc); ++currentSurfaceIndex)
+        if (transientSurfaceCount)
+        {
+            errorCode = createAliasedResourcesFromDescriptions(context, view, transientSurfaceDesc, transientSurfaceCount, lifetimes, lifetimeCount);
+            FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+        }
+
+		// Additional textures used by either balanced or performance presets
+		if(isBalancedOrPerformance)
 		{
-			FFXM_VALIDATE(createResourceFromDescription(context, &internalBalancedSurfaceDesc[currentSurfaceIndex]));
+			const FfxmInternalResourceDescription internalBalancedSurfaceDesc[] = {
+				{FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE_1, L"FSR2_InternalReactive1", FFXM_RESOURCE_TYPE_TEXTURE2D,
+				 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8_SNORM,
+				 contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
+
+				{FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE_2, L"FSR2_InternalReactive2", FFXM_RESOURCE_TYPE_TEXTURE2D,
+				 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8_SNORM,
+				 contextDescription->displaySize.width, contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
+			};
+
+			for(int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFXM_ARRAY_ELEMENTS(internalBalancedSurfaceDesc); ++currentSurfaceIndex)
+			{
+				FFXM_VALIDATE(createResourceFromDescription(context, view, &internalBalancedSurfaceDesc[currentSurfaceIndex]));
+			}
 		}
-	}
-	else
-	{
-		// Quality preset specific
-		const FfxmInternalResourceDescription internalQualitySurfaceDesc[] = {
-			{FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_1, L"FSR2_LumaHistory1", FFXM_RESOURCE_TYPE_TEXTURE2D,
-			 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM, contextDescription->displaySize.width,
-			 contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
-
-			{FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_2, L"FSR2_LumaHistory2", FFXM_RESOURCE_TYPE_TEXTURE2D,
-			 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM, contextDescription->displaySize.width,
-			 contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
-		};
-
-		for(int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFXM_ARRAY_ELEMENTS(internalQualitySurfaceDesc); ++currentSurfaceIndex)
+		else
 		{
-			FFXM_VALIDATE(createResourceFromDescription(context, &internalQualitySurfaceDesc[currentSurfaceIndex]));
+			// Quality preset specific
+			const FfxmInternalResourceDescription internalQualitySurfaceDesc[] = {
+				{FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_1, L"FSR2_LumaHistory1", FFXM_RESOURCE_TYPE_TEXTURE2D,
+				 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM, contextDescription->displaySize.width,
+				 contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
+
+				{FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY_2, L"FSR2_LumaHistory2", FFXM_RESOURCE_TYPE_TEXTURE2D,
+				 (FfxmResourceUsage)(FFXM_RESOURCE_USAGE_RENDERTARGET), FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM, contextDescription->displaySize.width,
+				 contextDescription->displaySize.height, 1, FFXM_RESOURCE_FLAGS_NONE},
+			};
+
+			for(int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFXM_ARRAY_ELEMENTS(internalQualitySurfaceDesc); ++currentSurfaceIndex)
+			{
+				FFXM_VALIDATE(createResourceFromDescription(context, view, &internalQualitySurfaceDesc[currentSurfaceIndex]));
+			}
 		}
-	}
 
-    // copy resources to uavResrouces list
-    memcpy(context->uavResources, context->srvResources, sizeof(context->srvResources));
-	// copy resources to uavResrouces list
-	memcpy(context->rtResources, context->srvResources, sizeof(context->srvResources));
+        // copy resources to uavResrouces list
+        memcpy(view->uavResources, view->srvResources, sizeof(view->srvResources));
+		// copy resources to uavResrouces list
+		memcpy(view->rtResources, view->srvResources, sizeof(view->srvResources));
+    }
 
     // avoid compiling pipelines on first render
     {
         errorCode = createPipelineStates(context);
         FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+
+        if (contextDescription->flags & FFXM_FSR2_ENABLE_PIPELINE_PREWARM) {
+            errorCode = prewarmPipelineStates(context);
+            FFXM_RETURN_ON_ERROR(errorCode == FFXM_OK, errorCode);
+        }
     }
     return FFXM_OK;
 }
@@ -784,6 +1264,12 @@ static FfxmErrorCode fsr2Release(FfxmFsr2Context_Private* context)
 {
     FFXM_ASSERT(context);
 
+    // a capture left open by the application is closed with the context
+    if (context->captureFile) {
+        fclose(context->captureFile);
+        context->captureFile = nullptr;
+    }
+
     ffxmSafeReleasePipeline(&context->contextDescription.backendInterface, &context->pipelineDepthClip, context->effectContextId);
     ffxmSafeReleasePipeline(&context->contextDescription.backendInterface, &context->pipelineReconstructPreviousDepth, context->effectContextId);
     ffxmSafeReleasePipeline(&context->contextDescription.backendInterface, &context->pipelineLock, context->effectContextId);
@@ -793,40 +1279,52 @@ static FfxmErrorCode fsr2Release(FfxmFsr2Context_Private* context)
     ffxmSafeReleasePipeline(&context->contextDescription.backendInterface, &context->pipelineComputeLuminancePyramid, context->effectContextId);
     ffxmSafeReleasePipeline(&context->contextDescription.backendInterface, &context->pipelineGenerateReactive, context->effectContextId);
 
-    // unregister resources not created internally
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_OPAQUE_ONLY] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_DEPTH] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_MOTION_VECTORS] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-	context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE] = {FFXM_FSR2_RESOURCE_IDENTIFIER_NULL};
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+    // the first view goes last, the others share its read only resources and its effect context holds the pipelines
+    for (uint32_t viewIndex = context->viewCount; viewIndex-- > 0;)
+    {
+        Fsr2View* view = &context->views[viewIndex];
+
+        // unregister resources not created internally
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_OPAQUE_ONLY] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_DEPTH] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_MOTION_VECTORS] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+		view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE] = {FFXM_FSR2_RESOURCE_IDENTIFIER_NULL};
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT] = { FFXM_FSR2_RESOURCE_IDENTIFIER_NULL };
+
+        // Release the copy resources for those that had init data
+        ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT]);
+        if (viewIndex == 0) {
+            ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LANCZOS_LUT]);
+            ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY]);
+            ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, view->srvResources[FFXM_FSR2_RESOURCE_IDENTITIER_UPSAMPLE_MAXIMUM_BIAS_LUT]);
+            ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_EXPOSURE]);
+        }
 
-    // Release the copy resources for those that had init data
-    ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT]);
-    ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LANCZOS_LUT]);
-    ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY]);
-    ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, context->srvResources[FFXM_FSR2_RESOURCE_IDENTITIER_UPSAMPLE_MAXIMUM_BIAS_LUT]);
-    ffxmSafeReleaseCopyResource(&context->contextDescription.backendInterface, context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_EXPOSURE]);
+        // release internal resources
+        for (int32_t currentResourceIndex = 0; currentResourceIndex < FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT; ++currentResourceIndex) {
 
-    // release internal resources
-    for (int32_t currentResourceIndex = 0; currentResourceIndex < FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT; ++currentResourceIndex) {
+            // the read only resources of the first view are shared, and released with it
+            if (viewIndex > 0 && view->srvResources[currentResourceIndex].internalIndex == context->views[0].srvResources[currentResourceIndex].internalIndex)
+                continue;
 
-        ffxmSafeReleaseResource(&context->contextDescription.backendInterface, context->srvResources[currentResourceIndex]);
-    }
+            ffxmSafeReleaseResource(&context->contextDescription.backendInterface, view->srvResources[currentResourceIndex]);
+        }
 
-    // Destroy the context
-    context->contextDescription.backendInterface.fpDestroyBackendContext(&context->contextDescription.backendInterface, context->effectContextId);
+        // Destroy the context
+        context->contextDescription.backendInterface.fpDestroyBackendContext(&context->contextDescription.backendInterface, view->effectContextId);
+    }
 
     return FFXM_OK;
 }
 
-static void setupDeviceDepthToViewSpaceDepthParams(FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params)
+static void setupDeviceDepthToViewSpaceDepthParams(FfxmFsr2Context_Private* context, Fsr2View* view, const FfxmFsr2DispatchDescription* params)
 {
     const bool bInverted = (context->contextDescription.flags & FFXM_FSR2_ENABLE_DEPTH_INVERTED) == FFXM_FSR2_ENABLE_DEPTH_INVERTED;
     const bool bInfinite = (context->contextDescription.flags & FFXM_FSR2_ENABLE_DEPTH_INFINITE) == FFXM_FSR2_ENABLE_DEPTH_INFINITE;
@@ -864,8 +1362,8 @@ static void setupDeviceDepthToViewSpaceDepthParams(FfxmFsr2Context_Private* cont
         fMax,                  // reversed, infinite
     };
 
-    context->constants.deviceToViewDepth[0] = d * matrix_elem_c[bInverted][bInfinite];
-    context->constants.deviceToViewDepth[1] = matrix_elem_e[bInverted][bInfinite];
+    view->constants.deviceToViewDepth[0] = d * matrix_elem_c[bInverted][bInfinite];
+    view->constants.deviceToViewDepth[1] = matrix_elem_e[bInverted][bInfinite];
 
     // revert x and y coords
     const float aspect = params->renderSize.width / float(params->renderSize.height);
@@ -873,39 +1371,42 @@ static void setupDeviceDepthToViewSpaceDepthParams(FfxmFsr2Context_Private* cont
     const float a = cotHalfFovY / aspect;
     const float b = cotHalfFovY;
 
-    context->constants.deviceToViewDepth[2] = (1.0f / a);
-    context->constants.deviceToViewDepth[3] = (1.0f / b);
+    view->constants.deviceToViewDepth[2] = (1.0f / a);
+    view->constants.deviceToViewDepth[3] = (1.0f / b);
 }
 
-static void scheduleDispatch(FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params, const FfxmPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
+static void scheduleDispatch(FfxmFsr2Context_Private* context, const Fsr2View* view, const FfxmFsr2DispatchDescription* params, FfxmPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY,
+                             bool asyncCompute = false, const FfxmRect2D* groupRects = nullptr, uint32_t groupRectCount = 0)
 {
     FfxmGpuJobDescription dispatchJob = {FFXM_GPU_JOB_COMPUTE};
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex) {
 
         const uint32_t currentResourceId = pipeline->srvTextureBindings[currentShaderResourceViewIndex].resourceIdentifier;
-        const FfxmResourceInternal currentResource = context->srvResources[currentResourceId];
+        const FfxmResourceInternal currentResource = view->srvResources[currentResourceId];
         dispatchJob.computeJobDescriptor.srvTextures[currentShaderResourceViewIndex] = currentResource;
-        wcscpy(dispatchJob.computeJobDescriptor.srvTextureNames[currentShaderResourceViewIndex],
-                 pipeline->srvTextureBindings[currentShaderResourceViewIndex].name);
+#ifdef FFXM_DEBUG_CHECKING
+        dispatchJob.computeJobDescriptor.srvTextureNames[currentShaderResourceViewIndex] = pipeline->srvTextureBindings[currentShaderResourceViewIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
     }
 
     for (uint32_t currentUnorderedAccessViewIndex = 0; currentUnorderedAccessViewIndex < pipeline->uavTextureCount; ++currentUnorderedAccessViewIndex) {
 
         const uint32_t currentResourceId = pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].resourceIdentifier;
-        wcscpy(dispatchJob.computeJobDescriptor.uavTextureNames[currentUnorderedAccessViewIndex],
-                 pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].name);
+#ifdef FFXM_DEBUG_CHECKING
+        dispatchJob.computeJobDescriptor.uavTextureNames[currentUnorderedAccessViewIndex] = pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
 
         if (currentResourceId >= FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_0 && currentResourceId <= FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_12)
         {
-            const FfxmResourceInternal currentResource = context->uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE];
+            const FfxmResourceInternal currentResource = view->uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE];
             dispatchJob.computeJobDescriptor.uavTextures[currentUnorderedAccessViewIndex] = currentResource;
             dispatchJob.computeJobDescriptor.uavTextureMips[currentUnorderedAccessViewIndex] =
                 currentResourceId - FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_0;
         }
         else
         {
-            const FfxmResourceInternal currentResource = context->uavResources[currentResourceId];
+            const FfxmResourceInternal currentResource = view->uavResources[currentResourceId];
             dispatchJob.computeJobDescriptor.uavTextures[currentUnorderedAccessViewIndex] = currentResource;
             dispatchJob.computeJobDescriptor.uavTextureMips[currentUnorderedAccessViewIndex] = 0;
         }
@@ -914,18 +1415,25 @@ static void scheduleDispatch(FfxmFsr2Context_Private* context, const FfxmFsr2Dis
     dispatchJob.computeJobDescriptor.dimensions[0] = dispatchX;
     dispatchJob.computeJobDescriptor.dimensions[1] = dispatchY;
     dispatchJob.computeJobDescriptor.dimensions[2] = 1;
-    dispatchJob.computeJobDescriptor.pipeline      = *pipeline;
+    dispatchJob.computeJobDescriptor.pipeline      = pipeline;
+    dispatchJob.computeJobDescriptor.asyncCompute  = asyncCompute;
+    dispatchJob.computeJobDescriptor.groupRectCount = groupRectCount;
+    for (uint32_t rectIndex = 0; rectIndex < groupRectCount; ++rectIndex)
+        dispatchJob.computeJobDescriptor.groupRects[rectIndex] = groupRects[rectIndex];
 
     for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < pipeline->constCount; ++currentRootConstantIndex) {
-        wcscpy(dispatchJob.computeJobDescriptor.cbNames[currentRootConstantIndex], pipeline->constantBufferBindings[currentRootConstantIndex].name);
-        dispatchJob.computeJobDescriptor.cbs[currentRootConstantIndex] = context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
+        const FfxmConstantBuffer& constantBuffer = context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
+        dispatchJob.computeJobDescriptor.cbs[currentRootConstantIndex] = { constantBuffer.data, constantBuffer.num32BitEntries };
+#ifdef FFXM_DEBUG_CHECKING
+        dispatchJob.computeJobDescriptor.cbNames[currentRootConstantIndex] = pipeline->constantBufferBindings[currentRootConstantIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
     }
 
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
 }
 
-static void scheduleFragment(FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params, FfxmPipelineState* pipeline,
-							 uint32_t width, uint32_t height)
+static void scheduleFragment(FfxmFsr2Context_Private* context, const Fsr2View* view, const FfxmFsr2DispatchDescription* params, FfxmPipelineState* pipeline,
+							 uint32_t width, uint32_t height, bool mergeWithNextJob = false, const FfxmRect2D* scissorRects = nullptr, uint32_t scissorRectCount = 0)
 {
 	FfxmGpuJobDescription fragmentJob = {FFXM_GPU_JOB_FRAGMENT};
 
@@ -933,30 +1441,32 @@ static void scheduleFragment(FfxmFsr2Context_Private* context, const FfxmFsr2Dis
 	{
 
 		const uint32_t currentResourceId = pipeline->srvTextureBindings[currentShaderResourceViewIndex].resourceIdentifier;
-		const FfxmResourceInternal currentResource = context->srvResources[currentResourceId];
+		const FfxmResourceInternal currentResource = view->srvResources[currentResourceId];
 		fragmentJob.fragmentJobDescription.srvTextures[currentShaderResourceViewIndex] = currentResource;
-		wcscpy(fragmentJob.fragmentJobDescription.srvTextureNames[currentShaderResourceViewIndex],
-			   pipeline->srvTextureBindings[currentShaderResourceViewIndex].name);
+#ifdef FFXM_DEBUG_CHECKING
+		fragmentJob.fragmentJobDescription.srvTextureNames[currentShaderResourceViewIndex] = pipeline->srvTextureBindings[currentShaderResourceViewIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
 	}
 
 	for(uint32_t currentUnorderedAccessViewIndex = 0; currentUnorderedAccessViewIndex < pipeline->uavTextureCount; ++currentUnorderedAccessViewIndex)
 	{
 
 		const uint32_t currentResourceId = pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].resourceIdentifier;
-		wcscpy(fragmentJob.fragmentJobDescription.uavTextureNames[currentUnorderedAccessViewIndex],
-			   pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].name);
+#ifdef FFXM_DEBUG_CHECKING
+		fragmentJob.fragmentJobDescription.uavTextureNames[currentUnorderedAccessViewIndex] = pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
 
 		if(currentResourceId >= FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_0
 		   && currentResourceId <= FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_12)
 		{
-			const FfxmResourceInternal currentResource = context->uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE];
+			const FfxmResourceInternal currentResource = view->uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE];
 			fragmentJob.fragmentJobDescription.uavTextures[currentUnorderedAccessViewIndex] = currentResource;
 			fragmentJob.fragmentJobDescription.uavTextureMips[currentUnorderedAccessViewIndex] =
 				currentResourceId - FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_0;
 		}
 		else
 		{
-			const FfxmResourceInternal currentResource = context->uavResources[currentResourceId];
+			const FfxmResourceInternal currentResource = view->uavResources[currentResourceId];
 			fragmentJob.fragmentJobDescription.uavTextures[currentUnorderedAccessViewIndex] = currentResource;
 			fragmentJob.fragmentJobDescription.uavTextureMips[currentUnorderedAccessViewIndex] = 0;
 		}
@@ -965,55 +1475,95 @@ static void scheduleFragment(FfxmFsr2Context_Private* context, const FfxmFsr2Dis
 	for(uint32_t currentRtIndex = 0; currentRtIndex < pipeline->rtCount; ++currentRtIndex)
 	{
 		const uint32_t currentResourceId = pipeline->rtBindings[currentRtIndex].resourceIdentifier;
-		const FfxmResourceInternal currentResource = context->rtResources[currentResourceId];
+		const FfxmResourceInternal currentResource = view->rtResources[currentResourceId];
 		fragmentJob.fragmentJobDescription.rtTextures[currentRtIndex] = currentResource;
-		wcscpy(fragmentJob.fragmentJobDescription.rtTextureNames[currentRtIndex],
-			   pipeline->rtBindings[currentRtIndex].name);
+#ifdef FFXM_DEBUG_CHECKING
+		fragmentJob.fragmentJobDescription.rtTextureNames[currentRtIndex] = pipeline->rtBindings[currentRtIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
 	}
 
 	fragmentJob.fragmentJobDescription.viewport[0] = width;
 	fragmentJob.fragmentJobDescription.viewport[1] = height;
 	fragmentJob.fragmentJobDescription.pipeline = pipeline;
+	fragmentJob.fragmentJobDescription.mergeWithNextJob = mergeWithNextJob;
+	fragmentJob.fragmentJobDescription.scissorRectCount = scissorRectCount;
+	for(uint32_t rectIndex = 0; rectIndex < scissorRectCount; ++rectIndex)
+		fragmentJob.fragmentJobDescription.scissorRects[rectIndex] = scissorRects[rectIndex];
 
 	for(uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < pipeline->constCount; ++currentRootConstantIndex)
 	{
-		wcscpy(fragmentJob.fragmentJobDescription.cbNames[currentRootConstantIndex], pipeline->constantBufferBindings[currentRootConstantIndex].name);
-		fragmentJob.fragmentJobDescription.cbs[currentRootConstantIndex] =
-			context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
+		const FfxmConstantBuffer& constantBuffer = context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
+		fragmentJob.fragmentJobDescription.cbs[currentRootConstantIndex] = { constantBuffer.data, constantBuffer.num32BitEntries };
+#ifdef FFXM_DEBUG_CHECKING
+		fragmentJob.fragmentJobDescription.cbNames[currentRootConstantIndex] = pipeline->constantBufferBindings[currentRootConstantIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
 	}
 
 	context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &fragmentJob);
 }
 
-static FfxmErrorCode fsr2Dispatch(FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params)
+// Border in render pixels around the render rectangles of the display regions read by the accumulation: the upsampling
+// kernel reaches 2 pixels away, the jitter and the dilation of the depth one more each. The passes producing the inputs
+// of a later pass cover one more pixel for its 3x3 neighbourhoods.
+static const uint32_t FSR2_REGION_RENDER_BORDER = 4;
+
+// Maps the display regions of a view to a surface of the given size, the rectangles are scaled, grown by the border and clamped.
+static uint32_t getRegionRects(const FfxmFsr2Context_Private* context, const Fsr2View* view, uint32_t width, uint32_t height, uint32_t border,
+                               FfxmRect2D* rects)
 {
-    if ((context->contextDescription.flags & FFXM_FSR2_ENABLE_DEBUG_CHECKING) == FFXM_FSR2_ENABLE_DEBUG_CHECKING)
+    const float scaleX = float(width) / float(context->contextDescription.displaySize.width);
+    const float scaleY = float(height) / float(context->contextDescription.displaySize.height);
+
+    for (uint32_t regionIndex = 0; regionIndex < view->regionCount; ++regionIndex)
     {
-        fsr2DebugCheckDispatch(context, params);
+        const FfxmRect2D& region = view->regions[regionIndex];
+        const int32_t left = FFXM_MAXIMUM(int32_t(floorf(region.x * scaleX)) - int32_t(border), 0);
+        const int32_t top = FFXM_MAXIMUM(int32_t(floorf(region.y * scaleY)) - int32_t(border), 0);
+        const int32_t right = FFXM_MINIMUM(int32_t(ceilf((region.x + region.width) * scaleX)) + int32_t(border), int32_t(width));
+        const int32_t bottom = FFXM_MINIMUM(int32_t(ceilf((region.y + region.height) * scaleY)) + int32_t(border), int32_t(height));
+        rects[regionIndex] = { uint32_t(left), uint32_t(top), uint32_t(right - left), uint32_t(bottom - top) };
     }
 
-    // take a short cut to the command list
-    FfxmCommandList commandList = params->commandList;
+    return view->regionCount;
+}
+
+// Converts pixel rectangles to the rectangles of the thread groups covering them.
+static void getGroupRects(FfxmRect2D* rects, uint32_t rectCount, uint32_t groupSize)
+{
+    for (uint32_t rectIndex = 0; rectIndex < rectCount; ++rectIndex)
+    {
+        FfxmRect2D& rect = rects[rectIndex];
+        const uint32_t right = FFXM_DIVIDE_ROUNDING_UP(rect.x + rect.width, groupSize);
+        const uint32_t bottom = FFXM_DIVIDE_ROUNDING_UP(rect.y + rect.height, groupSize);
+        rect = { rect.x / groupSize, rect.y / groupSize, right - rect.x / groupSize, bottom - rect.y / groupSize };
+    }
+}
 
-    if (context->firstExecution)
+static void scheduleViewPasses(FfxmFsr2Context_Private* context, Fsr2View* view, const FfxmFsr2DispatchDescription* params, bool asyncCompute)
+{
+    if (view->firstExecution)
     {
         FfxmGpuJobDescription clearJob = { FFXM_GPU_JOB_CLEAR_FLOAT };
 
         const float clearValuesToZeroFloat[]{ 0.f, 0.f, 0.f, 0.f };
         memcpy(clearJob.clearJobDescriptor.color, clearValuesToZeroFloat, 4 * sizeof(float));
 
-        clearJob.clearJobDescriptor.target = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
-        clearJob.clearJobDescriptor.target = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_2];
+        clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1];
         context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
-        clearJob.clearJobDescriptor.target = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR];
+        clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_2];
         context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        // Ultra performance reads the input color directly and has no prepared input color.
+        if (context->contextDescription.qualityMode != FFXM_FSR2_SHADER_QUALITY_MODE_ULTRA_PERFORMANCE)
+        {
+            clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_PREPARED_INPUT_COLOR];
+            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        }
     }
 
     // Prepare per frame descriptor tables
-    const bool isOddFrame = !!(context->resourceFrameIndex & 1);
+    const bool isOddFrame = !!(view->resourceFrameIndex & 1);
     const uint32_t currentCpuOnlyTableBase = isOddFrame ? FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT : 0;
-    const uint32_t currentGpuTableBase = 2 * FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT * context->resourceFrameIndex;
+    const uint32_t currentGpuTableBase = 2 * FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT * view->resourceFrameIndex;
     const uint32_t lockStatusSrvResourceIndex = isOddFrame ? FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_2 : FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1;
     const uint32_t lockStatusRtResourceIndex = isOddFrame ? FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_1 : FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS_2;
     const uint32_t upscaledColorSrvResourceIndex = isOddFrame ? FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_2 : FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR_1;
@@ -1028,139 +1578,174 @@ static FfxmErrorCode fsr2Dispatch(FfxmFsr2Context_Private* context, const FfxmFs
     const uint32_t dilatedDepthMotionVectorsInputLumaIndex = isOddFrame ? FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA_2 : FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA_1;
 	const uint32_t previousDilatedDepthMotionVectorsInputLumaIndex = isOddFrame ? FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA_1 : FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA_2;
 
-    const bool resetAccumulation = params->reset || context->firstExecution;
-    context->firstExecution = false;
+    const bool resetAccumulation = params->reset || view->firstExecution;
+    view->firstExecution = false;
+
+    // The history outside new regions is stale, it is rebuilt by full frames in both copies of the ping-pong resources.
+    const bool regionsChanged = params->regionCount != view->regionCount ||
+                                (params->regionCount && memcmp(params->regions, view->regions, params->regionCount * sizeof(FfxmRect2D)) != 0);
+    if (regionsChanged)
+    {
+        for (uint32_t regionIndex = 0; regionIndex < params->regionCount; ++regionIndex)
+            view->regions[regionIndex] = params->regions[regionIndex];
+        view->regionCount = params->regionCount;
+        view->fullFramesRemaining = 2;
+    }
+    const bool regionsActive = view->regionCount && !view->fullFramesRemaining;
+    if (view->fullFramesRemaining)
+        view->fullFramesRemaining--;
 
-    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->color, context->effectContextId, &context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR]);
-    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->depth, context->effectContextId, &context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_DEPTH]);
-    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->motionVectors, context->effectContextId, &context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_MOTION_VECTORS]);
+    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->color, view->effectContextId, &view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR]);
+    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->depth, view->effectContextId, &view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_DEPTH]);
+    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->motionVectors, view->effectContextId, &view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_MOTION_VECTORS]);
 
     // if auto exposure is enabled use the auto exposure SRV, otherwise what the app sends.
     if (context->contextDescription.flags & FFXM_FSR2_ENABLE_AUTO_EXPOSURE) {
-        context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE] = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE];
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE] = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE];
     } else {
         if (ffxmFsr2ResourceIsNull(params->exposure)) {
-            context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE] = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_EXPOSURE];
+            view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE] = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_EXPOSURE];
         } else {
-            context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->exposure, context->effectContextId, &context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE]);
+            context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->exposure, view->effectContextId, &view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE]);
         }
     }
 
     if (ffxmFsr2ResourceIsNull(params->reactive)) {
-        context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK] = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY];
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK] = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY];
     }
     else {
-        context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->reactive, context->effectContextId, &context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK]);
+        context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->reactive, view->effectContextId, &view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK]);
     }
 
     if (ffxmFsr2ResourceIsNull(params->transparencyAndComposition)) {
-        context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK] = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY];
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK] = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY];
     } else {
-        context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->transparencyAndComposition, context->effectContextId, &context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK]);
+        context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->transparencyAndComposition, view->effectContextId, &view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK]);
     }
 
-    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->output, context->effectContextId, &context->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT]);
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = context->srvResources[lockStatusSrvResourceIndex];
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = context->srvResources[upscaledColorSrvResourceIndex];
-	context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE] = context->srvResources[temporalReactiveSrvResourceIndex];
-    context->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = context->rtResources[lockStatusRtResourceIndex];
-    context->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = context->rtResources[upscaledColorRtResourceIndex];
-	context->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE] = context->rtResources[temporalReactiveRtResourceIndex];
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT] = context->rtResources[upscaledColorRtResourceIndex];
+    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->output, view->effectContextId, &view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT]);
+    view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = view->srvResources[lockStatusSrvResourceIndex];
+    view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = view->srvResources[upscaledColorSrvResourceIndex];
+	view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE] = view->srvResources[temporalReactiveSrvResourceIndex];
+    view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS] = view->rtResources[lockStatusRtResourceIndex];
+    view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR] = view->rtResources[upscaledColorRtResourceIndex];
+	view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INTERNAL_TEMPORAL_REACTIVE] = view->rtResources[temporalReactiveRtResourceIndex];
+    view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_RCAS_INPUT] = view->rtResources[upscaledColorRtResourceIndex];
 
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS] = context->srvResources[dilatedMotionVectorsResourceIndex];
-    context->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS] = context->rtResources[dilatedMotionVectorsResourceIndex];
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_PREVIOUS_DILATED_MOTION_VECTORS] = context->srvResources[previousDilatedMotionVectorsResourceIndex];
+    view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS] = view->srvResources[dilatedMotionVectorsResourceIndex];
+    view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS] = view->rtResources[dilatedMotionVectorsResourceIndex];
+    view->uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS] = view->uavResources[dilatedMotionVectorsResourceIndex];
+    view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_PREVIOUS_DILATED_MOTION_VECTORS] = view->srvResources[previousDilatedMotionVectorsResourceIndex];
 
-    context->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY] = context->rtResources[lumaHistoryRtResourceIndex];
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY] = context->srvResources[lumaHistorySrvResourceIndex];
+    view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY] = view->rtResources[lumaHistoryRtResourceIndex];
+    view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_LUMA_HISTORY] = view->srvResources[lumaHistorySrvResourceIndex];
 
-    context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA] = context->srvResources[dilatedDepthMotionVectorsInputLumaIndex];
-	context->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA] = context->rtResources[dilatedDepthMotionVectorsInputLumaIndex];
-	context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_PREV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA] = context->srvResources[previousDilatedDepthMotionVectorsInputLumaIndex];
+    view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA] = view->srvResources[dilatedDepthMotionVectorsInputLumaIndex];
+	view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA] = view->rtResources[dilatedDepthMotionVectorsInputLumaIndex];
+	view->uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA] = view->uavResources[dilatedDepthMotionVectorsInputLumaIndex];
+	view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_PREV_DILATED_DEPTH_MOTION_VECTORS_INPUT_LUMA] = view->srvResources[previousDilatedDepthMotionVectorsInputLumaIndex];
 
     // actual resource size may differ from render/display resolution (e.g. due to Hw/API restrictions), so query the descriptor for UVs adjustment
-    const FfxmResourceDescription resourceDescInputColor = context->contextDescription.backendInterface.fpGetResourceDescription(&context->contextDescription.backendInterface, context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR]);
-    const FfxmResourceDescription resourceDescLockStatus = context->contextDescription.backendInterface.fpGetResourceDescription(&context->contextDescription.backendInterface, context->srvResources[lockStatusSrvResourceIndex]);
-    const FfxmResourceDescription resourceDescReactiveMask = context->contextDescription.backendInterface.fpGetResourceDescription(&context->contextDescription.backendInterface, context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK]);
+    const FfxmResourceDescription resourceDescInputColor = context->contextDescription.backendInterface.fpGetResourceDescription(&context->contextDescription.backendInterface, view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR]);
+    const FfxmResourceDescription resourceDescLockStatus = context->contextDescription.backendInterface.fpGetResourceDescription(&context->contextDescription.backendInterface, view->srvResources[lockStatusSrvResourceIndex]);
+    const FfxmResourceDescription resourceDescReactiveMask = context->contextDescription.backendInterface.fpGetResourceDescription(&context->contextDescription.backendInterface, view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK]);
     FFXM_ASSERT(resourceDescInputColor.type == FFXM_RESOURCE_TYPE_TEXTURE2D);
     FFXM_ASSERT(resourceDescLockStatus.type == FFXM_RESOURCE_TYPE_TEXTURE2D);
 
-    context->constants.jitterOffset[0] = params->jitterOffset.x;
-    context->constants.jitterOffset[1] = params->jitterOffset.y;
-    context->constants.renderSize[0] = int32_t(params->renderSize.width ? params->renderSize.width   : resourceDescInputColor.width);
-    context->constants.renderSize[1] = int32_t(params->renderSize.height ? params->renderSize.height : resourceDescInputColor.height);
-    context->constants.maxRenderSize[0] = int32_t(context->contextDescription.maxRenderSize.width);
-    context->constants.maxRenderSize[1] = int32_t(context->contextDescription.maxRenderSize.height);
-    context->constants.inputColorResourceDimensions[0] = resourceDescInputColor.width;
-    context->constants.inputColorResourceDimensions[1] = resourceDescInputColor.height;
+    view->constants.jitterOffset[0] = params->jitterOffset.x;
+    view->constants.jitterOffset[1] = params->jitterOffset.y;
+    view->constants.renderSize[0] = int32_t(params->renderSize.width ? params->renderSize.width   : resourceDescInputColor.width);
+    view->constants.renderSize[1] = int32_t(params->renderSize.height ? params->renderSize.height : resourceDescInputColor.height);
+    view->constants.maxRenderSize[0] = int32_t(context->contextDescription.maxRenderSize.width);
+    view->constants.maxRenderSize[1] = int32_t(context->contextDescription.maxRenderSize.height);
+    view->constants.inputColorResourceDimensions[0] = resourceDescInputColor.width;
+    view->constants.inputColorResourceDimensions[1] = resourceDescInputColor.height;
 
     // compute the horizontal FOV for the shader from the vertical one.
     const float aspectRatio = (float)params->renderSize.width / (float)params->renderSize.height;
     const float cameraAngleHorizontal = atan(tan(params->cameraFovAngleVertical / 2) * aspectRatio) * 2;
-    context->constants.tanHalfFOV = tanf(cameraAngleHorizontal * 0.5f);
-    context->constants.viewSpaceToMetersFactor = (params->viewSpaceToMetersFactor > 0.0f) ? params->viewSpaceToMetersFactor : 1.0f;
+    view->constants.tanHalfFOV = tanf(cameraAngleHorizontal * 0.5f);
+    view->constants.viewSpaceToMetersFactor = (params->viewSpaceToMetersFactor > 0.0f) ? params->viewSpaceToMetersFactor : 1.0f;
+
+    // foveation, the unused center is a copy of the first one
+    const FfxmFsr2FoveationDescription& foveation = params->foveation;
+    view->constants.foveationCenterCount = int32_t(foveation.centerCount);
+    for (uint32_t centerIndex = 0; centerIndex < FFXM_FSR2_MAX_FOVEATION_CENTERS; ++centerIndex) {
+        const FfxmFloatCoords2D& center = foveation.centers[centerIndex < foveation.centerCount ? centerIndex : 0];
+        view->constants.foveationCenters[centerIndex * 2 + 0] = center.x;
+        view->constants.foveationCenters[centerIndex * 2 + 1] = center.y;
+    }
+    view->constants.foveationRadiusAndFalloff[0] = foveation.radius;
+    view->constants.foveationRadiusAndFalloff[1] = foveation.falloff;
 
     // compute params to enable device depth to view space depth computation in shader
-    setupDeviceDepthToViewSpaceDepthParams(context, params);
+    setupDeviceDepthToViewSpaceDepthParams(context, view, params);
 
     // To be updated if resource is larger than the actual image size
-    context->constants.downscaleFactor[0] = float(context->constants.renderSize[0]) / context->contextDescription.displaySize.width;
-    context->constants.downscaleFactor[1] = float(context->constants.renderSize[1]) / context->contextDescription.displaySize.height;
-    context->constants.previousFramePreExposure = context->constants.preExposure;
-    context->constants.preExposure = (params->preExposure != 0) ? params->preExposure : 1.0f;
+    view->constants.downscaleFactor[0] = float(view->constants.renderSize[0]) / context->contextDescription.displaySize.width;
+    view->constants.downscaleFactor[1] = float(view->constants.renderSize[1]) / context->contextDescription.displaySize.height;
+    view->constants.previousFramePreExposure = view->constants.preExposure;
+    view->constants.preExposure = (params->preExposure != 0) ? params->preExposure : 1.0f;
 
     // motion vector data
-    const int32_t* motionVectorsTargetSize = (context->contextDescription.flags & FFXM_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTORS) ? context->constants.displaySize : context->constants.renderSize;
+    const int32_t* motionVectorsTargetSize = (context->contextDescription.flags & FFXM_FSR2_ENABLE_DISPLAY_RESOLUTION_MOTION_VECTORS) ? view->constants.displaySize : view->constants.renderSize;
 
-    context->constants.motionVectorScale[0] = (params->motionVectorScale.x / motionVectorsTargetSize[0]);
-    context->constants.motionVectorScale[1] = (params->motionVectorScale.y / motionVectorsTargetSize[1]);
+    view->constants.motionVectorScale[0] = (params->motionVectorScale.x / motionVectorsTargetSize[0]);
+    view->constants.motionVectorScale[1] = (params->motionVectorScale.y / motionVectorsTargetSize[1]);
 
     // compute jitter cancellation
     if (context->contextDescription.flags & FFXM_FSR2_ENABLE_MOTION_VECTORS_JITTER_CANCELLATION) {
 
-        context->constants.motionVectorJitterCancellation[0] = (context->previousJitterOffset[0] - context->constants.jitterOffset[0]) / motionVectorsTargetSize[0];
-        context->constants.motionVectorJitterCancellation[1] = (context->previousJitterOffset[1] - context->constants.jitterOffset[1]) / motionVectorsTargetSize[1];
+        view->constants.motionVectorJitterCancellation[0] = (view->previousJitterOffset[0] - view->constants.jitterOffset[0]) / motionVectorsTargetSize[0];
+        view->constants.motionVectorJitterCancellation[1] = (view->previousJitterOffset[1] - view->constants.jitterOffset[1]) / motionVectorsTargetSize[1];
 
-        context->previousJitterOffset[0] = context->constants.jitterOffset[0];
-        context->previousJitterOffset[1] = context->constants.jitterOffset[1];
+        view->previousJitterOffset[0] = view->constants.jitterOffset[0];
+        view->previousJitterOffset[1] = view->constants.jitterOffset[1];
     }
 
     // lock data, assuming jitter sequence length computation for now
     const int32_t jitterPhaseCount = ffxmFsr2GetJitterPhaseCount(params->renderSize.width, context->contextDescription.displaySize.width);
 
     // init on first frame
-    if (resetAccumulation || context->constants.jitterPhaseCount == 0) {
-        context->constants.jitterPhaseCount = (float)jitterPhaseCount;
+    if (resetAccumulation || view->constants.jitterPhaseCount == 0) {
+        view->constants.jitterPhaseCount = (float)jitterPhaseCount;
     } else {
-        const int32_t jitterPhaseCountDelta = (int32_t)(jitterPhaseCount - context->constants.jitterPhaseCount);
+        const int32_t jitterPhaseCountDelta = (int32_t)(jitterPhaseCount - view->constants.jitterPhaseCount);
         if (jitterPhaseCountDelta > 0) {
-            context->constants.jitterPhaseCount++;
+            view->constants.jitterPhaseCount++;
         } else if (jitterPhaseCountDelta < 0) {
-            context->constants.jitterPhaseCount--;
+            view->constants.jitterPhaseCount--;
         }
     }
 
+    // rows of the Lanczos weight table for this frame, the shaders compute the weights when there is none
+    view->constants.lanczosTableSourceStep[0] = context->lanczosTableSourceStep[0];
+    view->constants.lanczosTableSourceStep[1] = context->lanczosTableSourceStep[1];
+    view->constants.lanczosTableInfo[0] = getLanczosTableJitterRow(context, params);
+    view->constants.lanczosTableInfo[1] = context->lanczosTablePeriod[0];
+    view->constants.lanczosTableInfo[2] = context->lanczosTablePeriod[1];
+    view->constants.lanczosTableInfo[3] = context->lanczosTableHeight;
+
     // convert delta time to seconds and clamp to [0, 1].
-    context->constants.deltaTime = FFXM_MAXIMUM(0.0f, FFXM_MINIMUM(1.0f, params->frameTimeDelta / 1000.0f));
+    view->constants.deltaTime = FFXM_MAXIMUM(0.0f, FFXM_MINIMUM(1.0f, params->frameTimeDelta / 1000.0f));
 
     if (resetAccumulation) {
-        context->constants.frameIndex = 0;
+        view->constants.frameIndex = 0;
     } else {
-        context->constants.frameIndex++;
+        view->constants.frameIndex++;
     }
 
     // shading change usage of the SPD mip levels.
-    context->constants.lumaMipLevelToUse = uint32_t(FFXM_FSR2_SHADING_CHANGE_MIP_LEVEL);
+    view->constants.lumaMipLevelToUse = uint32_t(FFXM_FSR2_SHADING_CHANGE_MIP_LEVEL);
 
-    const float mipDiv = float(2 << context->constants.lumaMipLevelToUse);
-    context->constants.lumaMipDimensions[0] = uint32_t(context->constants.maxRenderSize[0] / mipDiv);
-    context->constants.lumaMipDimensions[1] = uint32_t(context->constants.maxRenderSize[1] / mipDiv);
+    const float mipDiv = float(2 << view->constants.lumaMipLevelToUse);
+    view->constants.lumaMipDimensions[0] = uint32_t(view->constants.maxRenderSize[0] / mipDiv);
+    view->constants.lumaMipDimensions[1] = uint32_t(view->constants.maxRenderSize[1] / mipDiv);
 
     // reactive mask bias
     const int32_t threadGroupWorkRegionDim = 8;
-    const int32_t dispatchSrcX = FFXM_DIVIDE_ROUNDING_UP(context->constants.renderSize[0], threadGroupWorkRegionDim);
-    const int32_t dispatchSrcY = FFXM_DIVIDE_ROUNDING_UP(context->constants.renderSize[1], threadGroupWorkRegionDim);
+    const int32_t dispatchSrcX = FFXM_DIVIDE_ROUNDING_UP(view->constants.renderSize[0], threadGroupWorkRegionDim);
+    const int32_t dispatchSrcY = FFXM_DIVIDE_ROUNDING_UP(view->constants.renderSize[1], threadGroupWorkRegionDim);
     const int32_t dispatchDstX = FFXM_DIVIDE_ROUNDING_UP(context->contextDescription.displaySize.width, threadGroupWorkRegionDim);
     const int32_t dispatchDstY = FFXM_DIVIDE_ROUNDING_UP(context->contextDescription.displaySize.height, threadGroupWorkRegionDim);
 
@@ -1181,21 +1766,21 @@ static FfxmErrorCode fsr2Dispatch(FfxmFsr2Context_Private* context, const FfxmFs
         clearValuesLockStatus[LOCK_TEMPORAL_LUMA] = 0.0f;
 
         memcpy(clearJob.clearJobDescriptor.color, clearValuesLockStatus, 4 * sizeof(float));
-        clearJob.clearJobDescriptor.target = context->srvResources[lockStatusSrvResourceIndex];
+        clearJob.clearJobDescriptor.target = view->srvResources[lockStatusSrvResourceIndex];
         context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
 
         const float clearValuesToZeroFloat[]{ 0.f, 0.f, 0.f, 0.f };
         memcpy(clearJob.clearJobDescriptor.color, clearValuesToZeroFloat, 4 * sizeof(float));
-        clearJob.clearJobDescriptor.target = context->srvResources[upscaledColorSrvResourceIndex];
+        clearJob.clearJobDescriptor.target = view->srvResources[upscaledColorSrvResourceIndex];
         context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
 
 		if(isBalancedOrPerformance)
 		{
-			clearJob.clearJobDescriptor.target = context->srvResources[temporalReactiveSrvResourceIndex];
+			clearJob.clearJobDescriptor.target = view->srvResources[temporalReactiveSrvResourceIndex];
 			context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
 		}
 
-        clearJob.clearJobDescriptor.target = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE];
+        clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE];
         context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
 
         //if (context->contextDescription.flags & FFXM_FSR2_ENABLE_AUTO_EXPOSURE)
@@ -1203,7 +1788,15 @@ static FfxmErrorCode fsr2Dispatch(FfxmFsr2Context_Private* context, const FfxmFs
         {
             const float clearValuesExposure[]{ -1.f, 1e8f, 0.f, 0.f };
             memcpy(clearJob.clearJobDescriptor.color, clearValuesExposure, 4 * sizeof(float));
-            clearJob.clearJobDescriptor.target = context->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE];
+            clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTO_EXPOSURE];
+            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        }
+
+        // The subgroup luminance pyramid keeps whether the exposure has converged in the SPD atomic counter
+        if (context->contextDescription.flags & FFXM_FSR2_ENABLE_SUBGROUP_LUMINANCE_PYRAMID)
+        {
+            memset(clearJob.clearJobDescriptor.color, 0, 4 * sizeof(float));
+            clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT];
             context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
         }
     }
@@ -1230,43 +1823,256 @@ static FfxmErrorCode fsr2Dispatch(FfxmFsr2Context_Private* context, const FfxmFs
     FsrRcasCon(rcasConsts.rcasConfig, sharpenessRemapped);
 
     // initialize constantBuffers data
-    memcpy(&context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_FSR2].data,        &context->constants,        context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_FSR2].num32BitEntries * sizeof(uint32_t));
+    memcpy(&context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_FSR2].data,        &view->constants,        context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_FSR2].num32BitEntries * sizeof(uint32_t));
     memcpy(&context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_SPD].data,         &luminancePyramidConstants, context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_SPD].num32BitEntries * sizeof(uint32_t));
     memcpy(&context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_RCAS].data,        &rcasConsts,                context->constantBuffers[FFXM_FSR2_CONSTANTBUFFER_IDENTIFIER_RCAS].num32BitEntries * sizeof(uint32_t));
 
-	const uint32_t renderW = context->constants.renderSize[0];
-	const uint32_t renderH = context->constants.renderSize[1];
+	const uint32_t renderW = view->constants.renderSize[0];
+	const uint32_t renderH = view->constants.renderSize[1];
+	const uint32_t displayW = context->contextDescription.displaySize.width;
+	const uint32_t displayH = context->contextDescription.displaySize.height;
+
+	// The half resolution depth clip writes one texel per 2x2 render pixels to the top left of the dilated reactive masks,
+	// and with the performance preset of the prepared input color
+	const bool halfResDepthClipMode = applyUltraPerformanceOptimizations || context->contextDescription.qualityMode == FFXM_FSR2_SHADER_QUALITY_MODE_PERFORMANCE;
+	const bool halfResDepthClip = halfResDepthClipMode && (context->contextDescription.flags & FFXM_FSR2_ENABLE_HALF_RES_DEPTH_CLIP);
+	const uint32_t depthClipW = halfResDepthClip ? (renderW + 1) / 2 : renderW;
+	const uint32_t depthClipH = halfResDepthClip ? (renderH + 1) / 2 : renderH;
+
+	// The fused lock pass runs ahead of the depth clip in place of the reconstruction
+	const bool fusedReconstructAndLock = (context->contextDescription.flags & FFXM_FSR2_ENABLE_FUSED_RECONSTRUCT_AND_LOCK) != 0;
+
+	// Rectangles of the passes restricted to the display regions, a count of 0 covers the whole pass.
+	// RCAS reads the accumulation one pixel around its output.
+	const bool sharpenEnabled = params->enableSharpening;
+	FfxmRect2D reconstructRects[FFXM_FSR2_MAX_DISPATCH_REGIONS], depthClipRects[FFXM_FSR2_MAX_DISPATCH_REGIONS], lockGroupRects[FFXM_FSR2_MAX_DISPATCH_REGIONS];
+	FfxmRect2D accumulateRects[FFXM_FSR2_MAX_DISPATCH_REGIONS], rcasRects[FFXM_FSR2_MAX_DISPATCH_REGIONS];
+	uint32_t regionRectCount = 0;
+	if (regionsActive)
+	{
+		regionRectCount = getRegionRects(context, view, renderW, renderH, FSR2_REGION_RENDER_BORDER + 2, reconstructRects);
+		getRegionRects(context, view, depthClipW, depthClipH, halfResDepthClip ? FSR2_REGION_RENDER_BORDER / 2 + 1 : FSR2_REGION_RENDER_BORDER + 1, depthClipRects);
+		getRegionRects(context, view, renderW, renderH, fusedReconstructAndLock ? FSR2_REGION_RENDER_BORDER + 2 : FSR2_REGION_RENDER_BORDER + 1, lockGroupRects);
+		getGroupRects(lockGroupRects, regionRectCount, threadGroupWorkRegionDim);
+		getRegionRects(context, view, displayW, displayH, sharpenEnabled ? 1 : 0, accumulateRects);
+		getRegionRects(context, view, displayW, displayH, 0, rcasRects);
+	}
 
     if (!applyUltraPerformanceOptimizations)
     {
-        scheduleDispatch(context, params, &context->pipelineComputeLuminancePyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
+        scheduleDispatch(context, view, params, &context->pipelineComputeLuminancePyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1], asyncCompute);
     }
-	scheduleFragment(context, params, &context->pipelineReconstructPreviousDepth, renderW, renderH);
-	scheduleFragment(context, params, &context->pipelineDepthClip, renderW, renderH);
+    // An aliased new locks resource has lost the reset done by the previous accumulate pass. With regions, the
+    // accumulation only resets the new locks inside its rectangles, while the lock pass writes them around too.
+    const bool clearNewLocks = context->newLocksAliased || view->regionCount || regionsChanged;
 
-    scheduleDispatch(context, params, &context->pipelineLock, dispatchSrcX, dispatchSrcY);
+    if (fusedReconstructAndLock)
+    {
+        // The fused lock pass reconstructs the previous depth, which the lock pass otherwise resets after the depth clip.
+        // The clear value is the bit pattern of the far depth, as the lock pass stores it.
+        FfxmGpuJobDescription clearJob = { FFXM_GPU_JOB_CLEAR_FLOAT };
+        const float farDepth = (context->contextDescription.flags & FFXM_FSR2_ENABLE_DEPTH_INVERTED) ? 0.0f : 1.0f;
+        const float clearValuesFarDepth[]{ farDepth, 0.f, 0.f, 0.f };
+        memcpy(clearJob.clearJobDescriptor.color, clearValuesFarDepth, 4 * sizeof(float));
+        clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH];
+        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
 
-    const bool sharpenEnabled = params->enableSharpening;
-	scheduleFragment(context, params, sharpenEnabled ? &context->pipelineAccumulateSharpen : &context->pipelineAccumulate,
-					 context->contextDescription.displaySize.width, context->contextDescription.displaySize.height);
+        if (clearNewLocks) {
+            memset(clearJob.clearJobDescriptor.color, 0, 4 * sizeof(float));
+            clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS];
+            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        }
+
+        scheduleDispatch(context, view, params, &context->pipelineLock, dispatchSrcX, dispatchSrcY, false, lockGroupRects, regionRectCount);
+        scheduleFragment(context, view, params, &context->pipelineDepthClip, depthClipW, depthClipH, false, depthClipRects, regionRectCount);
+    }
+    else
+    {
+        // The depth clip pass directly follows the reconstruction at the same resolution, it can share its render pass.
+        // The lock pass keeps the accumulation out of it.
+        const bool mergeSubpasses = (context->contextDescription.flags & FFXM_FSR2_ENABLE_SUBPASS_MERGING) != 0 && !halfResDepthClip;
+        scheduleFragment(context, view, params, &context->pipelineReconstructPreviousDepth, renderW, renderH, mergeSubpasses, reconstructRects, regionRectCount);
+        scheduleFragment(context, view, params, &context->pipelineDepthClip, depthClipW, depthClipH, false, depthClipRects, regionRectCount);
+
+        if (clearNewLocks) {
+
+            FfxmGpuJobDescription clearJob = { FFXM_GPU_JOB_CLEAR_FLOAT };
+            clearJob.clearJobDescriptor.target = view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_NEW_LOCKS];
+            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        }
+
+        scheduleDispatch(context, view, params, &context->pipelineLock, dispatchSrcX, dispatchSrcY, false, lockGroupRects, regionRectCount);
+    }
+
+	scheduleFragment(context, view, params, sharpenEnabled ? &context->pipelineAccumulateSharpen : &context->pipelineAccumulate,
+					 displayW, displayH, false, accumulateRects, regionRectCount);
 
     // RCAS
     if (sharpenEnabled) {
 
         // Run RCAS
-        scheduleFragment(context, params, &context->pipelineRCAS, context->contextDescription.displaySize.width,
-						 context->contextDescription.displaySize.height);
+        scheduleFragment(context, view, params, &context->pipelineRCAS, displayW, displayH, false, rcasRects, regionRectCount);
     }
 
-    context->resourceFrameIndex = (context->resourceFrameIndex + 1) % FSR2_MAX_QUEUED_FRAMES;
+    view->resourceFrameIndex = (view->resourceFrameIndex + 1) % FSR2_MAX_QUEUED_FRAMES;
 
     // Fsr2MaxQueuedFrames must be an even number.
     FFXM_STATIC_ASSERT((FSR2_MAX_QUEUED_FRAMES & 1) == 0);
+}
+
+static void captureWrite(FfxmFsr2Context_Private* context, const void* data, size_t size)
+{
+    if (fwrite(data, 1, size, context->captureFile) != size)
+        context->captureFailed = true;
+}
+
+static void captureWriteChunkHeader(FfxmFsr2Context_Private* context, FfxmFsr2CaptureChunkType type, size_t payloadSize)
+{
+    const FfxmFsr2CaptureChunkHeader chunkHeader = { uint32_t(type), uint32_t(payloadSize) };
+    captureWrite(context, &chunkHeader, sizeof(chunkHeader));
+}
+
+static void captureWriteTexture(FfxmFsr2Context_Private* context, FfxmFsr2CaptureTexture texture, FfxmResourceInternal resource)
+{
+    FfxmInterface* backendInterface = &context->contextDescription.backendInterface;
 
-    context->contextDescription.backendInterface.fpExecuteGpuJobs(&context->contextDescription.backendInterface, commandList);
+    size_t dataSize = 0;
+    if (backendInterface->fpReadResource(backendInterface, resource, nullptr, &dataSize) != FFXM_OK ||
+        dataSize > UINT32_MAX - sizeof(FfxmFsr2CaptureTextureChunk)) {
+        context->captureFailed = true;
+        return;
+    }
+
+    void* data = malloc(dataSize);
+    if (!data || backendInterface->fpReadResource(backendInterface, resource, data, &dataSize) != FFXM_OK) {
+        free(data);
+        context->captureFailed = true;
+        return;
+    }
+
+    const FfxmResourceDescription description = backendInterface->fpGetResourceDescription(backendInterface, resource);
+    const FfxmFsr2CaptureTextureChunk textureChunk = { uint32_t(texture), uint32_t(description.format), description.width, description.height };
+    captureWriteChunkHeader(context, FFXM_FSR2_CAPTURE_CHUNK_TEXTURE, sizeof(textureChunk) + dataSize);
+    captureWrite(context, &textureChunk, sizeof(textureChunk));
+    captureWrite(context, data, dataSize);
+
+    free(data);
+}
+
+FFXM_STATIC_ASSERT(sizeof(FfxmFsr2CaptureFoveationChunk::centers) == FFXM_FSR2_MAX_FOVEATION_CENTERS * 2 * sizeof(float));
+
+// Appends a dispatch to the capture, the inputs and the output of the frame must still be registered.
+static void captureFrame(FfxmFsr2Context_Private* context, const Fsr2View* view, const FfxmFsr2DispatchDescription* params)
+{
+    // the exposure of the application is ignored with auto exposure, and the optional masks may be missing
+    uint32_t textureMask = (1u << FFXM_FSR2_CAPTURE_TEXTURE_COLOR) | (1u << FFXM_FSR2_CAPTURE_TEXTURE_DEPTH) |
+                           (1u << FFXM_FSR2_CAPTURE_TEXTURE_MOTION_VECTORS) | (1u << FFXM_FSR2_CAPTURE_TEXTURE_OUTPUT);
+    if (!(context->contextDescription.flags & FFXM_FSR2_ENABLE_AUTO_EXPOSURE) && !ffxmFsr2ResourceIsNull(params->exposure))
+        textureMask |= 1u << FFXM_FSR2_CAPTURE_TEXTURE_EXPOSURE;
+    if (!ffxmFsr2ResourceIsNull(params->reactive))
+        textureMask |= 1u << FFXM_FSR2_CAPTURE_TEXTURE_REACTIVE;
+    if (!ffxmFsr2ResourceIsNull(params->transparencyAndComposition))
+        textureMask |= 1u << FFXM_FSR2_CAPTURE_TEXTURE_TRANSPARENCY_AND_COMPOSITION;
+
+    FfxmFsr2CaptureFrameChunk frameChunk = {};
+    frameChunk.frameIndex = context->captureFrameIndex++;
+    frameChunk.textureMask = textureMask;
+    frameChunk.jitterOffset[0] = params->jitterOffset.x;
+    frameChunk.jitterOffset[1] = params->jitterOffset.y;
+    frameChunk.jitterIndex = params->jitterIndex;
+    frameChunk.motionVectorScale[0] = params->motionVectorScale.x;
+    frameChunk.motionVectorScale[1] = params->motionVectorScale.y;
+    frameChunk.renderSize[0] = params->renderSize.width;
+    frameChunk.renderSize[1] = params->renderSize.height;
+    frameChunk.enableSharpening = params->enableSharpening;
+    frameChunk.sharpness = params->sharpness;
+    frameChunk.frameTimeDelta = params->frameTimeDelta;
+    frameChunk.preExposure = params->preExposure;
+    frameChunk.reset = params->reset;
+    frameChunk.cameraNear = params->cameraNear;
+    frameChunk.cameraFar = params->cameraFar;
+    frameChunk.cameraFovAngleVertical = params->cameraFovAngleVertical;
+    frameChunk.viewSpaceToMetersFactor = params->viewSpaceToMetersFactor;
+    captureWriteChunkHeader(context, FFXM_FSR2_CAPTURE_CHUNK_FRAME, sizeof(frameChunk));
+    captureWrite(context, &frameChunk, sizeof(frameChunk));
+
+    if (params->regionCount)
+    {
+        captureWriteChunkHeader(context, FFXM_FSR2_CAPTURE_CHUNK_REGIONS, params->regionCount * sizeof(FfxmRect2D));
+        captureWrite(context, params->regions, params->regionCount * sizeof(FfxmRect2D));
+    }
+
+    if (params->foveation.centerCount)
+    {
+        FfxmFsr2CaptureFoveationChunk foveationChunk = {};
+        foveationChunk.centerCount = params->foveation.centerCount;
+        for (uint32_t centerIndex = 0; centerIndex < params->foveation.centerCount; ++centerIndex)
+        {
+            foveationChunk.centers[centerIndex * 2 + 0] = params->foveation.centers[centerIndex].x;
+            foveationChunk.centers[centerIndex * 2 + 1] = params->foveation.centers[centerIndex].y;
+        }
+        foveationChunk.radius = params->foveation.radius;
+        foveationChunk.falloff = params->foveation.falloff;
+        captureWriteChunkHeader(context, FFXM_FSR2_CAPTURE_CHUNK_FOVEATION, sizeof(foveationChunk));
+        captureWrite(context, &foveationChunk, sizeof(foveationChunk));
+    }
+
+    const FfxmResourceInternal textures[FFXM_FSR2_CAPTURE_TEXTURE_COUNT] = {
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR],
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_DEPTH],
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_MOTION_VECTORS],
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_EXPOSURE],
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK],
+        view->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK],
+        view->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT],
+    };
+    for (uint32_t texture = 0; texture < FFXM_FSR2_CAPTURE_TEXTURE_COUNT; ++texture)
+    {
+        if (textureMask & (1u << texture))
+            captureWriteTexture(context, FfxmFsr2CaptureTexture(texture), textures[texture]);
+    }
+}
+
+static FfxmErrorCode fsr2Dispatch(FfxmFsr2Context_Private* context, const FfxmFsr2DispatchDescription* params, uint32_t viewCount)
+{
+    if ((context->contextDescription.flags & FFXM_FSR2_ENABLE_DEBUG_CHECKING) == FFXM_FSR2_ENABLE_DEBUG_CHECKING)
+    {
+        for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+            fsr2DebugCheckDispatch(context, &params[viewIndex]);
+    }
+
+    // take a short cut to the command list, the same for all the views
+    FfxmCommandList commandList = params->commandList;
+
+    // The luminance pyramid only depends on the input color, it can overlap the work the application submits before the upscaler.
+    const bool asyncCompute = params->asyncComputeCommandList && context->contextDescription.backendInterface.fpExecuteGpuJobsAsync;
+
+    // Each view schedules its own passes with the pipelines of the context, the jobs of all the views are executed together.
+    for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+    {
+        scheduleViewPasses(context, &context->views[viewIndex], &params[viewIndex], asyncCompute);
+    }
+
+    if (asyncCompute)
+        context->contextDescription.backendInterface.fpExecuteGpuJobsAsync(&context->contextDescription.backendInterface, commandList, params->asyncComputeCommandList);
+    else
+        context->contextDescription.backendInterface.fpExecuteGpuJobs(&context->contextDescription.backendInterface, commandList);
+
+    // the jobs have been executed and the resources of the application are still registered
+    if (context->captureFile)
+    {
+        // the capture format holds a single view, a capture missing frames must not look complete
+        if (viewCount == 1)
+            captureFrame(context, &context->views[0], params);
+        else
+            context->captureFailed = true;
+    }
 
     // release dynamic resources
-    context->contextDescription.backendInterface.fpUnregisterResources(&context->contextDescription.backendInterface, commandList, context->effectContextId);
+    for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+    {
+        context->contextDescription.backendInterface.fpUnregisterResources(&context->contextDescription.backendInterface, commandList, context->views[viewIndex].effectContextId);
+    }
 
     return FFXM_OK;
 }
@@ -1289,6 +2095,8 @@ FfxmErrorCode ffxmFsr2ContextCreate(FfxmFsr2Context* context, const FfxmFsr2Cont
     FFXM_RETURN_ON_ERROR(contextDescription->backendInterface.fpCreateBackendContext, FFXM_ERROR_INCOMPLETE_INTERFACE);
     FFXM_RETURN_ON_ERROR(contextDescription->backendInterface.fpDestroyBackendContext, FFXM_ERROR_INCOMPLETE_INTERFACE);
 
+    FFXM_RETURN_ON_ERROR(contextDescription->viewCount <= FFXM_MAX_VIEW_COUNT, FFXM_ERROR_INVALID_ARGUMENT);
+
     // if a scratch buffer is declared, then we must have a size
     if (contextDescription->backendInterface.scratchBuffer) {
 
@@ -1317,6 +2125,112 @@ FfxmErrorCode ffxmFsr2ContextDestroy(FfxmFsr2Context* context)
     return errorCode;
 }
 
+FfxmErrorCode ffxmFsr2ContextGetAliasedMemorySavings(FfxmFsr2Context* context, size_t* savedMemorySize)
+{
+    FFXM_RETURN_ON_ERROR(
+        context,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        savedMemorySize,
+        FFXM_ERROR_INVALID_POINTER);
+
+    FfxmFsr2Context_Private* contextPrivate = (FfxmFsr2Context_Private*)(context);
+    *savedMemorySize = contextPrivate->aliasedMemorySavings;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmFsr2ContextGetPassTimings(FfxmFsr2Context* context, uint64_t* passTimings)
+{
+    FFXM_RETURN_ON_ERROR(
+        context,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        passTimings,
+        FFXM_ERROR_INVALID_POINTER);
+
+    FfxmFsr2Context_Private* contextPrivate = (FfxmFsr2Context_Private*)(context);
+    FFXM_RETURN_ON_ERROR(
+        contextPrivate->gpuTimingsActive,
+        FFXM_ERROR_INCOMPLETE_INTERFACE);
+
+    return contextPrivate->contextDescription.backendInterface.fpGetGpuTimings(&contextPrivate->contextDescription.backendInterface,
+        contextPrivate->effectContextId, passTimings, FFXM_FSR2_PASS_COUNT);
+}
+
+FfxmErrorCode ffxmFsr2ContextGetFlags(FfxmFsr2Context* context, uint32_t* flags)
+{
+    FFXM_RETURN_ON_ERROR(
+        context,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        flags,
+        FFXM_ERROR_INVALID_POINTER);
+
+    // the flags of the features unavailable for the context were dropped at its creation
+    const FfxmFsr2Context_Private* contextPrivate = (const FfxmFsr2Context_Private*)(context);
+    *flags = contextPrivate->contextDescription.flags;
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmFsr2ContextBeginCapture(FfxmFsr2Context* context, const char* filePath)
+{
+    FFXM_RETURN_ON_ERROR(
+        context,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        filePath,
+        FFXM_ERROR_INVALID_POINTER);
+
+    FfxmFsr2Context_Private* contextPrivate = (FfxmFsr2Context_Private*)(context);
+    FFXM_RETURN_ON_ERROR(
+        contextPrivate->contextDescription.backendInterface.fpReadResource,
+        FFXM_ERROR_INCOMPLETE_INTERFACE);
+
+    // a new capture replaces the current one
+    ffxmFsr2ContextEndCapture(context);
+
+    contextPrivate->captureFile = fopen(filePath, "wb");
+    FFXM_RETURN_ON_ERROR(
+        contextPrivate->captureFile,
+        FFXM_ERROR_INVALID_PATH);
+    contextPrivate->captureFrameIndex = 0;
+    contextPrivate->captureFailed = false;
+
+    const FfxmFsr2CaptureFileHeader fileHeader = { FFXM_FSR2_CAPTURE_MAGIC, FFXM_FSR2_CAPTURE_VERSION };
+    captureWrite(contextPrivate, &fileHeader, sizeof(fileHeader));
+
+    const FfxmFsr2ContextDescription* contextDescription = &contextPrivate->contextDescription;
+    const FfxmFsr2CaptureContextChunk contextChunk = {
+        uint32_t(contextDescription->qualityMode), contextDescription->flags,
+        { contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height },
+        { contextDescription->displaySize.width, contextDescription->displaySize.height } };
+    captureWriteChunkHeader(contextPrivate, FFXM_FSR2_CAPTURE_CHUNK_CONTEXT, sizeof(contextChunk));
+    captureWrite(contextPrivate, &contextChunk, sizeof(contextChunk));
+
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmFsr2ContextEndCapture(FfxmFsr2Context* context)
+{
+    FFXM_RETURN_ON_ERROR(
+        context,
+        FFXM_ERROR_INVALID_POINTER);
+
+    FfxmFsr2Context_Private* contextPrivate = (FfxmFsr2Context_Private*)(context);
+    if (!contextPrivate->captureFile)
+        return FFXM_OK;
+
+    const bool closed = fclose(contextPrivate->captureFile) == 0;
+    contextPrivate->captureFile = nullptr;
+    FFXM_RETURN_ON_ERROR(
+        closed && !contextPrivate->captureFailed,
+        FFXM_ERROR_INVALID_PATH);
+
+    return FFXM_OK;
+}
+
 FfxmErrorCode ffxmFsr2ContextDispatch(FfxmFsr2Context* context, const FfxmFsr2DispatchDescription* dispatchParams)
 {
     FFXM_RETURN_ON_ERROR(
@@ -1335,12 +2249,64 @@ FfxmErrorCode ffxmFsr2ContextDispatch(FfxmFsr2Context* context, const FfxmFsr2Di
     FFXM_RETURN_ON_ERROR(
         dispatchParams->renderSize.height <= contextPrivate->contextDescription.maxRenderSize.height,
         FFXM_ERROR_OUT_OF_RANGE);
+    FFXM_RETURN_ON_ERROR(
+        fsr2RegionsValid(contextPrivate, dispatchParams),
+        FFXM_ERROR_INVALID_ARGUMENT);
+    FFXM_RETURN_ON_ERROR(
+        fsr2FoveationValid(dispatchParams),
+        FFXM_ERROR_INVALID_ARGUMENT);
     FFXM_RETURN_ON_ERROR(
         contextPrivate->device,
         FFXM_ERROR_NULL_DEVICE);
 
     // dispatch the FSR2 passes.
-    const FfxmErrorCode errorCode = fsr2Dispatch(contextPrivate, dispatchParams);
+    const FfxmErrorCode errorCode = fsr2Dispatch(contextPrivate, dispatchParams, 1);
+    return errorCode;
+}
+
+FfxmErrorCode ffxmFsr2ContextDispatchMultiView(FfxmFsr2Context* context, const FfxmFsr2DispatchDescription* dispatchParams, uint32_t viewCount)
+{
+    FFXM_RETURN_ON_ERROR(
+        context,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        dispatchParams,
+        FFXM_ERROR_INVALID_POINTER);
+
+    FfxmFsr2Context_Private* contextPrivate = (FfxmFsr2Context_Private*)(context);
+
+    FFXM_RETURN_ON_ERROR(
+        viewCount > 0 && viewCount <= contextPrivate->viewCount,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+    {
+        // the jobs of the views are recorded together
+        FFXM_RETURN_ON_ERROR(
+            dispatchParams[viewIndex].commandList == dispatchParams[0].commandList &&
+            dispatchParams[viewIndex].asyncComputeCommandList == dispatchParams[0].asyncComputeCommandList,
+            FFXM_ERROR_INVALID_ARGUMENT);
+
+        // validate that renderSize is within the maximum.
+        FFXM_RETURN_ON_ERROR(
+            dispatchParams[viewIndex].renderSize.width <= contextPrivate->contextDescription.maxRenderSize.width,
+            FFXM_ERROR_OUT_OF_RANGE);
+        FFXM_RETURN_ON_ERROR(
+            dispatchParams[viewIndex].renderSize.height <= contextPrivate->contextDescription.maxRenderSize.height,
+            FFXM_ERROR_OUT_OF_RANGE);
+        FFXM_RETURN_ON_ERROR(
+            fsr2RegionsValid(contextPrivate, &dispatchParams[viewIndex]),
+            FFXM_ERROR_INVALID_ARGUMENT);
+        FFXM_RETURN_ON_ERROR(
+            fsr2FoveationValid(&dispatchParams[viewIndex]),
+            FFXM_ERROR_INVALID_ARGUMENT);
+    }
+    FFXM_RETURN_ON_ERROR(
+        contextPrivate->device,
+        FFXM_ERROR_NULL_DEVICE);
+
+    // dispatch the FSR2 passes of all the views.
+    const FfxmErrorCode errorCode = fsr2Dispatch(contextPrivate, dispatchParams, viewCount);
     return errorCode;
 }
 
@@ -1385,6 +2351,143 @@ FfxmErrorCode ffxmFsr2GetRenderResolutionFromUpscalingRatio(
     return FFXM_OK;
 }
 
+// Smoothing of the GPU timings fed to the dynamic resolution controller, and the default gains of its loop
+#define FSR2_DRS_FRAME_TIME_SMOOTHING       (0.5f)
+#define FSR2_DRS_DEFAULT_PROPORTIONAL_GAIN  (0.1f)
+#define FSR2_DRS_DEFAULT_INTEGRAL_GAIN      (0.1f)
+#define FSR2_DRS_DEFAULT_DERIVATIVE_GAIN    (0.0f)
+#define FSR2_DRS_DEFAULT_HYSTERESIS         (0.05f)
+#define FSR2_DRS_DEFAULT_SIZE_STEP          (8)
+// Fraction of a size step the scale has to move away from the current render size to change it
+#define FSR2_DRS_SIZE_STEP_HYSTERESIS       (0.75f)
+
+static uint32_t drsQuantizeSize(uint32_t maxSize, uint32_t minSize, float scale, uint32_t sizeStep)
+{
+    const uint32_t size = uint32_t(float(maxSize) * scale / float(sizeStep) + 0.5f) * sizeStep;
+    return FFXM_MINIMUM(maxSize, FFXM_MAXIMUM(minSize, size));
+}
+
+FfxmErrorCode ffxmFsr2DrsControllerCreate(FfxmFsr2DrsController* pController, const FfxmFsr2DrsControllerDescription* pDescription)
+{
+    FFXM_RETURN_ON_ERROR(
+        pController,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        pDescription,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_STATIC_ASSERT(sizeof(FfxmFsr2DrsController) >= sizeof(FfxmFsr2DrsController_Private));
+
+    FfxmFsr2DrsControllerDescription description = *pDescription;
+    if (description.minRenderSize.width == 0 && description.minRenderSize.height == 0)
+    {
+        description.minRenderSize.width = FFXM_MAXIMUM(description.maxRenderSize.width / 2, 1u);
+        description.minRenderSize.height = FFXM_MAXIMUM(description.maxRenderSize.height / 2, 1u);
+    }
+    if (description.hysteresis == 0.0f)
+        description.hysteresis = FSR2_DRS_DEFAULT_HYSTERESIS;
+    if (description.sizeStep == 0)
+        description.sizeStep = FSR2_DRS_DEFAULT_SIZE_STEP;
+    if (description.proportionalGain == 0.0f && description.integralGain == 0.0f && description.derivativeGain == 0.0f)
+    {
+        description.proportionalGain = FSR2_DRS_DEFAULT_PROPORTIONAL_GAIN;
+        description.integralGain = FSR2_DRS_DEFAULT_INTEGRAL_GAIN;
+        description.derivativeGain = FSR2_DRS_DEFAULT_DERIVATIVE_GAIN;
+    }
+
+    FFXM_RETURN_ON_ERROR(description.targetFrameTime > 0.0f && description.hysteresis > 0.0f, FFXM_ERROR_INVALID_ARGUMENT);
+    FFXM_RETURN_ON_ERROR(description.minRenderSize.width > 0 && description.minRenderSize.height > 0, FFXM_ERROR_INVALID_ARGUMENT);
+    FFXM_RETURN_ON_ERROR(description.minRenderSize.width <= description.maxRenderSize.width
+        && description.minRenderSize.height <= description.maxRenderSize.height, FFXM_ERROR_INVALID_ARGUMENT);
+
+    FfxmFsr2DrsController_Private* controller = (FfxmFsr2DrsController_Private*)(pController);
+    memset(pController, 0, sizeof(FfxmFsr2DrsController));
+    controller->description = description;
+
+    return ffxmFsr2DrsControllerReset(pController);
+}
+
+FfxmErrorCode ffxmFsr2DrsControllerUpdate(FfxmFsr2DrsController* pController, float gpuFrameTime, FfxmDimensions2D* pRenderSize)
+{
+    FFXM_RETURN_ON_ERROR(
+        pController,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        pRenderSize,
+        FFXM_ERROR_INVALID_POINTER);
+    FFXM_RETURN_ON_ERROR(
+        gpuFrameTime >= 0.0f,
+        FFXM_ERROR_INVALID_ARGUMENT);
+
+    FfxmFsr2DrsController_Private* controller = (FfxmFsr2DrsController_Private*)(pController);
+    const FfxmFsr2DrsControllerDescription& description = controller->description;
+
+    // the frames still in flight were rendered at the previous size
+    if (controller->holdFrames)
+    {
+        --controller->holdFrames;
+        *pRenderSize = controller->renderSize;
+        return FFXM_OK;
+    }
+
+    controller->filteredFrameTime = (controller->filteredFrameTime > 0.0f)
+        ? controller->filteredFrameTime + (gpuFrameTime - controller->filteredFrameTime) * FSR2_DRS_FRAME_TIME_SMOOTHING
+        : gpuFrameTime;
+
+    // velocity form of the PID loop: the output is the change of the scale, so clamping the scale does not wind up the integral term
+    // the hysteresis band is below the budget, frames over it are always corrected
+    const float error = (description.targetFrameTime - controller->filteredFrameTime) / description.targetFrameTime;
+    if (error < 0.0f || error > description.hysteresis)
+    {
+        const float scaleDelta = description.proportionalGain * (error - controller->previousErrors[0])
+            + description.integralGain * error
+            + description.derivativeGain * (error - 2.0f * controller->previousErrors[0] + controller->previousErrors[1]);
+
+        const float minScale = FFXM_MINIMUM(float(description.minRenderSize.width) / description.maxRenderSize.width,
+            float(description.minRenderSize.height) / description.maxRenderSize.height);
+        controller->scale = FFXM_MINIMUM(1.0f, FFXM_MAXIMUM(minScale, controller->scale + scaleDelta));
+    }
+    controller->previousErrors[1] = controller->previousErrors[0];
+    controller->previousErrors[0] = error;
+
+    // only move to another size once the scale is well past the current one, so that the render targets are not reallocated each frame
+    const uint32_t largestSize = FFXM_MAXIMUM(description.maxRenderSize.width, description.maxRenderSize.height);
+    if (fabsf(controller->scale - controller->outputScale) * largestSize >= FSR2_DRS_SIZE_STEP_HYSTERESIS * description.sizeStep)
+    {
+        const FfxmDimensions2D renderSize = {
+            drsQuantizeSize(description.maxRenderSize.width, description.minRenderSize.width, controller->scale, description.sizeStep),
+            drsQuantizeSize(description.maxRenderSize.height, description.minRenderSize.height, controller->scale, description.sizeStep) };
+
+        controller->outputScale = controller->scale;
+        if (renderSize.width != controller->renderSize.width || renderSize.height != controller->renderSize.height)
+        {
+            controller->renderSize = renderSize;
+            controller->holdFrames = description.latencyFrames;
+            controller->filteredFrameTime = 0.0f;
+        }
+    }
+
+    *pRenderSize = controller->renderSize;
+    return FFXM_OK;
+}
+
+FfxmErrorCode ffxmFsr2DrsControllerReset(FfxmFsr2DrsController* pController)
+{
+    FFXM_RETURN_ON_ERROR(
+        pController,
+        FFXM_ERROR_INVALID_POINTER);
+
+    FfxmFsr2DrsController_Private* controller = (FfxmFsr2DrsController_Private*)(pController);
+    controller->scale = 1.0f;
+    controller->outputScale = 1.0f;
+    controller->filteredFrameTime = 0.0f;
+    controller->previousErrors[0] = 0.0f;
+    controller->previousErrors[1] = 0.0f;
+    controller->holdFrames = 0;
+    controller->renderSize = controller->description.maxRenderSize;
+
+    return FFXM_OK;
+}
+
 int32_t ffxmFsr2GetJitterPhaseCount(int32_t renderWidth, int32_t displayWidth)
 {
     const float basePhaseCount = 8.0f;
@@ -1441,18 +2544,18 @@ FfxmErrorCode ffxmFsr2ContextGenerateReactiveMask(FfxmFsr2Context* context, cons
     FfxmPipelineState* pipeline = &contextPrivate->pipelineGenerateReactive;
 
     // save internal reactive resource
-    FfxmResourceInternal internalReactive = contextPrivate->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE];
+    FfxmResourceInternal internalReactive = contextPrivate->views[0].rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE];
 
     FfxmFragmentJobDescription jobDescriptor = {};
-    contextPrivate->contextDescription.backendInterface.fpRegisterResource(&contextPrivate->contextDescription.backendInterface, &params->colorOpaqueOnly, contextPrivate->effectContextId, &contextPrivate->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_OPAQUE_ONLY]);
-    contextPrivate->contextDescription.backendInterface.fpRegisterResource(&contextPrivate->contextDescription.backendInterface, &params->colorPreUpscale, contextPrivate->effectContextId, &contextPrivate->srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR]);
-    contextPrivate->contextDescription.backendInterface.fpRegisterResource(&contextPrivate->contextDescription.backendInterface, &params->outReactive, contextPrivate->effectContextId, &contextPrivate->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE]);
+    contextPrivate->contextDescription.backendInterface.fpRegisterResource(&contextPrivate->contextDescription.backendInterface, &params->colorOpaqueOnly, contextPrivate->effectContextId, &contextPrivate->views[0].srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_OPAQUE_ONLY]);
+    contextPrivate->contextDescription.backendInterface.fpRegisterResource(&contextPrivate->contextDescription.backendInterface, &params->colorPreUpscale, contextPrivate->effectContextId, &contextPrivate->views[0].srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR]);
+    contextPrivate->contextDescription.backendInterface.fpRegisterResource(&contextPrivate->contextDescription.backendInterface, &params->outReactive, contextPrivate->effectContextId, &contextPrivate->views[0].rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE]);
 
-    jobDescriptor.rtTextures[0] = contextPrivate->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE];
+    jobDescriptor.rtTextures[0] = contextPrivate->views[0].rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE];
 
-    wcscpy(jobDescriptor.srvTextureNames[0], pipeline->srvTextureBindings[0].name);
-    wcscpy(jobDescriptor.srvTextureNames[1], pipeline->srvTextureBindings[1].name);
-    wcscpy(jobDescriptor.rtTextureNames[0], pipeline->rtBindings[0].name);
+#ifdef FFXM_DEBUG_CHECKING
+    jobDescriptor.rtTextureNames[0] = pipeline->rtBindings[0].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
 
     jobDescriptor.viewport[0] = params->renderSize.width;
     jobDescriptor.viewport[1] = params->renderSize.height;
@@ -1461,20 +2564,27 @@ FfxmErrorCode ffxmFsr2ContextGenerateReactiveMask(FfxmFsr2Context* context, cons
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex) {
 
         const uint32_t currentResourceId = pipeline->srvTextureBindings[currentShaderResourceViewIndex].resourceIdentifier;
-        const FfxmResourceInternal currentResource = contextPrivate->srvResources[currentResourceId];
+        const FfxmResourceInternal currentResource = contextPrivate->views[0].srvResources[currentResourceId];
         jobDescriptor.srvTextures[currentShaderResourceViewIndex] = currentResource;
-        wcscpy(jobDescriptor.srvTextureNames[currentShaderResourceViewIndex], pipeline->srvTextureBindings[currentShaderResourceViewIndex].name);
+#ifdef FFXM_DEBUG_CHECKING
+        jobDescriptor.srvTextureNames[currentShaderResourceViewIndex] = pipeline->srvTextureBindings[currentShaderResourceViewIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
     }
 
     for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < pipeline->constCount; ++currentRootConstantIndex) {
-        wcscpy(jobDescriptor.cbNames[currentRootConstantIndex], pipeline->constantBufferBindings[currentRootConstantIndex].name);
-        jobDescriptor.cbs[currentRootConstantIndex] = contextPrivate->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
+        const FfxmConstantBuffer& constantBuffer = contextPrivate->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
+        jobDescriptor.cbs[currentRootConstantIndex] = { constantBuffer.data, constantBuffer.num32BitEntries };
+#ifdef FFXM_DEBUG_CHECKING
+        jobDescriptor.cbNames[currentRootConstantIndex] = pipeline->constantBufferBindings[currentRootConstantIndex].name;
+#endif // #ifdef FFXM_DEBUG_CHECKING
     }
 
-    int32_t renderSize[2];
+    // constant buffers are copied by the backend when the job is scheduled, so they can live on the stack
+    uint32_t renderSize[sizeof(Fsr2GenerateReactiveConstants) / sizeof(uint32_t)] = {};
     renderSize[0] = params->renderSize.width;
     renderSize[1] = params->renderSize.height;
-    memcpy(&jobDescriptor.cbs[0].data, renderSize, sizeof(renderSize));
+    FFXM_ASSERT(jobDescriptor.cbs[0].num32BitEntries * sizeof(uint32_t) <= sizeof(renderSize));
+    jobDescriptor.cbs[0].data = renderSize;
 
     Fsr2GenerateReactiveConstants constants = {};
     constants.scale = params->scale;
@@ -1482,8 +2592,8 @@ FfxmErrorCode ffxmFsr2ContextGenerateReactiveMask(FfxmFsr2Context* context, cons
     constants.binaryValue = params->binaryValue;
     constants.flags = params->flags;
 
-    jobDescriptor.cbs[1].num32BitEntries = sizeof(constants);
-    memcpy(&jobDescriptor.cbs[1].data, &constants, sizeof(constants));
+    jobDescriptor.cbs[1].num32BitEntries = sizeof(constants) / sizeof(uint32_t);
+    jobDescriptor.cbs[1].data = reinterpret_cast<const uint32_t*>(&constants);
 
     FfxmGpuJobDescription fragmentJob = { FFXM_GPU_JOB_FRAGMENT };
     fragmentJob.fragmentJobDescription = jobDescriptor;
@@ -1493,7 +2603,7 @@ FfxmErrorCode ffxmFsr2ContextGenerateReactiveMask(FfxmFsr2Context* context, cons
     contextPrivate->contextDescription.backendInterface.fpExecuteGpuJobs(&contextPrivate->contextDescription.backendInterface, commandList);
 
     // restore internal reactive
-    contextPrivate->rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE] = internalReactive;
+    contextPrivate->views[0].rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_AUTOREACTIVE] = internalReactive;
 
     // release dynamic resources
     contextPrivate->contextDescription.backendInterface.fpUnregisterResources(&contextPrivate->contextDescription.backendInterface, commandList, contextPrivate->effectContextId);
@@ -20,6 +20,7 @@
 // SOFTWARE.
 
 #pragma once
+#include <stdio.h>
 #include "./fsr2/ffxm_fsr2_resources.h"
 
 namespace arm
@@ -47,6 +48,15 @@ typedef enum Fs2ShaderPermutationOptions
 	FSR2_SHADER_PERMUTATION_APPLY_PERFORMANCE_OPT       = (1 << 9),  ///< Apply optimizations used by "Performance" preset
 	FSR2_SHADER_PERMUTATION_APPLY_ULTRA_PERFORMANCE_OPT = (1 << 10),  ///< Apply optimizations used by "Ultra Performance" preset
 	FSR2_SHADER_PERMUTATION_PLATFORM_GLES_3_2	        = (1 << 11), ///< Indicates that the upscaler is being run in a GLES 3.2 platform
+    FSR2_SHADER_PERMUTATION_HALF_RES_DEPTH_CLIP         = (1 << 12), ///< Evaluates the depth clip at half render resolution and upsamples it in the accumulation
+    FSR2_SHADER_PERMUTATION_FUSED_RECONSTRUCT_AND_LOCK  = (1 << 13), ///< Dilates the inputs and reconstructs the previous depth in the lock pass
+    FSR2_SHADER_PERMUTATION_SUBGROUP_LUMINANCE_PYRAMID  = (1 << 14), ///< Reduces the luminance pyramid with subgroup operations, writing only the shading change mip and the exposure
+    FSR2_SHADER_PERMUTATION_LANCZOS_WEIGHT_TABLE        = (1 << 15), ///< Reads the separable upsampling weights from the table precomputed per jitter and pixel phase
+
+    /// The options only compiled from source by the VK backend build, the prebuilt shaders and the shader archives
+    /// packed from them don't have these permutations
+    FSR2_SHADER_PERMUTATION_SOURCE_ONLY = FSR2_SHADER_PERMUTATION_HALF_RES_DEPTH_CLIP | FSR2_SHADER_PERMUTATION_FUSED_RECONSTRUCT_AND_LOCK |
+                                          FSR2_SHADER_PERMUTATION_SUBGROUP_LUMINANCE_PYRAMID | FSR2_SHADER_PERMUTATION_LANCZOS_WEIGHT_TABLE,
 } Fs2ShaderPermutationOptions;
 
 // Constants for FSR2 dispatches. Must be kept in sync with cbFSR2 in ffx_fsr2_callbacks_hlsl.h
@@ -72,8 +82,34 @@ typedef struct Fsr2Constants {
     float                       deltaTime;
     float                       dynamicResChangeFactor;
     float                       viewSpaceToMetersFactor;
+    int32_t                     foveationCenterCount;
+
+    float                       foveationCenters[4];
+    float                       foveationRadiusAndFalloff[2];
+    int32_t                     lanczosTableSourceStep[2];
+    int32_t                     lanczosTableInfo[4];
 } Fsr2Constants;
 
+// Fsr2View
+// The state of one view of the FSR2 context, the views share the pipelines and the read only resources of the context.
+typedef struct Fsr2View {
+
+    FfxmUInt32                   effectContextId;
+    Fsr2Constants                constants;
+    // 2 arrays of resources, as e.g. FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS will use different resources when bound as SRV vs when bound as UAV
+    FfxmResourceInternal         srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+    FfxmResourceInternal         uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+	FfxmResourceInternal         rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
+
+    bool                        firstExecution;
+    uint32_t                    resourceFrameIndex;
+    float                       previousJitterOffset[2];
+    int32_t                     jitterPhaseCountRemaining;
+    FfxmRect2D                   regions[FFXM_FSR2_MAX_DISPATCH_REGIONS];  // the display regions of the previous dispatch
+    uint32_t                    regionCount;
+    uint32_t                    fullFramesRemaining;                      // full frame dispatches left before the regions apply
+} Fsr2View;
+
 struct FfxmFsr2ContextDescription;
 struct FfxmDeviceCapabilities;
 struct FfxmPipelineState;
@@ -83,8 +119,7 @@ struct FfxmPipelineState;
 typedef struct FfxmFsr2Context_Private {
 
     FfxmFsr2ContextDescription   contextDescription;
-    FfxmUInt32                   effectContextId;
-    Fsr2Constants                constants;
+    FfxmUInt32                   effectContextId;   // the effect context of the pipelines and of the first view
     FfxmDevice                   device;
     FfxmDeviceCapabilities       deviceCapabilities;
     FfxmPipelineState            pipelineDepthClip;
@@ -96,15 +131,34 @@ typedef struct FfxmFsr2Context_Private {
     FfxmPipelineState            pipelineComputeLuminancePyramid;
     FfxmPipelineState            pipelineGenerateReactive;
     FfxmConstantBuffer           constantBuffers[4];
-    // 2 arrays of resources, as e.g. FFXM_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS will use different resources when bound as SRV vs when bound as UAV
-    FfxmResourceInternal         srvResources[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
-    FfxmResourceInternal         uavResources[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
-	FfxmResourceInternal         rtResources[FFXM_FSR2_RESOURCE_IDENTIFIER_COUNT];
 
-    bool                        firstExecution;
-    uint32_t                    resourceFrameIndex;
-    float                       previousJitterOffset[2];
-    int32_t                     jitterPhaseCountRemaining;
+    bool                        newLocksAliased;   // FSR2_NewLocks shares memory, it is cleared before the lock pass
+    size_t                      aliasedMemorySavings;
+    bool                        gpuTimingsActive;
+    FILE*                       captureFile;       // the capture written by the dispatches, if any
+    uint32_t                    captureFrameIndex;
+    bool                        captureFailed;
+    bool                        lanczosTableActive;     // the weight table fits the upscaling ratio, see createLanczosWeightTable
+    int32_t                     lanczosTableRenderSize[2];
+    int32_t                     lanczosTablePeriod[2];  // output pixels after which the source phase repeats
+    int32_t                     lanczosTableSourceStep[2]; // render pixels covered by one period
+    int32_t                     lanczosTablePhaseCount; // jitter phases, each one owns the rows of both axes
+    int32_t                     lanczosTableHeight;
+    uint32_t                    viewCount;
+    Fsr2View                    views[FFXM_MAX_VIEW_COUNT];
 } FfxmFsr2Context_Private;
 
+// FfxmFsr2DrsController_Private
+// The private implementation of the dynamic resolution controller.
+typedef struct FfxmFsr2DrsController_Private {
+
+    FfxmFsr2DrsControllerDescription description;   // with the defaults applied
+    float                       scale;              // the per-dimension scale of maxRenderSize requested by the loop
+    float                       outputScale;        // the scale renderSize was computed from
+    float                       filteredFrameTime;
+    float                       previousErrors[2];
+    uint32_t                    holdFrames;
+    FfxmDimensions2D            renderSize;
+} FfxmFsr2DrsController_Private;
+
 } // namespace arm
@@ -0,0 +1,281 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Host side benchmark of the Arm ASR API. The effect runs on the null backend, so the timings only cover the
+// CPU work of the library (and the call recording of the backend), which makes host regressions visible
+// without a device.
+//
+// Usage: Arm_ASR_bench [--filter=<substring>] [--min_time=<seconds>]
+
+#include <host/ffxm_fsr2.h>
+#include <host/backends/null/ffxm_null.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace arm;
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+struct BenchConfig {
+    FfxmFsr2ShaderQualityMode   qualityMode;
+    const char*                 qualityModeName;
+    FfxmDimensions2D            renderSize;
+    FfxmDimensions2D            displaySize;
+};
+
+struct BenchOptions {
+    const char*                 filter = nullptr;
+    double                      minTime = 0.5;
+};
+
+struct BenchBackend {
+    NullDeviceContext           device = {};
+    std::vector<uint8_t>        scratch;
+};
+
+// Dummy handles, the null backend never dereferences them
+uint8_t s_CommandList;
+uint8_t s_Color, s_Depth, s_MotionVectors, s_Output, s_Reactive;
+
+FfxmFsr2ContextDescription getContextDescription(const BenchConfig& config, BenchBackend& backend)
+{
+    FfxmFsr2ContextDescription contextDescription = {};
+    contextDescription.qualityMode = config.qualityMode;
+    contextDescription.flags = FFXM_FSR2_ENABLE_AUTO_EXPOSURE | FFXM_FSR2_ENABLE_HIGH_DYNAMIC_RANGE;
+    contextDescription.maxRenderSize = config.renderSize;
+    contextDescription.displaySize = config.displaySize;
+
+    backend.scratch.resize(ffxmGetScratchMemorySizeNull(1));
+    if (ffxmGetInterfaceNull(&contextDescription.backendInterface, ffxmGetDeviceNull(&backend.device), backend.scratch.data(), backend.scratch.size(), 1) != FFXM_OK) {
+        fprintf(stderr, "Failed to create the null backend interface\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return contextDescription;
+}
+
+void checkResult(FfxmErrorCode errorCode, const char* function)
+{
+    if (errorCode != FFXM_OK) {
+        fprintf(stderr, "%s failed (0x%x)\n", function, unsigned(errorCode));
+        exit(EXIT_FAILURE);
+    }
+}
+
+FfxmResource getTexture(void* handle, FfxmSurfaceFormat format, FfxmDimensions2D size, FfxmResourceUsage usage, FfxmResourceStates state = FFXM_RESOURCE_STATE_COMPUTE_READ)
+{
+    return ffxmGetResourceNull(handle, { FFXM_RESOURCE_TYPE_TEXTURE2D, format, size.width, size.height, 1, 1, FFXM_RESOURCE_FLAGS_NONE, usage }, nullptr, state);
+}
+
+FfxmFsr2DispatchDescription getDispatchDescription(const BenchConfig& config, int32_t frameIndex)
+{
+    FfxmFsr2DispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList = ffxmGetCommandListNull(&s_CommandList);
+    dispatchDescription.color = getTexture(&s_Color, FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT, config.renderSize, FFXM_RESOURCE_USAGE_READ_ONLY);
+    dispatchDescription.depth = getTexture(&s_Depth, FFXM_SURFACE_FORMAT_R32_FLOAT, config.renderSize, FFXM_RESOURCE_USAGE_DEPTHTARGET);
+    dispatchDescription.motionVectors = getTexture(&s_MotionVectors, FFXM_SURFACE_FORMAT_R16G16_FLOAT, config.renderSize, FFXM_RESOURCE_USAGE_READ_ONLY);
+    dispatchDescription.output = getTexture(&s_Output, FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT, config.displaySize, FFXM_RESOURCE_USAGE_UAV, FFXM_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    const int32_t jitterPhaseCount = ffxmFsr2GetJitterPhaseCount(config.renderSize.width, config.displaySize.width);
+    ffxmFsr2GetJitterOffset(&dispatchDescription.jitterOffset.x, &dispatchDescription.jitterOffset.y, frameIndex, jitterPhaseCount);
+    dispatchDescription.jitterIndex = uint32_t(frameIndex);
+    dispatchDescription.motionVectorScale = { float(config.renderSize.width), float(config.renderSize.height) };
+    dispatchDescription.renderSize = config.renderSize;
+    dispatchDescription.enableSharpening = true;
+    dispatchDescription.sharpness = 0.5f;
+    dispatchDescription.frameTimeDelta = 16.6f;
+    dispatchDescription.preExposure = 1.0f;
+    dispatchDescription.reset = frameIndex == 0;
+    dispatchDescription.cameraNear = 0.1f;
+    dispatchDescription.cameraFar = 1000.0f;
+    dispatchDescription.cameraFovAngleVertical = 1.0f;
+    dispatchDescription.viewSpaceToMetersFactor = 1.0f;
+
+    return dispatchDescription;
+}
+
+struct BenchResult {
+    double                      time = 0.0;
+    uint64_t                    iterations = 0;
+    uint64_t                    calls = 0;
+};
+
+double elapsedSeconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double>(end - start).count();
+}
+
+bool isSelected(const BenchOptions& options, const std::string& name)
+{
+    return !options.filter || name.find(options.filter) != std::string::npos;
+}
+
+void report(const std::string& name, const BenchResult& result)
+{
+    printf("%-72s %12.3f us %12llu %14.1f\n", name.c_str(), result.time * 1e6 / double(result.iterations),
+        (unsigned long long)result.iterations, double(result.calls) / double(result.iterations));
+}
+
+// Runs the body until the measured time reaches the minimum time, the body returns the time of one iteration
+template<typename Body>
+void runBenchmark(const BenchOptions& options, const std::string& name, const NullDeviceContext& device, Body body)
+{
+    if (!isSelected(options, name))
+        return;
+
+    BenchResult result;
+    while (result.time < options.minTime) {
+        const uint64_t traceCount = device.traceCount;
+        result.time += body();
+        result.calls += device.traceCount - traceCount;
+        ++result.iterations;
+    }
+
+    report(name, result);
+}
+
+void benchmarkConfig(const BenchOptions& options, const BenchConfig& config)
+{
+    char suffix[128];
+    snprintf(suffix, sizeof(suffix), "/%s/%ux%u->%ux%u", config.qualityModeName,
+        config.renderSize.width, config.renderSize.height, config.displaySize.width, config.displaySize.height);
+
+    // Creation and destruction are measured in pairs, each one is reported on its own
+    const std::string createName = std::string("ffxmFsr2ContextCreate") + suffix;
+    const std::string destroyName = std::string("ffxmFsr2ContextDestroy") + suffix;
+    if (isSelected(options, createName) || isSelected(options, destroyName)) {
+        BenchBackend backend;
+        BenchResult createResult, destroyResult;
+        while (createResult.time + destroyResult.time < options.minTime) {
+            const FfxmFsr2ContextDescription contextDescription = getContextDescription(config, backend);
+            FfxmFsr2Context context;
+
+            const uint64_t createTraceCount = backend.device.traceCount;
+            const Clock::time_point createStart = Clock::now();
+            const FfxmErrorCode errorCode = ffxmFsr2ContextCreate(&context, &contextDescription);
+            const Clock::time_point createEnd = Clock::now();
+            checkResult(errorCode, "ffxmFsr2ContextCreate");
+
+            const uint64_t destroyTraceCount = backend.device.traceCount;
+            const Clock::time_point destroyStart = Clock::now();
+            ffxmFsr2ContextDestroy(&context);
+            const Clock::time_point destroyEnd = Clock::now();
+
+            createResult.time += elapsedSeconds(createStart, createEnd);
+            createResult.calls += destroyTraceCount - createTraceCount;
+            ++createResult.iterations;
+            destroyResult.time += elapsedSeconds(destroyStart, destroyEnd);
+            destroyResult.calls += backend.device.traceCount - destroyTraceCount;
+            ++destroyResult.iterations;
+        }
+
+        if (isSelected(options, createName))
+            report(createName, createResult);
+        if (isSelected(options, destroyName))
+            report(destroyName, destroyResult);
+    }
+
+    BenchBackend backend;
+    const FfxmFsr2ContextDescription contextDescription = getContextDescription(config, backend);
+    FfxmFsr2Context context;
+    checkResult(ffxmFsr2ContextCreate(&context, &contextDescription), "ffxmFsr2ContextCreate");
+
+    int32_t frameIndex = 0;
+    runBenchmark(options, std::string("ffxmFsr2ContextDispatch") + suffix, backend.device, [&]() {
+        const FfxmFsr2DispatchDescription dispatchDescription = getDispatchDescription(config, frameIndex++);
+        const Clock::time_point start = Clock::now();
+        const FfxmErrorCode errorCode = ffxmFsr2ContextDispatch(&context, &dispatchDescription);
+        const Clock::time_point end = Clock::now();
+        checkResult(errorCode, "ffxmFsr2ContextDispatch");
+        return elapsedSeconds(start, end);
+    });
+
+    runBenchmark(options, std::string("ffxmFsr2ContextGenerateReactiveMask") + suffix, backend.device, [&]() {
+        FfxmFsr2GenerateReactiveDescription generateReactiveDescription = {};
+        generateReactiveDescription.commandList = ffxmGetCommandListNull(&s_CommandList);
+        generateReactiveDescription.colorOpaqueOnly = getTexture(&s_Color, FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT, config.renderSize, FFXM_RESOURCE_USAGE_READ_ONLY);
+        generateReactiveDescription.colorPreUpscale = getTexture(&s_Color, FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT, config.renderSize, FFXM_RESOURCE_USAGE_READ_ONLY);
+        generateReactiveDescription.outReactive = getTexture(&s_Reactive, FFXM_SURFACE_FORMAT_R8_UNORM, config.renderSize, FFXM_RESOURCE_USAGE_RENDERTARGET, FFXM_RESOURCE_STATE_PIXEL_WRITE);
+        generateReactiveDescription.renderSize = config.renderSize;
+        generateReactiveDescription.scale = 1.0f;
+        generateReactiveDescription.cutoffThreshold = 0.2f;
+        generateReactiveDescription.binaryValue = 0.9f;
+
+        const Clock::time_point start = Clock::now();
+        const FfxmErrorCode errorCode = ffxmFsr2ContextGenerateReactiveMask(&context, &generateReactiveDescription);
+        const Clock::time_point end = Clock::now();
+        checkResult(errorCode, "ffxmFsr2ContextGenerateReactiveMask");
+        return elapsedSeconds(start, end);
+    });
+
+    checkResult(ffxmFsr2ContextDestroy(&context), "ffxmFsr2ContextDestroy");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        if (!strncmp(argv[i], "--filter=", 9)) {
+            options.filter = argv[i] + 9;
+        } else if (!strncmp(argv[i], "--min_time=", 11)) {
+            options.minTime = atof(argv[i] + 11);
+        } else {
+            fprintf(stderr, "Usage: %s [--filter=<substring>] [--min_time=<seconds>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const struct {
+        FfxmFsr2ShaderQualityMode   mode;
+        const char*                 name;
+    } qualityModes[] = {
+        { FFXM_FSR2_SHADER_QUALITY_MODE_QUALITY,            "Quality" },
+        { FFXM_FSR2_SHADER_QUALITY_MODE_BALANCED,           "Balanced" },
+        { FFXM_FSR2_SHADER_QUALITY_MODE_PERFORMANCE,        "Performance" },
+        { FFXM_FSR2_SHADER_QUALITY_MODE_ULTRA_PERFORMANCE,  "UltraPerformance" },
+    };
+    const FfxmDimensions2D displaySizes[] = { { 1280, 720 }, { 1920, 1080 }, { 2560, 1440 } };
+    const FfxmFsr2UpscalingRatio upscalingRatios[] = { FFXM_FSR2_UPSCALING_RATIO_X1_5, FFXM_FSR2_UPSCALING_RATIO_X2 };
+
+    printf("%-72s %15s %12s %14s\n", "Benchmark", "Time", "Iterations", "Calls/iter");
+    printf("%s\n", std::string(116, '-').c_str());
+
+    for (const auto& qualityMode : qualityModes) {
+        for (const FfxmDimensions2D& displaySize : displaySizes) {
+            for (const FfxmFsr2UpscalingRatio upscalingRatio : upscalingRatios) {
+                BenchConfig config = { qualityMode.mode, qualityMode.name, {}, displaySize };
+                ffxmFsr2GetRenderResolutionFromUpscalingRatio(&config.renderSize.width, &config.renderSize.height, displaySize.width, displaySize.height, upscalingRatio);
+                benchmarkConfig(options, config);
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,245 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+// Simulation of the dynamic resolution controller on synthetic GPU load traces. The GPU time of a frame is a fixed
+// cost plus a load proportional to the render area, with a deterministic noise, and is handed to the controller
+// latencyFrames frames after the frame was rendered. Each trace is a sequence of load steps, run with 0 and 3 frames
+// of latency, and the controller is checked to:
+//   - converge within s_SettleFrames of each step: the frame time at the chosen size is within the hysteresis band
+//     below the budget, or the size is clamped to the largest or smallest render size,
+//   - not oscillate once settled: the render area keeps moving in the same direction, a slow drift of single
+//     steps is fine but growing after shrinking, or the other way around, is not,
+//   - only pick sizes that are multiples of sizeStep or one of the clamping sizes,
+//   - start again from the largest render size after ffxmFsr2DrsControllerReset.
+//
+// The hysteresis has to be wider than the peak to peak noise of the timings, relative to the budget, otherwise the
+// controller walks between two neighbouring sizes on the noise alone. Use --hysteresis and --noise to see it.
+//
+// Usage: Arm_ASR_drs_sim [--hysteresis=<fraction>] [--noise=<milliseconds>] [--verbose]
+
+#include <host/ffxm_fsr2.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+
+using namespace arm;
+
+namespace
+{
+
+const FfxmDimensions2D s_MaxRenderSize = { 1280, 720 };
+const float s_TargetFrameTime = 16.6f;
+const uint32_t s_SizeStep = 8;
+
+// GPU time model, in milliseconds
+const float s_FixedCost = 2.0f;
+
+const uint32_t s_SegmentFrames = 200;
+const uint32_t s_SettleFrames = 60;
+// Margin around the hysteresis band for the frame time at a settled size, relative to the budget, covering the noise
+// and the frame time difference between two neighbouring sizes
+const float s_ConvergenceMargin = 0.05f;
+
+const uint32_t s_Latencies[] = { 0, 3 };
+
+const uint32_t s_MaxSegmentCount = 3;
+
+// The load of each segment is the GPU time at the largest render size, minus the fixed cost
+const struct DrsTrace {
+    const char* name;
+    uint32_t    segmentCount;
+    float       loads[s_MaxSegmentCount];
+} s_Traces[] = {
+    { "step_up",    3, { 10.0f, 30.0f, 10.0f } },
+    { "step_down",  3, { 30.0f, 14.0f, 24.0f } },
+    { "small_step", 3, { 17.0f, 19.0f, 16.0f } },
+    { "saturate",   3, { 10.0f, 80.0f, 20.0f } },
+};
+
+struct DrsOptions {
+    float hysteresis = 0.08f;
+    float noise = 0.5f;
+    bool  verbose = false;
+};
+
+struct DrsResult {
+    uint32_t settleFrames = 0;
+    uint32_t settledChanges = 0;
+    uint32_t settledReversals = 0;
+    bool     converged = true;
+    bool     oscillated = false;
+    bool     quantized = true;
+    bool     reset = true;
+};
+
+void checkResult(FfxmErrorCode errorCode, const char* function)
+{
+    if (errorCode != FFXM_OK) {
+        fprintf(stderr, "%s failed (0x%x)\n", function, unsigned(errorCode));
+        exit(EXIT_FAILURE);
+    }
+}
+
+float getAreaFraction(FfxmDimensions2D size)
+{
+    return float(size.width) * float(size.height) / (float(s_MaxRenderSize.width) * float(s_MaxRenderSize.height));
+}
+
+// Noise free GPU time of a frame
+float getFrameTime(FfxmDimensions2D size, float load)
+{
+    return s_FixedCost + load * getAreaFraction(size);
+}
+
+// Uniform noise in [-noise, noise], the same sequence for every run
+float getNoise(float noise, uint32_t& seed)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (float((seed >> 16) & 0x7fff) / float(0x7fff) * 2.0f - 1.0f) * noise;
+}
+
+bool isQuantized(uint32_t size, uint32_t minSize, uint32_t maxSize)
+{
+    return minSize <= size && size <= maxSize && (size % s_SizeStep == 0 || size == minSize || size == maxSize);
+}
+
+bool isConverged(const DrsOptions& options, FfxmDimensions2D size, FfxmDimensions2D minSize, float load)
+{
+    const float frameTime = getFrameTime(size, load);
+    if (size.width == s_MaxRenderSize.width && size.height == s_MaxRenderSize.height && frameTime <= s_TargetFrameTime)
+        return true;
+    if (size.width == minSize.width && size.height == minSize.height && frameTime >= s_TargetFrameTime)
+        return true;
+    return frameTime >= s_TargetFrameTime * (1.0f - options.hysteresis - s_ConvergenceMargin)
+        && frameTime <= s_TargetFrameTime * (1.0f + s_ConvergenceMargin);
+}
+
+DrsResult runTrace(const DrsOptions& options, const DrsTrace& trace, uint32_t latencyFrames)
+{
+    FfxmFsr2DrsControllerDescription description = {};
+    description.maxRenderSize = s_MaxRenderSize;
+    description.targetFrameTime = s_TargetFrameTime;
+    description.hysteresis = options.hysteresis;
+    description.sizeStep = s_SizeStep;
+    description.latencyFrames = latencyFrames;
+
+    FfxmFsr2DrsController controller;
+    checkResult(ffxmFsr2DrsControllerCreate(&controller, &description), "ffxmFsr2DrsControllerCreate");
+
+    // the default smallest size
+    const FfxmDimensions2D minSize = { s_MaxRenderSize.width / 2, s_MaxRenderSize.height / 2 };
+
+    DrsResult result;
+    FfxmDimensions2D renderSize = s_MaxRenderSize;
+    std::deque<float> inFlightFrameTimes;
+    uint32_t seed = 1;
+
+    for (uint32_t segment = 0; segment < trace.segmentCount; ++segment) {
+        const float load = trace.loads[segment];
+        uint32_t lastUnconvergedFrame = 0;
+        int settledDirection = 0;
+
+        for (uint32_t frame = 0; frame < s_SegmentFrames; ++frame) {
+            // the timing of a frame is only available latencyFrames frames later
+            inFlightFrameTimes.push_back(getFrameTime(renderSize, load) + getNoise(options.noise, seed));
+            if (inFlightFrameTimes.size() <= latencyFrames)
+                continue;
+            const float gpuFrameTime = inFlightFrameTimes.front();
+            inFlightFrameTimes.pop_front();
+
+            const FfxmDimensions2D previousSize = renderSize;
+            checkResult(ffxmFsr2DrsControllerUpdate(&controller, gpuFrameTime, &renderSize), "ffxmFsr2DrsControllerUpdate");
+
+            if (!isQuantized(renderSize.width, minSize.width, s_MaxRenderSize.width)
+                || !isQuantized(renderSize.height, minSize.height, s_MaxRenderSize.height))
+                result.quantized = false;
+
+            if (!isConverged(options, renderSize, minSize, load))
+                lastUnconvergedFrame = frame + 1;
+
+            const float areaChange = getAreaFraction(renderSize) - getAreaFraction(previousSize);
+            if (frame >= s_SettleFrames && areaChange != 0.0f) {
+                const int direction = areaChange > 0.0f ? 1 : -1;
+                ++result.settledChanges;
+                if (settledDirection && direction != settledDirection)
+                    ++result.settledReversals;
+                settledDirection = direction;
+            }
+
+            if (options.verbose)
+                printf("%s latency %u segment %u frame %3u time %6.2f size %4ux%-4u\n", trace.name, latencyFrames, segment, frame,
+                    gpuFrameTime, renderSize.width, renderSize.height);
+        }
+
+        result.settleFrames = std::max(result.settleFrames, lastUnconvergedFrame);
+    }
+
+    result.converged = result.settleFrames <= s_SettleFrames;
+    result.oscillated = result.settledReversals > 0;
+
+    // a reset goes back to the largest size, without waiting for the frames in flight
+    checkResult(ffxmFsr2DrsControllerReset(&controller), "ffxmFsr2DrsControllerReset");
+    checkResult(ffxmFsr2DrsControllerUpdate(&controller, s_TargetFrameTime, &renderSize), "ffxmFsr2DrsControllerUpdate");
+    result.reset = renderSize.width == s_MaxRenderSize.width && renderSize.height == s_MaxRenderSize.height;
+
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    DrsOptions options;
+    for (int i = 1; i < argc; ++i) {
+        if (!strncmp(argv[i], "--hysteresis=", 13) && atof(argv[i] + 13) > 0.0) {
+            options.hysteresis = float(atof(argv[i] + 13));
+        } else if (!strncmp(argv[i], "--noise=", 8) && atof(argv[i] + 8) >= 0.0) {
+            options.noise = float(atof(argv[i] + 8));
+        } else if (!strcmp(argv[i], "--verbose")) {
+            options.verbose = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--hysteresis=<fraction>] [--noise=<milliseconds>] [--verbose]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("%-12s %8s %8s %8s %10s %10s %10s %10s %8s\n", "Trace", "Latency", "Settle", "Changes", "Reversals", "Converged", "Oscillated",
+        "Quantized", "Reset");
+    printf("%s\n", std::string(94, '-').c_str());
+
+    bool succeeded = true;
+    for (const DrsTrace& trace : s_Traces) {
+        for (uint32_t latencyFrames : s_Latencies) {
+            const DrsResult result = runTrace(options, trace, latencyFrames);
+            printf("%-12s %8u %8u %8u %10u %10s %10s %10s %8s\n", trace.name, latencyFrames, result.settleFrames, result.settledChanges,
+                result.settledReversals, result.converged ? "yes" : "NO", result.oscillated ? "YES" : "no", result.quantized ? "yes" : "NO", result.reset ? "yes" : "NO");
+            succeeded = succeeded && result.converged && !result.oscillated && result.quantized && result.reset;
+        }
+    }
+
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
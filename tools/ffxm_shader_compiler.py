@@ -0,0 +1,461 @@
+#!/usr/bin/env python3
+# Copyright  © 2024-2025 Arm Limited.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Portable replacement of FidelityFX_SC.exe for the SPIR-V permutations of the Vulkan backend.
+#
+# Takes the same command line as FidelityFX_SC: the -D<name>={<value>,...} arguments are expanded into every
+# permutation, each one is compiled to SPIR-V with DXC (HLSL) or glslangValidator (GLSL) on a pool of worker
+# threads, identical binaries are merged and the permutation headers are written in the same format, with the
+# reflection data read from the SPIR-V modules. The arguments the tool does not know are given to the compiler.
+#
+# Tool arguments:
+#   -name=<name>           prefix of the generated headers and symbols
+#   -output=<path>         directory of the generated headers
+#   -compiler=<dxc|glslang>
+#   -deps=gcc              write a make style depfile <output>/<name>_permutations.h.d for the build
+#   -num-threads=<count>   number of permutations compiled concurrently, all the cores by default
+#   -reflection            accepted for compatibility, the reflection data is always written
+#
+# The compilers are looked up in PATH, or set with the FFXM_DXC and FFXM_GLSLANG environment variables.
+
+import sys
+import os
+import re
+import hashlib
+import itertools
+import shutil
+import struct
+import subprocess
+import tempfile
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+SPIRV_MAGIC = 0x07230203
+
+# SPIR-V opcodes, decorations and storage classes used by the reflection
+OP_NAME = 5
+OP_ENTRY_POINT = 15
+OP_TYPE_IMAGE = 25
+OP_TYPE_SAMPLER = 26
+OP_TYPE_SAMPLED_IMAGE = 27
+OP_TYPE_ARRAY = 28
+OP_TYPE_RUNTIME_ARRAY = 29
+OP_TYPE_STRUCT = 30
+OP_TYPE_POINTER = 32
+OP_CONSTANT = 43
+OP_VARIABLE = 59
+OP_DECORATE = 71
+OP_MEMBER_DECORATE = 72
+OP_TYPE_ACCELERATION_STRUCTURE = 5341
+
+DECORATION_BLOCK = 2
+DECORATION_BUFFER_BLOCK = 3
+DECORATION_BUILTIN = 11
+DECORATION_NON_WRITABLE = 24
+DECORATION_LOCATION = 30
+DECORATION_BINDING = 33
+DECORATION_DESCRIPTOR_SET = 34
+
+STORAGE_UNIFORM_CONSTANT = 0
+STORAGE_OUTPUT = 3
+STORAGE_UNIFORM = 2
+STORAGE_STORAGE_BUFFER = 12
+
+DIM_BUFFER = 5
+
+# Resource kinds in the order of the generated headers: symbol suffix, then member prefix and count name of
+# the PermutationInfo structure
+RESOURCE_KINDS = [
+	("CBV", "constantBuffer", "numConstantBuffers"),
+	("TextureSRV", "srvTexture", "numSRVTextures"),
+	("TextureUAV", "uavTexture", "numUAVTextures"),
+	("BufferSRV", "srvBuffer", "numSRVBuffers"),
+	("BufferUAV", "uavBuffer", "numUAVBuffers"),
+	("Sampler", "sampler", "numSamplers"),
+	("RTAccelerationStructure", "rtAccelerationStructure", "numRTAccelerationStructures"),
+	("TextureRT", "rtTexture", "numRTTextures"),
+]
+
+# DXC names the fragment outputs after their semantic, so the render targets of the HLSL passes are named from
+# their location, as done by the extended FidelityFX_SC (see ffx_shader_compiler.diff). The names of the
+# accumulate pass depend on the quality preset of the permutation.
+ACCUMULATE_RT_NAMES = ["rw_internal_upscaled_color", "rw_lock_status", "rw_luma_history", "rw_upscaled_output"]
+ACCUMULATE_BALANCED_PERFORMANCE_RT_NAMES = ["rw_internal_upscaled_color", "rw_internal_temporal_reactive", "rw_lock_status", "rw_upscaled_output"]
+
+def get_hlsl_render_target_names(shader_name, defines):
+	def is_set(define):
+		return defines.get(define, "0") == "1"
+
+	if "accumulate" in shader_name:
+		if is_set("FFXM_FSR2_OPTION_SHADER_OPT_BALANCED") or is_set("FFXM_FSR2_OPTION_SHADER_OPT_PERFORMANCE"):
+			return ACCUMULATE_BALANCED_PERFORMANCE_RT_NAMES
+		return ACCUMULATE_RT_NAMES
+	if "depth_clip" in shader_name:
+		return ["rw_dilated_reactive_masks", "rw_prepared_input_color"]
+	if "reconstruct" in shader_name:
+		if is_set("FFXM_FSR2_OPTION_SHADER_OPT_ULTRA_PERFORMANCE"):
+			return ["rw_dilated_depth_motion_vectors_input_luma"]
+		return ["rw_dilatedDepth", "rw_dilated_motion_vectors", "rw_lock_input_luma"]
+	if "rcas" in shader_name:
+		return ["rw_upscaled_output"]
+	if "reactive" in shader_name:
+		return ["rw_output_autoreactive"]
+	return None
+
+class ShaderCompilerError(Exception):
+	pass
+
+def decode_string(words):
+	data = struct.pack("<%dI" % len(words), *words)
+	return data[:data.index(b"\0")].decode("utf-8")
+
+def reflect_spirv(code, is_hlsl, shader_name, defines):
+	"""Returns the resources of each kind of RESOURCE_KINDS as (name, binding, count, set) tuples."""
+	if len(code) % 4 or len(code) < 20:
+		raise ShaderCompilerError("invalid SPIR-V module size")
+	words = struct.unpack("<%dI" % (len(code) // 4), code)
+	if words[0] != SPIRV_MAGIC:
+		raise ShaderCompilerError("invalid SPIR-V magic number")
+
+	names = {}
+	decorations = {}
+	member_non_writable = {}
+	types = {}
+	constants = {}
+	variables = []
+
+	index = 5
+	while index < len(words):
+		opcode = words[index] & 0xffff
+		word_count = words[index] >> 16
+		if word_count == 0 or index + word_count > len(words):
+			raise ShaderCompilerError("truncated SPIR-V instruction")
+		operands = words[index + 1:index + word_count]
+		index += word_count
+
+		if opcode == OP_NAME:
+			names[operands[0]] = decode_string(operands[1:])
+		elif opcode == OP_DECORATE:
+			decorations.setdefault(operands[0], {})[operands[1]] = operands[2] if len(operands) > 2 else True
+		elif opcode == OP_MEMBER_DECORATE and operands[2] == DECORATION_NON_WRITABLE:
+			member_non_writable.setdefault(operands[0], set()).add(operands[1])
+		elif opcode in (OP_TYPE_IMAGE, OP_TYPE_SAMPLER, OP_TYPE_SAMPLED_IMAGE, OP_TYPE_ARRAY, OP_TYPE_RUNTIME_ARRAY,
+						OP_TYPE_STRUCT, OP_TYPE_POINTER, OP_TYPE_ACCELERATION_STRUCTURE):
+			types[operands[0]] = (opcode, operands[1:])
+		elif opcode == OP_CONSTANT:
+			constants[operands[1]] = operands[2]
+		elif opcode == OP_VARIABLE:
+			variables.append((operands[1], operands[0], operands[2]))
+
+	def get_descriptor_kind(variable, type_id, storage_class):
+		# unwrap the arrays of descriptors
+		count = 1
+		opcode, operands = types[type_id]
+		if opcode == OP_TYPE_ARRAY:
+			count = constants[operands[1]]
+			opcode, operands = types[operands[0]]
+		elif opcode == OP_TYPE_RUNTIME_ARRAY:
+			count = 0
+			opcode, operands = types[operands[0]]
+
+		if opcode == OP_TYPE_SAMPLER:
+			return "Sampler", count
+		if opcode == OP_TYPE_IMAGE and operands[1] != DIM_BUFFER:
+			if operands[5] == 1:
+				return "TextureSRV", count
+			if operands[5] == 2:
+				return "TextureUAV", count
+		if opcode == OP_TYPE_ACCELERATION_STRUCTURE:
+			return "RTAccelerationStructure", count
+		if opcode == OP_TYPE_STRUCT:
+			struct_decorations = decorations.get(type_id, {})
+			if storage_class == STORAGE_UNIFORM and DECORATION_BLOCK in struct_decorations:
+				return "CBV", count
+			if storage_class == STORAGE_STORAGE_BUFFER or DECORATION_BUFFER_BLOCK in struct_decorations:
+				non_writable = DECORATION_NON_WRITABLE in decorations.get(variable, {}) or \
+					len(member_non_writable.get(type_id, ())) == len(operands)
+				return ("BufferSRV" if non_writable else "BufferUAV"), count
+		raise ShaderCompilerError("shader uses an unsupported resource type: %s" % names.get(variable, variable))
+
+	bindings = []
+	outputs = []
+	for variable, pointer_type, storage_class in variables:
+		variable_decorations = decorations.get(variable, {})
+		pointee_type = types[pointer_type][1][1]
+		if storage_class in (STORAGE_UNIFORM_CONSTANT, STORAGE_UNIFORM, STORAGE_STORAGE_BUFFER) and DECORATION_BINDING in variable_decorations:
+			kind, count = get_descriptor_kind(variable, pointee_type, storage_class)
+			bindings.append((variable_decorations.get(DECORATION_DESCRIPTOR_SET, 0), variable_decorations[DECORATION_BINDING], kind, names.get(variable, ""), count))
+		elif storage_class == STORAGE_OUTPUT and DECORATION_LOCATION in variable_decorations and DECORATION_BUILTIN not in variable_decorations:
+			outputs.append((variable_decorations[DECORATION_LOCATION], names.get(variable, "")))
+
+	resources = {kind: [] for kind, _, _ in RESOURCE_KINDS}
+	for descriptor_set, binding, kind, name, count in sorted(bindings, key=lambda b: (b[0], b[1])):
+		resources[kind].append((name, binding, count, descriptor_set))
+
+	outputs.sort()
+	if is_hlsl:
+		render_target_names = get_hlsl_render_target_names(shader_name, defines)
+		if render_target_names is not None:
+			for location, _ in outputs:
+				name = render_target_names[location] if location < len(render_target_names) else ""
+				resources["TextureRT"].append((name, location, 0, 0))
+	else:
+		# GLSL outputs keep their names, only the ones at consecutive locations are render targets
+		for expected_location, (location, name) in enumerate(outputs):
+			if location != expected_location:
+				break
+			resources["TextureRT"].append((name, location, 0, 0))
+
+	return resources
+
+def write_if_changed(path, contents):
+	# keep the timestamps of the headers that do not change, so the backend is not rebuilt for nothing
+	path = Path(path)
+	if path.exists() and path.read_text() == contents:
+		return
+	path.write_text(contents)
+
+def get_blob_header(blob_name, code, resources):
+	lines = [f"// {blob_name}.h.", "// Auto generated by FidelityFX-SC.", ""]
+	for kind, _, _ in RESOURCE_KINDS:
+		kind_resources = resources[kind]
+		if not kind_resources:
+			continue
+		for field, column in (("Names", 0), ("Bindings", 1), ("Counts", 2), ("Spaces", 3)):
+			element_type = "const char*" if column == 0 else "const uint32_t"
+			values = "".join((f'"{r[column]}", ' if column == 0 else f"{r[column]}, ") for r in kind_resources)
+			lines.append(f"static {element_type} g_{blob_name}_{kind}Resource{field}[] = {{  {values}}};")
+		lines.append("")
+
+	lines.append(f"static const uint32_t g_{blob_name}_size = {len(code)};")
+	lines.append("")
+	lines.append(f"static const unsigned char g_{blob_name}_data[] = {{")
+	rows = [",".join("0x%02x" % b for b in code[offset:offset + 16]) for offset in range(0, len(code), 16)]
+	lines.append(",\n".join(rows))
+	lines.append("};")
+	lines.append("")
+	return "\n".join(lines) + "\n"
+
+def get_permutations_header(name, permutation_defines, blob_names, blob_resources, indirection_table):
+	lines = [f'#include "{blob_name}.h"' for blob_name in blob_names]
+	lines.append("")
+
+	lines.append(f"typedef union {name}_PermutationKey {{")
+	lines.append("    struct {")
+	for define, values in permutation_defines:
+		lines.append(f"        uint32_t {define} : {max(1, (len(values) - 1).bit_length())};")
+	lines.append("    };")
+	lines.append("    uint32_t index;")
+	lines.append(f"}} {name}_PermutationKey;")
+	lines.append("")
+
+	lines.append(f"typedef struct {name}_PermutationInfo {{")
+	lines.append("    const uint32_t       blobSize;")
+	lines.append("    const unsigned char* blobData;")
+	lines.append("")
+	for _, member, count_name in RESOURCE_KINDS:
+		lines.append("")
+		lines.append(f"    const uint32_t  {count_name};")
+		lines.append(f"    const char**    {member}Names;")
+		lines.append(f"    const uint32_t* {member}Bindings;")
+		lines.append(f"    const uint32_t* {member}Counts;")
+		lines.append(f"    const uint32_t* {member}Spaces;")
+	lines.append(f"}} {name}_PermutationInfo;")
+	lines.append("")
+
+	lines.append(f"static const uint32_t g_{name}_IndirectionTable[] = {{")
+	lines.extend(f"    {blob_index}," for blob_index in indirection_table)
+	lines.append("};")
+	lines.append("")
+
+	lines.append(f"static const {name}_PermutationInfo g_{name}_PermutationInfo[] = {{")
+	for blob_name, resources in zip(blob_names, blob_resources):
+		entry = f"    {{ g_{blob_name}_size, g_{blob_name}_data, "
+		for kind, _, _ in RESOURCE_KINDS:
+			if resources[kind]:
+				prefix = f"g_{blob_name}_{kind}Resource"
+				entry += f"{len(resources[kind])}, {prefix}Names, {prefix}Bindings, {prefix}Counts, {prefix}Spaces, "
+			else:
+				entry += "0, 0, 0, 0, 0, "
+		lines.append(entry + "},")
+	lines.append("};")
+	lines.append("")
+	return "\n".join(lines) + "\n"
+
+def get_dependencies(source, include_dirs):
+	include_pattern = re.compile(r'^\s*#\s*include\s*[<"]([^>"]+)[>"]', re.MULTILINE)
+	dependencies = []
+	pending = [Path(source).resolve()]
+	while pending:
+		path = pending.pop()
+		if path in dependencies:
+			continue
+		dependencies.append(path)
+		for include in include_pattern.findall(path.read_text(errors="replace")):
+			for directory in [path.parent] + include_dirs:
+				candidate = (directory / include).resolve()
+				if candidate.is_file():
+					pending.append(candidate)
+					break
+	return dependencies
+
+def write_depfile(path, target, dependencies):
+	def escape(p):
+		return str(p).replace("\\", "/").replace(" ", "\\ ")
+	contents = escape(target) + ":"
+	for dependency in dependencies:
+		contents += " \\\n  " + escape(dependency)
+	write_if_changed(path, contents + "\n")
+
+def parse_arguments(argv):
+	options = {"name": None, "output": None, "compiler": "dxc", "deps": None, "threads": os.cpu_count() or 1}
+	permutation_defines = []
+	include_dirs = []
+	compiler_args = []
+
+	if not argv:
+		raise ShaderCompilerError("no input file")
+	source = argv[-1]
+
+	arguments = iter(argv[:-1])
+	for argument in arguments:
+		if argument.startswith("-name="):
+			options["name"] = argument[len("-name="):]
+		elif argument.startswith("-output="):
+			options["output"] = argument[len("-output="):]
+		elif argument.startswith("-compiler="):
+			options["compiler"] = argument[len("-compiler="):]
+		elif argument.startswith("-deps="):
+			options["deps"] = argument[len("-deps="):]
+		elif argument.startswith("-num-threads="):
+			options["threads"] = max(1, int(argument[len("-num-threads="):]))
+		elif argument == "-reflection":
+			pass
+		elif re.fullmatch(r"-D\w+=.*", argument):
+			define, value = argument[2:].split("=", 1)
+			if value.startswith("{") and value.endswith("}"):
+				values = [v.strip() for v in value[1:-1].split(",")]
+			else:
+				values = [value]
+			# a shell may have expanded -DNAME={0,1} into -DNAME=0 -DNAME=1
+			for existing_define, existing_values in permutation_defines:
+				if existing_define == define:
+					existing_values.extend(v for v in values if v not in existing_values)
+					break
+			else:
+				permutation_defines.append((define, values))
+		elif argument.startswith("-I"):
+			# CMake passes "-I <dir>" as a single argument for DXC
+			directory = argument[2:].strip() or next(arguments)
+			include_dirs.append(Path(directory).resolve())
+		else:
+			compiler_args.append(argument)
+
+	# the defines with a single value are given to the compiler as they are
+	compiler_args += [f"-D{define}={values[0]}" for define, values in permutation_defines if len(values) == 1]
+	permutation_defines = [(define, values) for define, values in permutation_defines if len(values) > 1]
+
+	# glslangValidator only accepts the -I<dir> form
+	for directory in include_dirs:
+		compiler_args += ["-I", str(directory)] if options["compiler"] == "dxc" else [f"-I{directory}"]
+
+	if not options["name"] or not options["output"]:
+		raise ShaderCompilerError("-name and -output are required")
+	if options["compiler"] not in ("dxc", "glslang"):
+		raise ShaderCompilerError("unknown compiler " + options["compiler"])
+	return source, options, permutation_defines, include_dirs, compiler_args
+
+def find_compiler(compiler):
+	variable, executable = ("FFXM_DXC", "dxc") if compiler == "dxc" else ("FFXM_GLSLANG", "glslangValidator")
+	path = os.environ.get(variable) or shutil.which(executable)
+	if not path:
+		raise ShaderCompilerError(f"{executable} not found, add it to PATH or set {variable}")
+	return path
+
+def compile_permutation(executable, compiler, compiler_args, defines, source, output_dir):
+	define_args = [f"-D{define}={value}" for define, value in defines.items()]
+	with tempfile.TemporaryDirectory(dir=output_dir) as temp_dir:
+		spirv_path = os.path.join(temp_dir, "permutation.spv")
+		if compiler == "dxc":
+			command = [executable] + compiler_args + define_args + ["-Fo", spirv_path, source]
+		else:
+			command = [executable, "-V"] + compiler_args + define_args + ["-o", spirv_path, source]
+		result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+		if result.returncode != 0:
+			raise ShaderCompilerError("failed to compile %s with %s\n%s" % (source, " ".join(define_args), result.stdout))
+		return Path(spirv_path).read_bytes()
+
+def main(argv):
+	source, options, permutation_defines, include_dirs, compiler_args = parse_arguments(argv)
+	name = options["name"]
+	output_dir = Path(options["output"])
+	output_dir.mkdir(parents=True, exist_ok=True)
+	executable = find_compiler(options["compiler"])
+
+	# the first define is in the lowest bits of the permutation key
+	field_widths = [max(1, (len(values) - 1).bit_length()) for _, values in permutation_defines]
+	permutations = []
+	for value_indices in itertools.product(*[range(len(values)) for _, values in reversed(permutation_defines)]):
+		value_indices = list(reversed(value_indices))
+		key = 0
+		shift = 0
+		for value_index, width in zip(value_indices, field_widths):
+			key |= value_index << shift
+			shift += width
+		defines = {define: values[i] for (define, values), i in zip(permutation_defines, value_indices)}
+		permutations.append((key, defines))
+	permutations.sort(key=lambda p: p[0])
+
+	with ThreadPoolExecutor(max_workers=options["threads"]) as executor:
+		binaries = list(executor.map(
+			lambda p: compile_permutation(executable, options["compiler"], compiler_args, p[1], source, output_dir), permutations))
+
+	# merge the identical binaries, in the order of their first permutation key
+	blob_names = []
+	blob_resources = []
+	blob_indices = {}
+	indirection_table = [0] * (1 << sum(field_widths))
+	for (key, defines), code in zip(permutations, binaries):
+		digest = hashlib.md5(code).hexdigest()
+		if digest not in blob_indices:
+			blob_name = f"{name}_{digest}"
+			resources = reflect_spirv(code, options["compiler"] == "dxc", name, defines)
+			write_if_changed(output_dir / f"{blob_name}.h", get_blob_header(blob_name, code, resources))
+			blob_indices[digest] = len(blob_names)
+			blob_names.append(blob_name)
+			blob_resources.append(resources)
+		indirection_table[key] = blob_indices[digest]
+
+	# the permutations header is the output of the build rule, so it is always written to be newer than the sources
+	permutations_header = output_dir / f"{name}_permutations.h"
+	permutations_header.write_text(get_permutations_header(name, permutation_defines, blob_names, blob_resources, indirection_table))
+	if options["deps"] == "gcc":
+		write_depfile(output_dir / f"{name}_permutations.h.d", permutations_header, get_dependencies(source, include_dirs))
+
+	print(f"{name}: {len(permutations)} permutations, {len(blob_names)} unique")
+	return 0
+
+if __name__ == "__main__":
+	try:
+		sys.exit(main(sys.argv[1:]))
+	except ShaderCompilerError as error:
+		print(f"ffxm_shader_compiler: error: {error}", file=sys.stderr)
+		sys.exit(1)
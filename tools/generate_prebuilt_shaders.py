@@ -23,7 +23,11 @@ def compile_shaders(executable, base_args, hlsl_base_args, permutation_args, inc
 def main():
 	script_folder = str(Path(os.path.abspath(os.path.dirname(__file__))))
 
-	ffxm_sc_executable = script_folder+"/bin/FidelityFX_SC.exe"
+	if sys.platform == "win32":
+		ffxm_sc_executable = script_folder+"/bin/FidelityFX_SC.exe"
+	else:
+		# FidelityFX_SC.exe only runs on Windows, the portable driver compiles with DXC found in PATH
+		ffxm_sc_executable = sys.executable+" "+script_folder+"/ffxm_shader_compiler.py"
 
 	fsr2_base_args = "-reflection -deps=gcc -DFFXM_GPU=1"
 
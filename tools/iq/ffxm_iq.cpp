@@ -0,0 +1,621 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Image quality and throughput harness of the Arm ASR API. Synthetic scenes are shaded analytically, once per render
+// pixel with the camera jitter for the inputs, and with 4x4 samples per display pixel for the ground truth. Every
+// frame is upscaled with each shader quality mode on the CPU backend, the output is compared against the ground
+// truth and the dispatch is timed. Comparing two builds, or two quality modes, shows what a shader optimisation
+// costs in quality and what it saves in time.
+//
+// Metrics, averaged over the frames of a scene:
+//   PSNR   peak signal to noise ratio of the RGB channels, in dB, higher is better.
+//   SSIM   structural similarity of the luma over 8x8 windows, 1 is a perfect match.
+//   HyAB   colour error in the spirit of FLIP: HyAB distance in CIELAB after a 3x3 low-pass filter standing in
+//          for the contrast sensitivity filter, lower is better. It has no feature detection, so it is not FLIP.
+//
+// --capture=<prefix> writes the dispatches of each scene and quality mode to <prefix>_<scene>_<mode>.cap, to be
+// replayed by Arm_ASR_replay_vk against the shaders. Reading the textures back is then part of the timed dispatches.
+//
+// --min-psnr=<dB> makes the tool fail when the mean PSNR of a scene and quality mode is below the floor, which is
+// how the reduced run registered with ctest catches a broken mode. A black output scores below 7 dB on every scene.
+//
+// Usage: Arm_ASR_iq [--filter=<substring>] [--frames=<count>] [--display=<width>x<height>] [--ratio=1.5|1.7|2]
+//                   [--threads=<count>] [--csv=<path>] [--capture=<prefix>] [--min-psnr=<dB>]
+
+#include <host/ffxm_fsr2.h>
+#include <host/backends/cpu/ffxm_cpu.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace arm;
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+const float s_CameraNear = 0.1f;
+const float s_CameraFar = 1000.0f;
+
+struct IqOptions {
+    const char*                 filter = nullptr;
+    const char*                 csvPath = nullptr;
+    const char*                 capturePrefix = nullptr;
+    uint32_t                    frameCount = 48;
+    FfxmDimensions2D            displaySize = { 640, 360 };
+    FfxmFsr2UpscalingRatio      upscalingRatio = FFXM_FSR2_UPSCALING_RATIO_X2;
+    uint32_t                    threadCount = 0;
+    double                      minPsnr = 0.0;
+};
+
+// Scene space spans [0, aspect] x [0, 1], y down, one display pixel is pixelSize wide
+struct SceneView {
+    float                       aspect;
+    float                       pixelSize;
+};
+
+// What a scene returns for one point of the screen
+struct SceneSample {
+    float                       color[3];
+    float                       viewDepth;
+    float                       velocity[2];        // Scene space motion of the surface since the previous frame
+    float                       reactive;
+};
+
+typedef void (*SceneShadeFunc)(const SceneView& view, float x, float y, int32_t frame, SceneSample* sample);
+
+struct Scene {
+    const char*                 name;
+    SceneShadeFunc              shade;
+    int32_t                     cutFrame;           // Frame switching to another shot, with a reset, -1 for none
+};
+
+// Scene building blocks
+
+float fract(float value)
+{
+    return value - floorf(value);
+}
+
+float hash(uint32_t value)
+{
+    value ^= value >> 16;
+    value *= 0x7feb352dU;
+    value ^= value >> 15;
+    value *= 0x846ca68bU;
+    value ^= value >> 16;
+    return float(value & 0xffffff) / float(0x1000000);
+}
+
+float smoothStep(float edge0, float edge1, float value)
+{
+    const float t = std::clamp((value - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+float checker(float x, float y, float cellSize)
+{
+    return float((int32_t(floorf(x / cellSize)) + int32_t(floorf(y / cellSize))) & 1);
+}
+
+void setColor(SceneSample* sample, float r, float g, float b)
+{
+    sample->color[0] = r;
+    sample->color[1] = g;
+    sample->color[2] = b;
+}
+
+void setSurface(SceneSample* sample, float viewDepth, float velocityX, float velocityY)
+{
+    sample->viewDepth = viewDepth;
+    sample->velocity[0] = velocityX;
+    sample->velocity[1] = velocityY;
+}
+
+// A checkerboard scrolling under a square moving along a circle, hard edges in motion
+void shadeMovingEdges(const SceneView& view, float x, float y, int32_t frame, SceneSample* sample)
+{
+    const float scrollX = 0.37f * view.pixelSize, scrollY = 0.21f * view.pixelSize;
+    const float value = checker(x - scrollX * frame, y - scrollY * frame, 7.0f * view.pixelSize);
+    setColor(sample, 0.15f + 0.7f * value, 0.2f + 0.6f * value, 0.25f + 0.5f * value);
+    setSurface(sample, 50.0f, scrollX, scrollY);
+    sample->reactive = 0.0f;
+
+    const auto squareCenter = [&](int32_t f, float* cx, float* cy) {
+        *cx = 0.5f * view.aspect + 0.25f * cosf(0.05f * f);
+        *cy = 0.5f + 0.2f * sinf(0.05f * f);
+    };
+    float cx, cy, previousX, previousY;
+    squareCenter(frame, &cx, &cy);
+    squareCenter(frame - 1, &previousX, &previousY);
+    if (fabsf(x - cx) < 0.125f && fabsf(y - cy) < 0.125f) {
+        setColor(sample, 0.95f, 0.55f, 0.1f);
+        setSurface(sample, 10.0f, cx - previousX, cy - previousY);
+    }
+}
+
+// Wires thinner than a render pixel over a smooth sky, under a slow camera pan
+void shadeThinWires(const SceneView& view, float x, float y, int32_t frame, SceneSample* sample)
+{
+    const float pan = 0.15f * view.pixelSize;
+    const float sceneX = x - pan * frame;
+    setColor(sample, 0.45f + 0.3f * y, 0.6f + 0.25f * y, 0.9f);
+    setSurface(sample, 100.0f, pan, 0.0f);
+    sample->reactive = 0.0f;
+
+    const float halfWidth = 0.3f * view.pixelSize;
+    for (uint32_t wire = 0; wire < 6; ++wire) {
+        const float angle = 0.2f + 0.5f * wire;
+        const float distance = fabsf((sceneX - 0.2f * wire) * sinf(angle) - (y - 0.5f) * cosf(angle));
+        if (distance < halfWidth) {
+            setColor(sample, 0.05f, 0.05f, 0.05f);
+            setSurface(sample, 20.0f, pan, 0.0f);
+        }
+    }
+}
+
+// Fast alpha blended particles over a static background, marked only in the reactive mask
+void shadeParticles(const SceneView& view, float x, float y, int32_t frame, SceneSample* sample)
+{
+    const float dx = x - 0.5f * view.aspect, dy = y - 0.5f;
+    const float ring = 0.5f + 0.5f * cosf(sqrtf(dx * dx + dy * dy) * 180.0f);
+    const float background[3] = { 0.2f + 0.5f * ring, 0.25f + 0.4f * ring, 0.3f };
+    setSurface(sample, 30.0f, 0.0f, 0.0f);
+
+    float alpha = 0.0f;
+    const float radius = 6.0f * view.pixelSize;
+    for (uint32_t particle = 0; particle < 24; ++particle) {
+        const float speedX = (hash(particle * 4 + 2) - 0.5f) * 12.0f * view.pixelSize;
+        const float speedY = (hash(particle * 4 + 3) - 0.5f) * 12.0f * view.pixelSize;
+        const float px = fract(hash(particle * 4 + 0) + speedX * frame / view.aspect) * view.aspect;
+        const float py = fract(hash(particle * 4 + 1) + speedY * frame);
+        const float distance = sqrtf((x - px) * (x - px) + (y - py) * (y - py));
+        alpha = std::max(alpha, 0.9f * (1.0f - smoothStep(0.3f * radius, radius, distance)));
+    }
+
+    for (uint32_t channel = 0; channel < 3; ++channel) {
+        const float particleColor[3] = { 1.0f, 0.8f, 0.3f };
+        sample->color[channel] = background[channel] + (particleColor[channel] - background[channel]) * alpha;
+    }
+    sample->reactive = alpha;
+}
+
+// A pillar swinging in front of a detailed static background, uncovering it
+void shadeDisocclusion(const SceneView& view, float x, float y, int32_t frame, SceneSample* sample)
+{
+    const float value = checker(x, y, 3.0f * view.pixelSize) * (0.5f + 0.5f * sinf(40.0f * x + 25.0f * y));
+    setColor(sample, 0.1f + 0.8f * value, 0.3f + 0.4f * value, 0.2f + 0.6f * (1.0f - value));
+    setSurface(sample, 80.0f, 0.0f, 0.0f);
+    sample->reactive = 0.0f;
+
+    const float pillarX = 0.5f * view.aspect + 0.4f * sinf(0.08f * frame);
+    const float previousPillarX = 0.5f * view.aspect + 0.4f * sinf(0.08f * (frame - 1));
+    if (fabsf(x - pillarX) < 0.1f) {
+        const float stripe = float(int32_t(floorf((y + 0.01f * frame) * 40.0f)) & 1);
+        setColor(sample, 0.6f + 0.3f * stripe, 0.6f, 0.65f);
+        setSurface(sample, 5.0f, pillarX - previousPillarX, 0.0f);
+    }
+}
+
+const int32_t s_CameraCutFrame = 24;
+
+// The moving edges shot, then a cut to the thin wires shot
+void shadeCameraCut(const SceneView& view, float x, float y, int32_t frame, SceneSample* sample)
+{
+    if (frame < s_CameraCutFrame)
+        shadeMovingEdges(view, x, y, frame, sample);
+    else
+        shadeThinWires(view, x, y, frame - s_CameraCutFrame, sample);
+}
+
+const Scene s_Scenes[] = {
+    { "MovingEdges",    shadeMovingEdges,   -1 },
+    { "ThinWires",      shadeThinWires,     -1 },
+    { "Particles",      shadeParticles,     -1 },
+    { "Disocclusion",   shadeDisocclusion,  -1 },
+    { "CameraCut",      shadeCameraCut,     s_CameraCutFrame },
+};
+
+// Rendering the inputs and the ground truth
+
+struct FrameInputs {
+    std::vector<float>          color;              // R32G32B32A32_FLOAT
+    std::vector<float>          depth;              // R32_FLOAT, not inverted
+    std::vector<float>          motionVectors;      // R32G32_FLOAT, from the current to the previous position in UV
+    std::vector<uint8_t>        reactive;           // R8_UNORM
+};
+
+float getDeviceDepth(float viewDepth)
+{
+    return s_CameraFar / (s_CameraFar - s_CameraNear) * (1.0f - s_CameraNear / viewDepth);
+}
+
+// One sample per render pixel, at the pixel center offset by the jitter like a jittered projection matrix does
+void renderInputs(const Scene& scene, const SceneView& view, FfxmDimensions2D renderSize, int32_t frame,
+    float jitterX, float jitterY, FrameInputs* inputs)
+{
+    const size_t pixelCount = size_t(renderSize.width) * renderSize.height;
+    inputs->color.resize(pixelCount * 4);
+    inputs->depth.resize(pixelCount);
+    inputs->motionVectors.resize(pixelCount * 2);
+    inputs->reactive.resize(pixelCount);
+
+    for (uint32_t y = 0; y < renderSize.height; ++y) {
+        for (uint32_t x = 0; x < renderSize.width; ++x) {
+            const float u = (x + 0.5f - jitterX) / renderSize.width;
+            const float v = (y + 0.5f - jitterY) / renderSize.height;
+
+            SceneSample sample;
+            scene.shade(view, u * view.aspect, v, frame, &sample);
+
+            const size_t pixel = size_t(y) * renderSize.width + x;
+            memcpy(&inputs->color[pixel * 4], sample.color, sizeof(sample.color));
+            inputs->color[pixel * 4 + 3] = 1.0f;
+            inputs->depth[pixel] = getDeviceDepth(sample.viewDepth);
+            inputs->motionVectors[pixel * 2 + 0] = -sample.velocity[0] / view.aspect;
+            inputs->motionVectors[pixel * 2 + 1] = -sample.velocity[1];
+            inputs->reactive[pixel] = uint8_t(std::clamp(sample.reactive, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+    }
+}
+
+// Box filtered over 4x4 samples per display pixel, RGB
+void renderGroundTruth(const Scene& scene, const SceneView& view, FfxmDimensions2D displaySize, int32_t frame, std::vector<float>* groundTruth)
+{
+    const uint32_t sampleGrid = 4;
+    groundTruth->assign(size_t(displaySize.width) * displaySize.height * 3, 0.0f);
+
+    for (uint32_t y = 0; y < displaySize.height; ++y) {
+        for (uint32_t x = 0; x < displaySize.width; ++x) {
+            float* pixel = &(*groundTruth)[(size_t(y) * displaySize.width + x) * 3];
+            for (uint32_t sampleIndex = 0; sampleIndex < sampleGrid * sampleGrid; ++sampleIndex) {
+                const float u = (x + (sampleIndex % sampleGrid + 0.5f) / sampleGrid) / displaySize.width;
+                const float v = (y + (sampleIndex / sampleGrid + 0.5f) / sampleGrid) / displaySize.height;
+
+                SceneSample sample;
+                scene.shade(view, u * view.aspect, v, frame, &sample);
+                for (uint32_t channel = 0; channel < 3; ++channel)
+                    pixel[channel] += sample.color[channel] / float(sampleGrid * sampleGrid);
+            }
+        }
+    }
+}
+
+// Metrics, on RGB images in [0, 1]
+
+struct ImageView {
+    const float*                data;
+    uint32_t                    width;
+    uint32_t                    height;
+    uint32_t                    channelCount;
+
+    float channel(uint32_t x, uint32_t y, uint32_t c) const
+    {
+        return std::clamp(data[(size_t(y) * width + x) * channelCount + c], 0.0f, 1.0f);
+    }
+
+    float luma(uint32_t x, uint32_t y) const
+    {
+        return 0.2126f * channel(x, y, 0) + 0.7152f * channel(x, y, 1) + 0.0722f * channel(x, y, 2);
+    }
+};
+
+double computePsnr(const ImageView& test, const ImageView& reference)
+{
+    double squaredSum = 0.0;
+    for (uint32_t y = 0; y < reference.height; ++y)
+        for (uint32_t x = 0; x < reference.width; ++x)
+            for (uint32_t c = 0; c < 3; ++c) {
+                const double difference = test.channel(x, y, c) - reference.channel(x, y, c);
+                squaredSum += difference * difference;
+            }
+
+    const double mse = squaredSum / (double(reference.width) * reference.height * 3);
+    return mse > 0.0 ? 10.0 * log10(1.0 / mse) : 99.0;
+}
+
+double computeSsim(const ImageView& test, const ImageView& reference)
+{
+    const uint32_t windowSize = 8, windowStride = 4;
+    const double c1 = 0.01 * 0.01, c2 = 0.03 * 0.03;
+    const double sampleCount = windowSize * windowSize;
+
+    double ssimSum = 0.0;
+    uint32_t windowCount = 0;
+    for (uint32_t wy = 0; wy + windowSize <= reference.height; wy += windowStride) {
+        for (uint32_t wx = 0; wx + windowSize <= reference.width; wx += windowStride) {
+            double sumA = 0.0, sumB = 0.0, sumAA = 0.0, sumBB = 0.0, sumAB = 0.0;
+            for (uint32_t y = wy; y < wy + windowSize; ++y)
+                for (uint32_t x = wx; x < wx + windowSize; ++x) {
+                    const double a = test.luma(x, y), b = reference.luma(x, y);
+                    sumA += a;
+                    sumB += b;
+                    sumAA += a * a;
+                    sumBB += b * b;
+                    sumAB += a * b;
+                }
+
+            const double meanA = sumA / sampleCount, meanB = sumB / sampleCount;
+            const double varianceA = sumAA / sampleCount - meanA * meanA;
+            const double varianceB = sumBB / sampleCount - meanB * meanB;
+            const double covariance = sumAB / sampleCount - meanA * meanB;
+            ssimSum += ((2.0 * meanA * meanB + c1) * (2.0 * covariance + c2)) /
+                       ((meanA * meanA + meanB * meanB + c1) * (varianceA + varianceB + c2));
+            ++windowCount;
+        }
+    }
+
+    return windowCount ? ssimSum / windowCount : 1.0;
+}
+
+void srgbToLab(const float rgb[3], float lab[3])
+{
+    float linear[3];
+    for (uint32_t c = 0; c < 3; ++c)
+        linear[c] = rgb[c] <= 0.04045f ? rgb[c] / 12.92f : powf((rgb[c] + 0.055f) / 1.055f, 2.4f);
+
+    // D65 white point
+    const float xyz[3] = {
+        (0.4124f * linear[0] + 0.3576f * linear[1] + 0.1805f * linear[2]) / 0.9505f,
+        (0.2126f * linear[0] + 0.7152f * linear[1] + 0.0722f * linear[2]),
+        (0.0193f * linear[0] + 0.1192f * linear[1] + 0.9505f * linear[2]) / 1.0890f,
+    };
+    float f[3];
+    for (uint32_t c = 0; c < 3; ++c)
+        f[c] = xyz[c] > 0.008856f ? cbrtf(xyz[c]) : 7.787f * xyz[c] + 16.0f / 116.0f;
+
+    lab[0] = 116.0f * f[1] - 16.0f;
+    lab[1] = 500.0f * (f[0] - f[1]);
+    lab[2] = 200.0f * (f[1] - f[2]);
+}
+
+void getFilteredLab(const ImageView& image, uint32_t x, uint32_t y, float lab[3])
+{
+    float rgb[3] = {};
+    float weight = 0.0f;
+    for (int32_t dy = -1; dy <= 1; ++dy)
+        for (int32_t dx = -1; dx <= 1; ++dx) {
+            const int32_t sx = int32_t(x) + dx, sy = int32_t(y) + dy;
+            if (sx < 0 || sy < 0 || sx >= int32_t(image.width) || sy >= int32_t(image.height))
+                continue;
+            for (uint32_t c = 0; c < 3; ++c)
+                rgb[c] += image.channel(uint32_t(sx), uint32_t(sy), c);
+            weight += 1.0f;
+        }
+    for (uint32_t c = 0; c < 3; ++c)
+        rgb[c] /= weight;
+    srgbToLab(rgb, lab);
+}
+
+double computeHyab(const ImageView& test, const ImageView& reference)
+{
+    double errorSum = 0.0;
+    for (uint32_t y = 0; y < reference.height; ++y)
+        for (uint32_t x = 0; x < reference.width; ++x) {
+            float labA[3], labB[3];
+            getFilteredLab(test, x, y, labA);
+            getFilteredLab(reference, x, y, labB);
+            errorSum += fabsf(labA[0] - labB[0]) + sqrtf((labA[1] - labB[1]) * (labA[1] - labB[1]) + (labA[2] - labB[2]) * (labA[2] - labB[2]));
+        }
+
+    return errorSum / (double(reference.width) * reference.height);
+}
+
+// Running the scenes
+
+void checkResult(FfxmErrorCode errorCode, const char* function)
+{
+    if (errorCode != FFXM_OK) {
+        fprintf(stderr, "%s failed (0x%x)\n", function, unsigned(errorCode));
+        exit(EXIT_FAILURE);
+    }
+}
+
+const struct {
+    FfxmFsr2ShaderQualityMode   mode;
+    const char*                 name;
+} s_QualityModes[] = {
+    { FFXM_FSR2_SHADER_QUALITY_MODE_QUALITY,            "Quality" },
+    { FFXM_FSR2_SHADER_QUALITY_MODE_BALANCED,           "Balanced" },
+    { FFXM_FSR2_SHADER_QUALITY_MODE_PERFORMANCE,        "Performance" },
+    { FFXM_FSR2_SHADER_QUALITY_MODE_ULTRA_PERFORMANCE,  "UltraPerformance" },
+};
+const uint32_t s_QualityModeCount = sizeof(s_QualityModes) / sizeof(s_QualityModes[0]);
+
+struct QualityModeRun {
+    FfxmFsr2Context             context;
+    std::vector<float>          output;
+    double                      psnrSum = 0.0;
+    double                      ssimSum = 0.0;
+    double                      hyabSum = 0.0;
+    double                      timeSum = 0.0;
+    double                      timeMax = 0.0;
+};
+
+FfxmResource getTexture(void* hostPixels, FfxmSurfaceFormat format, FfxmDimensions2D size, bool output = false)
+{
+    return ffxmGetResourceCPU(hostPixels, { FFXM_RESOURCE_TYPE_TEXTURE2D, format, size.width, size.height, 1, 1, FFXM_RESOURCE_FLAGS_NONE,
+        output ? FFXM_RESOURCE_USAGE_UAV : FFXM_RESOURCE_USAGE_READ_ONLY }, nullptr, output ? FFXM_RESOURCE_STATE_UNORDERED_ACCESS : FFXM_RESOURCE_STATE_COMPUTE_READ);
+}
+
+// Every frame of the scene is rendered once and upscaled with each quality mode, returns false when a mode is below the PSNR floor
+bool runScene(const IqOptions& options, const Scene& scene, FfxmInterface* backendInterface, FILE* csv)
+{
+    const FfxmDimensions2D displaySize = options.displaySize;
+    FfxmDimensions2D renderSize;
+    checkResult(ffxmFsr2GetRenderResolutionFromUpscalingRatio(&renderSize.width, &renderSize.height, displaySize.width, displaySize.height, options.upscalingRatio),
+        "ffxmFsr2GetRenderResolutionFromUpscalingRatio");
+    const SceneView view = { float(displaySize.width) / float(displaySize.height), 1.0f / float(displaySize.height) };
+    const int32_t jitterPhaseCount = ffxmFsr2GetJitterPhaseCount(int32_t(renderSize.width), int32_t(displaySize.width));
+
+    std::vector<QualityModeRun> runs(s_QualityModeCount);
+    for (uint32_t modeIndex = 0; modeIndex < s_QualityModeCount; ++modeIndex) {
+        FfxmFsr2ContextDescription contextDescription = {};
+        contextDescription.qualityMode = s_QualityModes[modeIndex].mode;
+        contextDescription.maxRenderSize = renderSize;
+        contextDescription.displaySize = displaySize;
+        contextDescription.backendInterface = *backendInterface;
+        checkResult(ffxmFsr2ContextCreate(&runs[modeIndex].context, &contextDescription), "ffxmFsr2ContextCreate");
+        runs[modeIndex].output.resize(size_t(displaySize.width) * displaySize.height * 4);
+
+        if (options.capturePrefix) {
+            const std::string capturePath = std::string(options.capturePrefix) + "_" + scene.name + "_" + s_QualityModes[modeIndex].name + ".cap";
+            checkResult(ffxmFsr2ContextBeginCapture(&runs[modeIndex].context, capturePath.c_str()), "ffxmFsr2ContextBeginCapture");
+        }
+    }
+
+    FrameInputs inputs;
+    std::vector<float> groundTruth;
+    for (int32_t frame = 0; frame < int32_t(options.frameCount); ++frame) {
+        FfxmFsr2DispatchDescription dispatchDescription = {};
+        ffxmFsr2GetJitterOffset(&dispatchDescription.jitterOffset.x, &dispatchDescription.jitterOffset.y, frame, jitterPhaseCount);
+        dispatchDescription.jitterIndex = uint32_t(frame);
+        renderInputs(scene, view, renderSize, frame, dispatchDescription.jitterOffset.x, dispatchDescription.jitterOffset.y, &inputs);
+        renderGroundTruth(scene, view, displaySize, frame, &groundTruth);
+
+        dispatchDescription.commandList = ffxmGetCommandListCPU(nullptr);
+        dispatchDescription.color = getTexture(inputs.color.data(), FFXM_SURFACE_FORMAT_R32G32B32A32_FLOAT, renderSize);
+        dispatchDescription.depth = getTexture(inputs.depth.data(), FFXM_SURFACE_FORMAT_R32_FLOAT, renderSize);
+        dispatchDescription.motionVectors = getTexture(inputs.motionVectors.data(), FFXM_SURFACE_FORMAT_R32G32_FLOAT, renderSize);
+        dispatchDescription.reactive = getTexture(inputs.reactive.data(), FFXM_SURFACE_FORMAT_R8_UNORM, renderSize);
+        dispatchDescription.motionVectorScale = { float(renderSize.width), float(renderSize.height) };
+        dispatchDescription.renderSize = renderSize;
+        dispatchDescription.frameTimeDelta = 16.6f;
+        dispatchDescription.preExposure = 1.0f;
+        dispatchDescription.reset = frame == 0 || frame == scene.cutFrame;
+        dispatchDescription.cameraNear = s_CameraNear;
+        dispatchDescription.cameraFar = s_CameraFar;
+        dispatchDescription.cameraFovAngleVertical = 1.0f;
+        dispatchDescription.viewSpaceToMetersFactor = 1.0f;
+
+        const ImageView reference = { groundTruth.data(), displaySize.width, displaySize.height, 3 };
+        for (uint32_t modeIndex = 0; modeIndex < s_QualityModeCount; ++modeIndex) {
+            QualityModeRun& run = runs[modeIndex];
+            dispatchDescription.output = getTexture(run.output.data(), FFXM_SURFACE_FORMAT_R32G32B32A32_FLOAT, displaySize, true);
+
+            // the CPU backend executes the jobs within the dispatch, which is the time of the upscaling itself
+            const Clock::time_point start = Clock::now();
+            checkResult(ffxmFsr2ContextDispatch(&run.context, &dispatchDescription), "ffxmFsr2ContextDispatch");
+            const double time = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            const ImageView test = { run.output.data(), displaySize.width, displaySize.height, 4 };
+            const double psnr = computePsnr(test, reference);
+            const double ssim = computeSsim(test, reference);
+            const double hyab = computeHyab(test, reference);
+            run.psnrSum += psnr;
+            run.ssimSum += ssim;
+            run.hyabSum += hyab;
+            run.timeSum += time;
+            run.timeMax = std::max(run.timeMax, time);
+
+            if (csv)
+                fprintf(csv, "%s,%s,%d,%.4f,%.6f,%.4f,%.4f\n", scene.name, s_QualityModes[modeIndex].name, frame, psnr, ssim, hyab, time);
+        }
+    }
+
+    bool aboveFloor = true;
+    for (uint32_t modeIndex = 0; modeIndex < s_QualityModeCount; ++modeIndex) {
+        QualityModeRun& run = runs[modeIndex];
+        const double frameCount = double(options.frameCount);
+        printf("%-14s %-18s %10.3f %8.5f %8.3f %12.3f %12.3f\n", scene.name, s_QualityModes[modeIndex].name,
+            run.psnrSum / frameCount, run.ssimSum / frameCount, run.hyabSum / frameCount, run.timeSum / frameCount, run.timeMax);
+        if (run.psnrSum / frameCount < options.minPsnr) {
+            fprintf(stderr, "%s %s is below the PSNR floor of %.3f dB\n", scene.name, s_QualityModes[modeIndex].name, options.minPsnr);
+            aboveFloor = false;
+        }
+        if (options.capturePrefix)
+            checkResult(ffxmFsr2ContextEndCapture(&run.context), "ffxmFsr2ContextEndCapture");
+        checkResult(ffxmFsr2ContextDestroy(&run.context), "ffxmFsr2ContextDestroy");
+    }
+    return aboveFloor;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    IqOptions options;
+    for (int i = 1; i < argc; ++i) {
+        unsigned width = 0, height = 0;
+        if (!strncmp(argv[i], "--filter=", 9)) {
+            options.filter = argv[i] + 9;
+        } else if (!strncmp(argv[i], "--frames=", 9) && atoi(argv[i] + 9) > 0) {
+            options.frameCount = uint32_t(atoi(argv[i] + 9));
+        } else if (sscanf(argv[i], "--display=%ux%u", &width, &height) == 2 && width && height) {
+            options.displaySize = { width, height };
+        } else if (!strcmp(argv[i], "--ratio=1.5")) {
+            options.upscalingRatio = FFXM_FSR2_UPSCALING_RATIO_X1_5;
+        } else if (!strcmp(argv[i], "--ratio=1.7")) {
+            options.upscalingRatio = FFXM_FSR2_UPSCALING_RATIO_X1_7;
+        } else if (!strcmp(argv[i], "--ratio=2")) {
+            options.upscalingRatio = FFXM_FSR2_UPSCALING_RATIO_X2;
+        } else if (!strncmp(argv[i], "--threads=", 10)) {
+            options.threadCount = uint32_t(atoi(argv[i] + 10));
+        } else if (!strncmp(argv[i], "--csv=", 6)) {
+            options.csvPath = argv[i] + 6;
+        } else if (!strncmp(argv[i], "--capture=", 10) && argv[i][10]) {
+            options.capturePrefix = argv[i] + 10;
+        } else if (!strncmp(argv[i], "--min-psnr=", 11) && atof(argv[i] + 11) > 0.0) {
+            options.minPsnr = atof(argv[i] + 11);
+        } else {
+            fprintf(stderr, "Usage: %s [--filter=<substring>] [--frames=<count>] [--display=<width>x<height>] [--ratio=1.5|1.7|2] "
+                "[--threads=<count>] [--csv=<path>] [--capture=<prefix>] [--min-psnr=<dB>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // the contexts of the quality modes of a scene share the backend
+    CpuDeviceContext device = { options.threadCount };
+    FfxmInterface backendInterface;
+    std::vector<uint8_t> scratch(ffxmGetScratchMemorySizeCPU(s_QualityModeCount));
+    checkResult(ffxmGetInterfaceCPU(&backendInterface, ffxmGetDeviceCPU(&device), scratch.data(), scratch.size(), s_QualityModeCount), "ffxmGetInterfaceCPU");
+
+    FILE* csv = nullptr;
+    if (options.csvPath) {
+        csv = fopen(options.csvPath, "w");
+        if (!csv) {
+            fprintf(stderr, "Failed to create %s\n", options.csvPath);
+            return EXIT_FAILURE;
+        }
+        fprintf(csv, "scene,mode,frame,psnr,ssim,hyab,time_ms\n");
+    }
+
+    printf("%-14s %-18s %10s %8s %8s %12s %12s\n", "Scene", "Mode", "PSNR (dB)", "SSIM", "HyAB", "Mean (ms)", "Max (ms)");
+    printf("%s\n", std::string(88, '-').c_str());
+
+    bool aboveFloor = true;
+    for (const Scene& scene : s_Scenes) {
+        if (!options.filter || strstr(scene.name, options.filter))
+            aboveFloor = runScene(options, scene, &backendInterface, csv) && aboveFloor;
+    }
+
+    if (csv)
+        fclose(csv);
+
+    return aboveFloor ? EXIT_SUCCESS : EXIT_FAILURE;
+}
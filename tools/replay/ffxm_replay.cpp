@@ -0,0 +1,826 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Replays a capture written by ffxmFsr2ContextBeginCapture. The captured context is created again, each captured
+// dispatch is fed back with its parameters and input textures, and the upscaled output is compared against the
+// one stored in the capture. The tool fails when a frame differs by more than the tolerance, which is 0 by
+// default: the CPU backend is deterministic for a given binary, whatever the thread count.
+//
+// The backend specific code is limited to the ReplayBackend functions, the rest only goes through FfxmInterface.
+// Built with FFXM_REPLAY_VK (Arm_ASR_replay_vk), the capture is replayed through the VK backend instead, on the first
+// Vulkan device: the textures are uploaded before each dispatch and the output is read back once the frame has
+// completed. Since only the CPU backend can write captures, this compares the CPU backend against the GPU shaders,
+// with a tolerance covering the fp16 math of the shaders.
+//
+// Usage: Arm_ASR_replay <capture> [--threads=<count>] [--tolerance=<value>] [--capture=<path>]
+//        Arm_ASR_replay_vk <capture> --tolerance=<value>
+
+#include <host/ffxm_fsr2.h>
+#include <host/ffxm_fsr2_capture.h>
+#if defined(FFXM_REPLAY_VK)
+#include <host/backends/vk/ffxm_vk.h>
+#else
+#include <host/backends/cpu/ffxm_cpu.h>
+#endif // #if defined(FFXM_REPLAY_VK)
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace arm;
+
+namespace
+{
+
+struct ReplayOptions {
+    const char*                 capturePath = nullptr;
+    const char*                 recapturePath = nullptr;
+    uint32_t                    threadCount = 0;
+    double                      tolerance = 0.0;
+};
+
+struct ReplayTexture {
+    FfxmFsr2CaptureTextureChunk description = {};
+    std::vector<uint8_t>        texels;
+};
+
+struct ReplayFrame {
+    FfxmFsr2CaptureFrameChunk   parameters = {};
+    std::vector<FfxmRect2D>     regions;
+    FfxmFsr2CaptureFoveationChunk foveation = {};
+    ReplayTexture               textures[FFXM_FSR2_CAPTURE_TEXTURE_COUNT];
+};
+
+#if defined(FFXM_REPLAY_VK)
+
+// An image of the frame being replayed, with the buffer it is uploaded from or read back to
+struct ReplayImageVK {
+    VkImage                     image = VK_NULL_HANDLE;
+    VkDeviceMemory              imageMemory = VK_NULL_HANDLE;
+    VkBuffer                    buffer = VK_NULL_HANDLE;
+    VkDeviceMemory              bufferMemory = VK_NULL_HANDLE;
+    ReplayTexture*              texture = nullptr;
+};
+
+// The backend the capture is replayed through, one command buffer records the uploads, the dispatch and the read back
+// of a frame
+struct ReplayBackend {
+    VkInstance                  instance = VK_NULL_HANDLE;
+    VkPhysicalDevice            physicalDevice = VK_NULL_HANDLE;
+    VkDevice                    device = VK_NULL_HANDLE;
+    VkQueue                     queue = VK_NULL_HANDLE;
+    VkCommandPool               commandPool = VK_NULL_HANDLE;
+    VkCommandBuffer             commandBuffer = VK_NULL_HANDLE;
+    VkFence                     fence = VK_NULL_HANDLE;
+    VkDeviceContext             deviceContext = {};
+    std::vector<uint8_t>        scratch;
+    std::vector<ReplayImageVK>  frameImages;
+    ReplayImageVK               output;
+};
+
+void checkVkResult(VkResult result, const char* function)
+{
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "%s failed (%d)\n", function, int(result));
+        exit(EXIT_FAILURE);
+    }
+}
+
+// The formats the capture textures can have, see ffxmGetVKSurfaceFormatFromSurfaceFormat in the VK backend
+VkFormat getVkFormat(FfxmSurfaceFormat format)
+{
+    switch (format) {
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_FLOAT:   return VK_FORMAT_R32G32B32A32_SFLOAT;
+    case FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT:   return VK_FORMAT_R16G16B16A16_SFLOAT;
+    case FFXM_SURFACE_FORMAT_R32G32_FLOAT:         return VK_FORMAT_R32G32_SFLOAT;
+    case FFXM_SURFACE_FORMAT_R32_UINT:             return VK_FORMAT_R32_UINT;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM:       return VK_FORMAT_R8G8B8A8_UNORM;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SNORM:       return VK_FORMAT_R8G8B8A8_SNORM;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SRGB:        return VK_FORMAT_R8G8B8A8_SRGB;
+    case FFXM_SURFACE_FORMAT_R11G11B10_FLOAT:      return VK_FORMAT_B10G11R11_UFLOAT_PACK32;
+    case FFXM_SURFACE_FORMAT_R16G16_FLOAT:         return VK_FORMAT_R16G16_SFLOAT;
+    case FFXM_SURFACE_FORMAT_R16G16_UINT:          return VK_FORMAT_R16G16_UINT;
+    case FFXM_SURFACE_FORMAT_R16_FLOAT:            return VK_FORMAT_R16_SFLOAT;
+    case FFXM_SURFACE_FORMAT_R16_UINT:             return VK_FORMAT_R16_UINT;
+    case FFXM_SURFACE_FORMAT_R16_UNORM:            return VK_FORMAT_R16_UNORM;
+    case FFXM_SURFACE_FORMAT_R16_SNORM:            return VK_FORMAT_R16_SNORM;
+    case FFXM_SURFACE_FORMAT_R8_UNORM:             return VK_FORMAT_R8_UNORM;
+    case FFXM_SURFACE_FORMAT_R8_SNORM:             return VK_FORMAT_R8_SNORM;
+    case FFXM_SURFACE_FORMAT_R8_UINT:              return VK_FORMAT_R8_UINT;
+    case FFXM_SURFACE_FORMAT_R8G8_UNORM:           return VK_FORMAT_R8G8_UNORM;
+    case FFXM_SURFACE_FORMAT_R32_FLOAT:            return VK_FORMAT_R32_SFLOAT;
+    default:                                       return VK_FORMAT_UNDEFINED;
+    }
+}
+
+bool hasDeviceExtension(const std::vector<VkExtensionProperties>& extensions, const char* name)
+{
+    for (const VkExtensionProperties& extension : extensions) {
+        if (!strcmp(extension.extensionName, name))
+            return true;
+    }
+    return false;
+}
+
+VkDeviceMemory allocateMemory(ReplayBackend& backend, const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties)
+{
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(backend.physicalDevice, &memoryProperties);
+
+    uint32_t memoryTypeIndex = 0;
+    while (memoryTypeIndex < memoryProperties.memoryTypeCount &&
+           (!(requirements.memoryTypeBits & (1u << memoryTypeIndex)) ||
+            (memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & properties) != properties))
+        ++memoryTypeIndex;
+    if (memoryTypeIndex == memoryProperties.memoryTypeCount) {
+        fprintf(stderr, "No memory type with the properties 0x%x\n", unsigned(properties));
+        exit(EXIT_FAILURE);
+    }
+
+    VkMemoryAllocateInfo allocateInfo = {};
+
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.allocationSize = requirements.size;
+    allocateInfo.memoryTypeIndex = memoryTypeIndex;
+    VkDeviceMemory memory;
+    checkVkResult(vkAllocateMemory(backend.device, &allocateInfo, nullptr, &memory), "vkAllocateMemory");
+    return memory;
+}
+
+// Creates the device with the features the backend looks for when they are supported
+void createDevice(ReplayBackend& backend)
+{
+    checkVkResult(volkInitialize(), "volkInitialize");
+
+    VkApplicationInfo applicationInfo = {};
+
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pApplicationName = "Arm_ASR_replay_vk";
+    applicationInfo.apiVersion = VK_API_VERSION_1_1;
+    VkInstanceCreateInfo instanceCreateInfo = {};
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    checkVkResult(vkCreateInstance(&instanceCreateInfo, nullptr, &backend.instance), "vkCreateInstance");
+    volkLoadInstance(backend.instance);
+
+    uint32_t physicalDeviceCount = 1;
+    const VkResult enumerateResult = vkEnumeratePhysicalDevices(backend.instance, &physicalDeviceCount, &backend.physicalDevice);
+    if ((enumerateResult != VK_SUCCESS && enumerateResult != VK_INCOMPLETE) || !physicalDeviceCount) {
+        fprintf(stderr, "No Vulkan device\n");
+        exit(EXIT_FAILURE);
+    }
+
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(backend.physicalDevice, &deviceProperties);
+    printf("Replaying on %s\n", deviceProperties.deviceName);
+
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(backend.physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(backend.physicalDevice, &queueFamilyCount, queueFamilies.data());
+    const VkQueueFlags queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+    uint32_t queueFamilyIndex = 0;
+    while (queueFamilyIndex < queueFamilyCount && (queueFamilies[queueFamilyIndex].queueFlags & queueFlags) != queueFlags)
+        ++queueFamilyIndex;
+    if (queueFamilyIndex == queueFamilyCount) {
+        fprintf(stderr, "No graphics and compute queue\n");
+        exit(EXIT_FAILURE);
+    }
+
+    uint32_t extensionCount = 0;
+    vkEnumerateDeviceExtensionProperties(backend.physicalDevice, nullptr, &extensionCount, nullptr);
+    std::vector<VkExtensionProperties> extensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(backend.physicalDevice, nullptr, &extensionCount, extensions.data());
+
+    // the backend picks its permutations and descriptor update path from the supported extensions, they are all enabled
+    std::vector<const char*> enabledExtensions;
+    VkPhysicalDevice16BitStorageFeatures storage16BitFeatures = {};
+    storage16BitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES;
+    VkPhysicalDeviceShaderFloat16Int8Features float16Int8Features = {};
+    float16Int8Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES;
+    VkPhysicalDeviceSubgroupSizeControlFeatures subgroupSizeControlFeatures = {};
+    subgroupSizeControlFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES;
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features2.pNext = &storage16BitFeatures;
+    void** nextFeatures = &storage16BitFeatures.pNext;
+    if (hasDeviceExtension(extensions, VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME)) {
+        enabledExtensions.push_back(VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME);
+        *nextFeatures = &float16Int8Features;
+        nextFeatures = &float16Int8Features.pNext;
+    }
+    if (hasDeviceExtension(extensions, VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME)) {
+        enabledExtensions.push_back(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
+        *nextFeatures = &subgroupSizeControlFeatures;
+        nextFeatures = &subgroupSizeControlFeatures.pNext;
+    }
+    if (hasDeviceExtension(extensions, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+        enabledExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    vkGetPhysicalDeviceFeatures2(backend.physicalDevice, &features2);
+
+    const float queuePriority = 1.0f;
+    VkDeviceQueueCreateInfo queueCreateInfo = {};
+    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueFamilyIndex = queueFamilyIndex;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+    VkDeviceCreateInfo deviceCreateInfo = {};
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.pNext = &features2;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+    deviceCreateInfo.enabledExtensionCount = uint32_t(enabledExtensions.size());
+    deviceCreateInfo.ppEnabledExtensionNames = enabledExtensions.data();
+    checkVkResult(vkCreateDevice(backend.physicalDevice, &deviceCreateInfo, nullptr, &backend.device), "vkCreateDevice");
+    volkLoadDevice(backend.device);
+    vkGetDeviceQueue(backend.device, queueFamilyIndex, 0, &backend.queue);
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndex;
+    checkVkResult(vkCreateCommandPool(backend.device, &commandPoolCreateInfo, nullptr, &backend.commandPool), "vkCreateCommandPool");
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandPool = backend.commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    checkVkResult(vkAllocateCommandBuffers(backend.device, &commandBufferAllocateInfo, &backend.commandBuffer), "vkAllocateCommandBuffers");
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    checkVkResult(vkCreateFence(backend.device, &fenceCreateInfo, nullptr, &backend.fence), "vkCreateFence");
+}
+
+void getBackendInterface(ReplayBackend& backend, const ReplayOptions& options, FfxmInterface* backendInterface)
+{
+    (void)options;
+    createDevice(backend);
+
+    backend.deviceContext = { backend.device, backend.physicalDevice, vkGetDeviceProcAddr };
+    backend.scratch.resize(ffxmGetScratchMemorySizeVK(backend.physicalDevice, 1));
+    if (ffxmGetInterfaceVK(backendInterface, ffxmGetDeviceVK(&backend.deviceContext), backend.scratch.data(), backend.scratch.size(), 1) != FFXM_OK) {
+        fprintf(stderr, "Failed to create the VK backend interface\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Starts recording the frame, the textures are uploaded as they are fetched
+void beginBackendFrame(ReplayBackend& backend)
+{
+    checkVkResult(vkResetCommandBuffer(backend.commandBuffer, 0), "vkResetCommandBuffer");
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    checkVkResult(vkBeginCommandBuffer(backend.commandBuffer, &beginInfo), "vkBeginCommandBuffer");
+}
+
+void recordImageBarrier(ReplayBackend& backend, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout,
+    VkAccessFlags srcAccessMask, VkAccessFlags dstAccessMask)
+{
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = srcAccessMask;
+    barrier.dstAccessMask = dstAccessMask;
+    barrier.oldLayout = oldLayout;
+    barrier.newLayout = newLayout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    vkCmdPipelineBarrier(backend.commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr,
+        1, &barrier);
+}
+
+// The output is left in the general layout, the state the backend returns it to at the end of the dispatch
+FfxmResource getBackendTexture(ReplayBackend& backend, ReplayTexture& texture, bool output)
+{
+    const FfxmSurfaceFormat format = FfxmSurfaceFormat(texture.description.format);
+    const VkFormat vkFormat = getVkFormat(format);
+    if (vkFormat == VK_FORMAT_UNDEFINED) {
+        fprintf(stderr, "Texture format %u is not supported\n", texture.description.format);
+        exit(EXIT_FAILURE);
+    }
+
+    ReplayImageVK image;
+    image.texture = &texture;
+
+    VkImageCreateInfo imageCreateInfo = {};
+
+    imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageCreateInfo.format = vkFormat;
+    imageCreateInfo.extent = { texture.description.width, texture.description.height, 1 };
+    imageCreateInfo.mipLevels = 1;
+    imageCreateInfo.arrayLayers = 1;
+    imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageCreateInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    if (output)
+        imageCreateInfo.usage |= VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    checkVkResult(vkCreateImage(backend.device, &imageCreateInfo, nullptr, &image.image), "vkCreateImage");
+    VkMemoryRequirements imageRequirements;
+    vkGetImageMemoryRequirements(backend.device, image.image, &imageRequirements);
+    image.imageMemory = allocateMemory(backend, imageRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    checkVkResult(vkBindImageMemory(backend.device, image.image, image.imageMemory, 0), "vkBindImageMemory");
+
+    // the same host visible buffer uploads the texels and, for the output, reads them back
+    VkBufferCreateInfo bufferCreateInfo = {};
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.size = texture.texels.size();
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    checkVkResult(vkCreateBuffer(backend.device, &bufferCreateInfo, nullptr, &image.buffer), "vkCreateBuffer");
+    VkMemoryRequirements bufferRequirements;
+    vkGetBufferMemoryRequirements(backend.device, image.buffer, &bufferRequirements);
+    image.bufferMemory = allocateMemory(backend, bufferRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    checkVkResult(vkBindBufferMemory(backend.device, image.buffer, image.bufferMemory, 0), "vkBindBufferMemory");
+
+    void* mapped;
+    checkVkResult(vkMapMemory(backend.device, image.bufferMemory, 0, VK_WHOLE_SIZE, 0, &mapped), "vkMapMemory");
+    memcpy(mapped, texture.texels.data(), texture.texels.size());
+    vkUnmapMemory(backend.device, image.bufferMemory);
+
+    const VkImageLayout layout = output ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    VkBufferImageCopy region = {};
+    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+    region.imageExtent = imageCreateInfo.extent;
+    recordImageBarrier(backend, image.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, VK_ACCESS_TRANSFER_WRITE_BIT);
+    vkCmdCopyBufferToImage(backend.commandBuffer, image.buffer, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    recordImageBarrier(backend, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, layout, VK_ACCESS_TRANSFER_WRITE_BIT,
+        VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+
+    if (output)
+        backend.output = image;
+    else
+        backend.frameImages.push_back(image);
+
+    const FfxmResourceDescription description = { FFXM_RESOURCE_TYPE_TEXTURE2D, format, texture.description.width, texture.description.height, 1, 1,
+        FFXM_RESOURCE_FLAGS_NONE, output ? FfxmResourceUsage(FFXM_RESOURCE_USAGE_UAV | FFXM_RESOURCE_USAGE_RENDERTARGET) : FFXM_RESOURCE_USAGE_READ_ONLY };
+    return ffxmGetResourceVK(reinterpret_cast<void*>(image.image), description, nullptr,
+        output ? FFXM_RESOURCE_STATE_UNORDERED_ACCESS : FFXM_RESOURCE_STATE_COMPUTE_READ);
+}
+
+FfxmCommandList getBackendCommandList(ReplayBackend& backend)
+{
+    return ffxmGetCommandListVK(backend.commandBuffer);
+}
+
+void destroyImage(ReplayBackend& backend, ReplayImageVK& image)
+{
+    vkDestroyImage(backend.device, image.image, nullptr);
+    vkFreeMemory(backend.device, image.imageMemory, nullptr);
+    vkDestroyBuffer(backend.device, image.buffer, nullptr);
+    vkFreeMemory(backend.device, image.bufferMemory, nullptr);
+    image = ReplayImageVK();
+}
+
+// Submits the frame and reads the output back once it has completed
+void endBackendFrame(ReplayBackend& backend)
+{
+    ReplayImageVK& output = backend.output;
+    VkBufferImageCopy region = {};
+    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+    region.imageExtent = { output.texture->description.width, output.texture->description.height, 1 };
+    recordImageBarrier(backend, output.image, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT);
+    vkCmdCopyImageToBuffer(backend.commandBuffer, output.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, output.buffer, 1, &region);
+
+    VkBufferMemoryBarrier bufferBarrier = {};
+
+    bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    bufferBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    bufferBarrier.buffer = output.buffer;
+    bufferBarrier.size = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(backend.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+    checkVkResult(vkEndCommandBuffer(backend.commandBuffer), "vkEndCommandBuffer");
+
+    VkSubmitInfo submitInfo = {};
+
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &backend.commandBuffer;
+    checkVkResult(vkQueueSubmit(backend.queue, 1, &submitInfo, backend.fence), "vkQueueSubmit");
+    checkVkResult(vkWaitForFences(backend.device, 1, &backend.fence, VK_TRUE, UINT64_MAX), "vkWaitForFences");
+    checkVkResult(vkResetFences(backend.device, 1, &backend.fence), "vkResetFences");
+
+    void* mapped;
+    checkVkResult(vkMapMemory(backend.device, output.bufferMemory, 0, VK_WHOLE_SIZE, 0, &mapped), "vkMapMemory");
+    memcpy(output.texture->texels.data(), mapped, output.texture->texels.size());
+    vkUnmapMemory(backend.device, output.bufferMemory);
+
+    destroyImage(backend, output);
+    for (ReplayImageVK& image : backend.frameImages)
+        destroyImage(backend, image);
+    backend.frameImages.clear();
+}
+
+void destroyBackend(ReplayBackend& backend)
+{
+    vkDestroyFence(backend.device, backend.fence, nullptr);
+    vkDestroyCommandPool(backend.device, backend.commandPool, nullptr);
+    vkDestroyDevice(backend.device, nullptr);
+    vkDestroyInstance(backend.instance, nullptr);
+}
+
+#else
+
+// The backend the capture is replayed through, textures live in host memory
+struct ReplayBackend {
+    CpuDeviceContext            device = {};
+    std::vector<uint8_t>        scratch;
+};
+
+void getBackendInterface(ReplayBackend& backend, const ReplayOptions& options, FfxmInterface* backendInterface)
+{
+    backend.device.threadCount = options.threadCount;
+    backend.scratch.resize(ffxmGetScratchMemorySizeCPU(1));
+    if (ffxmGetInterfaceCPU(backendInterface, ffxmGetDeviceCPU(&backend.device), backend.scratch.data(), backend.scratch.size(), 1) != FFXM_OK) {
+        fprintf(stderr, "Failed to create the CPU backend interface\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void beginBackendFrame(ReplayBackend&)
+{
+}
+
+FfxmResource getBackendTexture(ReplayBackend&, ReplayTexture& texture, bool output)
+{
+    const FfxmResourceDescription description = { FFXM_RESOURCE_TYPE_TEXTURE2D, FfxmSurfaceFormat(texture.description.format),
+        texture.description.width, texture.description.height, 1, 1, FFXM_RESOURCE_FLAGS_NONE,
+        output ? FFXM_RESOURCE_USAGE_UAV : FFXM_RESOURCE_USAGE_READ_ONLY };
+    return ffxmGetResourceCPU(texture.texels.data(), description, nullptr, output ? FFXM_RESOURCE_STATE_UNORDERED_ACCESS : FFXM_RESOURCE_STATE_COMPUTE_READ);
+}
+
+FfxmCommandList getBackendCommandList(ReplayBackend&)
+{
+    return ffxmGetCommandListCPU(nullptr);
+}
+
+// The CPU backend has written the output when the dispatch returns
+void endBackendFrame(ReplayBackend&)
+{
+}
+
+void destroyBackend(ReplayBackend&)
+{
+}
+
+#endif // #if defined(FFXM_REPLAY_VK)
+
+// Reading the capture
+
+bool readBytes(FILE* file, void* data, size_t size)
+{
+    return fread(data, 1, size, file) == size;
+}
+
+bool readChunkHeader(FILE* file, FfxmFsr2CaptureChunkHeader* chunkHeader)
+{
+    return readBytes(file, chunkHeader, sizeof(*chunkHeader));
+}
+
+// Reads the payload of a known chunk, the chunk may be larger than the structure in later versions of the format
+bool readChunkPayload(FILE* file, const FfxmFsr2CaptureChunkHeader& chunkHeader, void* payload, size_t payloadSize)
+{
+    return chunkHeader.size >= payloadSize && readBytes(file, payload, payloadSize) &&
+           fseek(file, long(chunkHeader.size - payloadSize), SEEK_CUR) == 0;
+}
+
+bool readTexture(FILE* file, const FfxmFsr2CaptureChunkHeader& chunkHeader, ReplayFrame& frame)
+{
+    FfxmFsr2CaptureTextureChunk description;
+    if (chunkHeader.size < sizeof(description) || !readBytes(file, &description, sizeof(description)) ||
+        description.texture >= FFXM_FSR2_CAPTURE_TEXTURE_COUNT)
+        return false;
+
+    ReplayTexture& texture = frame.textures[description.texture];
+    texture.description = description;
+    texture.texels.resize(chunkHeader.size - sizeof(description));
+    return readBytes(file, texture.texels.data(), texture.texels.size());
+}
+
+bool readRegions(FILE* file, const FfxmFsr2CaptureChunkHeader& chunkHeader, ReplayFrame& frame)
+{
+    if (chunkHeader.size % sizeof(FfxmRect2D) || chunkHeader.size / sizeof(FfxmRect2D) > FFXM_FSR2_MAX_DISPATCH_REGIONS)
+        return false;
+
+    frame.regions.resize(chunkHeader.size / sizeof(FfxmRect2D));
+    return readBytes(file, frame.regions.data(), chunkHeader.size);
+}
+
+// Reads the chunks up to the output texture of the next frame, returns false at the end of the capture
+bool readFrame(FILE* file, ReplayFrame& frame)
+{
+    bool frameStarted = false;
+    FfxmFsr2CaptureChunkHeader chunkHeader;
+    while (readChunkHeader(file, &chunkHeader)) {
+        bool valid = true;
+        if (chunkHeader.type == FFXM_FSR2_CAPTURE_CHUNK_FRAME) {
+            frame = ReplayFrame();
+            valid = readChunkPayload(file, chunkHeader, &frame.parameters, sizeof(frame.parameters));
+            frameStarted = true;
+        } else if (chunkHeader.type == FFXM_FSR2_CAPTURE_CHUNK_REGIONS && frameStarted) {
+            valid = readRegions(file, chunkHeader, frame);
+        } else if (chunkHeader.type == FFXM_FSR2_CAPTURE_CHUNK_FOVEATION && frameStarted) {
+            valid = readChunkPayload(file, chunkHeader, &frame.foveation, sizeof(frame.foveation)) &&
+                    frame.foveation.centerCount <= FFXM_FSR2_MAX_FOVEATION_CENTERS;
+        } else if (chunkHeader.type == FFXM_FSR2_CAPTURE_CHUNK_TEXTURE && frameStarted) {
+            valid = readTexture(file, chunkHeader, frame);
+            if (valid && !frame.textures[FFXM_FSR2_CAPTURE_TEXTURE_OUTPUT].texels.empty())
+                return true;
+        } else {
+            valid = fseek(file, long(chunkHeader.size), SEEK_CUR) == 0;
+        }
+
+        if (!valid) {
+            fprintf(stderr, "Malformed capture chunk (type %u, size %u)\n", chunkHeader.type, chunkHeader.size);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (frameStarted) {
+        fprintf(stderr, "Truncated capture, frame %u has no output\n", frame.parameters.frameIndex);
+        exit(EXIT_FAILURE);
+    }
+    return false;
+}
+
+// Comparing the outputs
+
+float halfToFloat(uint16_t value)
+{
+    const uint32_t sign = uint32_t(value >> 15) << 31;
+    const uint32_t exponent = (value >> 10) & 0x1f;
+    const uint32_t mantissa = value & 0x3ff;
+
+    float magnitude;
+    if (exponent == 0)
+        magnitude = ldexpf(float(mantissa), -24);
+    else if (exponent == 31)
+        magnitude = mantissa ? NAN : INFINITY;
+    else
+        magnitude = ldexpf(float(mantissa | 0x400), int(exponent) - 25);
+    return sign ? -magnitude : magnitude;
+}
+
+// Decodes the channels of the output formats, returns false for the formats only compared bit by bit
+bool decodeTexels(const ReplayTexture& texture, std::vector<float>& channels)
+{
+    const std::vector<uint8_t>& texels = texture.texels;
+    switch (FfxmSurfaceFormat(texture.description.format)) {
+    case FFXM_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+    case FFXM_SURFACE_FORMAT_R32G32_FLOAT:
+    case FFXM_SURFACE_FORMAT_R32_FLOAT:
+        channels.resize(texels.size() / sizeof(float));
+        memcpy(channels.data(), texels.data(), channels.size() * sizeof(float));
+        return true;
+    case FFXM_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+    case FFXM_SURFACE_FORMAT_R16G16_FLOAT:
+    case FFXM_SURFACE_FORMAT_R16_FLOAT:
+        channels.resize(texels.size() / sizeof(uint16_t));
+        for (size_t i = 0; i < channels.size(); ++i) {
+            uint16_t value;
+            memcpy(&value, &texels[i * sizeof(uint16_t)], sizeof(value));
+            channels[i] = halfToFloat(value);
+        }
+        return true;
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_UNORM:
+    case FFXM_SURFACE_FORMAT_R8G8B8A8_SRGB:
+    case FFXM_SURFACE_FORMAT_R8G8_UNORM:
+    case FFXM_SURFACE_FORMAT_R8_UNORM:
+        channels.resize(texels.size());
+        for (size_t i = 0; i < channels.size(); ++i)
+            channels[i] = float(texels[i]) / 255.0f;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns true when the replayed output matches the captured one within the tolerance
+bool compareOutputs(uint32_t frameIndex, const ReplayTexture& captured, const ReplayTexture& replayed, double tolerance)
+{
+    if (captured.texels == replayed.texels) {
+        printf("frame %5u: identical\n", frameIndex);
+        return true;
+    }
+
+    std::vector<float> capturedChannels, replayedChannels;
+    if (!decodeTexels(captured, capturedChannels) || !decodeTexels(replayed, replayedChannels)) {
+        printf("frame %5u: differs (format %u is compared bit by bit)\n", frameIndex, captured.description.format);
+        return false;
+    }
+
+    double maxDifference = 0.0, squaredSum = 0.0;
+    for (size_t i = 0; i < capturedChannels.size(); ++i) {
+        const float capturedChannel = capturedChannels[i];
+        const float replayedChannel = replayedChannels[i];
+
+        // a NaN on one side only is a mismatch whatever the tolerance
+        double difference = fabs(double(capturedChannel) - double(replayedChannel));
+        if (std::isnan(capturedChannel) || std::isnan(replayedChannel))
+            difference = std::isnan(capturedChannel) == std::isnan(replayedChannel) ? 0.0 : INFINITY;
+
+        maxDifference = std::max(maxDifference, difference);
+        squaredSum += difference * difference;
+    }
+
+    const bool match = tolerance > 0.0 && maxDifference <= tolerance;
+    printf("frame %5u: %s, max difference %g, rmse %g\n", frameIndex, match ? "within tolerance" : "differs",
+        maxDifference, sqrt(squaredSum / double(capturedChannels.size())));
+    return match;
+}
+
+void checkResult(FfxmErrorCode errorCode, const char* function)
+{
+    if (errorCode != FFXM_OK) {
+        fprintf(stderr, "%s failed (0x%x)\n", function, unsigned(errorCode));
+        exit(EXIT_FAILURE);
+    }
+}
+
+FfxmResource getFrameTexture(ReplayBackend& backend, ReplayFrame& frame, FfxmFsr2CaptureTexture texture)
+{
+    if (!(frame.parameters.textureMask & (1u << texture)))
+        return FfxmResource();
+    return getBackendTexture(backend, frame.textures[texture], texture == FFXM_FSR2_CAPTURE_TEXTURE_OUTPUT);
+}
+
+FfxmFsr2DispatchDescription getDispatchDescription(ReplayBackend& backend, ReplayFrame& frame, ReplayTexture& output)
+{
+    const FfxmFsr2CaptureFrameChunk& parameters = frame.parameters;
+
+    FfxmFsr2DispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList = getBackendCommandList(backend);
+    dispatchDescription.color = getFrameTexture(backend, frame, FFXM_FSR2_CAPTURE_TEXTURE_COLOR);
+    dispatchDescription.depth = getFrameTexture(backend, frame, FFXM_FSR2_CAPTURE_TEXTURE_DEPTH);
+    dispatchDescription.motionVectors = getFrameTexture(backend, frame, FFXM_FSR2_CAPTURE_TEXTURE_MOTION_VECTORS);
+    dispatchDescription.exposure = getFrameTexture(backend, frame, FFXM_FSR2_CAPTURE_TEXTURE_EXPOSURE);
+    dispatchDescription.reactive = getFrameTexture(backend, frame, FFXM_FSR2_CAPTURE_TEXTURE_REACTIVE);
+    dispatchDescription.transparencyAndComposition = getFrameTexture(backend, frame, FFXM_FSR2_CAPTURE_TEXTURE_TRANSPARENCY_AND_COMPOSITION);
+    dispatchDescription.output = getBackendTexture(backend, output, true);
+    dispatchDescription.jitterOffset = { parameters.jitterOffset[0], parameters.jitterOffset[1] };
+    dispatchDescription.jitterIndex = parameters.jitterIndex;
+    dispatchDescription.motionVectorScale = { parameters.motionVectorScale[0], parameters.motionVectorScale[1] };
+    dispatchDescription.renderSize = { parameters.renderSize[0], parameters.renderSize[1] };
+    dispatchDescription.enableSharpening = parameters.enableSharpening != 0;
+    dispatchDescription.sharpness = parameters.sharpness;
+    dispatchDescription.frameTimeDelta = parameters.frameTimeDelta;
+    dispatchDescription.preExposure = parameters.preExposure;
+    dispatchDescription.reset = parameters.reset != 0;
+    dispatchDescription.cameraNear = parameters.cameraNear;
+    dispatchDescription.cameraFar = parameters.cameraFar;
+    dispatchDescription.cameraFovAngleVertical = parameters.cameraFovAngleVertical;
+    dispatchDescription.viewSpaceToMetersFactor = parameters.viewSpaceToMetersFactor;
+    dispatchDescription.regions = frame.regions.data();
+    dispatchDescription.regionCount = uint32_t(frame.regions.size());
+    dispatchDescription.foveation.centerCount = frame.foveation.centerCount;
+    for (uint32_t centerIndex = 0; centerIndex < frame.foveation.centerCount; ++centerIndex)
+        dispatchDescription.foveation.centers[centerIndex] = { frame.foveation.centers[centerIndex * 2 + 0], frame.foveation.centers[centerIndex * 2 + 1] };
+    dispatchDescription.foveation.radius = frame.foveation.radius;
+    dispatchDescription.foveation.falloff = frame.foveation.falloff;
+
+    return dispatchDescription;
+}
+
+FILE* openCapture(const char* path, FfxmFsr2CaptureContextChunk* contextChunk)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+
+    FfxmFsr2CaptureFileHeader fileHeader;
+    FfxmFsr2CaptureChunkHeader chunkHeader;
+    if (!readBytes(file, &fileHeader, sizeof(fileHeader)) || fileHeader.magic != FFXM_FSR2_CAPTURE_MAGIC) {
+        fprintf(stderr, "%s is not an Arm ASR capture\n", path);
+        exit(EXIT_FAILURE);
+    }
+    if (fileHeader.version != FFXM_FSR2_CAPTURE_VERSION) {
+        fprintf(stderr, "%s has version %u, version %u is supported\n", path, fileHeader.version, FFXM_FSR2_CAPTURE_VERSION);
+        exit(EXIT_FAILURE);
+    }
+    if (!readChunkHeader(file, &chunkHeader) || chunkHeader.type != FFXM_FSR2_CAPTURE_CHUNK_CONTEXT ||
+        !readChunkPayload(file, chunkHeader, contextChunk, sizeof(*contextChunk))) {
+        fprintf(stderr, "%s does not start with a context chunk\n", path);
+        exit(EXIT_FAILURE);
+    }
+
+    return file;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    ReplayOptions options;
+    for (int i = 1; i < argc; ++i) {
+        if (!strncmp(argv[i], "--tolerance=", 12)) {
+            options.tolerance = atof(argv[i] + 12);
+#if !defined(FFXM_REPLAY_VK)
+        } else if (!strncmp(argv[i], "--threads=", 10)) {
+            options.threadCount = uint32_t(atoi(argv[i] + 10));
+        } else if (!strncmp(argv[i], "--capture=", 10)) {
+            options.recapturePath = argv[i] + 10;
+#endif // #if !defined(FFXM_REPLAY_VK)
+        } else if (argv[i][0] != '-' && !options.capturePath) {
+            options.capturePath = argv[i];
+        } else {
+            options.capturePath = nullptr;
+            break;
+        }
+    }
+#if defined(FFXM_REPLAY_VK)
+    // the shaders never match the CPU backend bit for bit, the tolerance has to be given
+    if (!options.capturePath || options.tolerance <= 0.0) {
+        fprintf(stderr, "Usage: %s <capture> --tolerance=<value>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+#else
+    if (!options.capturePath) {
+        fprintf(stderr, "Usage: %s <capture> [--threads=<count>] [--tolerance=<value>] [--capture=<path>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+#endif // #if defined(FFXM_REPLAY_VK)
+
+    FfxmFsr2CaptureContextChunk contextChunk;
+    FILE* file = openCapture(options.capturePath, &contextChunk);
+
+    ReplayBackend backend;
+    FfxmFsr2ContextDescription contextDescription = {};
+    contextDescription.qualityMode = FfxmFsr2ShaderQualityMode(contextChunk.qualityMode);
+    contextDescription.flags = contextChunk.flags;
+    contextDescription.maxRenderSize = { contextChunk.maxRenderSize[0], contextChunk.maxRenderSize[1] };
+    contextDescription.displaySize = { contextChunk.displaySize[0], contextChunk.displaySize[1] };
+    getBackendInterface(backend, options, &contextDescription.backendInterface);
+
+    FfxmFsr2Context context;
+    checkResult(ffxmFsr2ContextCreate(&context, &contextDescription), "ffxmFsr2ContextCreate");
+    if (options.recapturePath)
+        checkResult(ffxmFsr2ContextBeginCapture(&context, options.recapturePath), "ffxmFsr2ContextBeginCapture");
+
+    uint32_t frameCount = 0, mismatchCount = 0;
+    ReplayFrame frame;
+    ReplayTexture output;
+    while (readFrame(file, frame)) {
+        const ReplayTexture& capturedOutput = frame.textures[FFXM_FSR2_CAPTURE_TEXTURE_OUTPUT];
+        output.description = capturedOutput.description;
+
+        // with regions the output is only written in them, it starts with the content the application has around them
+        if (frame.regions.empty())
+            output.texels.assign(capturedOutput.texels.size(), 0);
+        else
+            output.texels = capturedOutput.texels;
+
+        beginBackendFrame(backend);
+        const FfxmFsr2DispatchDescription dispatchDescription = getDispatchDescription(backend, frame, output);
+        checkResult(ffxmFsr2ContextDispatch(&context, &dispatchDescription), "ffxmFsr2ContextDispatch");
+        endBackendFrame(backend);
+
+        if (!compareOutputs(frame.parameters.frameIndex, capturedOutput, output, options.tolerance))
+            ++mismatchCount;
+        ++frameCount;
+    }
+    fclose(file);
+
+    if (options.recapturePath)
+        checkResult(ffxmFsr2ContextEndCapture(&context), "ffxmFsr2ContextEndCapture");
+    checkResult(ffxmFsr2ContextDestroy(&context), "ffxmFsr2ContextDestroy");
+    destroyBackend(backend);
+
+    printf("%u frames replayed, %u mismatching\n", frameCount, mismatchCount);
+    return mismatchCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
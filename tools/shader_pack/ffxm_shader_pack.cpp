@@ -0,0 +1,446 @@
+// Copyright  © 2023 Advanced Micro Devices, Inc.
+// Copyright  © 2024-2025 Arm Limited.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+// Packs the prebuilt FSR2 shader permutations into an archive loaded with ffxmSetShaderArchive, see
+// ffxm_shader_archive_codec.h for the format. With --verify, reads an archive back through the runtime
+// accessor and checks every pass and permutation key against the prebuilt shaders linked in the tool.
+//
+// Usage: Arm_ASR_shader_pack [--verify] <archive>
+
+#include <host/ffxm_types.h>
+#include <host/ffxm_util.h>
+#include <host/ffxm_shader_archive.h>
+#include "blob_accessors/ffxm_fsr2_shaderblobs.h"
+#include "blob_accessors/ffxm_shader_archive_codec.h"
+#include "fsr2/ffxm_fsr2_private.h"
+
+using namespace arm;
+
+#include <ffxm_fsr2_autogen_reactive_pass_fs_16bit_permutations.h>
+#include <ffxm_fsr2_accumulate_pass_fs_16bit_permutations.h>
+#include <ffxm_fsr2_compute_luminance_pyramid_pass_16bit_permutations.h>
+#include <ffxm_fsr2_depth_clip_pass_fs_16bit_permutations.h>
+#include <ffxm_fsr2_lock_pass_16bit_permutations.h>
+#include <ffxm_fsr2_reconstruct_previous_depth_pass_fs_16bit_permutations.h>
+#include <ffxm_fsr2_rcas_pass_fs_16bit_permutations.h>
+#include <ffxm_fsr2_vs_16bit_permutations.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+// The permutations of one shader, with the table mapping each permutation key to one of them
+struct PackShader {
+    const char*                 name;
+    const uint32_t*             indirectionTable;
+    std::vector<FfxmShaderBlob> permutations;
+    uint32_t                    firstBlob = 0;
+};
+
+struct PackBindingKind {
+    uint32_t        count;
+    const char**    names;
+    const uint32_t* bindings;
+    const uint32_t* counts;
+    const uint32_t* sets;
+};
+
+template <typename Info, size_t PermutationCount>
+PackShader getPackShader(const char* name, const uint32_t (&indirectionTable)[FFXM_SHADER_ARCHIVE_KEY_COUNT], const Info (&info)[PermutationCount])
+{
+    PackShader shader = { name, indirectionTable, {} };
+    for (size_t index = 0; index < PermutationCount; ++index) {
+        shader.permutations.push_back(POPULATE_SHADER_BLOB_FFX(info, index));
+    }
+    return shader;
+}
+
+#define PACK_SHADER(name) getPackShader(#name, g_##name##_IndirectionTable, g_##name##_PermutationInfo)
+
+// The shaders in the order of the archive lookup tables, each FfxmFsr2Pass then the vertex shader
+std::vector<PackShader> getPackShaders()
+{
+    std::vector<PackShader> shaders;
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_depth_clip_pass_fs_16bit));
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_reconstruct_previous_depth_pass_fs_16bit));
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_lock_pass_16bit));
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_accumulate_pass_fs_16bit));
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_rcas_pass_fs_16bit));
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_compute_luminance_pyramid_pass_16bit));
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_autogen_reactive_pass_fs_16bit));
+    shaders.push_back(PACK_SHADER(ffxm_fsr2_vs_16bit));
+    return shaders;
+}
+
+// Index in getPackShaders of the shader of each archive lookup table, the sharpening accumulate pass shares
+// the shader of the accumulate pass
+const uint32_t s_lookupShaders[FFXM_FSR2_PASS_COUNT + 1] = { 0, 1, 2, 3, 3, 4, 5, 6, 7 };
+
+void getBindingKinds(const FfxmShaderBlob& blob, PackBindingKind (&kinds)[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT])
+{
+    kinds[0] = { blob.cbvCount, blob.boundConstantBufferNames, blob.boundConstantBuffers, blob.boundConstantBufferCounts, blob.boundConstantBufferSets };
+    kinds[1] = { blob.srvTextureCount, blob.boundSRVTextureNames, blob.boundSRVTextures, blob.boundSRVTextureCounts, blob.boundSRVTextureSets };
+    kinds[2] = { blob.uavTextureCount, blob.boundUAVTextureNames, blob.boundUAVTextures, blob.boundUAVTextureCounts, blob.boundUAVTextureSets };
+    kinds[3] = { blob.srvBufferCount, blob.boundSRVBufferNames, blob.boundSRVBuffers, blob.boundSRVBufferCounts, blob.boundSRVBufferSets };
+    kinds[4] = { blob.uavBufferCount, blob.boundUAVBufferNames, blob.boundUAVBuffers, blob.boundUAVBufferCounts, blob.boundUAVBufferSets };
+    kinds[5] = { blob.samplerCount, blob.boundSamplerNames, blob.boundSamplers, blob.boundSamplerCounts, blob.boundSamplerSets };
+    kinds[6] = { blob.rtAccelStructCount, blob.boundRTAccelerationStructureNames, blob.boundRTAccelerationStructures,
+                 blob.boundRTAccelerationStructureCounts, blob.boundRTAccelerationStructureSets };
+    kinds[7] = { blob.rtTextureCount, blob.boundRTTextureNames, blob.boundRTTextures, blob.boundRTTextureCounts, blob.boundRTTextureSets };
+}
+
+uint32_t getPermutationOptions(uint32_t key)
+{
+    const uint32_t keyOptions[] = {
+        FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT,         FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS,
+        FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS,   FSR2_SHADER_PERMUTATION_DEPTH_INVERTED,
+        FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING,       FSR2_SHADER_PERMUTATION_APPLY_BALANCED_OPT,
+        FSR2_SHADER_PERMUTATION_APPLY_PERFORMANCE_OPT,   FSR2_SHADER_PERMUTATION_APPLY_ULTRA_PERFORMANCE_OPT,
+    };
+
+    uint32_t options = FSR2_SHADER_PERMUTATION_ALLOW_FP16;
+    for (uint32_t bit = 0; bit < uint32_t(FFXM_ARRAY_ELEMENTS(keyOptions)); ++bit) {
+        if (key & (1u << bit))
+            options |= keyOptions[bit];
+    }
+    return options;
+}
+
+void writeVarint(std::vector<uint8_t>& stream, uint32_t value)
+{
+    while (value >= 0x80) {
+        stream.push_back(uint8_t(value | 0x80));
+        value >>= 7;
+    }
+    stream.push_back(uint8_t(value));
+}
+
+// Mirrors ffxmShaderArchiveDecodeSpirv
+bool encodeSpirv(const FfxmShaderBlob& blob, std::vector<uint8_t>& encoded)
+{
+    const uint32_t* code = reinterpret_cast<const uint32_t*>(blob.data);
+    const uint32_t  wordCount = blob.size / sizeof(uint32_t);
+
+    const uint32_t headerWordCount = 5;
+    if ((blob.size % sizeof(uint32_t)) != 0 || wordCount < headerWordCount || code[0] != 0x07230203)
+        return false;
+
+    encoded.clear();
+    for (uint32_t i = 0; i < headerWordCount; ++i)
+        writeVarint(encoded, code[i]);
+
+    std::unordered_map<uint32_t, uint32_t> previousOperands;
+    for (uint32_t word = headerWordCount; word < wordCount;) {
+        const uint32_t opcode = code[word] & 0xffff;
+        const uint32_t instructionWordCount = code[word] >> 16;
+        if (instructionWordCount == 0 || instructionWordCount > wordCount - word)
+            return false;
+
+        writeVarint(encoded, opcode);
+        writeVarint(encoded, instructionWordCount);
+        for (uint32_t operand = 1; operand < instructionWordCount; ++operand) {
+            uint32_t& previous = previousOperands[(opcode << 8) | (operand < 255 ? operand : 255)];
+            const int32_t delta = int32_t(code[word + operand] - previous);
+            writeVarint(encoded, (uint32_t(delta) << 1) ^ uint32_t(delta >> 31));
+            previous = code[word + operand];
+        }
+        word += instructionWordCount;
+    }
+    return true;
+}
+
+void writeLength(std::vector<uint8_t>& stream, size_t length)
+{
+    for (; length >= 255; length -= 255)
+        stream.push_back(255);
+    stream.push_back(uint8_t(length));
+}
+
+// Greedy LZ77 over a hash chain, in the block format read by ffxmShaderArchiveDecompress. The matches can start
+// in the dictionary, which is only indexed and not written.
+void compress(const std::vector<uint8_t>& dictionary, const std::vector<uint8_t>& source, std::vector<uint8_t>& compressed)
+{
+    const size_t   minMatch = 4, maxOffset = 65535, maxChain = 256;
+    const uint32_t hashBits = 16;
+
+    std::vector<uint8_t> window(dictionary);
+    window.insert(window.end(), source.begin(), source.end());
+    const size_t windowSize = window.size();
+
+    std::vector<int64_t> head(size_t(1) << hashBits, -1), previous(windowSize, -1);
+    auto hash = [&](size_t position) {
+        uint32_t value;
+        memcpy(&value, &window[position], sizeof(value));
+        return (value * 2654435761u) >> (32 - hashBits);
+    };
+    auto insert = [&](size_t position) {
+        const uint32_t h = hash(position);
+        previous[position] = head[h];
+        head[h] = int64_t(position);
+    };
+
+    auto emit = [&](size_t literalStart, size_t literalEnd, size_t matchLength, size_t offset) {
+        const size_t literalLength = literalEnd - literalStart;
+        const size_t matchCode = matchLength ? matchLength - minMatch : 0;
+        compressed.push_back(uint8_t((literalLength < 15 ? literalLength : 15) << 4 | (matchCode < 15 ? matchCode : 15)));
+        if (literalLength >= 15)
+            writeLength(compressed, literalLength - 15);
+        compressed.insert(compressed.end(), window.begin() + literalStart, window.begin() + literalEnd);
+        if (matchLength) {
+            compressed.push_back(uint8_t(offset));
+            compressed.push_back(uint8_t(offset >> 8));
+            if (matchCode >= 15)
+                writeLength(compressed, matchCode - 15);
+        }
+    };
+
+    for (size_t position = 0; position + minMatch <= dictionary.size(); ++position)
+        insert(position);
+
+    compressed.clear();
+    size_t literalStart = dictionary.size(), position = dictionary.size();
+    while (position + minMatch <= windowSize) {
+        size_t bestLength = 0, bestOffset = 0, chain = maxChain;
+        for (int64_t candidate = head[hash(position)]; candidate >= 0 && chain-- && position - size_t(candidate) <= maxOffset;
+             candidate = previous[size_t(candidate)]) {
+            size_t length = 0;
+            while (position + length < windowSize && window[size_t(candidate) + length] == window[position + length])
+                ++length;
+            if (length > bestLength) {
+                bestLength = length;
+                bestOffset = position - size_t(candidate);
+            }
+        }
+
+        if (bestLength >= minMatch) {
+            emit(literalStart, position, bestLength, bestOffset);
+            for (size_t end = position + bestLength; position < end; ++position) {
+                if (position + minMatch <= windowSize)
+                    insert(position);
+            }
+            literalStart = position;
+        } else {
+            insert(position);
+            ++position;
+        }
+    }
+    emit(literalStart, windowSize, 0, 0);
+}
+
+template <typename T>
+uint32_t appendSection(std::vector<uint8_t>& archive, const T* data, size_t count)
+{
+    archive.resize((archive.size() + 3) & ~size_t(3));
+    const uint32_t offset = uint32_t(archive.size());
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    archive.insert(archive.end(), bytes, bytes + count * sizeof(T));
+    return offset;
+}
+
+bool writeArchive(const char* path)
+{
+    std::vector<PackShader> shaders = getPackShaders();
+
+    std::vector<FfxmShaderArchiveBlob> blobs;
+    std::vector<uint32_t>              reflection;
+    std::string                        strings;
+    std::map<std::string, uint32_t>    stringOffsets;
+    std::vector<uint8_t>               data;
+    size_t                             codeSize = 0, encodedSize = 0;
+
+    for (PackShader& shader : shaders) {
+        shader.firstBlob = uint32_t(blobs.size());
+
+        // the first permutation is the dictionary of the others
+        std::vector<uint8_t> dictionary, encoded, compressed;
+        for (const FfxmShaderBlob& permutation : shader.permutations) {
+            if (!encodeSpirv(permutation, encoded)) {
+                fprintf(stderr, "%s: permutation %zu is not a SPIR-V module\n", shader.name, blobs.size() - shader.firstBlob);
+                return false;
+            }
+
+            const bool isBase = blobs.size() == shader.firstBlob;
+            compress(isBase ? std::vector<uint8_t>() : dictionary, encoded, compressed);
+
+            FfxmShaderArchiveBlob blob = {};
+            blob.codeSize = permutation.size;
+            blob.encodedSize = uint32_t(encoded.size());
+            blob.dataOffset = uint32_t(data.size());
+            blob.dataSize = uint32_t(compressed.size());
+            blob.baseBlob = isBase ? FFXM_SHADER_ARCHIVE_NO_BASE : shader.firstBlob;
+            blob.reflectionOffset = uint32_t(reflection.size() * sizeof(uint32_t));
+            blobs.push_back(blob);
+
+            data.insert(data.end(), compressed.begin(), compressed.end());
+            codeSize += permutation.size;
+            encodedSize += encoded.size();
+            if (isBase)
+                dictionary = encoded;
+
+            PackBindingKind kinds[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT];
+            getBindingKinds(permutation, kinds);
+            for (const PackBindingKind& kind : kinds) {
+                reflection.push_back(kind.count);
+                for (uint32_t resource = 0; resource < kind.count; ++resource) {
+                    auto inserted = stringOffsets.insert({ kind.names[resource], uint32_t(strings.size()) });
+                    if (inserted.second)
+                        strings.append(kind.names[resource]).push_back('\0');
+                    reflection.push_back(inserted.first->second);
+                }
+                reflection.insert(reflection.end(), kind.bindings, kind.bindings + kind.count);
+                reflection.insert(reflection.end(), kind.counts, kind.counts + kind.count);
+                reflection.insert(reflection.end(), kind.sets, kind.sets + kind.count);
+            }
+        }
+    }
+
+    std::vector<uint16_t> lookup;
+    for (uint32_t shaderIndex : s_lookupShaders) {
+        const PackShader& shader = shaders[shaderIndex];
+        for (uint32_t key = 0; key < FFXM_SHADER_ARCHIVE_KEY_COUNT; ++key)
+            lookup.push_back(uint16_t(shader.firstBlob + shader.indirectionTable[key]));
+    }
+
+    FfxmShaderArchiveHeader header = {};
+    header.magic = FFXM_SHADER_ARCHIVE_MAGIC;
+    header.version = FFXM_SHADER_ARCHIVE_VERSION;
+    header.lookupCount = uint32_t(FFXM_ARRAY_ELEMENTS(s_lookupShaders));
+    header.blobCount = uint32_t(blobs.size());
+
+    std::vector<uint8_t> archive(sizeof(header));
+    header.lookupOffset = appendSection(archive, lookup.data(), lookup.size());
+    header.blobOffset = appendSection(archive, blobs.data(), blobs.size());
+    header.reflectionOffset = appendSection(archive, reflection.data(), reflection.size());
+    header.stringOffset = appendSection(archive, strings.data(), strings.size());
+    header.dataOffset = appendSection(archive, data.data(), data.size());
+    header.size = uint32_t(archive.size());
+    memcpy(archive.data(), &header, sizeof(header));
+
+    FILE* file = fopen(path, "wb");
+    if (!file || fwrite(archive.data(), 1, archive.size(), file) != archive.size()) {
+        fprintf(stderr, "Failed to write %s\n", path);
+        if (file)
+            fclose(file);
+        return false;
+    }
+    fclose(file);
+
+    printf("%u permutations, SPIR-V %zu bytes, encoded %zu bytes, compressed %zu bytes, archive %zu bytes\n",
+           header.blobCount, codeSize, encodedSize, data.size(), archive.size());
+    return true;
+}
+
+bool compareBlobs(const FfxmShaderBlob& expected, const FfxmShaderBlob& actual)
+{
+    if (expected.size != actual.size || memcmp(expected.data, actual.data, expected.size))
+        return false;
+
+    PackBindingKind expectedKinds[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT], actualKinds[FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT];
+    getBindingKinds(expected, expectedKinds);
+    getBindingKinds(actual, actualKinds);
+    for (uint32_t kind = 0; kind < FFXM_SHADER_ARCHIVE_BINDING_KIND_COUNT; ++kind) {
+        const PackBindingKind& e = expectedKinds[kind];
+        const PackBindingKind& a = actualKinds[kind];
+        if (e.count != a.count)
+            return false;
+        for (uint32_t resource = 0; resource < e.count; ++resource) {
+            if (strcmp(e.names[resource], a.names[resource]) || e.bindings[resource] != a.bindings[resource] ||
+                e.counts[resource] != a.counts[resource] || e.sets[resource] != a.sets[resource])
+                return false;
+        }
+    }
+    return true;
+}
+
+bool verifyArchive(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    const long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    std::vector<uint32_t> archive((size_t(fileSize) + 3) / 4);
+    const bool read = fread(archive.data(), 1, size_t(fileSize), file) == size_t(fileSize);
+    fclose(file);
+
+    if (!read || ffxmSetShaderArchive(archive.data(), size_t(fileSize)) != FFXM_OK) {
+        fprintf(stderr, "%s is not a shader archive\n", path);
+        return false;
+    }
+
+    const std::vector<PackShader> shaders = getPackShaders();
+    const PackShader& vertexShader = shaders[s_lookupShaders[FFXM_FSR2_PASS_COUNT]];
+
+    uint32_t mismatchCount = 0;
+    for (uint32_t pass = 0; pass < FFXM_FSR2_PASS_COUNT; ++pass) {
+        const PackShader& shader = shaders[s_lookupShaders[pass]];
+        for (uint32_t key = 0; key < FFXM_SHADER_ARCHIVE_KEY_COUNT; ++key) {
+            FfxmShaderBlob blob = {}, vertexBlob = {};
+            if (fsr2GetPermutationBlobByIndex(FfxmFsr2Pass(pass), getPermutationOptions(key), &blob, &vertexBlob) != FFXM_OK ||
+                !compareBlobs(shader.permutations[shader.indirectionTable[key]], blob) ||
+                !compareBlobs(vertexShader.permutations[vertexShader.indirectionTable[key]], vertexBlob)) {
+                fprintf(stderr, "%s: permutation key %u differs\n", shader.name, key);
+                ++mismatchCount;
+            }
+        }
+    }
+
+    ffxmSetShaderArchive(nullptr, 0);
+    printf("%u passes verified, %u mismatching permutations\n", FFXM_FSR2_PASS_COUNT, mismatchCount);
+    return mismatchCount == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* path = nullptr;
+    bool        verify = false;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--verify")) {
+            verify = true;
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            path = nullptr;
+            break;
+        }
+    }
+    if (!path) {
+        fprintf(stderr, "Usage: %s [--verify] <archive>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const bool succeeded = verify ? verifyArchive(path) : writeArchive(path);
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}